@@ -73,3 +73,118 @@ static void DiffuseLight_Vectorized(benchmark::State & state)
     benchmark::DoNotOptimize(outLightBuffer);
 }
 BENCHMARK(DiffuseLight_Vectorized)->Arg(4)->Arg(8)->Arg(16)->Arg(32)->Arg(128);
+
+//
+// Ship-like data: points on a 400x250 grid, lamps scattered over it with spreads
+// of a few meters, as with lamp-heavy ships
+//
+
+namespace {
+
+    struct ShipLikeLightData
+    {
+        ElementCount PointCount;
+        unique_aligned_buffer<vec2f> PointPositions;
+        unique_aligned_buffer<PlaneId> PointPlaneIds;
+        ElementCount LampCount;
+        unique_aligned_buffer<vec2f> LampPositions;
+        unique_aligned_buffer<PlaneId> LampPlaneIds;
+        unique_aligned_buffer<float> LampDistanceCoeffs;
+        unique_aligned_buffer<float> LampSpreadMaxDistances;
+    };
+
+    ShipLikeLightData MakeShipLikeLightData(size_t lampCount)
+    {
+        int constexpr Width = 400;
+        int constexpr Height = 250;
+
+        ShipLikeLightData data;
+
+        data.PointCount = Width * Height;
+        data.PointPositions = make_unique_buffer_aligned_to_vectorization_word<vec2f>(data.PointCount);
+        data.PointPlaneIds = make_unique_buffer_aligned_to_vectorization_word<PlaneId>(data.PointCount);
+        for (ElementIndex p = 0; p < data.PointCount; ++p)
+        {
+            data.PointPositions[p] = vec2f(static_cast<float>(p % Width), static_cast<float>(p / Width));
+            data.PointPlaneIds[p] = static_cast<PlaneId>(p % 7);
+        }
+
+        data.LampCount = static_cast<ElementCount>(make_aligned_float_element_count(lampCount));
+        data.LampPositions = make_unique_buffer_aligned_to_vectorization_word<vec2f>(data.LampCount);
+        data.LampPlaneIds = make_unique_buffer_aligned_to_vectorization_word<PlaneId>(data.LampCount);
+        data.LampDistanceCoeffs = make_unique_buffer_aligned_to_vectorization_word<float>(data.LampCount);
+        data.LampSpreadMaxDistances = make_unique_buffer_aligned_to_vectorization_word<float>(data.LampCount);
+        for (ElementIndex l = 0; l < data.LampCount; ++l)
+        {
+            // Pseudo-random, well-spread positions
+            data.LampPositions[l] = vec2f(
+                static_cast<float>((l * 7919) % Width),
+                static_cast<float>((l * 104729) % Height));
+            data.LampPlaneIds[l] = static_cast<PlaneId>(l % 11);
+            data.LampDistanceCoeffs[l] = (l < lampCount) ? 0.1f : 0.0f;
+            data.LampSpreadMaxDistances[l] = (l < lampCount) ? 5.0f + static_cast<float>(l % 10) : 0.0f;
+        }
+
+        return data;
+    }
+}
+
+static void DiffuseLight_ShipLike(benchmark::State & state)
+{
+    auto const data = MakeShipLikeLightData(static_cast<size_t>(state.range(0)));
+
+    auto outLightBuffer = make_unique_buffer_aligned_to_vectorization_word<float>(data.PointCount);
+
+    for (auto _ : state)
+    {
+        Algorithms::DiffuseLight(
+            0,
+            data.PointCount,
+            data.PointPositions.get(),
+            data.PointPlaneIds.get(),
+            data.LampPositions.get(),
+            data.LampPlaneIds.get(),
+            data.LampDistanceCoeffs.get(),
+            data.LampSpreadMaxDistances.get(),
+            data.LampCount,
+            outLightBuffer.get());
+    }
+
+    benchmark::DoNotOptimize(outLightBuffer);
+}
+BENCHMARK(DiffuseLight_ShipLike)->Arg(4)->Arg(16)->Arg(64)->Arg(512)->Arg(1024)->Unit(benchmark::kMicrosecond);
+
+// Includes the preparation of the tiles, as each frame does
+static void DiffuseLight_ShipLike_Tiled(benchmark::State & state)
+{
+    auto const data = MakeShipLikeLightData(static_cast<size_t>(state.range(0)));
+
+    auto outLightBuffer = make_unique_buffer_aligned_to_vectorization_word<float>(data.PointCount);
+
+    Algorithms::DiffuseLightTiles<vec2f> tiles;
+
+    for (auto _ : state)
+    {
+        Algorithms::PrepareDiffuseLightTiles(
+            data.PointCount,
+            data.PointPositions.get(),
+            data.PointPlaneIds.get(),
+            data.LampPositions.get(),
+            data.LampPlaneIds.get(),
+            data.LampDistanceCoeffs.get(),
+            data.LampSpreadMaxDistances.get(),
+            data.LampCount,
+            tiles);
+
+        Algorithms::DiffuseLight_Tiled(
+            0,
+            data.PointCount,
+            data.PointPositions.get(),
+            data.PointPlaneIds.get(),
+            tiles,
+            outLightBuffer.get());
+    }
+
+    benchmark::DoNotOptimize(outLightBuffer);
+}
+BENCHMARK(DiffuseLight_ShipLike_Tiled)->Arg(4)->Arg(16)->Arg(64)->Arg(512)->Arg(1024)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,47 @@
+#include "Utils.h"
+
+#include <Game/GameParameters.h>
+#include <Game/PerfStats.h>
+
+#include <GameCore/ThreadManager.h>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+static constexpr size_t WarmupSteps = 10;
+
+//
+// Updates a world with no ships and with range(0) fishes; reports the
+// average fishes update duration
+//
+static void Fishes_Update(benchmark::State & state)
+{
+    GameParameters gameParameters;
+    gameParameters.NumberOfFishes = static_cast<unsigned int>(state.range(0));
+
+    auto const world = MakeWorldWithShips({}, gameParameters);
+
+    ThreadManager threadManager(false, 1);
+
+    PerfStats perfStats;
+
+    for (size_t i = 0; i < WarmupSteps; ++i)
+    {
+        world->Update(gameParameters, threadManager, perfStats);
+    }
+
+    perfStats.Reset();
+
+    for (auto _ : state)
+    {
+        world->Update(gameParameters, threadManager, perfStats);
+    }
+
+    state.counters["FishUs"] = perfStats.TotalFishUpdateDuration.ToRatio<std::chrono::microseconds>();
+}
+BENCHMARK(Fishes_Update)
+    ->ArgNames({ "fishes" })
+    ->Arg(100)->Arg(1000)->Arg(2000)->Arg(5000)->Arg(10000)->Arg(20000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,75 @@
+#include "Utils.h"
+
+#include <Game/GameParameters.h>
+#include <Game/Physics.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+//
+// Compares finding the leaking points of a large, lightly damaged ship (one point
+// out of range(0) damaged) by scanning all points, as UpdatePressureAndWaterInflow
+// used to do, with visiting the leaking point index
+//
+
+namespace {
+
+    std::unique_ptr<WorldWithShips> MakeLightlyDamagedLargeShip(ElementIndex damageStride)
+    {
+        auto worldWithShips = MakeWorldWithShips({ BuiltInShip::Holidays }, GameParameters());
+
+        auto & points = worldWithShips->Ships[0]->GetPoints();
+        for (ElementIndex p = 0; p < points.GetRawShipPointCount(); p += damageStride)
+        {
+            points.Damage(p);
+        }
+
+        worldWithShips->EventDispatcher->Flush();
+
+        return worldWithShips;
+    }
+}
+
+static void LeakingPoints_FullScan(benchmark::State & state)
+{
+    auto const largeShip = MakeLightlyDamagedLargeShip(static_cast<ElementIndex>(state.range(0)));
+    auto const & points = largeShip->Ships[0]->GetPoints();
+
+    float totalWater = 0.0f;
+    for (auto _ : state)
+    {
+        for (auto pointIndex : points.RawShipPoints())
+        {
+            if (points.GetLeakingComposite(pointIndex).IsCumulativelyLeaking)
+            {
+                totalWater += points.GetWater(pointIndex);
+            }
+        }
+    }
+
+    benchmark::DoNotOptimize(totalWater);
+
+    state.SetItemsProcessed(state.iterations() * points.GetRawShipPointCount());
+}
+BENCHMARK(LeakingPoints_FullScan)->Arg(100)->Arg(1000);
+
+static void LeakingPoints_Index(benchmark::State & state)
+{
+    auto const largeShip = MakeLightlyDamagedLargeShip(static_cast<ElementIndex>(state.range(0)));
+    auto const & points = largeShip->Ships[0]->GetPoints();
+
+    float totalWater = 0.0f;
+    for (auto _ : state)
+    {
+        for (auto pointIndex : points.GetLeakingPoints())
+        {
+            totalWater += points.GetWater(pointIndex);
+        }
+    }
+
+    benchmark::DoNotOptimize(totalWater);
+
+    state.SetItemsProcessed(state.iterations() * points.GetRawShipPointCount());
+}
+BENCHMARK(LeakingPoints_Index)->Arg(100)->Arg(1000);
@@ -0,0 +1,171 @@
+#include <Game/GameParameters.h>
+#include <Game/PerfStats.h>
+
+#include <GameCore/Algorithms.h>
+#include <GameCore/ThreadManager.h>
+
+#include "Utils.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+// Same as the ocean surface's SWE field; buffers have one extra sample at each end for the stencil
+static constexpr size_t ShallowWaterSampleSize = 16384;
+
+static constexpr size_t WarmupSteps = 10;
+
+static void OceanSurface_ShallowWater_Naive(benchmark::State & state)
+{
+    auto heightField = MakeFloats(ShallowWaterSampleSize + 2, 1.0f);
+    auto velocityField = MakeFloats(ShallowWaterSampleSize + 2, 0.0f);
+    auto newVelocityField = MakeFloats(ShallowWaterSampleSize + 2, 0.0f);
+
+    for (auto _ : state)
+    {
+        Algorithms::UpdateShallowWaterHeights_Naive(
+            heightField.get() + 1,
+            velocityField.get() + 1,
+            ShallowWaterSampleSize,
+            0.001f);
+
+        Algorithms::UpdateShallowWaterVelocities_Naive(
+            heightField.get() + 1,
+            velocityField.get() + 1,
+            newVelocityField.get() + 1,
+            ShallowWaterSampleSize,
+            0.99f,
+            0.005f,
+            0.001f);
+
+        std::swap(velocityField, newVelocityField);
+    }
+
+    benchmark::DoNotOptimize(heightField);
+    benchmark::DoNotOptimize(velocityField);
+}
+BENCHMARK(OceanSurface_ShallowWater_Naive);
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+static void OceanSurface_ShallowWater_SSEVectorized(benchmark::State & state)
+{
+    auto heightField = MakeFloats(ShallowWaterSampleSize + 2, 1.0f);
+    auto velocityField = MakeFloats(ShallowWaterSampleSize + 2, 0.0f);
+    auto newVelocityField = MakeFloats(ShallowWaterSampleSize + 2, 0.0f);
+
+    for (auto _ : state)
+    {
+        Algorithms::UpdateShallowWaterHeights_SSEVectorized(
+            heightField.get() + 1,
+            velocityField.get() + 1,
+            ShallowWaterSampleSize,
+            0.001f);
+
+        Algorithms::UpdateShallowWaterVelocities_SSEVectorized(
+            heightField.get() + 1,
+            velocityField.get() + 1,
+            newVelocityField.get() + 1,
+            ShallowWaterSampleSize,
+            0.99f,
+            0.005f,
+            0.001f);
+
+        std::swap(velocityField, newVelocityField);
+    }
+
+    benchmark::DoNotOptimize(heightField);
+    benchmark::DoNotOptimize(velocityField);
+}
+BENCHMARK(OceanSurface_ShallowWater_SSEVectorized);
+#endif
+
+static constexpr size_t HeightFieldSampleSize = 200000;
+
+static void OceanSurface_SampleDepths_Naive(benchmark::State & state)
+{
+    auto const positionsSize = MakeSize(HeightFieldSampleSize);
+
+    auto samples = MakeFloats((ShallowWaterSampleSize + 1) * 2, 1.0f);
+    auto positions = MakeVectors(positionsSize);
+    auto depths = MakeFloats(positionsSize);
+
+    for (auto _ : state)
+    {
+        Algorithms::SampleHeightField_Naive<true>(
+            positions.get(),
+            positionsSize,
+            samples.get(),
+            static_cast<float>(positionsSize), // Positions' x are within [0, positionsSize)
+            static_cast<float>(positionsSize) * 2.0f / static_cast<float>(ShallowWaterSampleSize - 1),
+            depths.get());
+    }
+
+    benchmark::DoNotOptimize(depths);
+}
+BENCHMARK(OceanSurface_SampleDepths_Naive);
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+static void OceanSurface_SampleDepths_SSEVectorized(benchmark::State & state)
+{
+    auto const positionsSize = MakeSize(HeightFieldSampleSize);
+
+    auto samples = MakeFloats((ShallowWaterSampleSize + 1) * 2, 1.0f);
+    auto positions = MakeVectors(positionsSize);
+    auto depths = MakeFloats(positionsSize);
+
+    for (auto _ : state)
+    {
+        Algorithms::SampleHeightField_SSEVectorized<true>(
+            positions.get(),
+            positionsSize,
+            samples.get(),
+            static_cast<float>(positionsSize), // Positions' x are within [0, positionsSize)
+            static_cast<float>(positionsSize) * 2.0f / static_cast<float>(ShallowWaterSampleSize - 1),
+            depths.get());
+    }
+
+    benchmark::DoNotOptimize(depths);
+}
+BENCHMARK(OceanSurface_SampleDepths_SSEVectorized);
+#endif
+
+//
+// Updates a world with a large ship using range(0) threads, updating the ocean
+// surface either before the ships (range(1) == 0) or concurrently with them
+// (range(1) == 1); reports the average ocean surface update duration
+//
+static void OceanSurface_WorldUpdate(benchmark::State & state)
+{
+    size_t const parallelism = static_cast<size_t>(state.range(0));
+    bool const doUpdateOceanSurfaceConcurrently = (state.range(1) != 0);
+
+    GameParameters gameParameters;
+    gameParameters.DoUpdateOceanSurfaceConcurrently = doUpdateOceanSurfaceConcurrently;
+
+    auto const worldWithShips = MakeWorldWithShips({ BuiltInShip::Holidays }, gameParameters);
+    worldWithShips->AddShipsToWorld();
+
+    ThreadManager threadManager(false, parallelism);
+
+    PerfStats perfStats;
+
+    for (size_t i = 0; i < WarmupSteps; ++i)
+    {
+        worldWithShips->Update(gameParameters, threadManager, perfStats);
+    }
+
+    perfStats.Reset();
+
+    for (auto _ : state)
+    {
+        worldWithShips->Update(gameParameters, threadManager, perfStats);
+    }
+
+    state.counters["OceanSurfaceUs"] = perfStats.TotalOceanSurfaceUpdateDuration.ToRatio<std::chrono::microseconds>();
+    state.counters["ShipsUs"] = perfStats.TotalShipsUpdateDuration.ToRatio<std::chrono::microseconds>();
+}
+BENCHMARK(OceanSurface_WorldUpdate)
+    ->ArgNames({ "threads", "concurrent" })
+    ->ArgsProduct({ { 1, 4, 8 }, { 0, 1 } })
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
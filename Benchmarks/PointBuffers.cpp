@@ -0,0 +1,60 @@
+#include <GameCore/Buffer.h>
+#include <GameCore/BufferAllocator.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+// A large ship's worth of points
+static constexpr size_t PointCount = 100000;
+
+//
+// The ways of getting hold of a point buffer's previous-step contents
+// while calculating its next-step contents
+//
+
+static void PointBuffers_PoolCopy(benchmark::State & state)
+{
+    BufferAllocator<float> allocator(PointCount);
+    Buffer<float> buffer(PointCount, 1.0f);
+
+    for (auto _ : state)
+    {
+        auto bufferCopy = allocator.Allocate();
+        bufferCopy->copy_from(buffer);
+
+        benchmark::DoNotOptimize(bufferCopy->data());
+    }
+}
+BENCHMARK(PointBuffers_PoolCopy);
+
+static void PointBuffers_Copy(benchmark::State & state)
+{
+    Buffer<float> buffer(PointCount, 1.0f);
+    Buffer<float> bufferCopy(PointCount);
+
+    for (auto _ : state)
+    {
+        std::copy_n(
+            buffer.data(),
+            PointCount,
+            bufferCopy.data());
+
+        benchmark::DoNotOptimize(bufferCopy.data());
+    }
+}
+BENCHMARK(PointBuffers_Copy);
+
+static void PointBuffers_Swap(benchmark::State & state)
+{
+    Buffer<float> buffer(PointCount, 1.0f);
+    Buffer<float> backBuffer(PointCount, 1.0f);
+
+    for (auto _ : state)
+    {
+        buffer.swap(backBuffer);
+
+        benchmark::DoNotOptimize(buffer.data());
+    }
+}
+BENCHMARK(PointBuffers_Swap);
@@ -0,0 +1,190 @@
+#include <GameCore/GameRandomEngine.h>
+#include <GameCore/Xoshiro128PlusPlus.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+static constexpr size_t ValueCount = 10000;
+
+//
+// Raw bits
+//
+
+static void RandomEngines_Ranlux48Base(benchmark::State & state)
+{
+    std::seed_seq seed_seq({ 1u, 242u, 19730528u });
+    std::ranlux48_base engine(seed_seq);
+
+    std::vector<std::uint64_t> values(ValueCount);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < ValueCount; ++i)
+        {
+            values[i] = engine();
+        }
+
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(RandomEngines_Ranlux48Base);
+
+static void RandomEngines_Xoshiro128PlusPlus_Single(benchmark::State & state)
+{
+    Xoshiro128PlusPlus engine(19730528u);
+
+    std::vector<std::uint32_t> values(ValueCount);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < ValueCount; ++i)
+        {
+            values[i] = engine();
+        }
+
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(RandomEngines_Xoshiro128PlusPlus_Single);
+
+static void RandomEngines_Xoshiro128PlusPlus_Batch(benchmark::State & state)
+{
+    Xoshiro128PlusPlus engine(19730528u);
+
+    std::vector<std::uint32_t> values(ValueCount);
+
+    for (auto _ : state)
+    {
+        engine.Generate(values.data(), ValueCount);
+
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(RandomEngines_Xoshiro128PlusPlus_Batch);
+
+//
+// Distributions
+//
+
+static void RandomEngines_UniformReal_Ranlux48Base(benchmark::State & state)
+{
+    std::seed_seq seed_seq({ 1u, 242u, 19730528u });
+    std::ranlux48_base engine(seed_seq);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+    std::vector<float> values(ValueCount);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < ValueCount; ++i)
+        {
+            values[i] = distribution(engine);
+        }
+
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(RandomEngines_UniformReal_Ranlux48Base);
+
+static void RandomEngines_UniformReal_Single(benchmark::State & state)
+{
+    auto engine = GameRandomEngine::CreateStream(0);
+
+    std::vector<float> values(ValueCount);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < ValueCount; ++i)
+        {
+            values[i] = engine.GenerateNormalizedUniformReal();
+        }
+
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(RandomEngines_UniformReal_Single);
+
+static void RandomEngines_UniformReal_Batch(benchmark::State & state)
+{
+    auto engine = GameRandomEngine::CreateStream(0);
+
+    std::vector<float> values(ValueCount);
+
+    for (auto _ : state)
+    {
+        engine.GenerateNormalizedUniformReals(values.data(), ValueCount);
+
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(RandomEngines_UniformReal_Batch);
+
+static void RandomEngines_StandardNormalReal_Ranlux48Base(benchmark::State & state)
+{
+    std::seed_seq seed_seq({ 1u, 242u, 19730528u });
+    std::ranlux48_base engine(seed_seq);
+    std::normal_distribution<float> distribution(0.0f, 1.0f);
+
+    std::vector<float> values(ValueCount);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < ValueCount; ++i)
+        {
+            values[i] = distribution(engine);
+        }
+
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(RandomEngines_StandardNormalReal_Ranlux48Base);
+
+static void RandomEngines_StandardNormalReal_Batch(benchmark::State & state)
+{
+    auto engine = GameRandomEngine::CreateStream(0);
+
+    std::vector<float> values(ValueCount);
+
+    for (auto _ : state)
+    {
+        engine.GenerateStandardNormalReals(values.data(), ValueCount);
+
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(RandomEngines_StandardNormalReal_Batch);
+
+static void RandomEngines_UniformRadialVector_Single(benchmark::State & state)
+{
+    auto engine = GameRandomEngine::CreateStream(0);
+
+    std::vector<vec2f> values(ValueCount);
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < ValueCount; ++i)
+        {
+            values[i] = engine.GenerateUniformRadialVector(1.0f, 2.0f);
+        }
+
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(RandomEngines_UniformRadialVector_Single);
+
+static void RandomEngines_UniformRadialVector_Batch(benchmark::State & state)
+{
+    auto engine = GameRandomEngine::CreateStream(0);
+
+    std::vector<vec2f> values(ValueCount);
+
+    for (auto _ : state)
+    {
+        engine.GenerateUniformRadialVectors(values.data(), ValueCount, 1.0f, 2.0f);
+
+        benchmark::DoNotOptimize(values.data());
+    }
+}
+BENCHMARK(RandomEngines_UniformRadialVector_Batch);
@@ -0,0 +1,62 @@
+#include "Utils.h"
+
+#include <Game/GameParameters.h>
+#include <Game/PerfStats.h>
+
+#include <GameCore/AABB.h>
+#include <GameCore/ThreadManager.h>
+
+#include <benchmark/benchmark.h>
+
+static constexpr size_t WarmupSteps = 10;
+
+//
+// Updates a world with a large ship riddled with holes - one every range(0) world
+// units, each hole being a frontier - using range(1) threads; surface forces and
+// static pressure forces are calculated along all of those frontiers
+//
+static void ShipFrontiers_Update(benchmark::State & state)
+{
+    float const holeSpacing = static_cast<float>(state.range(0));
+    size_t const parallelism = static_cast<size_t>(state.range(1));
+
+    GameParameters gameParameters;
+
+    auto const worldWithShips = MakeWorldWithShips({ BuiltInShip::Holidays }, gameParameters);
+
+    Geometry::AABB shipAABB;
+    for (auto p : worldWithShips->Ships[0]->GetPoints().RawShipPoints())
+    {
+        shipAABB.ExtendTo(worldWithShips->Ships[0]->GetPoints().GetPosition(p));
+    }
+
+    worldWithShips->AddShipsToWorld();
+
+    // Punch holes
+    for (float y = shipAABB.BottomLeft.y + holeSpacing / 2.0f; y < shipAABB.TopRight.y; y += holeSpacing)
+    {
+        for (float x = shipAABB.BottomLeft.x + holeSpacing / 2.0f; x < shipAABB.TopRight.x; x += holeSpacing)
+        {
+            worldWithShips->World->DestroyAt(vec2f(x, y), 0.25f, gameParameters);
+        }
+    }
+
+    ThreadManager threadManager(false, parallelism);
+
+    PerfStats perfStats;
+
+    for (size_t i = 0; i < WarmupSteps; ++i)
+    {
+        worldWithShips->Update(gameParameters, threadManager, perfStats);
+    }
+
+    for (auto _ : state)
+    {
+        worldWithShips->Update(gameParameters, threadManager, perfStats);
+    }
+}
+BENCHMARK(ShipFrontiers_Update)
+    ->ArgNames({ "spacing", "threads" })
+    ->ArgsProduct({ { 4, 8 }, { 1, 4, 8 } })
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,105 @@
+#include <GameCore/ThreadPool.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+//
+// Measures the latency of dispatching a batch of near-empty tasks, i.e. the
+// overhead paid at each Run() by e.g. the spring relaxation iterations.
+//
+// Only uses Run(), hence it may be used to compare against previous pool
+// implementations.
+//
+
+static void ThreadPool_Run_DispatchLatency(benchmark::State & state)
+{
+    size_t const parallelism = static_cast<size_t>(state.range(0));
+
+    ThreadManager threadManager(false, parallelism);
+    ThreadPool threadPool(parallelism, threadManager);
+
+    std::vector<size_t> counters(parallelism * 16, 0);
+
+    std::vector<ThreadPool::Task> tasks;
+    for (size_t t = 0; t < parallelism; ++t)
+    {
+        tasks.emplace_back(
+            [&counters, t]()
+            {
+                ++counters[t * 16]; // Separate cache lines
+            });
+    }
+
+    for (auto _ : state)
+    {
+        threadPool.Run(tasks);
+    }
+
+    benchmark::DoNotOptimize(counters);
+}
+BENCHMARK(ThreadPool_Run_DispatchLatency)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+//
+// Two batches back-to-back, as in each mechanical iteration
+//
+
+static void ThreadPool_Run_BackToBack(benchmark::State & state)
+{
+    size_t const parallelism = static_cast<size_t>(state.range(0));
+
+    ThreadManager threadManager(false, parallelism);
+    ThreadPool threadPool(parallelism, threadManager);
+
+    std::vector<float> buffer(parallelism * 4096, 1.0f);
+
+    std::vector<ThreadPool::Task> tasks;
+    for (size_t t = 0; t < parallelism; ++t)
+    {
+        tasks.emplace_back(
+            [&buffer, t]()
+            {
+                for (size_t i = t * 4096; i < (t + 1) * 4096; ++i)
+                {
+                    buffer[i] = buffer[i] * 0.999f + 0.001f;
+                }
+            });
+    }
+
+    for (auto _ : state)
+    {
+        threadPool.Run(tasks);
+        threadPool.Run(tasks);
+    }
+
+    benchmark::DoNotOptimize(buffer);
+}
+BENCHMARK(ThreadPool_Run_BackToBack)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+static void ThreadPool_ParallelFor_DispatchLatency(benchmark::State & state)
+{
+    size_t const parallelism = static_cast<size_t>(state.range(0));
+
+    ThreadManager threadManager(false, parallelism);
+    ThreadPool threadPool(parallelism, threadManager);
+
+    std::vector<size_t> counters(parallelism * 16, 0);
+
+    for (auto _ : state)
+    {
+        threadPool.ParallelFor(
+            0,
+            parallelism,
+            1,
+            [&counters](size_t begin, size_t end)
+            {
+                for (size_t t = begin; t < end; ++t)
+                {
+                    ++counters[t * 16];
+                }
+            });
+    }
+
+    benchmark::DoNotOptimize(counters);
+}
+BENCHMARK(ThreadPool_ParallelFor_DispatchLatency)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
@@ -1,11 +1,17 @@
 #include "Utils.h"
 
+#include <Game/GameParameters.h>
+#include <Game/Physics.h>
+#include <Game/SpringRelaxationKernels.h>
+
 #include <GameCore/SysSpecifics.h>
 
 #include <benchmark/benchmark.h>
 
 #include <algorithm>
 #include <limits>
+#include <memory>
+#include <vector>
 
 static constexpr size_t SampleSize = 20000000;
 
@@ -260,4 +266,144 @@ static void UpdateSpringForces_LibSimdPpAndIntrinsics(benchmark::State& state)
     benchmark::DoNotOptimize(pointsForce);
 }
 BENCHMARK(UpdateSpringForces_LibSimdPpAndIntrinsics);
-*/
\ No newline at end of file
+*/
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+//
+// Compares the SSE, AVX2, and AVX-512 spring relaxation kernels on the springs and
+// points of the default ship; variants not supported by this CPU are skipped
+//
+
+namespace {
+
+    Physics::Ship & GetDefaultShip()
+    {
+        static auto const defaultShip = MakeWorldWithShips({ BuiltInShip::Default }, GameParameters());
+
+        return *(defaultShip->Ships[0]);
+    }
+
+    bool IsSupported(SimdInstructionSet instructionSet)
+    {
+        return static_cast<int>(instructionSet) <= static_cast<int>(GetSimdInstructionSet());
+    }
+
+    using ApplySpringsForcesKernel = void(*)(
+        Physics::SpringRelaxationKernels::SpringForcesInput const &,
+        ElementIndex,
+        ElementIndex,
+        vec2f *);
+
+    using IntegrateAndResetDynamicForcesKernel = void(*)(
+        Physics::SpringRelaxationKernels::DynamicForcesIntegrationInput const &,
+        ElementIndex,
+        ElementIndex);
+}
+
+static void UpdateSpringForces_ShipKernel(
+    benchmark::State & state,
+    SimdInstructionSet instructionSet,
+    ApplySpringsForcesKernel kernel)
+{
+    if (!IsSupported(instructionSet))
+    {
+        state.SkipWithError("Instruction set not supported by this CPU");
+        return;
+    }
+
+    auto & points = GetDefaultShip().GetPoints();
+    auto const & springs = GetDefaultShip().GetSprings();
+
+    Physics::SpringRelaxationKernels::SpringForcesInput const input{
+        points.GetPositionBufferAsVec2(),
+        points.GetVelocityBufferAsVec2(),
+        springs.GetEndpointsBuffer(),
+        springs.GetRestLengthBuffer(),
+        springs.GetStiffnessCoefficientBuffer(),
+        springs.GetDampingCoefficientBuffer(),
+        springs.GetPerfectSquareCount() };
+
+    auto dynamicForceBuffer = make_unique_buffer_aligned_to_vectorization_word<vec2f>(points.GetBufferElementCount());
+    std::fill_n(dynamicForceBuffer.get(), points.GetBufferElementCount(), vec2f::zero());
+
+    for (auto _ : state)
+    {
+        kernel(input, 0, springs.GetElementCount(), dynamicForceBuffer.get());
+    }
+
+    benchmark::DoNotOptimize(dynamicForceBuffer);
+
+    state.SetItemsProcessed(state.iterations() * springs.GetElementCount());
+}
+BENCHMARK_CAPTURE(UpdateSpringForces_ShipKernel, SSE, SimdInstructionSet::SSE, Physics::SpringRelaxationKernels::ApplySpringsForces_SSE);
+BENCHMARK_CAPTURE(UpdateSpringForces_ShipKernel, AVX2, SimdInstructionSet::AVX2, Physics::SpringRelaxationKernels::ApplySpringsForces_AVX2);
+BENCHMARK_CAPTURE(UpdateSpringForces_ShipKernel, AVX512, SimdInstructionSet::AVX512, Physics::SpringRelaxationKernels::ApplySpringsForces_AVX512);
+
+//
+// Integrates the points of the default ship with range(0) dynamic force buffers
+//
+
+static void IntegrateAndResetDynamicForces_ShipKernel(
+    benchmark::State & state,
+    SimdInstructionSet instructionSet,
+    IntegrateAndResetDynamicForcesKernel kernel)
+{
+    if (!IsSupported(instructionSet))
+    {
+        state.SkipWithError("Instruction set not supported by this CPU");
+        return;
+    }
+
+    size_t const dynamicForceBufferCount = static_cast<size_t>(state.range(0));
+
+    // Work on copies, so that all variants see the same data
+    auto & points = GetDefaultShip().GetPoints();
+    size_t const floatCount = points.GetBufferElementCount() * 2;
+
+    auto const makeCopy = [floatCount](float const * source)
+    {
+        auto buffer = make_unique_buffer_aligned_to_vectorization_word<float>(floatCount);
+        std::copy_n(source, floatCount, buffer.get());
+        return buffer;
+    };
+
+    auto positionBuffer = makeCopy(points.GetPositionBufferAsFloat());
+    auto velocityBuffer = makeCopy(points.GetVelocityBufferAsFloat());
+    auto const staticForceBuffer = makeCopy(points.GetStaticForceBufferAsFloat());
+    auto const integrationFactorBuffer = makeCopy(points.GetIntegrationFactorBufferAsFloat());
+
+    std::vector<unique_aligned_buffer<float>> dynamicForceBuffers;
+    std::vector<float *> dynamicForceBufferPointers;
+    for (size_t b = 0; b < dynamicForceBufferCount; ++b)
+    {
+        dynamicForceBuffers.emplace_back(make_unique_buffer_aligned_to_vectorization_word<float>(floatCount));
+        std::fill_n(dynamicForceBuffers.back().get(), floatCount, 0.0f);
+        dynamicForceBufferPointers.push_back(dynamicForceBuffers.back().get());
+    }
+
+    Physics::SpringRelaxationKernels::DynamicForcesIntegrationInput const input{
+        positionBuffer.get(),
+        velocityBuffer.get(),
+        staticForceBuffer.get(),
+        integrationFactorBuffer.get(),
+        dynamicForceBufferPointers.data(),
+        dynamicForceBufferCount,
+        GameParameters().MechanicalSimulationStepTimeDuration<float>(),
+        0.99f };
+
+    for (auto _ : state)
+    {
+        kernel(input, 0, points.GetBufferElementCount());
+    }
+
+    benchmark::DoNotOptimize(positionBuffer);
+    benchmark::DoNotOptimize(velocityBuffer);
+
+    state.SetItemsProcessed(state.iterations() * points.GetBufferElementCount());
+}
+BENCHMARK_CAPTURE(IntegrateAndResetDynamicForces_ShipKernel, SSE, SimdInstructionSet::SSE, Physics::SpringRelaxationKernels::IntegrateAndResetDynamicForces_SSE)->Arg(1)->Arg(4);
+BENCHMARK_CAPTURE(IntegrateAndResetDynamicForces_ShipKernel, AVX2, SimdInstructionSet::AVX2, Physics::SpringRelaxationKernels::IntegrateAndResetDynamicForces_AVX2)->Arg(1)->Arg(4);
+BENCHMARK_CAPTURE(IntegrateAndResetDynamicForces_ShipKernel, AVX512, SimdInstructionSet::AVX512, Physics::SpringRelaxationKernels::IntegrateAndResetDynamicForces_AVX512)->Arg(1)->Arg(4);
+
+#endif
@@ -1,5 +1,16 @@
 #include "Utils.h"
 
+#include <Game/FishSpeciesDatabase.h>
+#include <Game/MaterialDatabase.h>
+#include <Game/OceanFloorTerrain.h>
+#include <Game/ResourceLocator.h>
+#include <Game/ShipDeSerializer.h>
+#include <Game/ShipFactory.h>
+#include <Game/ShipStrengthRandomizer.h>
+#include <Game/ShipTexturizer.h>
+
+#include <filesystem>
+
 size_t MakeSize(size_t count)
 {
     return make_aligned_float_element_count(count);
@@ -144,4 +155,79 @@ void MakeGraph2(
         springsDamperCoefficient.emplace_back(static_cast<float>(i) * 0.5f);
         springsRestLength.emplace_back(1.0f + static_cast<float>(i % 2));
     }
-}
\ No newline at end of file
+}
+
+void WorldWithShips::AddShipsToWorld()
+{
+    for (auto & ship : Ships)
+    {
+        World->AddShip(std::move(ship));
+    }
+
+    Ships.clear();
+}
+
+void WorldWithShips::Update(
+    GameParameters const & gameParameters,
+    ThreadManager & threadManager,
+    PerfStats & perfStats)
+{
+    World->Update(
+        gameParameters,
+        ViewModel.GetVisibleWorld(),
+        StressRenderModeType::None,
+        threadManager,
+        perfStats);
+
+    EventDispatcher->Flush();
+}
+
+std::unique_ptr<WorldWithShips> MakeWorldWithShips(
+    std::vector<BuiltInShip> const & ships,
+    GameParameters const & gameParameters)
+{
+    ThreadManager::InitializeThisThread();
+
+    // The world and the ships keep references to the databases
+    ResourceLocator const resourceLocator = ResourceLocator(std::filesystem::current_path());
+    static FishSpeciesDatabase const fishSpeciesDatabase = FishSpeciesDatabase::Load(resourceLocator);
+    static MaterialDatabase const materialDatabase = MaterialDatabase::Load(resourceLocator);
+    ShipTexturizer const shipTexturizer(materialDatabase, resourceLocator);
+    ShipStrengthRandomizer const shipStrengthRandomizer;
+
+    auto worldWithShips = std::unique_ptr<WorldWithShips>(new WorldWithShips{
+        std::make_shared<GameEventDispatcher>(),
+        Render::ViewModel(1.0f, vec2f::zero(), DisplayLogicalSize(1920, 1080), 1),
+        nullptr,
+        {} });
+
+    worldWithShips->World = std::make_unique<Physics::World>(
+        OceanFloorTerrain::LoadFromImage(resourceLocator.GetDefaultOceanFloorTerrainFilePath()),
+        false, // areCloudShadowsEnabled
+        fishSpeciesDatabase,
+        worldWithShips->EventDispatcher,
+        gameParameters,
+        worldWithShips->ViewModel.GetVisibleWorld());
+
+    for (auto const builtInShip : ships)
+    {
+        auto const shipFilePath = (builtInShip == BuiltInShip::Default)
+            ? resourceLocator.GetDefaultShipDefinitionFilePath()
+            : resourceLocator.GetHolidaysShipDefinitionFilePath();
+
+        auto [ship, textureImage] = ShipFactory::Create(
+            worldWithShips->World->GetNextShipId() + static_cast<ShipId>(worldWithShips->Ships.size()),
+            *(worldWithShips->World),
+            ShipDeSerializer::LoadShip(shipFilePath, materialDatabase),
+            ShipLoadOptions(),
+            materialDatabase,
+            shipTexturizer,
+            shipStrengthRandomizer,
+            worldWithShips->EventDispatcher,
+            gameParameters);
+
+        worldWithShips->Ships.push_back(std::move(ship));
+    }
+
+    return worldWithShips;
+}
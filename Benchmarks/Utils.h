@@ -1,7 +1,15 @@
+#include <Game/GameEventDispatcher.h>
+#include <Game/GameParameters.h>
+#include <Game/PerfStats.h>
+#include <Game/Physics.h>
+#include <Game/ViewModel.h>
+
 #include <GameCore/GameTypes.h>
 #include <GameCore/SysSpecifics.h>
+#include <GameCore/ThreadManager.h>
 #include <GameCore/Vectors.h>
 
+#include <memory>
 #include <vector>
 
 size_t MakeSize(size_t count);
@@ -32,3 +40,33 @@ void MakeGraph2(
     std::vector<float> & springsStiffnessCoefficient,
     std::vector<float> & springsDamperCoefficient,
     std::vector<float> & springsRestLength);
+
+enum class BuiltInShip
+{
+    Default,
+    Holidays
+};
+
+/*
+ * A world and the built-in ships loaded for it. The ships are left out of the world,
+ * so that they may be worked on - or damaged - before AddShipsToWorld() hands them over.
+ */
+struct WorldWithShips
+{
+    std::shared_ptr<GameEventDispatcher> EventDispatcher;
+    Render::ViewModel ViewModel;
+    std::unique_ptr<Physics::World> World;
+    std::vector<std::unique_ptr<Physics::Ship>> Ships;
+
+    void AddShipsToWorld();
+
+    // Runs one simulation step and flushes its events
+    void Update(
+        GameParameters const & gameParameters,
+        ThreadManager & threadManager,
+        PerfStats & perfStats);
+};
+
+std::unique_ptr<WorldWithShips> MakeWorldWithShips(
+    std::vector<BuiltInShip> const & ships,
+    GameParameters const & gameParameters);
@@ -0,0 +1,54 @@
+#include "Utils.h"
+
+#include <Game/GameParameters.h>
+#include <Game/PerfStats.h>
+
+#include <GameCore/ThreadManager.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+static constexpr size_t WarmupSteps = 10;
+
+//
+// Updates a world with range(0) built-in ships, using range(1) threads;
+// ships are updated concurrently when range(2) is non-zero
+//
+static void World_Update(benchmark::State & state)
+{
+    size_t const shipCount = static_cast<size_t>(state.range(0));
+    size_t const parallelism = static_cast<size_t>(state.range(1));
+
+    GameParameters gameParameters;
+    gameParameters.DoUpdateShipsConcurrently = (state.range(2) != 0);
+
+    // Alternate between the built-in ships
+    std::vector<BuiltInShip> ships;
+    for (size_t s = 0; s < shipCount; ++s)
+    {
+        ships.push_back((s % 2) == 0 ? BuiltInShip::Default : BuiltInShip::Holidays);
+    }
+
+    auto const worldWithShips = MakeWorldWithShips(ships, gameParameters);
+    worldWithShips->AddShipsToWorld();
+
+    ThreadManager threadManager(false, parallelism);
+
+    PerfStats perfStats;
+
+    for (size_t i = 0; i < WarmupSteps; ++i)
+    {
+        worldWithShips->Update(gameParameters, threadManager, perfStats);
+    }
+
+    for (auto _ : state)
+    {
+        worldWithShips->Update(gameParameters, threadManager, perfStats);
+    }
+}
+BENCHMARK(World_Update)
+    ->ArgNames({ "ships", "threads", "concurrent" })
+    ->ArgsProduct({ { 4, 8 }, { 1, 4, 8 }, { 0, 1 } })
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
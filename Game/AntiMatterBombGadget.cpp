@@ -322,144 +322,6 @@ bool AntiMatterBombGadget::Update(
     }
 }
 
-void AntiMatterBombGadget::Upload(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
-
-    switch (mState)
-    {
-        case State::Contained_1:
-        case State::TriggeringPreImploding_2:
-        {
-            // Armor
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombArmor, 0),
-                GetPosition(),
-                1.0f,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            // Sphere
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombSphere, 0),
-                GetPosition(),
-                1.0f,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            // Rotating cloud
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombSphereCloud, 0),
-                GetPosition(),
-                1.0f,
-                mCurrentCloudRotationAngle,
-                1.0f);
-
-            break;
-        }
-
-        case State::PreImploding_3:
-        {
-            // Armor
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombArmor, 0),
-                GetPosition(),
-                1.0f,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            // Sphere
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombSphere, 0),
-                GetPosition(),
-                1.0f,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            // Rotating cloud
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombSphereCloud, 0),
-                GetPosition(),
-                1.0f,
-                mCurrentCloudRotationAngle,
-                1.0f);
-
-            // Pre-implosion
-            renderContext.UploadAMBombPreImplosion(
-                GetPosition(),
-                mCurrentStateProgress,
-                CalculatePreImplosionRadius(mCurrentStateProgress));
-
-            break;
-        }
-
-        case State::PreImplodingToImplodingPause_4:
-        case State::Imploding_5:
-        {
-            // Armor
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombArmor, 0),
-                GetPosition(),
-                1.0f,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            // Sphere
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombSphere, 0),
-                GetPosition(),
-                1.0f,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            // Rotating cloud
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombSphereCloud, 0),
-                GetPosition(),
-                1.0f,
-                mCurrentCloudRotationAngle,
-                1.0f);
-
-            break;
-        }
-
-        case State::PreExploding_6:
-        {
-            // Cross-of-light
-            renderContext.UploadCrossOfLight(
-                mExplosionPosition,
-                mCurrentStateProgress);
-
-            break;
-        }
-
-        case State::Exploding_7:
-        case State::Expired_8:
-        default:
-        {
-            // No drawing
-            break;
-        }
-    }
-}
-
 void AntiMatterBombGadget::Detonate()
 {
     if (State::Contained_1 == mState)
@@ -230,52 +230,6 @@ void Clouds::Update(
     }
 }
 
-void Clouds::Upload(Render::RenderContext & renderContext) const
-{
-    //
-    // Upload clouds
-    //
-
-    renderContext.UploadCloudsStart(mClouds.size() + mStormClouds.size());
-
-    for (auto const & cloud : mClouds)
-    {
-        renderContext.UploadCloud(
-            cloud->Id,
-            cloud->X,
-            cloud->Y,
-            cloud->Z,
-            cloud->Scale,
-            cloud->Darkening,
-            cloud->GrowthProgress);
-    }
-
-    for (auto const & cloud : mStormClouds)
-    {
-        renderContext.UploadCloud(
-            cloud->Id,
-            cloud->X,
-            cloud->Y,
-            cloud->Z,
-            cloud->Scale,
-            cloud->Darkening,
-            cloud->GrowthProgress);
-    }
-
-    renderContext.UploadCloudsEnd();
-
-    //
-    // Upload shadows
-    //
-
-    if (mAreShadowsEnabled)
-    {
-        renderContext.UploadCloudShadows(
-            mShadowBuffer.data(),
-            mShadowBuffer.GetSize());
-    }
-}
-
 /////////////////////////////////////////////////////////////////////////////////////////////
 
 void Clouds::UpdateShadows(std::vector<std::unique_ptr<Cloud>> const & clouds)
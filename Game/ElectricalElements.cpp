@@ -1138,34 +1138,6 @@ void ElectricalElements::Update(
         gameParameters);
 }
 
-void ElectricalElements::Upload(
-    Render::ShipRenderContext & shipRenderContext,
-    Points const & points) const
-{
-    //
-    // Upload jet engine flames
-    //
-
-    shipRenderContext.UploadJetEngineFlamesStart();
-
-    for (auto const jetEngineElementIndex : mJetEnginesSortedByPlaneId)
-    {
-        auto const & engineState = mElementStateBuffer[jetEngineElementIndex].Engine;
-        if (engineState.CurrentJetEngineFlameVector != vec2f::zero())
-        {
-            auto const pointIndex = mPointIndexBuffer[jetEngineElementIndex];
-
-            shipRenderContext.UploadJetEngineFlame(
-                points.GetPlaneId(pointIndex),
-                points.GetPosition(pointIndex),
-                engineState.CurrentJetEngineFlameVector,
-                points.GetRandomNormalizedUniformPersonalitySeed(pointIndex));
-        }
-    }
-
-    shipRenderContext.UploadJetEngineFlamesEnd();
-}
-
 void ElectricalElements::AddFactoryConnectedElectricalElement(
     ElementIndex electricalElementIndex,
     ElementIndex connectedElectricalElementIndex)
@@ -2262,7 +2234,7 @@ void ElectricalElements::UpdateSinks(
                 }
 
                 // Apply force to point
-                points.GetLeakingComposite(pointIndex).LeakingSources.WaterPumpForce = waterPumpForce;
+                points.SetWaterPumpForce(pointIndex, waterPumpForce);
 
                 // Eventually publish force change notification
                 if (waterPumpState.CurrentNormalizedForce != waterPumpState.LastPublishedNormalizedForce)
@@ -32,6 +32,17 @@ Fishes::Fishes(
     , mGameEventHandler(std::move(gameEventDispatcher))
     , mFishShoals()
     , mFishes()
+    , mFishPositions()
+    , mFishVelocities()
+    , mFishTargetVelocities()
+    , mFishShoalingVelocities()
+    , mFishRenderVectors()
+    , mFishTailProgressPhases()
+    , mFishPanicCharges()
+    , mFishAttractionDecayTimers()
+    , mFishOceanSurfaceHeights()
+    , mFishVelocityIntegrationFactors()
+    , mFishRenderVectorIntegrationFactors()
     , mInteractions()
     , mCurrentFishSizeMultiplier(0.0f)
     , mCurrentFishSpeedAdjustment(0.0f)
@@ -64,14 +75,14 @@ void Fishes::Update(
             ? gameParameters.FishSizeMultiplier / mCurrentFishSizeMultiplier
             : 1.0f;
 
-        for (auto & fish : mFishes)
+        for (size_t f = 0; f < mFishes.size(); ++f)
         {
-            fish.CurrentVelocity *= speedFactor * sizeFactor;
-            fish.TargetVelocity *= speedFactor * sizeFactor;
-            fish.ShoalingVelocity *= speedFactor * sizeFactor;
+            mFishVelocities[f] *= speedFactor * sizeFactor;
+            mFishTargetVelocities[f] *= speedFactor * sizeFactor;
+            mFishShoalingVelocities[f] *= speedFactor * sizeFactor;
             // No need to change render direction, velocity hasn't changed direction
 
-            fish.HeadOffset *= sizeFactor;
+            mFishes[f].HeadOffset *= sizeFactor;
         }
 
         for (auto & fishShoal : mFishShoals)
@@ -89,10 +100,7 @@ void Fishes::Update(
         // Update shoaling velocity if we're turning off shoaling
         if (!gameParameters.DoFishShoaling)
         {
-            for (auto & fish : mFishes)
-            {
-                fish.ShoalingVelocity = vec2f::zero();
-            }
+            std::fill(mFishShoalingVelocities.begin(), mFishShoalingVelocities.end(), vec2f::zero());
         }
 
         // Update parameters
@@ -142,42 +150,6 @@ void Fishes::Update(
     }
 }
 
-void Fishes::Upload(Render::RenderContext & renderContext) const
-{
-    renderContext.UploadFishesStart(mFishes.size());
-
-    for (auto const & fish : mFishes)
-    {
-        float angleCw = fish.CurrentRenderVector.angleCw();
-        float horizontalScale = fish.CurrentRenderVector.length();
-
-        if (angleCw < -Pi<float> / 2.0f)
-        {
-            angleCw = Pi<float> +angleCw;
-            horizontalScale *= -1.0f;
-        }
-        else if (angleCw > Pi<float> / 2.0f)
-        {
-            angleCw = -Pi<float> +angleCw;
-            horizontalScale *= -1.0f;
-        }
-
-        auto const & species = mFishShoals[fish.ShoalId].Species;
-
-        renderContext.UploadFish(
-            fish.RenderTextureFrameId,
-            fish.CurrentPosition,
-            species.WorldSize * mCurrentFishSizeMultiplier,
-            angleCw,
-            horizontalScale,
-            species.TailX,
-            species.TailSwingWidth,
-            std::sin(fish.CurrentTailProgressPhase));
-    }
-
-    renderContext.UploadFishesEnd();
-}
-
 void Fishes::DisturbAt(
     vec2f const & worldCoordinates,
     float worldRadius,
@@ -239,9 +211,7 @@ void Fishes::UpdateNumberOfFishes(
         }
 
         // Remove fishes
-        mFishes.erase(
-            mFishes.begin() + gameParameters.NumberOfFishes,
-            mFishes.end());
+        TrimFishes(gameParameters.NumberOfFishes);
 
         // Trim empty shoals
         while (!mFishShoals.empty())
@@ -374,7 +344,7 @@ void Fishes::UpdateNumberOfFishes(
             TextureFrameIndex const renderTextureFrameIndex = static_cast<TextureFrameIndex>(
                 GameRandomEngine::GetInstance().Choose(species.RenderTextureFrameIndices.size()));
 
-            mFishes.emplace_back(
+            AddFish(
                 freeShoalIndex,
                 personalitySeed,
                 initialPosition,
@@ -398,6 +368,51 @@ void Fishes::UpdateNumberOfFishes(
     }
 }
 
+void Fishes::AddFish(
+    FishShoalId shoalId,
+    float personalitySeed,
+    vec2f const & initialPosition,
+    vec2f const & targetPosition,
+    vec2f const & targetVelocity,
+    float headOffset,
+    float initialTailProgressPhase,
+    TextureFrameId<Render::FishTextureGroups> renderTextureFrameId)
+{
+    mFishes.emplace_back(
+        shoalId,
+        personalitySeed,
+        targetPosition,
+        headOffset,
+        renderTextureFrameId);
+
+    mFishPositions.emplace_back(initialPosition);
+    mFishVelocities.emplace_back(targetVelocity);
+    mFishTargetVelocities.emplace_back(targetVelocity);
+    mFishShoalingVelocities.emplace_back(vec2f::zero());
+    mFishRenderVectors.emplace_back(targetVelocity.normalise());
+    mFishTailProgressPhases.emplace_back(initialTailProgressPhase);
+    mFishPanicCharges.emplace_back(0.0f);
+    mFishAttractionDecayTimers.emplace_back(0.0f);
+}
+
+void Fishes::TrimFishes(size_t fishCount)
+{
+    assert(fishCount <= mFishes.size());
+
+    mFishes.erase(
+        mFishes.begin() + fishCount,
+        mFishes.end());
+
+    mFishPositions.resize(fishCount);
+    mFishVelocities.resize(fishCount);
+    mFishTargetVelocities.resize(fishCount);
+    mFishShoalingVelocities.resize(fishCount);
+    mFishRenderVectors.resize(fishCount);
+    mFishTailProgressPhases.resize(fishCount);
+    mFishPanicCharges.resize(fishCount);
+    mFishAttractionDecayTimers.resize(fishCount);
+}
+
 void Fishes::UpdateInteractions(GameParameters const & gameParameters)
 {
     auto const now = GameWallClock::GetInstance().Now();
@@ -464,6 +479,27 @@ void Fishes::UpdateDynamics(
     float const outOfWaterVelocityAmplification = (1.0f + std::max(5.0f - mCurrentFishSpeedAdjustment, 0.0f)); // 5 at adj==1
 
     ElementCount const fishCount = static_cast<ElementCount>(mFishes.size());
+
+    mFishOceanSurfaceHeights.resize(fishCount);
+    mFishVelocityIntegrationFactors.resize(fishCount);
+    mFishRenderVectorIntegrationFactors.resize(fishCount);
+
+    //
+    // Sample the ocean surface at all fishes at once
+    //
+
+    oceanSurface.GetHeightsAt(
+        mFishPositions.data(),
+        fishCount,
+        mFishOceanSurfaceHeights.data());
+
+    //
+    // Steer and prepare integration.
+    //
+    // Fishes only change their own state during their update, hence we may
+    // run each phase of the update on all fishes before moving on to the next
+    //
+
     for (ElementIndex f = 0; f < fishCount; ++f)
     {
         Fish & fish = mFishes[f];
@@ -491,8 +527,8 @@ void Fishes::UpdateDynamics(
                 fish.CruiseSteeringState.reset();
 
                 // Reach all targets
-                fish.CurrentVelocity = fish.TargetVelocity;
-                fish.CurrentRenderVector = fish.TargetVelocity.normalise();
+                mFishVelocities[f] = mFishTargetVelocities[f];
+                mFishRenderVectors[f] = mFishTargetVelocities[f].normalise();
             }
             else
             {
@@ -507,30 +543,30 @@ void Fishes::UpdateDynamics(
                 // - smooth towards target during second half
                 if (elapsedSteeringDurationFraction <= 0.5f)
                 {
-                    fish.CurrentVelocity =
+                    mFishVelocities[f] =
                         fish.CruiseSteeringState->StartVelocity * (1.0f - SmoothStep(0.0f, 0.5f, elapsedSteeringDurationFraction));
                 }
                 else
                 {
-                    fish.CurrentVelocity =
-                        fish.TargetVelocity * SmoothStep(0.5f, 1.0f, elapsedSteeringDurationFraction);
+                    mFishVelocities[f] =
+                        mFishTargetVelocities[f] * SmoothStep(0.5f, 1.0f, elapsedSteeringDurationFraction);
                 }
 
-                vec2f const targetRenderVector = fish.TargetVelocity.normalise();
+                vec2f const targetRenderVector = mFishTargetVelocities[f].normalise();
 
                 // RenderVector Y:
                 // - smooth towards zero during an initial interval
                 // - smooth towards target during a second interval
                 if (elapsedSteeringDurationFraction <= 0.5f)
                 {
-                    fish.CurrentRenderVector.y =
+                    mFishRenderVectors[f].y =
                         fish.CruiseSteeringState->StartRenderVector.y
                         * (1.0f - 2.0f * SmoothStep(0.0f, 1.0f, elapsedSteeringDurationFraction));
                 }
                 else
                 {
 
-                    fish.CurrentRenderVector.y =
+                    mFishRenderVectors[f].y =
                         targetRenderVector.y
                         * (1.0f - 2.0f * SmoothStep(0.0f, 1.0f, 1.0f - elapsedSteeringDurationFraction));
                 }
@@ -542,13 +578,13 @@ void Fishes::UpdateDynamics(
                 float constexpr TurnLimit = 0.05f; // Minimum multiplier of render vector X - not going to zero
                 if (elapsedSteeringDurationFraction <= 0.5f)
                 {
-                    fish.CurrentRenderVector.x =
+                    mFishRenderVectors[f].x =
                         fish.CruiseSteeringState->StartRenderVector.x
                         * (1.0f - (1.0f - TurnLimit) * 2.0f * SmoothStep(TimeMargin, 1.0f - TimeMargin, elapsedSteeringDurationFraction));
                 }
                 else
                 {
-                    fish.CurrentRenderVector.x =
+                    mFishRenderVectors[f].x =
                         targetRenderVector.x
                         * (1.0f - (1.0f - TurnLimit) * 2.0f * SmoothStep(TimeMargin, 1.0f - TimeMargin, 1.0f - elapsedSteeringDurationFraction));
                 }
@@ -563,12 +599,12 @@ void Fishes::UpdateDynamics(
             if (!fish.IsInFreefall) // If we're free-falling, current velocity has already converged towards target velocity
             {
                 // Smooth velocity towards target + shoaling
-                fish.CurrentVelocity +=
-                    ((fish.TargetVelocity + fish.ShoalingVelocity) - fish.CurrentVelocity) * fish.CurrentDirectionSmoothingConvergenceRate;
+                mFishVelocities[f] +=
+                    ((mFishTargetVelocities[f] + mFishShoalingVelocities[f]) - mFishVelocities[f]) * fish.CurrentDirectionSmoothingConvergenceRate;
             }
 
             // Make RenderVector match current velocity
-            fish.CurrentRenderVector = fish.CurrentVelocity.normalise();
+            mFishRenderVectors[f] = mFishVelocities[f].normalise();
 
             // Converge smoothing convergence rate to its ideal value
             fish.CurrentDirectionSmoothingConvergenceRate =
@@ -583,14 +619,14 @@ void Fishes::UpdateDynamics(
         float constexpr OceanSurfaceDisturbanceMagnitude = 8.0f; // Magic number
 
         // Get water surface level at this fish
-        float const oceanY = oceanSurface.GetHeightAt(fish.CurrentPosition.x);
+        float const oceanY = mFishOceanSurfaceHeights[f];
 
         //
         // Run freefall state machine
         //
 
         if (!fish.IsInFreefall
-            && fish.CurrentPosition.y > oceanY)
+            && mFishPositions[f].y > oceanY)
         {
             //
             // Enter freefall
@@ -602,10 +638,10 @@ void Fishes::UpdateDynamics(
             fish.CruiseSteeringState.reset();
 
             // Create a little disturbance in the ocean surface
-            oceanSurface.DisplaceAt(fish.CurrentPosition.x, OceanSurfaceDisturbanceMagnitude);
+            oceanSurface.DisplaceAt(mFishPositions[f].x, OceanSurfaceDisturbanceMagnitude);
         }
         else if (fish.IsInFreefall
-            && fish.CurrentPosition.y <= oceanY - OceanSurfaceLowWatermark)  // Lower level for re-entry, so that jump is more pronounced
+            && mFishPositions[f].y <= oceanY - OceanSurfaceLowWatermark)  // Lower level for re-entry, so that jump is more pronounced
         {
             //
             // Leave freefall (re-entry!)
@@ -614,10 +650,10 @@ void Fishes::UpdateDynamics(
             fish.IsInFreefall = false;
 
             // Drag velocity down
-            float const currentVelocityMagnitude = fish.CurrentVelocity.length();
+            float const currentVelocityMagnitude = mFishVelocities[f].length();
             float constexpr MaxVelocityMagnitude = 1.3f; // Magic number
-            fish.TargetVelocity =
-                fish.CurrentVelocity.normalise(currentVelocityMagnitude)
+            mFishTargetVelocities[f] =
+                mFishVelocities[f].normalise(currentVelocityMagnitude)
                 * Clamp(currentVelocityMagnitude, 0.0f, MaxVelocityMagnitude);
 
             // Converge to dragged velocity at this rate, overriding current rate
@@ -628,14 +664,14 @@ void Fishes::UpdateDynamics(
             // Enter "a bit of" panic mode (overriding current panic);
             // after exhausting this panic charge, the fish will resume
             // swimming towards it current target position
-            fish.PanicCharge = 0.03f;
+            mFishPanicCharges[f] = 0.03f;
 
             // Create a little disturbance in the ocean surface
-            oceanSurface.DisplaceAt(fish.CurrentPosition.x, OceanSurfaceDisturbanceMagnitude);
+            oceanSurface.DisplaceAt(mFishPositions[f].x, OceanSurfaceDisturbanceMagnitude);
         }
 
         //
-        // Dynamics update
+        // Dynamics update - prepare integration factors
         //
 
         if (!fish.IsInFreefall)
@@ -644,26 +680,22 @@ void Fishes::UpdateDynamics(
             // Swimming
             //
 
-            float const speedMultiplier = (fish.PanicCharge * 8.5f + 1.0f);
+            float const speedMultiplier = (mFishPanicCharges[f] * 8.5f + 1.0f);
 
             // Update position: add current velocity
-            fish.CurrentPosition +=
-                fish.CurrentVelocity
-                * GameParameters::SimulationStepTimeDuration<float>
+            mFishVelocityIntegrationFactors[f] =
+                GameParameters::SimulationStepTimeDuration<float>
                 * speedMultiplier;
 
             // Update tail progress phase: add basal speed
-            fish.CurrentTailProgressPhase += fishSpecies.TailSpeed * speedMultiplier * gameParameters.FishSpeedAdjustment;
+            mFishTailProgressPhases[f] += fishSpecies.TailSpeed * speedMultiplier * gameParameters.FishSpeedAdjustment;
 
             // Update position: superimpose a small sin component, unless we're steering
-            if (!fish.CruiseSteeringState.has_value())
-            {
-                fish.CurrentPosition +=
-                    fish.CurrentRenderVector
-                    * (1.0f + std::sin(2.0f * fish.CurrentTailProgressPhase))
-                    * (1.0f + fish.PanicCharge) // Grow incisiveness with panic
-                    / 150.0f; // Magic number
-            }
+            mFishRenderVectorIntegrationFactors[f] = !fish.CruiseSteeringState.has_value()
+                ? (1.0f + std::sin(2.0f * mFishTailProgressPhases[f]))
+                    * (1.0f + mFishPanicCharges[f]) // Grow incisiveness with panic
+                    / 150.0f // Magic number
+                : 0.0f;
         }
         else
         {
@@ -672,35 +704,54 @@ void Fishes::UpdateDynamics(
             //
 
             // Update velocity with gravity
-            float const newVelocityY = fish.CurrentVelocity.y
+            float const newVelocityY = mFishVelocities[f].y
                 - 2.0f // Magnification factor
                 * GameParameters::GravityMagnitude
                 * GameParameters::SimulationStepTimeDuration<float>;
 
-            fish.TargetVelocity = vec2f(
-                fish.CurrentVelocity.x,
+            mFishTargetVelocities[f] = vec2f(
+                mFishVelocities[f].x,
                 newVelocityY);
 
-            fish.CurrentVelocity = fish.TargetVelocity; // Converge immediately
+            mFishVelocities[f] = mFishTargetVelocities[f]; // Converge immediately
 
             // Converge direction at this rate, overriding current convergence rate
             fish.CurrentDirectionSmoothingConvergenceRate = 0.06f;
 
             // Update position: add velocity
-            fish.CurrentPosition +=
-                fish.CurrentVelocity
-                * GameParameters::SimulationStepTimeDuration<float>
+            mFishVelocityIntegrationFactors[f] =
+                GameParameters::SimulationStepTimeDuration<float>
                 * outOfWaterVelocityAmplification;
 
+            mFishRenderVectorIntegrationFactors[f] = 0.0f;
+
             // Update tail progress phase: add extra speed (fish flapping its tail)
-            fish.CurrentTailProgressPhase += fishSpecies.TailSpeed * 20.0f;
+            mFishTailProgressPhases[f] += fishSpecies.TailSpeed * 20.0f;
         }
+    }
 
-        // Decay panic charge
-        fish.PanicCharge *= 0.985f;
+    //
+    // Integrate
+    //
 
-        // Decay attraction timer
-        fish.AttractionDecayTimer *= 0.75f;
+    IntegrateFishes(fishCount);
+
+    //
+    // Check boundaries and state machine transitions
+    //
+
+    // Calculate the extent of all AABBs, so to quickly skip fishes that are far from all of them
+    Geometry::AABB aabbSetExtent;
+    for (auto const & aabb : aabbSet.GetItems())
+    {
+        aabbSetExtent.ExtendTo(aabb);
+    }
+
+    for (ElementIndex f = 0; f < fishCount; ++f)
+    {
+        Fish & fish = mFishes[f];
+        FishShoal const & fishShoal = mFishShoals[fish.ShoalId];
+        FishSpecies const & fishSpecies = fishShoal.Species;
 
         ///////////////////////////////////////////////////////////////////
         // 3) World boundaries check
@@ -708,26 +759,26 @@ void Fishes::UpdateDynamics(
 
         bool hasBouncedAgainstWorldBoundaries = false;
 
-        if (fish.CurrentPosition.x < -GameParameters::HalfMaxWorldWidth)
+        if (mFishPositions[f].x < -GameParameters::HalfMaxWorldWidth)
         {
             // Bounce position
-            fish.CurrentPosition.x = -GameParameters::HalfMaxWorldWidth + (-GameParameters::HalfMaxWorldWidth - fish.CurrentPosition.x);
+            mFishPositions[f].x = -GameParameters::HalfMaxWorldWidth + (-GameParameters::HalfMaxWorldWidth - mFishPositions[f].x);
 
             // Bounce both current and target velocity
-            fish.CurrentVelocity.x = std::abs(fish.CurrentVelocity.x);
-            fish.TargetVelocity.x = std::abs(fish.TargetVelocity.x);
+            mFishVelocities[f].x = std::abs(mFishVelocities[f].x);
+            mFishTargetVelocities[f].x = std::abs(mFishTargetVelocities[f].x);
 
             // Adjust other fish properties
             hasBouncedAgainstWorldBoundaries = true;
         }
-        else if (fish.CurrentPosition.x > GameParameters::HalfMaxWorldWidth)
+        else if (mFishPositions[f].x > GameParameters::HalfMaxWorldWidth)
         {
             // Bounce position
-            fish.CurrentPosition.x = GameParameters::HalfMaxWorldWidth - (fish.CurrentPosition.x - GameParameters::HalfMaxWorldWidth);
+            mFishPositions[f].x = GameParameters::HalfMaxWorldWidth - (mFishPositions[f].x - GameParameters::HalfMaxWorldWidth);
 
             // Bounce both current and target velocity
-            fish.CurrentVelocity.x = -std::abs(fish.CurrentVelocity.x);
-            fish.TargetVelocity.x = -std::abs(fish.TargetVelocity.x);
+            mFishVelocities[f].x = -std::abs(mFishVelocities[f].x);
+            mFishTargetVelocities[f].x = -std::abs(mFishTargetVelocities[f].x);
 
             // Adjust other fish properties
             hasBouncedAgainstWorldBoundaries = true;
@@ -737,8 +788,8 @@ void Fishes::UpdateDynamics(
         {
             // Find a new target position away
             fish.TargetPosition = FindNewCruisingTargetPosition(
-                fish.CurrentPosition,
-                fish.TargetVelocity.normalise(),
+                mFishPositions[f],
+                mFishTargetVelocities[f].normalise(),
                 fishSpecies,
                 visibleWorld);
 
@@ -749,8 +800,8 @@ void Fishes::UpdateDynamics(
             continue;
         }
 
-        assert(fish.CurrentPosition.x >= -GameParameters::HalfMaxWorldWidth
-            && fish.CurrentPosition.x <= GameParameters::HalfMaxWorldWidth);
+        assert(mFishPositions[f].x >= -GameParameters::HalfMaxWorldWidth
+            && mFishPositions[f].x <= GameParameters::HalfMaxWorldWidth);
 
         // Stop now if we're free-falling
         if (fish.IsInFreefall)
@@ -764,8 +815,8 @@ void Fishes::UpdateDynamics(
         ///////////////////////////////////////////////////////////////////
 
         // Check whether this fish has reached its target
-        if (std::abs(fish.CurrentPosition.x - fish.TargetPosition.x) < 7.0f
-            && fish.PanicCharge == 0.0f) // Not in panic
+        if (std::abs(mFishPositions[f].x - fish.TargetPosition.x) < 7.0f
+            && mFishPanicCharges[f] == 0.0f) // Not in panic
         {
             //
             // Target Reached
@@ -773,22 +824,22 @@ void Fishes::UpdateDynamics(
 
             // Choose new target position
             fish.TargetPosition = FindNewCruisingTargetPosition(
-                fish.CurrentPosition,
-                -fish.CurrentVelocity.normalise(),
+                mFishPositions[f],
+                -mFishVelocities[f].normalise(),
                 fishSpecies,
                 visibleWorld);
 
             // Calculate new target velocity
-            fish.TargetVelocity = MakeCuisingVelocity((fish.TargetPosition - fish.CurrentPosition).normalise(), fishSpecies, fish.PersonalitySeed, gameParameters);
+            mFishTargetVelocities[f] = MakeCuisingVelocity((fish.TargetPosition - mFishPositions[f]).normalise(), fishSpecies, fish.PersonalitySeed, gameParameters);
 
             // Setup steering, depending on whether we're turning or not
-            if (fish.TargetVelocity.x * fish.CurrentVelocity.x < 0.0f
+            if (mFishTargetVelocities[f].x * mFishVelocities[f].x < 0.0f
                 && !fish.CruiseSteeringState.has_value()) // Not steering already
             {
                 // Perform a cruise steering
                 fish.CruiseSteeringState.emplace(
-                    fish.CurrentVelocity,
-                    fish.CurrentRenderVector,
+                    mFishVelocities[f],
+                    mFishRenderVectors[f],
                     currentSimulationTime,
                     1.5f); // Slow turn
 
@@ -803,27 +854,27 @@ void Fishes::UpdateDynamics(
             }
         }
         // Check whether this fish has reached the end of panic mode
-        else if (fish.PanicCharge != 0.0f && fish.PanicCharge < 0.02f) // Reached end of panic
+        else if (mFishPanicCharges[f] != 0.0f && mFishPanicCharges[f] < 0.02f) // Reached end of panic
         {
             //
             // End of Panic
             //
 
-            fish.PanicCharge = 0.0f;
+            mFishPanicCharges[f] = 0.0f;
 
             // Continue to current target
 
             // Calculate new target velocity
-            fish.TargetVelocity = MakeCuisingVelocity((fish.TargetPosition - fish.CurrentPosition).normalise(), fishSpecies, fish.PersonalitySeed, gameParameters);
+            mFishTargetVelocities[f] = MakeCuisingVelocity((fish.TargetPosition - mFishPositions[f]).normalise(), fishSpecies, fish.PersonalitySeed, gameParameters);
 
             // Setup steering, depending on whether we're turning or not
-            if (fish.TargetVelocity.x * fish.CurrentVelocity.x < 0.0f
+            if (mFishTargetVelocities[f].x * mFishVelocities[f].x < 0.0f
                 && !fish.CruiseSteeringState.has_value()) // Not steering already
             {
                 // Perform a cruise steering
                 fish.CruiseSteeringState.emplace(
-                    fish.CurrentVelocity,
-                    fish.CurrentRenderVector,
+                    mFishVelocities[f],
+                    mFishRenderVectors[f],
                     currentSimulationTime,
                     1.5f); // Slow turn
 
@@ -844,30 +895,30 @@ void Fishes::UpdateDynamics(
 
         // Calculate position of head
         vec2f const fishHeadPosition =
-            fish.CurrentPosition
-            + fish.CurrentRenderVector * fish.HeadOffset;
+            mFishPositions[f]
+            + mFishRenderVectors[f] * fish.HeadOffset;
 
         // Calculate depth of fish head
-        float const fishHeadDepth = oceanY - fishHeadPosition.y;
+        float const fishHeadDepth = mFishOceanSurfaceHeights[f] - fishHeadPosition.y;
 
         // Check whether we're too close to the water surface (idealized as being horizontal) - but only if fish is not in too much panic
         if (fishHeadDepth < 2.0f + OceanSurfaceLowWatermark
-            && fish.PanicCharge <= 0.3f // Not too much panic
-            && fish.TargetVelocity.y >= 0.0f) // Bounce away only if we're really going into it
+            && mFishPanicCharges[f] <= 0.3f // Not too much panic
+            && mFishTargetVelocities[f].y >= 0.0f) // Bounce away only if we're really going into it
         {
             //
             // OceanSurface Bounce
             //
 
             // Bounce direction, opposite of target
-            vec2f const bounceDirection = vec2f(fish.TargetVelocity.x, -fish.TargetVelocity.y).normalise();
+            vec2f const bounceDirection = vec2f(mFishTargetVelocities[f].x, -mFishTargetVelocities[f].y).normalise();
 
             // Calculate new target velocity - along bounce direction
-            fish.TargetVelocity = MakeCuisingVelocity(bounceDirection, fishSpecies, fish.PersonalitySeed, gameParameters);
+            mFishTargetVelocities[f] = MakeCuisingVelocity(bounceDirection, fishSpecies, fish.PersonalitySeed, gameParameters);
 
             // Converge direction change at this rate
             fish.CurrentDirectionSmoothingConvergenceRate = std::max(
-                0.05f * (1.0f + fish.PanicCharge),
+                0.05f * (1.0f + mFishPanicCharges[f]),
                 fish.CurrentDirectionSmoothingConvergenceRate);
         }
 
@@ -886,15 +937,15 @@ void Fishes::UpdateDynamics(
 
             // Calculate the component of the fish's target velocity along the normal,
             // i.e. towards the outside of the floor...
-            float const targetVelocityAlongNormal = fish.TargetVelocity.dot(seaFloorNormal);
+            float const targetVelocityAlongNormal = mFishTargetVelocities[f].dot(seaFloorNormal);
 
             // ...if positive, it will soon be going already outside of the floor, hence we leave it as-is
             if (targetVelocityAlongNormal <= 0.0f)
             {
                 // Set target velocity to reflection of fish's target velocity around normal:
                 // R = V − 2(V⋅N^)N^
-                fish.TargetVelocity =
-                    fish.TargetVelocity
+                mFishTargetVelocities[f] =
+                    mFishTargetVelocities[f]
                     - seaFloorNormal * 2.0f * targetVelocityAlongNormal;
 
                 // Converge direction change at this rate
@@ -908,8 +959,12 @@ void Fishes::UpdateDynamics(
         // 6) Check AABB boundaries
         ///////////////////////////////////////////////////////////////////
 
-        //if (fish.PanicCharge <= 0.3f) // Only if we're not in panic
-        if (fish.PanicCharge <= 0.1f) // Only if we're not in panic
+        //if (mFishPanicCharges[f] <= 0.3f) // Only if we're not in panic
+        if (mFishPanicCharges[f] <= 0.1f // Only if we're not in panic
+            && fishHeadPosition.x >= aabbSetExtent.BottomLeft.x - AABBMargin
+            && fishHeadPosition.x <= aabbSetExtent.TopRight.x + AABBMargin
+            && fishHeadPosition.y >= aabbSetExtent.BottomLeft.y - AABBMargin
+            && fishHeadPosition.y <= aabbSetExtent.TopRight.y + AABBMargin)
         {
             for (auto const & aabb : aabbSet.GetItems())
             {
@@ -940,9 +995,9 @@ void Fishes::UpdateDynamics(
                     }
 
                     // Rotate target velocity towards normal
-                    float const targetVelocityMagnitude = fish.TargetVelocity.length();
-                    fish.TargetVelocity =
-                        (fish.TargetVelocity.normalise(targetVelocityMagnitude) + outwardNormal * 2.0f).normalise()
+                    float const targetVelocityMagnitude = mFishTargetVelocities[f].length();
+                    mFishTargetVelocities[f] =
+                        (mFishTargetVelocities[f].normalise(targetVelocityMagnitude) + outwardNormal * 2.0f).normalise()
                         * targetVelocityMagnitude;
 
                     // Converge direction change at a fast rate
@@ -951,9 +1006,9 @@ void Fishes::UpdateDynamics(
                         fish.CurrentDirectionSmoothingConvergenceRate);
 
                     // Panic a bit
-                    fish.PanicCharge = std::max(
+                    mFishPanicCharges[f] = std::max(
                         0.5f,
-                        fish.PanicCharge);
+                        mFishPanicCharges[f]);
 
                     // Stop steering, if we're steering
                     fish.CruiseSteeringState.reset();
@@ -963,6 +1018,43 @@ void Fishes::UpdateDynamics(
     }
 }
 
+void Fishes::IntegrateFishes(ElementCount fishCount)
+{
+    //
+    // Branch-free, on the kinematic state buffers only, so
+    // that the compiler may vectorize it
+    //
+
+    float * const restrict positionBuffer = reinterpret_cast<float *>(mFishPositions.data());
+    float const * const restrict velocityBuffer = reinterpret_cast<float const *>(mFishVelocities.data());
+    float const * const restrict renderVectorBuffer = reinterpret_cast<float const *>(mFishRenderVectors.data());
+    float const * const restrict velocityIntegrationFactorBuffer = mFishVelocityIntegrationFactors.data();
+    float const * const restrict renderVectorIntegrationFactorBuffer = mFishRenderVectorIntegrationFactors.data();
+
+    for (ElementIndex f = 0; f < fishCount; ++f)
+    {
+        positionBuffer[f * 2] +=
+            velocityBuffer[f * 2] * velocityIntegrationFactorBuffer[f]
+            + renderVectorBuffer[f * 2] * renderVectorIntegrationFactorBuffer[f];
+
+        positionBuffer[f * 2 + 1] +=
+            velocityBuffer[f * 2 + 1] * velocityIntegrationFactorBuffer[f]
+            + renderVectorBuffer[f * 2 + 1] * renderVectorIntegrationFactorBuffer[f];
+    }
+
+    float * const restrict panicChargeBuffer = mFishPanicCharges.data();
+    float * const restrict attractionDecayTimerBuffer = mFishAttractionDecayTimers.data();
+
+    for (ElementIndex f = 0; f < fishCount; ++f)
+    {
+        // Decay panic charge
+        panicChargeBuffer[f] *= 0.985f;
+
+        // Decay attraction timer
+        attractionDecayTimerBuffer[f] *= 0.75f;
+    }
+}
+
 void Fishes::UpdateShoaling(
     float currentSimulationTime,
     GameParameters const & gameParameters,
@@ -985,7 +1077,7 @@ void Fishes::UpdateShoaling(
 
             if (fishShoal.CurrentMemberCount > 1 // A shoal contains at least one fish
                 && fish.ShoalingTimer <= 0.0f // Wait for this fish's shoaling cycle
-                && fish.PanicCharge < 0.02f) // Skip fishes even in little panic
+                && mFishPanicCharges[f] < 0.02f) // Skip fishes even in little panic
             {
                 if (!fish.CruiseSteeringState.has_value() // Fish is not u-turning
                     && !fish.IsInFreefall) // Fish is swimming
@@ -1012,7 +1104,7 @@ void Fishes::UpdateShoaling(
                         {
                             Fish const & neighbor = mFishes[n];
 
-                            if (float const distance = (neighbor.CurrentPosition - fish.CurrentPosition).length();
+                            if (float const distance = (mFishPositions[n] - mFishPositions[f]).length();
                                 distance < fishShoalRadius) // Neighbor is in the neighborhood (...hence a neighbor)
                             {
                                 // Update closest and furthest
@@ -1037,26 +1129,26 @@ void Fishes::UpdateShoaling(
 
                                 // Check if should do a u-turn based on this neighbor
                                 float constexpr UTurnSpeed = 2.5f;
-                                if (neighbor.TargetVelocity.x * fish.TargetVelocity.x < 0.0f // Intents are opposite
+                                if (mFishTargetVelocities[n].x * mFishTargetVelocities[f].x < 0.0f // Intents are opposite
                                     && (currentSimulationTime - fish.LastSteeringSimulationTime) > UTurnSpeed + 3.0f // This fish hasn't u-turned recently
                                     && fish.LastSteeringSimulationTime < neighbor.LastSteeringSimulationTime) // The neighbor has u-turned more recently
                                 {
-                                    vec2f const neighborDirection = neighbor.TargetVelocity.normalise();
+                                    vec2f const neighborDirection = mFishTargetVelocities[n].normalise();
 
                                     // Find a new target position along the neighbor's direction
                                     fish.TargetPosition = FindNewCruisingTargetPosition(
-                                        fish.CurrentPosition,
+                                        mFishPositions[f],
                                         neighborDirection,
                                         fishShoal.Species,
                                         visibleWorld);
 
                                     // Change target velocity to get to target position
-                                    fish.TargetVelocity = MakeCuisingVelocity(neighborDirection, fishShoal.Species, fish.PersonalitySeed, gameParameters);
+                                    mFishTargetVelocities[f] = MakeCuisingVelocity(neighborDirection, fishShoal.Species, fish.PersonalitySeed, gameParameters);
 
                                     // Perform a cruise steering
                                     fish.CruiseSteeringState.emplace(
-                                        fish.CurrentVelocity,
-                                        fish.CurrentRenderVector,
+                                        mFishVelocities[f],
+                                        mFishRenderVectors[f],
                                         currentSimulationTime,
                                         UTurnSpeed);
 
@@ -1085,29 +1177,29 @@ void Fishes::UpdateShoaling(
                         //
 
                         // Pick lead
-                        Fish const & lead = mFishes[fishShoal.StartFishIndex];
+                        ElementIndex const leadFishIndex = fishShoal.StartFishIndex;
 
-                        vec2f const fishToLeadVector = lead.CurrentPosition - fish.CurrentPosition;
+                        vec2f const fishToLeadVector = mFishPositions[leadFishIndex] - mFishPositions[f];
                         float const distance = fishToLeadVector.length();
                         vec2f const fishToLeadDirection = fishToLeadVector.normalise(distance);
 
                         // Check whether we need to turn - we do if lead is currently behind us
-                        if (fish.TargetVelocity.x * fishToLeadDirection.x < 0.0f)
+                        if (mFishTargetVelocities[f].x * fishToLeadDirection.x < 0.0f)
                         {
                             // Find a new target position towards the lead
                             fish.TargetPosition = FindNewCruisingTargetPosition(
-                                fish.CurrentPosition,
+                                mFishPositions[f],
                                 fishToLeadDirection,
                                 fishShoal.Species,
                                 visibleWorld);
 
                             // Change target velocity to get to target position
-                            fish.TargetVelocity = MakeCuisingVelocity(fishToLeadDirection, fishShoal.Species, fish.PersonalitySeed, gameParameters);
+                            mFishTargetVelocities[f] = MakeCuisingVelocity(fishToLeadDirection, fishShoal.Species, fish.PersonalitySeed, gameParameters);
 
                             // Perform a cruise steering
                             fish.CruiseSteeringState.emplace(
-                                fish.CurrentVelocity,
-                                fish.CurrentRenderVector,
+                                mFishVelocities[f],
+                                mFishRenderVectors[f],
                                 currentSimulationTime,
                                 0.5f);
 
@@ -1116,14 +1208,14 @@ void Fishes::UpdateShoaling(
                         }
 
                         // Set shoaling velocity to match
-                        fish.ShoalingVelocity =
+                        mFishShoalingVelocities[f] =
                             fishToLeadDirection
                             * 1.8f // Magic number
                             * gameParameters.FishSpeedAdjustment;
 
                         // Add some panic, depending on distance
-                        fish.PanicCharge = std::max(
-                            fish.PanicCharge,
+                        mFishPanicCharges[f] = std::max(
+                            mFishPanicCharges[f],
                             0.4f * SmoothStep(0.0f, 30.0f, distance));
                     }
                     else
@@ -1133,14 +1225,14 @@ void Fishes::UpdateShoaling(
                         //
 
                         vec2f collisionCorrectionVelocity = (closestFishIndex != NoneElementIndex)
-                            ? -(mFishes[closestFishIndex].CurrentPosition - fish.CurrentPosition).normalise() * 1.2f // Go away from neighbor
+                            ? -(mFishPositions[closestFishIndex] - mFishPositions[f]).normalise() * 1.2f // Go away from neighbor
                             : vec2f::zero();
 
                         vec2f cohesionCorrectionVelocity = (furthestFishIndex != NoneElementIndex)
-                            ? (mFishes[furthestFishIndex].CurrentPosition - fish.CurrentPosition).normalise() * 1.8f // Go towards neighbor
+                            ? (mFishPositions[furthestFishIndex] - mFishPositions[f]).normalise() * 1.8f // Go towards neighbor
                             : vec2f::zero();
 
-                        fish.ShoalingVelocity =
+                        mFishShoalingVelocities[f] =
                             (collisionCorrectionVelocity + cohesionCorrectionVelocity)
                             * gameParameters.FishSpeedAdjustment;
                     }
@@ -1151,7 +1243,7 @@ void Fishes::UpdateShoaling(
                 else
                 {
                     // Zero out any residual shoaling
-                    fish.ShoalingVelocity = vec2f::zero();
+                    mFishShoalingVelocities[f] = vec2f::zero();
                 }
             }
 
@@ -1170,16 +1262,18 @@ void Fishes::EnactDisturbance(
         worldRadius
         * (gameParameters.IsUltraViolentMode ? 5.0f : 1.0f);
 
-    for (auto & fish : mFishes)
+    for (size_t f = 0; f < mFishes.size(); ++f)
     {
+        Fish & fish = mFishes[f];
+
         if (!fish.IsInFreefall)
         {
             FishSpecies const & species = mFishShoals[fish.ShoalId].Species;
 
             // Calculate position of head
             vec2f const fishHeadPosition =
-                fish.CurrentPosition
-                + fish.CurrentRenderVector.normalise() * fish.HeadOffset;
+                mFishPositions[f]
+                + mFishRenderVectors[f].normalise() * fish.HeadOffset;
 
             // Calculate distance from disturbance
             float const distance = (fishHeadPosition - worldCoordinates).length();
@@ -1190,11 +1284,11 @@ void Fishes::EnactDisturbance(
                 // Enter panic mode with a charge decreasing with distance, and a
                 // tiny bit being random
                 float constexpr MinPanic = 0.25f;
-                fish.PanicCharge = std::max(
+                mFishPanicCharges[f] = std::max(
                     MinPanic
                     + (0.8f - MinPanic) * (1.0f - SmoothStep(0.0f, effectiveRadius, distance))
                     + 0.2f * fish.PersonalitySeed,
-                    fish.PanicCharge);
+                    mFishPanicCharges[f]);
 
                 // Don't change target position, we'll return to it when panic is over
 
@@ -1215,7 +1309,7 @@ void Fishes::EnactDisturbance(
                 }
 
                 // Calculate new target velocity - away from disturbance point, and will be panic velocity
-                fish.TargetVelocity = MakeCuisingVelocity(panicDirection, species, fish.PersonalitySeed, gameParameters);
+                mFishTargetVelocities[f] = MakeCuisingVelocity(panicDirection, species, fish.PersonalitySeed, gameParameters);
 
                 // Converge directions really fast
                 fish.CurrentDirectionSmoothingConvergenceRate = std::max(
@@ -1238,29 +1332,31 @@ void Fishes::EnactAttraction(
         worldRadius
         * (gameParameters.IsUltraViolentMode ? 5.0f : 1.0f);
 
-    for (auto & fish : mFishes)
+    for (size_t f = 0; f < mFishes.size(); ++f)
     {
+        Fish & fish = mFishes[f];
+
         if (!fish.IsInFreefall
-            && fish.PanicCharge < 0.65f) // Don't attract fish in much panic
+            && mFishPanicCharges[f] < 0.65f) // Don't attract fish in much panic
         {
             FishSpecies const & species = mFishShoals[fish.ShoalId].Species;
 
             // Calculate position of head
             vec2f const fishHeadPosition =
-                fish.CurrentPosition
-                + fish.CurrentRenderVector.normalise() * fish.HeadOffset;
+                mFishPositions[f]
+                + mFishRenderVectors[f].normalise() * fish.HeadOffset;
 
             // Calculate distance from attraction
             float const distance = (worldCoordinates - fishHeadPosition).length();
 
             // Check whether the fish has been attracted
             if (distance < effectiveRadius
-                && fish.AttractionDecayTimer < 0.05f) // Free to begin a new attraction cycle
+                && mFishAttractionDecayTimers[f] < 0.05f) // Free to begin a new attraction cycle
             {
                 // Enter panic mode with a charge decreasing with distance
-                fish.PanicCharge = std::max(
+                mFishPanicCharges[f] = std::max(
                     0.3f + 0.7f * (1.0f - SmoothStep(0.0f, effectiveRadius, distance)), // At least 0.3 immediate panic once in radius
-                    fish.PanicCharge);
+                    mFishPanicCharges[f]);
 
                 // Calculate new direction, randomly in the area of food
                 float constexpr RandomnessWidth = 3.0f;
@@ -1285,7 +1381,7 @@ void Fishes::EnactAttraction(
                 // Don't change target position, we'll return to it when panic is over
 
                 // Calculate new target velocity - towards food, and will be panic velocity
-                fish.TargetVelocity = MakeCuisingVelocity(panicDirection, species, fish.PersonalitySeed, gameParameters);
+                mFishTargetVelocities[f] = MakeCuisingVelocity(panicDirection, species, fish.PersonalitySeed, gameParameters);
 
                 // Converge directions at this rate
                 fish.CurrentDirectionSmoothingConvergenceRate = std::max(
@@ -1296,7 +1392,7 @@ void Fishes::EnactAttraction(
                 fish.CruiseSteeringState.reset();
 
                 // Begin attraction cycle
-                fish.AttractionDecayTimer = 1.0f;
+                mFishAttractionDecayTimers[f] = 1.0f;
             }
         }
     }
@@ -1304,28 +1400,30 @@ void Fishes::EnactAttraction(
 
 void Fishes::EnactWidespreadPanic(GameParameters const & gameParameters)
 {
-    for (auto & fish : mFishes)
+    for (size_t f = 0; f < mFishes.size(); ++f)
     {
+        Fish & fish = mFishes[f];
+
         if (!fish.IsInFreefall)
         {
             FishSpecies const & species = mFishShoals[fish.ShoalId].Species;
 
             // Enter panic mode
-            fish.PanicCharge = std::max(
+            mFishPanicCharges[f] = std::max(
                 1.6f,
-                fish.PanicCharge);
+                mFishPanicCharges[f]);
 
             // Calculate new direction - opposite of current
             float constexpr RandomnessWidth = 5.0f;
             vec2f const randomDelta(
                 GameRandomEngine::GetInstance().GenerateUniformReal(-RandomnessWidth, RandomnessWidth),
                 GameRandomEngine::GetInstance().GenerateUniformReal(-RandomnessWidth, RandomnessWidth));
-            vec2f panicDirection = (-fish.CurrentVelocity + randomDelta).normalise();
+            vec2f panicDirection = (-mFishVelocities[f] + randomDelta).normalise();
 
             // Don't change target position, we'll return to it when panic is over
 
             // Calculate new target velocity in this direction - and will be panic velocity
-            fish.TargetVelocity = MakeCuisingVelocity(panicDirection, species, fish.PersonalitySeed, gameParameters);
+            mFishTargetVelocities[f] = MakeCuisingVelocity(panicDirection, species, fish.PersonalitySeed, gameParameters);
 
             // Converge directions at this rate
             fish.CurrentDirectionSmoothingConvergenceRate = std::max(
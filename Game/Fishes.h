@@ -88,6 +88,13 @@ private:
     // Shoal ID is index in Shoals vector
     using FishShoalId = size_t;
 
+    //
+    // A fish's state is split between the Fish struct, which contains
+    // the state of the fish's behavioral state machines, and the kinematic
+    // state buffers below, which are visited by the dynamics integration
+    // and by neighbor searches
+    //
+
     struct Fish
     {
     public:
@@ -117,27 +124,12 @@ private:
 
         float PersonalitySeed;
 
-        vec2f CurrentPosition;
         vec2f TargetPosition;
 
-        vec2f CurrentVelocity;
-        vec2f TargetVelocity;
-
-        vec2f ShoalingVelocity;
-
-        vec2f CurrentRenderVector;
-
         float CurrentDirectionSmoothingConvergenceRate; // Rate of converge of velocity and direction
         static float constexpr IdealDirectionSmoothingConvergenceRate = 0.016f;
 
         float HeadOffset; // Offset of head from position along fish direction
-        float CurrentTailProgressPhase;
-
-        // Panic mode state machine
-        float PanicCharge; // When not zero, fish is panic mode; decays towards zero
-
-        // Provides a heartbeat for attractions
-        float AttractionDecayTimer;
 
         // Provides a heartbeat for shoaling
         float ShoalingTimer;
@@ -156,25 +148,14 @@ private:
         Fish(
             FishShoalId shoalId,
             float personalitySeed,
-            vec2f const & initialPosition,
             vec2f const & targetPosition,
-            vec2f const & targetVelocity,
             float headOffset,
-            float initialTailProgressPhase,
             TextureFrameId<Render::FishTextureGroups> renderTextureFrameId)
             : ShoalId(shoalId)
             , PersonalitySeed(personalitySeed)
-            , CurrentPosition(initialPosition)
             , TargetPosition(targetPosition)
-            , CurrentVelocity(targetVelocity)
-            , TargetVelocity(CurrentVelocity)
-            , ShoalingVelocity(vec2f::zero())
-            , CurrentRenderVector(targetVelocity.normalise())
             , CurrentDirectionSmoothingConvergenceRate(IdealDirectionSmoothingConvergenceRate)
             , HeadOffset(headOffset)
-            , CurrentTailProgressPhase(initialTailProgressPhase)
-            , PanicCharge(0.0f)
-            , AttractionDecayTimer(0.0f)
             , ShoalingTimer(personalitySeed * ShoalingTimerCycleDuration) // Randomize a bit the shoaling cycles
             , CruiseSteeringState()
             , LastSteeringSimulationTime(0.0f)
@@ -228,6 +209,18 @@ private:
         GameParameters const & gameParameters,
         VisibleWorld const & visibleWorld);
 
+    void AddFish(
+        FishShoalId shoalId,
+        float personalitySeed,
+        vec2f const & initialPosition,
+        vec2f const & targetPosition,
+        vec2f const & targetVelocity,
+        float headOffset,
+        float initialTailProgressPhase,
+        TextureFrameId<Render::FishTextureGroups> renderTextureFrameId);
+
+    void TrimFishes(size_t fishCount);
+
     void UpdateInteractions(GameParameters const & gameParameters);
 
     void UpdateDynamics(
@@ -238,6 +231,8 @@ private:
         GameParameters const & gameParameters,
         VisibleWorld const & visibleWorld);
 
+    void IntegrateFishes(ElementCount fishCount);
+
     void UpdateShoaling(
         float currentSimulationTime,
         GameParameters const & gameParameters,
@@ -290,6 +285,27 @@ private:
     // The...fishes
     std::vector<Fish> mFishes;
 
+    //
+    // Kinematic state buffers, one element per fish
+    //
+
+    std::vector<vec2f> mFishPositions;
+    std::vector<vec2f> mFishVelocities;
+    std::vector<vec2f> mFishTargetVelocities;
+    std::vector<vec2f> mFishShoalingVelocities;
+    std::vector<vec2f> mFishRenderVectors;
+    std::vector<float> mFishTailProgressPhases;
+    std::vector<float> mFishPanicCharges; // When not zero, fish is panic mode; decays towards zero
+    std::vector<float> mFishAttractionDecayTimers; // Provides a heartbeat for attractions
+
+    //
+    // Dynamics integration buffers, one element per fish
+    //
+
+    std::vector<float> mFishOceanSurfaceHeights;
+    std::vector<float> mFishVelocityIntegrationFactors; // Velocity -> position delta
+    std::vector<float> mFishRenderVectorIntegrationFactors; // Render vector -> position delta, i.e. swimming wiggle
+
     // Delayed interactions
     std::vector<Interaction> mInteractions;
 
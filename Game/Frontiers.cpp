@@ -590,72 +590,6 @@ void Frontiers::HandleTriangleRestore(
     mIsDirtyForRendering = true;
 }
 
-void Frontiers::Upload(
-    ShipId shipId,
-    Render::RenderContext & renderContext)
-{
-    if (renderContext.GetShowFrontiers()
-        && mIsDirtyForRendering)
-    {
-        //
-        // Upload frontier point colors
-        //
-
-        // Generate point colors
-        RegeneratePointColors();
-
-        // Upload point colors
-        renderContext.UploadShipPointFrontierColorsAsync(shipId, mPointColors.data());
-
-        //
-        // Upload frontier point indices
-        //
-
-        auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
-
-        size_t const totalSize = std::accumulate(
-            mFrontiers.cbegin(),
-            mFrontiers.cend(),
-            size_t(0),
-            [](size_t total, auto const & f)
-            {
-                return total + (f.has_value() ? f->Size : 0);
-            });
-
-        shipRenderContext.UploadElementFrontierEdgesStart(totalSize);
-
-        for (auto const & frontier : mFrontiers)
-        {
-            if (frontier.has_value())
-            {
-                assert(frontier->Size > 0);
-
-                ElementIndex const startingEdgeIndex = frontier->StartingEdgeIndex;
-                ElementIndex edgeIndex = startingEdgeIndex;
-
-                do
-                {
-                    auto const nextEdgeIndex = mFrontierEdges[edgeIndex].NextEdgeIndex;
-
-                    // Upload
-                    shipRenderContext.UploadElementFrontierEdge(
-                        mFrontierEdges[edgeIndex].PointAIndex,
-                        mFrontierEdges[nextEdgeIndex].PointAIndex);
-
-                    // Advance
-                    edgeIndex = nextEdgeIndex;
-
-                } while (edgeIndex != startingEdgeIndex);
-            }
-        }
-
-        shipRenderContext.UploadElementFrontierEdgesEnd();
-
-        // We are not dirty anymore
-        mIsDirtyForRendering = false;
-    }
-}
-
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 FrontierId Frontiers::CreateNewFrontier(
@@ -81,11 +81,12 @@ public:
     virtual void OnNeighborhoodDisturbed() = 0;
 
     /*
-     * Uploads rendering information to the render context.
+     * Uploads rendering information to the render context, via the specialization's own
+     * Upload().
      */
-    virtual void Upload(
+    void Upload(
         ShipId shipId,
-        Render::RenderContext & renderContext) const = 0;
+        Render::RenderContext & renderContext) const;
 
     /*
      * Invoked when the spring tracked by the gadget is destroyed.
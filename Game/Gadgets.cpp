@@ -302,19 +302,4 @@ void Gadgets::DetonateAntiMatterBombs()
     }
 }
 
-void Gadgets::Upload(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    for (auto & gadget : mCurrentGadgets)
-    {
-        gadget->Upload(shipId, renderContext);
-    }
-
-    if (mCurrentPhysicsProbeGadget)
-    {
-        mCurrentPhysicsProbeGadget->Upload(shipId, renderContext);
-    }
-}
-
 }
\ No newline at end of file
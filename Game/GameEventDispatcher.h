@@ -11,11 +11,24 @@
 #include <GameCore/TupleKeys.h>
 
 #include <algorithm>
+#include <cassert>
+#include <functional>
+#include <mutex>
 #include <optional>
+#include <thread>
 #include <vector>
 
 /*
  * Dispatches events to multiple sinks, aggregating some events in the process.
+ *
+ * Thread-safe, as events may be fired by ships being updated concurrently.
+ * Sinks are only ever invoked on the thread that created the dispatcher: non-aggregated
+ * events fired on that thread are published right away, while those fired on other
+ * threads are queued and published - in the order they were fired - at the next Flush().
+ *
+ * When the simulation runs deterministically, events are fired from one thread
+ * at a time and always in the same order, hence aggregated values (e.g. sums of
+ * floats) are reproducible too.
  */
 class GameEventDispatcher final
     : public ILifecycleGameEventHandler
@@ -30,24 +43,8 @@ class GameEventDispatcher final
 public:
 
     GameEventDispatcher()
-        : mStressEvents()
-        , mBreakEvents()
-        , mLampBrokenEvents()
-        , mLampExplodedEvents()
-        , mLampImplodedEvents()
-        , mCombustionExplosionEvents()
-        , mLightningHitEvents()
-        , mLightFlickerEvents()
-        , mSpringRepairedEvents()
-        , mTriangleRepairedEvents()
-        , mPinToggledEvents()
-        , mWaterDisplacedEvents(0.0f)
-        , mAirBubbleSurfacedEvents(0u)
-        , mBombExplosionEvents()
-        , mRCBombPingEvents()
-        , mTimerBombDefusedEvents()
-        , mWatertightDoorOpenedEvents()
-        , mWatertightDoorClosedEvents()
+        : mAggregatedEvents()
+        , mDeferredEvents()
         // Sinks
         , mLifecycleSinks()
         , mStructuralSinks()
@@ -57,6 +54,8 @@ public:
         , mAtmosphereSinks()
         , mElectricalElementSinks()
         , mGenericSinks()
+        , mOwnerThreadId(std::this_thread::get_id())
+        , mMutex()
     {
     }
 
@@ -68,44 +67,54 @@ public:
 
     void OnGameReset() override
     {
-        for (auto sink : mLifecycleSinks)
-        {
-            sink->OnGameReset();
-        }
+        DispatchToSinks(
+            mLifecycleSinks,
+            [](auto * sink)
+            {
+                sink->OnGameReset();
+            });
     }
 
     void OnShipLoaded(
         ShipId id,
         ShipMetadata const & shipMetadata) override
     {
-        for (auto sink : mLifecycleSinks)
-        {
-            sink->OnShipLoaded(id, shipMetadata);
-        }
+        DispatchToSinks(
+            mLifecycleSinks,
+            [id, shipMetadata](auto * sink)
+            {
+                sink->OnShipLoaded(id, shipMetadata);
+            });
     }
 
     void OnSinkingBegin(ShipId shipId) override
     {
-        for (auto sink : mLifecycleSinks)
-        {
-            sink->OnSinkingBegin(shipId);
-        }
+        DispatchToSinks(
+            mLifecycleSinks,
+            [shipId](auto * sink)
+            {
+                sink->OnSinkingBegin(shipId);
+            });
     }
 
     void OnSinkingEnd(ShipId shipId) override
     {
-        for (auto sink : mLifecycleSinks)
-        {
-            sink->OnSinkingEnd(shipId);
-        }
+        DispatchToSinks(
+            mLifecycleSinks,
+            [shipId](auto * sink)
+            {
+                sink->OnSinkingEnd(shipId);
+            });
     }
 
     void OnShipRepaired(ShipId shipId) override
     {
-        for (auto sink : mLifecycleSinks)
-        {
-            sink->OnShipRepaired(shipId);
-        }
+        DispatchToSinks(
+            mLifecycleSinks,
+            [shipId](auto * sink)
+            {
+                sink->OnShipRepaired(shipId);
+            });
     }
 
     //
@@ -117,7 +126,9 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mStressEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.StressEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
     }
 
     void OnBreak(
@@ -125,28 +136,36 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mBreakEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.BreakEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
     }
 
     void OnLampBroken(
         bool isUnderwater,
         unsigned int size) override
     {
-        mLampBrokenEvents[std::make_tuple(isUnderwater)] += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.LampBrokenEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     void OnLampExploded(
         bool isUnderwater,
         unsigned int size) override
     {
-        mLampExplodedEvents[std::make_tuple(isUnderwater)] += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.LampExplodedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     void OnLampImploded(
         bool isUnderwater,
         unsigned int size) override
     {
-        mLampImplodedEvents[std::make_tuple(isUnderwater)] += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.LampImplodedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     //
@@ -155,18 +174,22 @@ public:
 
     void OnTsunami(float x) override
     {
-        for (auto sink : mWavePhenomenaSinks)
-        {
-            sink->OnTsunami(x);
-        }
+        DispatchToSinks(
+            mWavePhenomenaSinks,
+            [x](auto * sink)
+            {
+                sink->OnTsunami(x);
+            });
     }
 
     void OnTsunamiNotification(float x) override
     {
-        for (auto sink : mWavePhenomenaSinks)
-        {
-            sink->OnTsunamiNotification(x);
-        }
+        DispatchToSinks(
+            mWavePhenomenaSinks,
+            [x](auto * sink)
+            {
+                sink->OnTsunamiNotification(x);
+            });
     }
 
     //
@@ -175,33 +198,41 @@ public:
 
     void OnPointCombustionBegin() override
     {
-        for (auto sink : mCombustionSinks)
-        {
-            sink->OnPointCombustionBegin();
-        }
+        DispatchToSinks(
+            mCombustionSinks,
+            [](auto * sink)
+            {
+                sink->OnPointCombustionBegin();
+            });
     }
 
     void OnPointCombustionEnd() override
     {
-        for (auto sink : mCombustionSinks)
-        {
-            sink->OnPointCombustionEnd();
-        }
+        DispatchToSinks(
+            mCombustionSinks,
+            [](auto * sink)
+            {
+                sink->OnPointCombustionEnd();
+            });
     }
 
     void OnCombustionSmothered() override
     {
-        for (auto sink : mCombustionSinks)
-        {
-            sink->OnCombustionSmothered();
-        }
+        DispatchToSinks(
+            mCombustionSinks,
+            [](auto * sink)
+            {
+                sink->OnCombustionSmothered();
+            });
     }
 
     void OnCombustionExplosion(
         bool isUnderwater,
         unsigned int size) override
     {
-        mCombustionExplosionEvents[std::make_tuple(isUnderwater)] += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.CombustionExplosionEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     //
@@ -212,32 +243,38 @@ public:
         float immediateFps,
         float averageFps) override
     {
-        for (auto sink : mStatisticsSinks)
-        {
-            sink->OnFrameRateUpdated(
-                immediateFps,
-                averageFps);
-        }
+        DispatchToSinks(
+            mStatisticsSinks,
+            [immediateFps, averageFps](auto * sink)
+            {
+                sink->OnFrameRateUpdated(
+                    immediateFps,
+                    averageFps);
+            });
     }
 
     void OnCurrentUpdateDurationUpdated(float currentUpdateDuration) override
     {
-        for (auto sink : mStatisticsSinks)
-        {
-            sink->OnCurrentUpdateDurationUpdated(currentUpdateDuration);
-        }
+        DispatchToSinks(
+            mStatisticsSinks,
+            [currentUpdateDuration](auto * sink)
+            {
+                sink->OnCurrentUpdateDurationUpdated(currentUpdateDuration);
+            });
     }
 
     void OnStaticPressureUpdated(
         float netForce,
         float complexity) override
     {
-        for (auto sink : mStatisticsSinks)
-        {
-            sink->OnStaticPressureUpdated(
-                netForce,
-                complexity);
-        }
+        DispatchToSinks(
+            mStatisticsSinks,
+            [netForce, complexity](auto * sink)
+            {
+                sink->OnStaticPressureUpdated(
+                    netForce,
+                    complexity);
+            });
     }
 
     //
@@ -246,18 +283,22 @@ public:
 
     void OnStormBegin() override
     {
-        for (auto sink : mAtmosphereSinks)
-        {
-            sink->OnStormBegin();
-        }
+        DispatchToSinks(
+            mAtmosphereSinks,
+            [](auto * sink)
+            {
+                sink->OnStormBegin();
+            });
     }
 
     void OnStormEnd() override
     {
-        for (auto sink : mAtmosphereSinks)
-        {
-            sink->OnStormEnd();
-        }
+        DispatchToSinks(
+            mAtmosphereSinks,
+            [](auto * sink)
+            {
+                sink->OnStormEnd();
+            });
     }
 
     void OnWindSpeedUpdated(
@@ -268,45 +309,55 @@ public:
         float const maxSpeedMagnitude,
         vec2f const & windSpeed) override
     {
-        for (auto sink : mAtmosphereSinks)
-        {
-            sink->OnWindSpeedUpdated(
-                zeroSpeedMagnitude,
-                baseSpeedMagnitude,
-                baseAndStormSpeedMagnitude,
-                preMaxSpeedMagnitude,
-                maxSpeedMagnitude,
-                windSpeed);
-        }
+        DispatchToSinks(
+            mAtmosphereSinks,
+            [zeroSpeedMagnitude, baseSpeedMagnitude, baseAndStormSpeedMagnitude, preMaxSpeedMagnitude, maxSpeedMagnitude, windSpeed](auto * sink)
+            {
+                sink->OnWindSpeedUpdated(
+                    zeroSpeedMagnitude,
+                    baseSpeedMagnitude,
+                    baseAndStormSpeedMagnitude,
+                    preMaxSpeedMagnitude,
+                    maxSpeedMagnitude,
+                    windSpeed);
+            });
     }
 
     void OnRainUpdated(float const density) override
     {
-        for (auto sink : mAtmosphereSinks)
-        {
-            sink->OnRainUpdated(density);
-        }
+        DispatchToSinks(
+            mAtmosphereSinks,
+            [density](auto * sink)
+            {
+                sink->OnRainUpdated(density);
+            });
     }
 
     void OnThunder() override
     {
-        for (auto sink : mAtmosphereSinks)
-        {
-            sink->OnThunder();
-        }
+        DispatchToSinks(
+            mAtmosphereSinks,
+            [](auto * sink)
+            {
+                sink->OnThunder();
+            });
     }
 
     void OnLightning() override
     {
-        for (auto sink : mAtmosphereSinks)
-        {
-            sink->OnLightning();
-        }
+        DispatchToSinks(
+            mAtmosphereSinks,
+            [](auto * sink)
+            {
+                sink->OnLightning();
+            });
     }
 
     void OnLightningHit(StructuralMaterial const & structuralMaterial) override
     {
-        mLightningHitEvents[std::make_tuple(&structuralMaterial)] += 1;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.LightningHitEvents[std::make_tuple(&structuralMaterial)] += 1;
     }
 
     //
@@ -318,15 +369,19 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mLightFlickerEvents[std::make_tuple(duration, isUnderwater)] += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.LightFlickerEvents[std::make_tuple(duration, isUnderwater)] += size;
     }
 
     void OnElectricalElementAnnouncementsBegin() override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnElectricalElementAnnouncementsBegin();
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [](auto * sink)
+            {
+                sink->OnElectricalElementAnnouncementsBegin();
+            });
     }
 
     void OnSwitchCreated(
@@ -339,10 +394,12 @@ public:
     {
         LogMessage("OnSwitchCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), "): State=", static_cast<bool>(state));
 
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnSwitchCreated(electricalElementId, instanceIndex, type, state, electricalMaterial, panelElementMetadata);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, instanceIndex, type, state, &electricalMaterial, panelElementMetadata](auto * sink)
+            {
+                sink->OnSwitchCreated(electricalElementId, instanceIndex, type, state, electricalMaterial, panelElementMetadata);
+            });
     }
 
     void OnPowerProbeCreated(
@@ -355,10 +412,12 @@ public:
     {
         LogMessage("OnPowerProbeCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), "): State=", static_cast<bool>(state));
 
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnPowerProbeCreated(electricalElementId, instanceIndex, type, state, electricalMaterial, panelElementMetadata);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, instanceIndex, type, state, &electricalMaterial, panelElementMetadata](auto * sink)
+            {
+                sink->OnPowerProbeCreated(electricalElementId, instanceIndex, type, state, electricalMaterial, panelElementMetadata);
+            });
     }
 
     void OnEngineControllerCreated(
@@ -369,10 +428,12 @@ public:
     {
         LogMessage("OnEngineControllerCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), ")");
 
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnEngineControllerCreated(electricalElementId, instanceIndex, electricalMaterial, panelElementMetadata);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, instanceIndex, &electricalMaterial, panelElementMetadata](auto * sink)
+            {
+                sink->OnEngineControllerCreated(electricalElementId, instanceIndex, electricalMaterial, panelElementMetadata);
+            });
     }
 
     void OnEngineMonitorCreated(
@@ -385,10 +446,12 @@ public:
     {
         LogMessage("OnEngineMonitorCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), "): Thrust=", thrustMagnitude, " RPM=", rpm);
 
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnEngineMonitorCreated(electricalElementId, instanceIndex, thrustMagnitude, rpm, electricalMaterial, panelElementMetadata);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, instanceIndex, thrustMagnitude, rpm, &electricalMaterial, panelElementMetadata](auto * sink)
+            {
+                sink->OnEngineMonitorCreated(electricalElementId, instanceIndex, thrustMagnitude, rpm, electricalMaterial, panelElementMetadata);
+            });
     }
 
     void OnWaterPumpCreated(
@@ -400,10 +463,12 @@ public:
     {
         LogMessage("OnWaterPumpCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), ")");
 
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnWaterPumpCreated(electricalElementId, instanceIndex, normalizedForce, electricalMaterial, panelElementMetadata);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, instanceIndex, normalizedForce, &electricalMaterial, panelElementMetadata](auto * sink)
+            {
+                sink->OnWaterPumpCreated(electricalElementId, instanceIndex, normalizedForce, electricalMaterial, panelElementMetadata);
+            });
     }
 
     void OnWatertightDoorCreated(
@@ -415,58 +480,70 @@ public:
     {
         LogMessage("OnWatertightDoorCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), ")");
 
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnWatertightDoorCreated(electricalElementId, instanceIndex, isOpen, electricalMaterial, panelElementMetadata);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, instanceIndex, isOpen, &electricalMaterial, panelElementMetadata](auto * sink)
+            {
+                sink->OnWatertightDoorCreated(electricalElementId, instanceIndex, isOpen, electricalMaterial, panelElementMetadata);
+            });
     }
 
     void OnElectricalElementAnnouncementsEnd() override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnElectricalElementAnnouncementsEnd();
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [](auto * sink)
+            {
+                sink->OnElectricalElementAnnouncementsEnd();
+            });
     }
 
     void OnSwitchEnabled(
         ElectricalElementId electricalElementId,
         bool isEnabled) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnSwitchEnabled(electricalElementId, isEnabled);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, isEnabled](auto * sink)
+            {
+                sink->OnSwitchEnabled(electricalElementId, isEnabled);
+            });
     }
 
     void OnSwitchToggled(
         ElectricalElementId electricalElementId,
         ElectricalState newState) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnSwitchToggled(electricalElementId, newState);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, newState](auto * sink)
+            {
+                sink->OnSwitchToggled(electricalElementId, newState);
+            });
     }
 
     void OnPowerProbeToggled(
         ElectricalElementId electricalElementId,
         ElectricalState newState) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnPowerProbeToggled(electricalElementId, newState);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, newState](auto * sink)
+            {
+                sink->OnPowerProbeToggled(electricalElementId, newState);
+            });
     }
 
     void OnEngineControllerEnabled(
         ElectricalElementId electricalElementId,
         bool isEnabled) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnEngineControllerEnabled(electricalElementId, isEnabled);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, isEnabled](auto * sink)
+            {
+                sink->OnEngineControllerEnabled(electricalElementId, isEnabled);
+            });
     }
 
     void OnEngineControllerUpdated(
@@ -475,10 +552,12 @@ public:
         float oldControllerValue,
         float newControllerValue) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnEngineControllerUpdated(electricalElementId, electricalMaterial, oldControllerValue, newControllerValue);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, &electricalMaterial, oldControllerValue, newControllerValue](auto * sink)
+            {
+                sink->OnEngineControllerUpdated(electricalElementId, electricalMaterial, oldControllerValue, newControllerValue);
+            });
     }
 
     void OnEngineMonitorUpdated(
@@ -486,10 +565,12 @@ public:
         float thrustMagnitude,
         float rpm) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnEngineMonitorUpdated(electricalElementId, thrustMagnitude, rpm);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, thrustMagnitude, rpm](auto * sink)
+            {
+                sink->OnEngineMonitorUpdated(electricalElementId, thrustMagnitude, rpm);
+            });
     }
 
     void OnShipSoundUpdated(
@@ -498,50 +579,60 @@ public:
         bool isPlaying,
         bool isUnderwater) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnShipSoundUpdated(electricalElementId, electricalMaterial, isPlaying, isUnderwater);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, &electricalMaterial, isPlaying, isUnderwater](auto * sink)
+            {
+                sink->OnShipSoundUpdated(electricalElementId, electricalMaterial, isPlaying, isUnderwater);
+            });
     }
 
     void OnWaterPumpEnabled(
         ElectricalElementId electricalElementId,
         bool isEnabled) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnWaterPumpEnabled(electricalElementId, isEnabled);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, isEnabled](auto * sink)
+            {
+                sink->OnWaterPumpEnabled(electricalElementId, isEnabled);
+            });
     }
 
     void OnWaterPumpUpdated(
         ElectricalElementId electricalElementId,
         float normalizedForce) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnWaterPumpUpdated(electricalElementId, normalizedForce);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, normalizedForce](auto * sink)
+            {
+                sink->OnWaterPumpUpdated(electricalElementId, normalizedForce);
+            });
     }
 
     void OnWatertightDoorEnabled(
         ElectricalElementId electricalElementId,
         bool isEnabled) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnWatertightDoorEnabled(electricalElementId, isEnabled);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, isEnabled](auto * sink)
+            {
+                sink->OnWatertightDoorEnabled(electricalElementId, isEnabled);
+            });
     }
 
     void OnWatertightDoorUpdated(
         ElectricalElementId electricalElementId,
         bool isOpen) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnWatertightDoorUpdated(electricalElementId, isOpen);
-        }
+        DispatchToSinks(
+            mElectricalElementSinks,
+            [electricalElementId, isOpen](auto * sink)
+            {
+                sink->OnWatertightDoorUpdated(electricalElementId, isOpen);
+            });
     }
 
     //
@@ -553,10 +644,12 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnDestroy(structuralMaterial, isUnderwater, size);
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [&structuralMaterial, isUnderwater, size](auto * sink)
+            {
+                sink->OnDestroy(structuralMaterial, isUnderwater, size);
+            });
     }
 
     void OnSpringRepaired(
@@ -564,7 +657,9 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mSpringRepairedEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.SpringRepairedEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
     }
 
     void OnTriangleRepaired(
@@ -572,94 +667,118 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mTriangleRepairedEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.TriangleRepairedEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
     }
 
     void OnSawed(
         bool isMetal,
         unsigned int size) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnSawed(isMetal, size);
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [isMetal, size](auto * sink)
+            {
+                sink->OnSawed(isMetal, size);
+            });
     }
 
     virtual void OnLaserCut(unsigned int size) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnLaserCut(size);
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [size](auto * sink)
+            {
+                sink->OnLaserCut(size);
+            });
     }
 
     void OnPinToggled(
         bool isPinned,
         bool isUnderwater) override
     {
-        mPinToggledEvents.emplace(isPinned, isUnderwater);
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.PinToggledEvents.emplace(isPinned, isUnderwater);
     }
 
     void OnWaterTaken(float waterTaken) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnWaterTaken(waterTaken);
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [waterTaken](auto * sink)
+            {
+                sink->OnWaterTaken(waterTaken);
+            });
     }
 
     void OnWaterSplashed(float waterSplashed) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnWaterSplashed(waterSplashed);
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [waterSplashed](auto * sink)
+            {
+                sink->OnWaterSplashed(waterSplashed);
+            });
     }
 
     void OnWaterDisplaced(float waterDisplacedMagnitude) override
     {
-        mWaterDisplacedEvents += waterDisplacedMagnitude;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.WaterDisplacedEvents += waterDisplacedMagnitude;
     }
 
     void OnAirBubbleSurfaced(unsigned int size) override
     {
-        mAirBubbleSurfacedEvents += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.AirBubbleSurfacedEvents += size;
     }
 
     void OnWaterReaction(
         bool isUnderwater,
         unsigned int size) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnWaterReaction(isUnderwater, size);
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [isUnderwater, size](auto * sink)
+            {
+                sink->OnWaterReaction(isUnderwater, size);
+            });
     }
 
     void OnWaterReactionExplosion(
         bool isUnderwater,
         unsigned int size) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnWaterReactionExplosion(isUnderwater, size);
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [isUnderwater, size](auto * sink)
+            {
+                sink->OnWaterReactionExplosion(isUnderwater, size);
+            });
     }
 
     void OnSilenceStarted() override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnSilenceStarted();
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [](auto * sink)
+            {
+                sink->OnSilenceStarted();
+            });
     }
 
     void OnSilenceLifted() override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnSilenceLifted();
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [](auto * sink)
+            {
+                sink->OnSilenceLifted();
+            });
     }
 
     void OnPhysicsProbeReading(
@@ -668,26 +787,30 @@ public:
         float depth,
         float pressure) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnPhysicsProbeReading(
-                velocity,
-                temperature,
-                depth,
-                pressure);
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [velocity, temperature, depth, pressure](auto * sink)
+            {
+                sink->OnPhysicsProbeReading(
+                    velocity,
+                    temperature,
+                    depth,
+                    pressure);
+            });
     }
 
     void OnCustomProbe(
         std::string const & name,
         float value) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnCustomProbe(
-                name,
-                value);
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [name, value](auto * sink)
+            {
+                sink->OnCustomProbe(
+                    name,
+                    value);
+            });
     }
 
     void OnGadgetPlaced(
@@ -695,13 +818,15 @@ public:
         GadgetType gadgetType,
         bool isUnderwater) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnGadgetPlaced(
-                gadgetId,
-                gadgetType,
-                isUnderwater);
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [gadgetId, gadgetType, isUnderwater](auto * sink)
+            {
+                sink->OnGadgetPlaced(
+                    gadgetId,
+                    gadgetType,
+                    isUnderwater);
+            });
     }
 
     void OnGadgetRemoved(
@@ -709,13 +834,15 @@ public:
         GadgetType gadgetType,
         std::optional<bool> isUnderwater) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnGadgetRemoved(
-                gadgetId,
-                gadgetType,
-                isUnderwater);
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [gadgetId, gadgetType, isUnderwater](auto * sink)
+            {
+                sink->OnGadgetRemoved(
+                    gadgetId,
+                    gadgetType,
+                    isUnderwater);
+            });
     }
 
     void OnBombExplosion(
@@ -723,302 +850,383 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mBombExplosionEvents[std::make_tuple(gadgetType, isUnderwater)] += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.BombExplosionEvents[std::make_tuple(gadgetType, isUnderwater)] += size;
     }
 
     void OnRCBombPing(
         bool isUnderwater,
         unsigned int size) override
     {
-        mRCBombPingEvents[std::make_tuple(isUnderwater)] += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.RCBombPingEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     void OnTimerBombFuse(
         GadgetId gadgetId,
         std::optional<bool> isFast) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnTimerBombFuse(
-                gadgetId,
-                isFast);
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [gadgetId, isFast](auto * sink)
+            {
+                sink->OnTimerBombFuse(
+                    gadgetId,
+                    isFast);
+            });
     }
 
     void OnTimerBombDefused(
         bool isUnderwater,
         unsigned int size) override
     {
-        mTimerBombDefusedEvents[std::make_tuple(isUnderwater)] += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.TimerBombDefusedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     void OnAntiMatterBombContained(
         GadgetId gadgetId,
         bool isContained) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnAntiMatterBombContained(
-                gadgetId,
-                isContained);
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [gadgetId, isContained](auto * sink)
+            {
+                sink->OnAntiMatterBombContained(
+                    gadgetId,
+                    isContained);
+            });
     }
 
     void OnAntiMatterBombPreImploding() override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnAntiMatterBombPreImploding();
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [](auto * sink)
+            {
+                sink->OnAntiMatterBombPreImploding();
+            });
     }
 
     void OnAntiMatterBombImploding() override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnAntiMatterBombImploding();
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [](auto * sink)
+            {
+                sink->OnAntiMatterBombImploding();
+            });
     }
 
     void OnWatertightDoorOpened(
         bool isUnderwater,
         unsigned int size) override
     {
-        mWatertightDoorOpenedEvents[std::make_tuple(isUnderwater)] += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.WatertightDoorOpenedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     void OnWatertightDoorClosed(
         bool isUnderwater,
         unsigned int size) override
     {
-        mWatertightDoorClosedEvents[std::make_tuple(isUnderwater)] += size;
+        std::scoped_lock const lock(mMutex);
+
+        mAggregatedEvents.WatertightDoorClosedEvents[std::make_tuple(isUnderwater)] += size;
     }
 
     void OnFishCountUpdated(size_t count) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnFishCountUpdated(count);
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [count](auto * sink)
+            {
+                sink->OnFishCountUpdated(count);
+            });
     }
 
     void OnPhysicsProbePanelOpened() override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnPhysicsProbePanelOpened();
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [](auto * sink)
+            {
+                sink->OnPhysicsProbePanelOpened();
+            });
     }
 
     void OnPhysicsProbePanelClosed() override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnPhysicsProbePanelClosed();
-        }
+        DispatchToSinks(
+            mGenericSinks,
+            [](auto * sink)
+            {
+                sink->OnPhysicsProbePanelClosed();
+            });
     }
 
 public:
 
     /*
-     * Flushes all events aggregated so far and clears the state.
+     * Publishes all events deferred and aggregated so far, and clears the state.
+     *
+     * Must be invoked on the thread that created the dispatcher. Sinks are
+     * invoked without holding the lock, hence they may fire events while
+     * being notified.
      */
     void Flush()
     {
+        assert(std::this_thread::get_id() == mOwnerThreadId);
+
+        std::vector<std::function<void()>> deferredEvents;
+        AggregatedEvents aggregatedEvents;
+
+        {
+            std::scoped_lock const lock(mMutex);
+
+            std::swap(deferredEvents, mDeferredEvents);
+            std::swap(aggregatedEvents, mAggregatedEvents);
+        }
+
+        //
+        // Publish deferred events, in the order in which they were fired
+        //
+
+        for (auto const & deferredEvent : deferredEvents)
+        {
+            deferredEvent();
+        }
+
         //
         // Publish aggregations
         //
 
         for (auto * sink : mStructuralSinks)
         {
-            for (auto const & entry : mStressEvents)
+            for (auto const & entry : aggregatedEvents.StressEvents)
             {
                 sink->OnStress(*(std::get<0>(entry.first)), std::get<1>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mBreakEvents)
+            for (auto const & entry : aggregatedEvents.BreakEvents)
             {
                 sink->OnBreak(*(std::get<0>(entry.first)), std::get<1>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mLampBrokenEvents)
+            for (auto const & entry : aggregatedEvents.LampBrokenEvents)
             {
                 sink->OnLampBroken(std::get<0>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mLampExplodedEvents)
+            for (auto const & entry : aggregatedEvents.LampExplodedEvents)
             {
                 sink->OnLampExploded(std::get<0>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mLampImplodedEvents)
+            for (auto const & entry : aggregatedEvents.LampImplodedEvents)
             {
                 sink->OnLampImploded(std::get<0>(entry.first), entry.second);
             }
         }
 
-        mStressEvents.clear();
-        mBreakEvents.clear();
-        mLampBrokenEvents.clear();
-        mLampExplodedEvents.clear();
-        mLampImplodedEvents.clear();
-
         for (auto * sink : mCombustionSinks)
         {
-            for (auto const & entry : mCombustionExplosionEvents)
+            for (auto const & entry : aggregatedEvents.CombustionExplosionEvents)
             {
                 sink->OnCombustionExplosion(std::get<0>(entry.first), entry.second);
             }
         }
 
-        mCombustionExplosionEvents.clear();
-
         for (auto * sink : mAtmosphereSinks)
         {
-            for (auto const & entry : mLightningHitEvents)
+            for (auto const & entry : aggregatedEvents.LightningHitEvents)
             {
                 sink->OnLightningHit(*(std::get<0>(entry.first)));
             }
         }
 
-        mLightningHitEvents.clear();
-
         for (auto * sink : mElectricalElementSinks)
         {
-            for (auto const & entry : mLightFlickerEvents)
+            for (auto const & entry : aggregatedEvents.LightFlickerEvents)
             {
                 sink->OnLightFlicker(std::get<0>(entry.first), std::get<1>(entry.first), entry.second);
             }
         }
 
-        mLightFlickerEvents.clear();
-
         for (auto * sink : mGenericSinks)
         {
-            for (auto const & entry : mSpringRepairedEvents)
+            for (auto const & entry : aggregatedEvents.SpringRepairedEvents)
             {
                 sink->OnSpringRepaired(*(std::get<0>(entry.first)), std::get<1>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mTriangleRepairedEvents)
+            for (auto const & entry : aggregatedEvents.TriangleRepairedEvents)
             {
                 sink->OnTriangleRepaired(*(std::get<0>(entry.first)), std::get<1>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mPinToggledEvents)
+            for (auto const & entry : aggregatedEvents.PinToggledEvents)
             {
                 sink->OnPinToggled(std::get<0>(entry), std::get<1>(entry));
             }
 
-            if (mWaterDisplacedEvents != 0.0f)
+            if (aggregatedEvents.WaterDisplacedEvents != 0.0f)
             {
-                sink->OnWaterDisplaced(mWaterDisplacedEvents);
+                sink->OnWaterDisplaced(aggregatedEvents.WaterDisplacedEvents);
             }
 
-            if (mAirBubbleSurfacedEvents > 0)
+            if (aggregatedEvents.AirBubbleSurfacedEvents > 0)
             {
-                sink->OnAirBubbleSurfaced(mAirBubbleSurfacedEvents);
+                sink->OnAirBubbleSurfaced(aggregatedEvents.AirBubbleSurfacedEvents);
             }
 
-            for (auto const & entry : mBombExplosionEvents)
+            for (auto const & entry : aggregatedEvents.BombExplosionEvents)
             {
                 sink->OnBombExplosion(std::get<0>(entry.first), std::get<1>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mRCBombPingEvents)
+            for (auto const & entry : aggregatedEvents.RCBombPingEvents)
             {
                 sink->OnRCBombPing(std::get<0>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mTimerBombDefusedEvents)
+            for (auto const & entry : aggregatedEvents.TimerBombDefusedEvents)
             {
                 sink->OnTimerBombDefused(std::get<0>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mWatertightDoorOpenedEvents)
+            for (auto const & entry : aggregatedEvents.WatertightDoorOpenedEvents)
             {
                 sink->OnWatertightDoorOpened(std::get<0>(entry.first), entry.second);
             }
 
-            for (auto const & entry : mWatertightDoorClosedEvents)
+            for (auto const & entry : aggregatedEvents.WatertightDoorClosedEvents)
             {
                 sink->OnWatertightDoorClosed(std::get<0>(entry.first), entry.second);
             }
         }
 
-        mSpringRepairedEvents.clear();
-        mTriangleRepairedEvents.clear();
-        mPinToggledEvents.clear();
-        mWaterDisplacedEvents = 0.0f;
-        mAirBubbleSurfacedEvents = 0u;
-        mBombExplosionEvents.clear();
-        mRCBombPingEvents.clear();
-        mTimerBombDefusedEvents.clear();
-        mWatertightDoorOpenedEvents.clear();
-        mWatertightDoorClosedEvents.clear();
     }
 
     void RegisterLifecycleEventHandler(ILifecycleGameEventHandler * sink)
     {
+        std::scoped_lock const lock(mMutex);
+
         mLifecycleSinks.push_back(sink);
     }
 
     void RegisterStructuralEventHandler(IStructuralGameEventHandler * sink)
     {
+        std::scoped_lock const lock(mMutex);
+
         mStructuralSinks.push_back(sink);
     }
 
     void RegisterWavePhenomenaEventHandler(IWavePhenomenaGameEventHandler * sink)
     {
+        std::scoped_lock const lock(mMutex);
+
         mWavePhenomenaSinks.push_back(sink);
     }
 
     void RegisterCombustionEventHandler(ICombustionGameEventHandler * sink)
     {
+        std::scoped_lock const lock(mMutex);
+
         mCombustionSinks.push_back(sink);
     }
 
     void RegisterStatisticsEventHandler(IStatisticsGameEventHandler * sink)
     {
+        std::scoped_lock const lock(mMutex);
+
         mStatisticsSinks.push_back(sink);
     }
 
     void RegisterAtmosphereEventHandler(IAtmosphereGameEventHandler * sink)
     {
+        std::scoped_lock const lock(mMutex);
+
         mAtmosphereSinks.push_back(sink);
     }
 
     void RegisterElectricalElementEventHandler(IElectricalElementGameEventHandler * sink)
     {
+        std::scoped_lock const lock(mMutex);
+
         mElectricalElementSinks.push_back(sink);
     }
 
     void RegisterGenericEventHandler(IGenericGameEventHandler * sink)
     {
+        std::scoped_lock const lock(mMutex);
+
         mGenericSinks.push_back(sink);
     }
 
+private:
+
+    template<typename TSink, typename TAction>
+    void DispatchToSinks(
+        std::vector<TSink *> const & sinks,
+        TAction && action)
+    {
+        if (std::this_thread::get_id() == mOwnerThreadId)
+        {
+            for (auto * sink : sinks)
+            {
+                action(sink);
+            }
+        }
+        else
+        {
+            // Sinks are not thread-safe: defer to the owner thread
+            std::scoped_lock const lock(mMutex);
+
+            mDeferredEvents.emplace_back(
+                [&sinks, action = std::forward<TAction>(action)]()
+                {
+                    for (auto * sink : sinks)
+                    {
+                        action(sink);
+                    }
+                });
+        }
+    }
+
 private:
 
     // The current events being aggregated
-    unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> mStressEvents;
-    unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> mBreakEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mLampBrokenEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mLampExplodedEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mLampImplodedEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mCombustionExplosionEvents;
-    unordered_tuple_map<std::tuple<StructuralMaterial const *>, unsigned int> mLightningHitEvents;
-    unordered_tuple_map<std::tuple<DurationShortLongType, bool>, unsigned int> mLightFlickerEvents;
-    unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> mSpringRepairedEvents;
-    unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> mTriangleRepairedEvents;
-    unordered_tuple_set<std::tuple<bool, bool>> mPinToggledEvents;
-    float mWaterDisplacedEvents;
-    unsigned int mAirBubbleSurfacedEvents;
-    unordered_tuple_map<std::tuple<GadgetType, bool>, unsigned int> mBombExplosionEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mRCBombPingEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mTimerBombDefusedEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mWatertightDoorOpenedEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mWatertightDoorClosedEvents;
+    struct AggregatedEvents
+    {
+        unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> StressEvents;
+        unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> BreakEvents;
+        unordered_tuple_map<std::tuple<bool>, unsigned int> LampBrokenEvents;
+        unordered_tuple_map<std::tuple<bool>, unsigned int> LampExplodedEvents;
+        unordered_tuple_map<std::tuple<bool>, unsigned int> LampImplodedEvents;
+        unordered_tuple_map<std::tuple<bool>, unsigned int> CombustionExplosionEvents;
+        unordered_tuple_map<std::tuple<StructuralMaterial const *>, unsigned int> LightningHitEvents;
+        unordered_tuple_map<std::tuple<DurationShortLongType, bool>, unsigned int> LightFlickerEvents;
+        unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> SpringRepairedEvents;
+        unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> TriangleRepairedEvents;
+        unordered_tuple_set<std::tuple<bool, bool>> PinToggledEvents;
+        float WaterDisplacedEvents{ 0.0f };
+        unsigned int AirBubbleSurfacedEvents{ 0u };
+        unordered_tuple_map<std::tuple<GadgetType, bool>, unsigned int> BombExplosionEvents;
+        unordered_tuple_map<std::tuple<bool>, unsigned int> RCBombPingEvents;
+        unordered_tuple_map<std::tuple<bool>, unsigned int> TimerBombDefusedEvents;
+        unordered_tuple_map<std::tuple<bool>, unsigned int> WatertightDoorOpenedEvents;
+        unordered_tuple_map<std::tuple<bool>, unsigned int> WatertightDoorClosedEvents;
+    };
+
+    AggregatedEvents mAggregatedEvents;
+
+    // The non-aggregated events fired on other threads, waiting for the next Flush()
+    std::vector<std::function<void()>> mDeferredEvents;
 
     // The registered sinks
     std::vector<ILifecycleGameEventHandler *> mLifecycleSinks;
@@ -1029,4 +1237,10 @@ private:
     std::vector<IAtmosphereGameEventHandler *> mAtmosphereSinks;
     std::vector<IElectricalElementGameEventHandler *> mElectricalElementSinks;
     std::vector<IGenericGameEventHandler *> mGenericSinks;
+
+    // The thread that publishes events to sinks
+    std::thread::id const mOwnerThreadId;
+
+    // Guards aggregations and deferred events; never held while invoking sinks
+    std::mutex mMutex;
 };
@@ -94,6 +94,10 @@ GameParameters::GameParameters()
     , NumberOfClouds(24)
     , DoDayLightCycle(false)
     , DayLightCycleDuration(std::chrono::minutes(4))
+    , DoUpdateShipsConcurrently(false)
+    , DoUpdateOceanSurfaceConcurrently(false)
+    , DoColorSpringsForParallelism(false)
+    , DoRunDeterministically(false)
     // Interactions
     , ToolSearchRadius(2.0f)
     , DestroyRadius(0.5f)
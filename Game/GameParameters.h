@@ -473,6 +473,29 @@ struct GameParameters
     static std::chrono::minutes constexpr MinDayLightCycleDuration = std::chrono::minutes(1);
     static std::chrono::minutes constexpr MaxDayLightCycleDuration = std::chrono::minutes(60);
 
+    // When set, ships are updated concurrently with each other, each one
+    // using a share of the simulation threads
+    bool DoUpdateShipsConcurrently;
+
+    // When set, the ocean surface is updated concurrently with ships, on a thread of
+    // its own; ships then see the ocean surface as of the previous simulation step
+    bool DoUpdateOceanSurfaceConcurrently;
+
+    // When set, ship springs are re-ordered at load time into "colors" whose springs
+    // share no endpoints, so that spring forces may be calculated concurrently without
+    // per-thread force buffers
+    bool DoColorSpringsForParallelism;
+
+    // When set, the simulation produces bit-identical results from run to run, regardless
+    // of the number of simulation threads: work is partitioned as if there were
+    // DeterministicSimulationParallelism threads, ships and their update phases are run
+    // one after the other, and the ocean surface is updated together with ships.
+    // Requires the game wall clock to be simulated (GameWallClock::SetSimulated()) before
+    // the world is created, or else time-driven effects follow the real clock; the world
+    // refuses to be created or updated with this flag set otherwise
+    bool DoRunDeterministically;
+    static size_t constexpr DeterministicSimulationParallelism = 8;
+
     // Interactions
 
     float ToolSearchRadius;
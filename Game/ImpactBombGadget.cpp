@@ -134,54 +134,4 @@ bool ImpactBombGadget::Update(
     }
 }
 
-void ImpactBombGadget::Upload(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
-
-    switch (mState)
-    {
-        case State::Idle:
-        case State::TriggeringExplosion:
-        {
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::ImpactBomb, 0),
-                GetPosition(),
-                1.0,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            break;
-        }
-
-        case State::Exploding:
-        {
-            // Calculate current progress
-            float const progress =
-                static_cast<float>(mExplosionFadeoutCounter + 1)
-                / static_cast<float>(ExplosionFadeoutStepsCount);
-
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                mExplosionPlaneId,
-                TextureFrameId(Render::GenericMipMappedTextureGroups::ImpactBomb, 0),
-                mExplosionPosition,
-                1.0f, // Scale
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f - progress);  // Alpha
-
-            break;
-        }
-
-        case State::Expired:
-        {
-            // No drawing
-            break;
-        }
-    }
-}
-
 }
\ No newline at end of file
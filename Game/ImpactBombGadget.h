@@ -61,9 +61,9 @@ public:
         }
     }
 
-    virtual void Upload(
+    void Upload(
         ShipId shipId,
-        Render::RenderContext & renderContext) const override;
+        Render::RenderContext & renderContext) const;
 
 private:
 
@@ -0,0 +1,124 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-16
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "Physics.h"
+
+#include <GameCore/GameTypes.h>
+#include <GameCore/SysSpecifics.h>
+
+#include <algorithm>
+
+namespace Physics {
+
+/*
+ * The steps of the internal pressure equalization algorithm.
+ *
+ * Internal pressure flows along springs between non-hull points, from the higher-pressure
+ * endpoint to the lower-pressure one. The flux of each spring is calculated once from the
+ * current pressures, and then each point gathers the fluxes of its springs; as each
+ * flux is subtracted at one endpoint and added at the other, the total internal pressure
+ * of non-hull points is conserved.
+ *
+ * Each spring moves a fraction 1/(1 + max(n_a, n_b)) of its pressure difference, where
+ * n is the number of non-hull neighbors of an endpoint; the fractions at each point hence
+ * add up to less than one, and each new pressure is a weighted average of the old
+ * pressures of the point and of its neighbors.
+ *
+ * Hull points do not take part in the flow; they just take the average internal pressure
+ * of their non-hull neighbors.
+ */
+namespace InternalPressureEqualization {
+
+/*
+ * Step 1: the number of non-hull neighbors of a point.
+ */
+inline float CalculateNonHullNeighborCount(
+    Points::ConnectedSpringsRow const & connectedSprings,
+    bool const * restrict isHullBuffer) noexcept
+{
+    float count = 0.0f;
+    for (auto const & cs : connectedSprings)
+    {
+        if (!isHullBuffer[cs.OtherEndpointIndex])
+        {
+            count += 1.0f;
+        }
+    }
+
+    return count;
+}
+
+/*
+ * Step 2: the internal pressure flowing through a spring, from its lower-index endpoint
+ * towards its higher-index endpoint (negative when flowing the other way).
+ */
+inline float CalculateSpringFlux(
+    ElementIndex endpointAIndex,
+    ElementIndex endpointBIndex,
+    float const * restrict internalPressureBuffer,
+    bool const * restrict isHullBuffer,
+    float const * restrict nonHullNeighborCountBuffer) noexcept
+{
+    if (isHullBuffer[endpointAIndex] || isHullBuffer[endpointBIndex])
+    {
+        return 0.0f;
+    }
+
+    ElementIndex const lowIndex = std::min(endpointAIndex, endpointBIndex);
+    ElementIndex const highIndex = std::max(endpointAIndex, endpointBIndex);
+
+    return (internalPressureBuffer[lowIndex] - internalPressureBuffer[highIndex])
+        / (1.0f + std::max(nonHullNeighborCountBuffer[lowIndex], nonHullNeighborCountBuffer[highIndex]));
+}
+
+/*
+ * Step 3: the new internal pressure of a point.
+ */
+inline float GatherInternalPressure(
+    ElementIndex pointIndex,
+    Points::ConnectedSpringsRow const & connectedSprings,
+    float const * restrict internalPressureBuffer,
+    bool const * restrict isHullBuffer,
+    float const * restrict springFluxBuffer) noexcept
+{
+    if (!isHullBuffer[pointIndex])
+    {
+        float internalPressure = internalPressureBuffer[pointIndex];
+
+        for (auto const & cs : connectedSprings)
+        {
+            if (pointIndex < cs.OtherEndpointIndex)
+                internalPressure -= springFluxBuffer[cs.SpringIndex]; // Outflow
+            else
+                internalPressure += springFluxBuffer[cs.SpringIndex]; // Inflow
+        }
+
+        return internalPressure;
+    }
+    else
+    {
+        float averageInternalPressure = 0.0f;
+        float neighborsCount = 0.0f;
+
+        for (auto const & cs : connectedSprings)
+        {
+            if (!isHullBuffer[cs.OtherEndpointIndex])
+            {
+                averageInternalPressure += internalPressureBuffer[cs.OtherEndpointIndex];
+                neighborsCount += 1.0f;
+            }
+        }
+
+        return (neighborsCount != 0.0f)
+            ? averageInternalPressure / neighborsCount
+            : internalPressureBuffer[pointIndex];
+    }
+}
+
+}
+
+}
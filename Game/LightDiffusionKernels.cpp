@@ -0,0 +1,190 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-17
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "LightDiffusionKernels.h"
+
+#include <GameCore/SysSpecifics.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <optional>
+
+namespace Physics {
+namespace LightDiffusionKernels {
+
+void LampHistory::RememberAll(LightDiffusionInput const & input)
+{
+    Positions.assign(input.LampPositionBuffer, input.LampPositionBuffer + input.LampCount);
+    DistanceCoeffs.assign(input.LampDistanceCoeffBuffer, input.LampDistanceCoeffBuffer + input.LampCount);
+    SpreadMaxDistances.assign(input.LampSpreadMaxDistanceBuffer, input.LampSpreadMaxDistanceBuffer + input.LampCount);
+}
+
+void DetectLampChanges(
+    LightDiffusionInput const & input,
+    LampHistory & lampHistory,
+    std::vector<DirtyRegion> & dirtyRegions)
+{
+    assert(lampHistory.Positions.size() == static_cast<size_t>(input.LampCount));
+
+    for (ElementIndex l = 0; l < input.LampCount; ++l)
+    {
+        vec2f const lampPosition = input.LampPositionBuffer[l];
+        float const distanceCoeff = input.LampDistanceCoeffBuffer[l];
+        float const spreadMaxDistance = input.LampSpreadMaxDistanceBuffer[l];
+
+        float const lastDistanceCoeff = lampHistory.DistanceCoeffs[l];
+        float const lastSpreadMaxDistance = lampHistory.SpreadMaxDistances[l];
+
+        // Max change of the light from this lamp, at any distance
+        float const maxLightChange =
+            std::abs(distanceCoeff * spreadMaxDistance - lastDistanceCoeff * lastSpreadMaxDistance)
+            + std::abs(distanceCoeff - lastDistanceCoeff) * std::max(spreadMaxDistance, lastSpreadMaxDistance);
+
+        bool const hasMoved =
+            (lampPosition - lampHistory.Positions[l]).squareLength()
+            > MaxPositionChange * MaxPositionChange;
+
+        bool const isLit =
+            distanceCoeff * spreadMaxDistance > 0.0f
+            || lastDistanceCoeff * lastSpreadMaxDistance > 0.0f;
+
+        if (isLit && (hasMoved || maxLightChange > MaxLightChange))
+        {
+            float const radius = std::max(spreadMaxDistance, lastSpreadMaxDistance);
+
+            dirtyRegions.emplace_back(lampHistory.Positions[l], radius * radius);
+            if (hasMoved)
+            {
+                dirtyRegions.emplace_back(lampPosition, radius * radius);
+            }
+
+            lampHistory.Positions[l] = lampPosition;
+            lampHistory.DistanceCoeffs[l] = distanceCoeff;
+            lampHistory.SpreadMaxDistances[l] = spreadMaxDistance;
+        }
+    }
+}
+
+ElementCount DetectDirtyPointBatches(
+    LightDiffusionInput const & input,
+    vec2f const * lastPointPositionBuffer,
+    std::vector<DirtyRegion> const & dirtyRegions,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    bool * dirtyBatchBuffer)
+{
+    assert(is_aligned_to_float_element_count(startPointIndex));
+    assert(is_aligned_to_float_element_count(endPointIndex));
+
+    vec2f const * restrict const positionBuffer = input.PointPositionBuffer;
+
+    ElementCount dirtyBatchCount = 0;
+
+    for (ElementIndex batchStart = startPointIndex; batchStart < endPointIndex; batchStart += vectorization_float_count<ElementIndex>)
+    {
+        bool isDirty = false;
+
+        for (ElementIndex p = batchStart; p < batchStart + vectorization_float_count<ElementIndex>; ++p)
+        {
+            vec2f const position = positionBuffer[p];
+
+            isDirty |=
+                (position - lastPointPositionBuffer[p]).squareLength()
+                > MaxPositionChange * MaxPositionChange;
+
+            for (auto const & dirtyRegion : dirtyRegions)
+            {
+                isDirty |= (position - dirtyRegion.Center).squareLength() < dirtyRegion.RadiusSquared;
+            }
+        }
+
+        dirtyBatchBuffer[batchStart / vectorization_float_count<ElementIndex>] = isDirty;
+
+        if (isDirty)
+        {
+            ++dirtyBatchCount;
+        }
+    }
+
+    return dirtyBatchCount;
+}
+
+void DiffuseLightOnPoints(
+    LightDiffusionInput const & input,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    vec2f * lastPointPositionBuffer,
+    float * lightBuffer)
+{
+    if (input.Tiles != nullptr)
+    {
+        Algorithms::DiffuseLight_Tiled(
+            startPointIndex,
+            endPointIndex,
+            input.PointPositionBuffer,
+            input.PointPlaneIdBuffer,
+            *input.Tiles,
+            lightBuffer);
+    }
+    else
+    {
+        Algorithms::DiffuseLight(
+            startPointIndex,
+            endPointIndex,
+            input.PointPositionBuffer,
+            input.PointPlaneIdBuffer,
+            input.LampPositionBuffer,
+            input.LampPlaneIdBuffer,
+            input.LampDistanceCoeffBuffer,
+            input.LampSpreadMaxDistanceBuffer,
+            input.BufferLampCount,
+            lightBuffer);
+    }
+
+    // Remember the positions these points have been diffused at
+    std::copy(
+        input.PointPositionBuffer + startPointIndex,
+        input.PointPositionBuffer + endPointIndex,
+        lastPointPositionBuffer + startPointIndex);
+}
+
+void DiffuseLightOnDirtyPoints(
+    LightDiffusionInput const & input,
+    bool const * dirtyBatchBuffer,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    vec2f * lastPointPositionBuffer,
+    float * lightBuffer)
+{
+    assert(is_aligned_to_float_element_count(startPointIndex));
+    assert(is_aligned_to_float_element_count(endPointIndex));
+
+    std::optional<ElementIndex> dirtyRunStart;
+
+    for (ElementIndex batchStart = startPointIndex; batchStart < endPointIndex; batchStart += vectorization_float_count<ElementIndex>)
+    {
+        if (dirtyBatchBuffer[batchStart / vectorization_float_count<ElementIndex>])
+        {
+            if (!dirtyRunStart.has_value())
+            {
+                dirtyRunStart = batchStart;
+            }
+        }
+        else if (dirtyRunStart.has_value())
+        {
+            DiffuseLightOnPoints(input, *dirtyRunStart, batchStart, lastPointPositionBuffer, lightBuffer);
+            dirtyRunStart.reset();
+        }
+    }
+
+    if (dirtyRunStart.has_value())
+    {
+        DiffuseLightOnPoints(input, *dirtyRunStart, endPointIndex, lastPointPositionBuffer, lightBuffer);
+    }
+}
+
+}
+}
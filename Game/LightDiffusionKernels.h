@@ -0,0 +1,116 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-17
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <GameCore/Algorithms.h>
+#include <GameCore/GameTypes.h>
+#include <GameCore/Vectors.h>
+
+#include <vector>
+
+namespace Physics {
+
+/*
+ * The passes of the incremental light diffusion run by Ship::DiffuseLight(), on plain buffers.
+ *
+ * Light is only re-diffused on the batches of points that have moved, or that are reached by
+ * lamps that have changed, since the last time they have been diffused; changes below the
+ * thresholds below are ignored. All passes only write the state of the points they visit,
+ * hence they may run concurrently on disjoint ranges of points.
+ */
+namespace LightDiffusionKernels {
+
+// Changes below these thresholds since the last time a point has been diffused
+// do not cause the point to be diffused again
+float constexpr MaxPositionChange = 0.01f; // World units
+float constexpr MaxLightChange = 1.0f / 256.0f;
+
+struct LightDiffusionInput
+{
+    vec2f const * PointPositionBuffer;
+    PlaneId const * PointPlaneIdBuffer;
+    vec2f const * LampPositionBuffer;
+    PlaneId const * LampPlaneIdBuffer;
+    float const * LampDistanceCoeffBuffer;
+    float const * LampSpreadMaxDistanceBuffer;
+    ElementCount LampCount;
+    ElementCount BufferLampCount; // Lamp buffers are padded to this count with lamps that produce no light
+    Algorithms::DiffuseLightTiles<vec2f> const * Tiles; // When not null, the lamps binned into tiles covering all points
+};
+
+// The state of the lamps at the last time they have been diffused
+struct LampHistory
+{
+    std::vector<vec2f> Positions;
+    std::vector<float> DistanceCoeffs;
+    std::vector<float> SpreadMaxDistances;
+
+    void RememberAll(LightDiffusionInput const & input);
+};
+
+// An area reached by a lamp that has changed, before or after the change
+struct DirtyRegion
+{
+    vec2f Center;
+    float RadiusSquared;
+
+    DirtyRegion(
+        vec2f const & center,
+        float radiusSquared)
+        : Center(center)
+        , RadiusSquared(radiusSquared)
+    {}
+};
+
+/*
+ * Compares the lamps with their history - which is expected to be of the same lamps - adding
+ * the areas reached by the light of each lamp that has changed, before and after the change,
+ * to the dirty regions, and remembering the new state of those lamps.
+ */
+void DetectLampChanges(
+    LightDiffusionInput const & input,
+    LampHistory & lampHistory,
+    std::vector<DirtyRegion> & dirtyRegions);
+
+/*
+ * Flags the batches of vectorization_float_count points in [startPointIndex, endPointIndex) that
+ * have moved since they have been diffused, or that have a point in a dirty region; returns the
+ * number of dirty batches.
+ */
+ElementCount DetectDirtyPointBatches(
+    LightDiffusionInput const & input,
+    vec2f const * lastPointPositionBuffer,
+    std::vector<DirtyRegion> const & dirtyRegions,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    bool * dirtyBatchBuffer);
+
+/*
+ * Diffuses light on the points in [startPointIndex, endPointIndex), remembering the positions
+ * they have been diffused at.
+ */
+void DiffuseLightOnPoints(
+    LightDiffusionInput const & input,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    vec2f * lastPointPositionBuffer,
+    float * lightBuffer);
+
+/*
+ * Diffuses light on the dirty batches of points in [startPointIndex, endPointIndex), one run
+ * of contiguous dirty batches at a time.
+ */
+void DiffuseLightOnDirtyPoints(
+    LightDiffusionInput const & input,
+    bool const * dirtyBatchBuffer,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    vec2f * lastPointPositionBuffer,
+    float * lightBuffer);
+
+}
+
+}
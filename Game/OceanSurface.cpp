@@ -17,11 +17,6 @@ namespace Physics {
 
 float constexpr MaxInteractiveWaveAbsRelativeHeight = 6.0f;
 
-// The number of slices we want to render the water surface as;
-// this is our graphical resolution
-template<typename T>
-T constexpr RenderSlices = 768;
-
 static std::chrono::seconds constexpr TsunamiGracePeriod(120);
 static std::chrono::seconds constexpr RogueWaveGracePeriod(5);
 
@@ -30,6 +25,7 @@ OceanSurface::OceanSurface(
     std::shared_ptr<GameEventDispatcher> gameEventDispatcher)
     : mParentWorld(parentWorld)
     , mGameEventHandler(std::move(gameEventDispatcher))
+    , mRandomStream(GameRandomEngine::CreateStream(0)) // Ships take the following streams
     ////////
     , mBasalWaveAmplitude1(0.0f)
     , mBasalWaveAmplitude2(0.0f)
@@ -49,13 +45,16 @@ OceanSurface::OceanSurface(
     , mRogueWaveRate(std::chrono::seconds::max())
     ////////
     , mSamples(SamplesCount + 1)
+    , mNextSamples(SamplesCount + 1)
     , mSWEHeightField(SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples)
     , mSWEVelocityField(SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples + 1)
+    , mSWENewVelocityField(SWEBufferAlignmentPrefixSize + SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples + 1)
     , mInteractiveWaveTargetHeight(SamplesCount)
     , mInteractiveWaveCurrentHeightGrowthCoefficient(SamplesCount)
     , mInteractiveWaveTargetHeightGrowthCoefficient(SamplesCount)
     , mInteractiveWaveHeightGrowthCoefficientGrowthRate(SamplesCount)
     , mDeltaHeightBuffer(DeltaHeightBufferSize)
+    , mUpdateDeltaHeightBuffer(DeltaHeightBufferSize)
     ////////
     , mSWETsunamiWaveStateMachine()
     , mSWERogueWaveWaveStateMachine()
@@ -64,17 +63,29 @@ OceanSurface::OceanSurface(
 {
     // Initialize buffers
     mSamples.fill({ 0.0f, 0.0f });
+    mNextSamples.fill({ 0.0f, 0.0f });
     mSWEHeightField.fill(SWEHeightFieldOffset);
     mSWEVelocityField.fill(0.0f);
+    mSWENewVelocityField.fill(0.0f);
     mInteractiveWaveTargetHeight.fill(SWEHeightFieldOffset);
     mInteractiveWaveCurrentHeightGrowthCoefficient.fill(0.0f);
     mInteractiveWaveTargetHeightGrowthCoefficient.fill(0.0f);
     mInteractiveWaveHeightGrowthCoefficientGrowthRate.fill(0.0f);
     mDeltaHeightBuffer.fill(0.0f);
+    mUpdateDeltaHeightBuffer.fill(0.0f);
 
     // Initialize constant sample values
     mSamples[SamplesCount - 1].SampleValuePlusOneMinusSampleValue = 0.0f; // Extra sample is always == last sample
     mSamples[SamplesCount].SampleValuePlusOneMinusSampleValue = 0.0f; // Won't really be used
+    mNextSamples[SamplesCount - 1].SampleValuePlusOneMinusSampleValue = 0.0f;
+    mNextSamples[SamplesCount].SampleValuePlusOneMinusSampleValue = 0.0f;
+}
+
+void OceanSurface::BeginUpdate()
+{
+    // Take in the displacements accumulated so far; the update clears
+    // this buffer once it's done with it
+    mDeltaHeightBuffer.swap(mUpdateDeltaHeightBuffer);
 }
 
 void OceanSurface::Update(
@@ -82,6 +93,8 @@ void OceanSurface::Update(
     Wind const & wind,
     GameParameters const & gameParameters)
 {
+    GameRandomEngine::StreamScope const randomStreamScope(mRandomStream);
+
     auto const now = GameWallClock::GetInstance().Now();
 
     //
@@ -222,24 +235,41 @@ void OceanSurface::Update(
     ResetInteractiveWaves();
 }
 
-void OceanSurface::Upload(Render::RenderContext & renderContext) const
+void OceanSurface::EndUpdate()
 {
-    switch (renderContext.GetOceanRenderDetail())
-    {
-        case OceanRenderDetailType::Basic:
-        {
-            InternalUpload<OceanRenderDetailType::Basic>(renderContext);
-
-            break;
-        }
+    mSamples.swap(mNextSamples);
+}
 
-        case OceanRenderDetailType::Detailed:
-        {
-            InternalUpload<OceanRenderDetailType::Detailed>(renderContext);
+void OceanSurface::GetHeightsAt(
+    vec2f const * restrict positions,
+    size_t count,
+    float * restrict outHeights) const noexcept
+{
+    static_assert(sizeof(Sample) == 2 * sizeof(float));
+
+    Algorithms::SampleHeightField<false>(
+        positions,
+        count,
+        reinterpret_cast<float const *>(mSamples.data()),
+        GameParameters::HalfMaxWorldWidth,
+        Dx,
+        outHeights);
+}
 
-            break;
-        }
-    }
+void OceanSurface::GetDepths(
+    vec2f const * restrict positions,
+    size_t count,
+    float * restrict outDepths) const noexcept
+{
+    static_assert(sizeof(Sample) == 2 * sizeof(float));
+
+    Algorithms::SampleHeightField<true>(
+        positions,
+        count,
+        reinterpret_cast<float const *>(mSamples.data()),
+        GameParameters::HalfMaxWorldWidth,
+        Dx,
+        outDepths);
 }
 
 void OceanSurface::AdjustTo(
@@ -344,199 +374,6 @@ void OceanSurface::TriggerRogueWave(
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
-template<OceanRenderDetailType DetailType>
-void OceanSurface::InternalUpload(Render::RenderContext & renderContext) const
-{
-    static_assert(DetailType == OceanRenderDetailType::Basic || DetailType == OceanRenderDetailType::Detailed);
-
-    register_int constexpr DetailXOffsetSamples = 2; // # of (whole) samples that the detailed planes are offset by
-
-    float constexpr MidPlaneDamp = 0.8f;
-    float constexpr BackPlaneDamp = 0.45f;
-
-    //
-    // We want to upload at most RenderSlices slices
-    //
-
-    // Find index of leftmost sample, and its corresponding world X
-    auto const leftmostSampleIndex = FastTruncateToArchInt((renderContext.GetVisibleWorld().TopLeft.x + GameParameters::HalfMaxWorldWidth) / Dx);
-    float sampleIndexWorldX = -GameParameters::HalfMaxWorldWidth + (Dx * leftmostSampleIndex);
-
-    // Calculate number of samples required to cover screen from leftmost sample
-    // up to the visible world right (included)
-    float const coverageWorldWidth = renderContext.GetVisibleWorld().BottomRight.x - sampleIndexWorldX;
-    auto const numberOfSamplesToRender = static_cast<size_t>(ceil(coverageWorldWidth / Dx));
-
-    if (numberOfSamplesToRender >= RenderSlices<size_t>)
-    {
-        //
-        // Zoom out from afar: each slice encompasses more than 1 sample;
-        // we upload then RenderSlices slices, interpolating Y at each slice boundary
-        //
-
-        // Start uploading
-        if constexpr (DetailType == OceanRenderDetailType::Basic)
-            renderContext.UploadOceanBasicStart(RenderSlices<int>);
-        else
-            renderContext.UploadOceanDetailedStart(RenderSlices<int>);
-
-        // Calculate dx between each pair of slices we want to upload
-        float const sliceDx = coverageWorldWidth / RenderSlices<float>;
-
-        if constexpr (DetailType == OceanRenderDetailType::Basic)
-        {
-            for (size_t s = 0;
-                s <= RenderSlices<size_t>;
-                ++s, sampleIndexWorldX = std::min(sampleIndexWorldX + sliceDx, GameParameters::HalfMaxWorldWidth))
-            {
-                renderContext.UploadOceanBasic(
-                    sampleIndexWorldX,
-                    GetHeightAt(sampleIndexWorldX));
-            }
-        }
-        else
-        {
-            auto const getSampleAtX = [this](float sampleIndexWorldX)
-            {
-                //
-                // Split sample index X into index in sample array and fractional part
-                // between that sample and the next
-                //
-
-                assert(sampleIndexWorldX >= -GameParameters::HalfMaxWorldWidth
-                    && sampleIndexWorldX <= GameParameters::HalfMaxWorldWidth + 1.0f); // Allow for compounding inaccuracies
-
-                // Fractional index in the sample array
-                float const sampleIndexF = (sampleIndexWorldX + GameParameters::HalfMaxWorldWidth) / Dx;
-
-                // Integral part
-                auto const sampleIndexI = FastTruncateToArchInt(sampleIndexF);
-
-                // Fractional part within sample index and the next sample index
-                float const sampleIndexDx = sampleIndexF - sampleIndexI;
-
-                assert(sampleIndexI >= 0 && sampleIndexI <= static_cast<decltype(sampleIndexI)>(SamplesCount)); // Allow for compounding inaccuracies
-                assert(sampleIndexDx >= 0.0f && sampleIndexDx < 1.0f);
-
-                //
-                // Interpolate sample at sampleIndexX
-                //
-
-                float const sample =
-                    mSamples[sampleIndexI].SampleValue
-                    + mSamples[sampleIndexI].SampleValuePlusOneMinusSampleValue * sampleIndexDx;
-
-                return std::make_tuple(sample, sampleIndexI, sampleIndexDx);
-            };
-
-            // First step:
-            //  - previous, current = s[0]
-            auto [currentSample, currentSampleIndexI, currentSampleIndexDx] = getSampleAtX(sampleIndexWorldX);
-            float previousDerivative = 0.0f; // [0] - [-1]
-            float nextSample = 0.0f;
-
-            for (size_t s = 0; s < RenderSlices<size_t>; ++s)
-            {
-                //
-                // Interpolate back- and mid- samples at sampleIndeX minus offsets,
-                // re-using the fractional part that we've already calculated for sampleIndexX
-                //
-
-                auto const indexBack = std::max(currentSampleIndexI - DetailXOffsetSamples * 2, register_int(0));
-                float const sampleBack =
-                    mSamples[indexBack].SampleValue
-                    + mSamples[indexBack].SampleValuePlusOneMinusSampleValue * currentSampleIndexDx;
-
-                auto const indexMid = std::max(currentSampleIndexI - DetailXOffsetSamples, register_int(0));
-                float const sampleMid =
-                    mSamples[indexMid].SampleValue
-                    + mSamples[indexMid].SampleValuePlusOneMinusSampleValue * currentSampleIndexDx;
-
-                // Get next sample
-                float const nextSampleIndexWorldX = sampleIndexWorldX + sliceDx;
-                std::tie(nextSample, currentSampleIndexI, currentSampleIndexDx) = getSampleAtX(nextSampleIndexWorldX);
-
-                // Calculate second derivative
-                float const nextDerivative = nextSample - currentSample;
-                float const d2YFront = nextDerivative - previousDerivative;
-
-                // Upload
-                renderContext.UploadOceanDetailed(
-                    sampleIndexWorldX,
-                    sampleBack * BackPlaneDamp,
-                    sampleMid * MidPlaneDamp,
-                    currentSample,
-                    d2YFront);
-
-                // Advance
-                currentSample = nextSample;
-                previousDerivative = nextDerivative;
-                sampleIndexWorldX = nextSampleIndexWorldX;
-            }
-
-            // We do one extra iteration as the number of slices is the number of quads, and the last vertical
-            // quad side must be at the end of the width
-
-            auto const indexBack = std::max(currentSampleIndexI - DetailXOffsetSamples * 2, register_int(0));
-            float const sampleBack =
-                mSamples[indexBack].SampleValue
-                + mSamples[indexBack].SampleValuePlusOneMinusSampleValue * currentSampleIndexDx;
-
-            auto const indexMid = std::max(currentSampleIndexI - DetailXOffsetSamples, register_int(0));
-            float const sampleMid =
-                mSamples[indexMid].SampleValue
-                + mSamples[indexMid].SampleValuePlusOneMinusSampleValue * currentSampleIndexDx;
-
-            renderContext.UploadOceanDetailed(
-                sampleIndexWorldX,
-                sampleBack * BackPlaneDamp,
-                sampleMid * MidPlaneDamp,
-                currentSample,
-                -previousDerivative); // 0.0 - previousDerivative
-        }
-    }
-    else
-    {
-        //
-        // Zoom in: each sample encompasses multiple slices; we upload then just the
-        // required number of samples - using straight, whole samples - which is less
-        // than the max number of slices we're prepared to upload, and we let OpenGL
-        // interpolate on our behalf
-        //
-
-        if constexpr (DetailType == OceanRenderDetailType::Basic)
-            renderContext.UploadOceanBasicStart(numberOfSamplesToRender);
-        else
-            renderContext.UploadOceanDetailedStart(numberOfSamplesToRender);
-
-        // We do one extra iteration as the number of slices is the number of quads, and the last vertical
-        // quad side must be at the end of the width
-        for (size_t s = 0; s <= numberOfSamplesToRender; ++s, sampleIndexWorldX += Dx)
-        {
-            if constexpr (DetailType == OceanRenderDetailType::Basic)
-            {
-                renderContext.UploadOceanBasic(
-                    sampleIndexWorldX,
-                    mSamples[leftmostSampleIndex + static_cast<register_int>(s)].SampleValue);
-            }
-            else
-            {
-                renderContext.UploadOceanDetailed(
-                    sampleIndexWorldX,
-                    mSamples[std::max(leftmostSampleIndex + static_cast<register_int>(s) - DetailXOffsetSamples * 2, register_int(0))].SampleValue * BackPlaneDamp,
-                    mSamples[std::max(leftmostSampleIndex + static_cast<register_int>(s) - DetailXOffsetSamples, register_int(0))].SampleValue * MidPlaneDamp,
-                    mSamples[leftmostSampleIndex + static_cast<register_int>(s)].SampleValue,
-                    0.0f); // No need to worry with second derivative in zoom-in case
-            }
-        }
-    }
-
-    if constexpr (DetailType == OceanRenderDetailType::Basic)
-        renderContext.UploadOceanBasicEnd();
-    else
-        renderContext.UploadOceanDetailedEnd();
-}
-
 void OceanSurface::RecalculateWaveCoefficients(
     Wind const & wind,
     GameParameters const & gameParameters)
@@ -761,11 +598,11 @@ void OceanSurface::SmoothDeltaBufferIntoHeightField()
     //
 
     Algorithms::SmoothBufferAndAdd<SamplesCount, DeltaHeightSmoothing>(
-        mDeltaHeightBuffer.data() + DeltaHeightBufferPrefixSize,
+        mUpdateDeltaHeightBuffer.data() + DeltaHeightBufferPrefixSize,
         mSWEHeightField.data() + SWEBufferPrefixSize);
 
     // Clear delta-height buffer
-    mDeltaHeightBuffer.fill<DeltaHeightBufferSize>(0.0f);
+    mUpdateDeltaHeightBuffer.fill<DeltaHeightBufferSize>(0.0f);
 }
 
 void OceanSurface::ApplyDampingBoundaryConditions()
@@ -812,26 +649,33 @@ void OceanSurface::UpdateFields(GameParameters const & gameParameters)
     float const previousVWeight2 = gameParameters.WaveSmoothnessAdjustment / 2.0f; // Includes /2 for average
 
     float * const restrict heightField = mSWEHeightField.data() + SWEBufferAlignmentPrefixSize;
-    float * const restrict velocityField = mSWEVelocityField.data() + SWEBufferAlignmentPrefixSize;
-
-    // Update first height field value
-    heightField[0] *=
-        1.0f + Dt / Dx * (velocityField[0] - velocityField[0 + 1]);
-
-    for (size_t i = 1; i < SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples; ++i)
-    {
-        // Update height field
-        heightField[i] *=
-            1.0f + Dt / Dx * (velocityField[i] - velocityField[i + 1]);
-
-        // V @ t-1: mix of V[i] and of avg(V[i-1], V[i+1])
-        float const previousV =
-            previousVWeight1 * velocityField[i]
-            + previousVWeight2 * (velocityField[i - 1] + velocityField[i + 1]);
-
-        // Update velocity field
-        velocityField[i] = previousV - G * Dt / Dx * (heightField[i] - heightField[i - 1]);
-    }
+    float const * const restrict velocityField = mSWEVelocityField.data() + SWEBufferAlignmentPrefixSize;
+    float * const restrict newVelocityField = mSWENewVelocityField.data() + SWEBufferAlignmentPrefixSize;
+
+    size_t constexpr HeightFieldSize = SWEBoundaryConditionsSamples + SamplesCount + SWEBoundaryConditionsSamples;
+
+    // Update height field, from current velocity field
+    Algorithms::UpdateShallowWaterHeights(
+        heightField,
+        velocityField,
+        HeightFieldSize,
+        Dt / Dx);
+
+    // Update velocity field, from new height field; V @ t-1 is a mix of V[i]
+    // and of avg(V[i-1], V[i+1]).
+    // The outermost velocities are not updated.
+    newVelocityField[0] = velocityField[0];
+    Algorithms::UpdateShallowWaterVelocities(
+        heightField + 1,
+        velocityField + 1,
+        newVelocityField + 1,
+        HeightFieldSize - 1,
+        previousVWeight1,
+        previousVWeight2,
+        G * Dt / Dx);
+    newVelocityField[HeightFieldSize] = velocityField[HeightFieldSize];
+
+    mSWEVelocityField.swap(mSWENewVelocityField);
 }
 
 void OceanSurface::AdvectFields()
@@ -994,7 +838,7 @@ void OceanSurface::GenerateSamples(
             + basalValue2
             + rippleValue;
 
-        mSamples[0].SampleValue = previousSampleValue;
+        mNextSamples[0].SampleValue = previousSampleValue;
     }
 
     float const sinArg1Dx = mBasalWaveNumber1 * Dx / (2 * Pi<float>);
@@ -1028,19 +872,19 @@ void OceanSurface::GenerateSamples(
             + basalValue2
             + rippleValue;
 
-        mSamples[i].SampleValue = sampleValue;
-        mSamples[i - 1].SampleValuePlusOneMinusSampleValue = sampleValue - previousSampleValue;
+        mNextSamples[i].SampleValue = sampleValue;
+        mNextSamples[i - 1].SampleValuePlusOneMinusSampleValue = sampleValue - previousSampleValue;
 
         previousSampleValue = sampleValue;
     }
 
-    assert(mSamples[SamplesCount - 1].SampleValuePlusOneMinusSampleValue == 0.0f); // From cctor
+    assert(mNextSamples[SamplesCount - 1].SampleValuePlusOneMinusSampleValue == 0.0f); // From cctor
 
     // Populate extra sample - same value as last sample
-    assert(previousSampleValue == mSamples[SamplesCount - 1].SampleValue);
-    mSamples[SamplesCount].SampleValue = previousSampleValue;
+    assert(previousSampleValue == mNextSamples[SamplesCount - 1].SampleValue);
+    mNextSamples[SamplesCount].SampleValue = previousSampleValue;
 
-    assert(mSamples[SamplesCount].SampleValuePlusOneMinusSampleValue == 0.0f); // From cctor
+    assert(mNextSamples[SamplesCount].SampleValuePlusOneMinusSampleValue == 0.0f); // From cctor
 }
 
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 
 #include <GameCore/Buffer.h>
 #include <GameCore/GameMath.h>
+#include <GameCore/GameRandomEngine.h>
 #include <GameCore/PrecalculatedFunction.h>
 #include <GameCore/RunningAverage.h>
 #include <GameCore/StrongTypeDef.h>
@@ -29,11 +30,24 @@ public:
         World & parentWorld,
         std::shared_ptr<GameEventDispatcher> gameEventDispatcher);
 
+    /*
+     * Updates happen in three phases:
+     *  - BeginUpdate(): takes in the displacements accumulated since the previous update;
+     *  - Update(): calculates the new surface, while the current one is still the one
+     *    that queries see, and while new displacements are accumulated for the next
+     *    update; hence it may run concurrently with queries and with DisplaceAt();
+     *  - EndUpdate(): publishes the new surface to queries.
+     */
+
+    void BeginUpdate();
+
     void Update(
         float currentSimulationTime,
         Wind const & wind,
         GameParameters const & gameParameters);
 
+    void EndUpdate();
+
     void Upload(Render::RenderContext & renderContext) const;
 
 public:
@@ -73,6 +87,22 @@ public:
         return GetHeightAt(position.x) - position.y;
     }
 
+    /*
+     * Batch versions of GetHeightAt() and GetDepth(), sampling the surface at many positions
+     * at once; results match those of the single-position versions within floating-point rounding.
+     *
+     * Assumption: all x's are in world boundaries.
+     */
+    void GetHeightsAt(
+        vec2f const * restrict positions,
+        size_t count,
+        float * restrict outHeights) const noexcept;
+
+    void GetDepths(
+        vec2f const * restrict positions,
+        size_t count,
+        float * restrict outDepths) const noexcept;
+
     /*
      * Assumption: x is in world boundaries.
      */
@@ -196,6 +226,10 @@ private:
     World & mParentWorld;
     std::shared_ptr<GameEventDispatcher> mGameEventHandler;
 
+    // The random stream drawn from while updating, as we might be updated
+    // concurrently with ships
+    GameRandomEngine mRandomStream;
+
     // Smoothing of wind incisiveness
     RunningAverage<15> mWindIncisivenessRunningAverage;
 
@@ -263,6 +297,10 @@ private:
     // The samples
     Buffer<Sample> mSamples;
 
+    // The samples being calculated by the current update, which become
+    // the samples at the end of the update
+    Buffer<Sample> mNextSamples;
+
     //
     // SWE Buffers
     //
@@ -294,6 +332,10 @@ private:
     //      - H[i] has V[i] at its left and V[i+1] at its right
     Buffer<float> mSWEVelocityField;
 
+    // The SWE velocity field being calculated by the current update, from the
+    // current one; swapped with the current one afterwards
+    Buffer<float> mSWENewVelocityField;
+
     //
     // Interactive waves
     //
@@ -340,6 +382,10 @@ private:
 
     Buffer<float> mDeltaHeightBuffer;
 
+    // The delta height buffer being consumed by the current update; swapped
+    // with the accumulating one at the beginning of each update
+    Buffer<float> mUpdateDeltaHeightBuffer;
+
 private:
     
     //
@@ -54,10 +54,13 @@ struct PerfStats
 
         inline void Update(GameChronometer::duration duration)
         {
+            // Might be invoked concurrently (e.g. by ships being updated in parallel)
             auto ratio = mRatio.load();
-            ratio.Duration += duration;
-            ratio.Denominator += 1;
-            mRatio.store(ratio);
+            _Ratio newRatio;
+            do
+            {
+                newRatio = _Ratio(ratio.Duration + duration, ratio.Denominator + 1);
+            } while (!mRatio.compare_exchange_weak(ratio, newRatio));
         }
 
         template<typename TDuration>
@@ -92,12 +95,61 @@ struct PerfStats
         }
     };
 
+    struct Counter
+    {
+    private:
+
+        std::atomic<size_t> mCount;
+
+    public:
+
+        Counter()
+            : mCount(0)
+        {}
+
+        Counter(Counter const & other)
+        {
+            mCount.store(other.mCount.load());
+        }
+
+        Counter const & operator=(Counter const & other)
+        {
+            mCount.store(other.mCount.load());
+            return *this;
+        }
+
+        inline void Increment()
+        {
+            // Might be invoked concurrently (e.g. by ships being updated in parallel)
+            ++mCount;
+        }
+
+        inline size_t GetCount() const
+        {
+            return mCount.load();
+        }
+
+        inline void Reset()
+        {
+            mCount.store(0);
+        }
+
+        friend Counter operator-(Counter const & lhs, Counter const & rhs)
+        {
+            Counter res;
+            res.mCount.store(lhs.mCount.load() - rhs.mCount.load());
+            return res;
+        }
+    };
+
     // Update
     Ratio TotalUpdateDuration;
     Ratio TotalFishUpdateDuration;
     Ratio TotalOceanSurfaceUpdateDuration;
     Ratio TotalShipsUpdateDuration;
     Ratio TotalShipsSpringsUpdateDuration;
+    Ratio TotalShipsUpdateTaskGraphDuration; // Wall-clock
+    Ratio TotalShipsUpdateTaskGraphTasksDuration; // Sum of task durations; over the wall-clock duration, it's the overlap
     Ratio TotalWaitForRenderUploadDuration;
     Ratio TotalNetUpdateDuration; // = TotalUpdateDuration - TotalWaitForRenderUploadDuration
 
@@ -110,6 +162,11 @@ struct PerfStats
     Ratio TotalRenderDrawDuration; // In render thread
     Ratio TotalUploadRenderDrawDuration;
 
+    // Light diffusion passes, by outcome (per ship)
+    Counter LightDiffusionHits; // Nothing changed, skipped
+    Counter LightDiffusionPartialHits; // Only changed points re-diffused
+    Counter LightDiffusionMisses; // All points re-diffused
+
     PerfStats()
     {
         Reset();
@@ -122,6 +179,8 @@ struct PerfStats
         TotalOceanSurfaceUpdateDuration.Reset();
         TotalShipsUpdateDuration.Reset();
         TotalShipsSpringsUpdateDuration.Reset();
+        TotalShipsUpdateTaskGraphDuration.Reset();
+        TotalShipsUpdateTaskGraphTasksDuration.Reset();
         TotalWaitForRenderUploadDuration.Reset();
         TotalNetUpdateDuration.Reset();
 
@@ -131,6 +190,10 @@ struct PerfStats
         TotalMainThreadRenderDrawDuration.Reset();
         TotalRenderDrawDuration.Reset();
         TotalUploadRenderDrawDuration.Reset();
+
+        LightDiffusionHits.Reset();
+        LightDiffusionPartialHits.Reset();
+        LightDiffusionMisses.Reset();
     }
 
     PerfStats & operator=(PerfStats const & other) = default;
@@ -145,6 +208,8 @@ inline PerfStats operator-(PerfStats const & lhs, PerfStats const & rhs)
     perfStats.TotalOceanSurfaceUpdateDuration = lhs.TotalOceanSurfaceUpdateDuration - rhs.TotalOceanSurfaceUpdateDuration;
     perfStats.TotalShipsUpdateDuration = lhs.TotalShipsUpdateDuration - rhs.TotalShipsUpdateDuration;
     perfStats.TotalShipsSpringsUpdateDuration = lhs.TotalShipsSpringsUpdateDuration - rhs.TotalShipsSpringsUpdateDuration;
+    perfStats.TotalShipsUpdateTaskGraphDuration = lhs.TotalShipsUpdateTaskGraphDuration - rhs.TotalShipsUpdateTaskGraphDuration;
+    perfStats.TotalShipsUpdateTaskGraphTasksDuration = lhs.TotalShipsUpdateTaskGraphTasksDuration - rhs.TotalShipsUpdateTaskGraphTasksDuration;
     perfStats.TotalWaitForRenderUploadDuration = lhs.TotalWaitForRenderUploadDuration - rhs.TotalWaitForRenderUploadDuration;
     perfStats.TotalNetUpdateDuration = lhs.TotalNetUpdateDuration - rhs.TotalNetUpdateDuration;
 
@@ -155,5 +220,9 @@ inline PerfStats operator-(PerfStats const & lhs, PerfStats const & rhs)
     perfStats.TotalRenderDrawDuration = lhs.TotalRenderDrawDuration - rhs.TotalRenderDrawDuration;
     perfStats.TotalUploadRenderDrawDuration = lhs.TotalUploadRenderDrawDuration - rhs.TotalUploadRenderDrawDuration;
 
+    perfStats.LightDiffusionHits = lhs.LightDiffusionHits - rhs.LightDiffusionHits;
+    perfStats.LightDiffusionPartialHits = lhs.LightDiffusionPartialHits - rhs.LightDiffusionPartialHits;
+    perfStats.LightDiffusionMisses = lhs.LightDiffusionMisses - rhs.LightDiffusionMisses;
+
     return perfStats;
 }
\ No newline at end of file
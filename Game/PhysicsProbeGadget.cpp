@@ -85,52 +85,4 @@ bool PhysicsProbeGadget::Update(
     return true;
 }
 
-void PhysicsProbeGadget::Upload(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
-
-    switch (mState)
-    {
-        case State::PingOff:
-        {
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::PhysicsProbe, 0),
-                GetPosition(),
-                1.0,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            break;
-        }
-
-        case State::PingOn:
-        {
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::PhysicsProbe, 0),
-                GetPosition(),
-                1.0,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::PhysicsProbePing, 0),
-                GetPosition(),
-                1.0,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            break;
-        }
-
-    }
-}
-
 }
\ No newline at end of file
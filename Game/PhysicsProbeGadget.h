@@ -58,9 +58,9 @@ public:
         // Doe niets
     }
 
-    virtual void Upload(
+    void Upload(
         ShipId shipId,
-        Render::RenderContext & renderContext) const override;
+        Render::RenderContext & renderContext) const;
 
 private:
 
@@ -25,21 +25,4 @@ void PinnedPoints::OnEphemeralParticleDestroyed(ElementIndex pointElementIndex)
     }
 }
 
-void PinnedPoints::Upload(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
-
-    for (auto pinnedPointIndex : mCurrentPinnedPoints)
-    {
-        assert(mShipPoints.IsPinned(pinnedPointIndex));
-
-        shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-            mShipPoints.GetPlaneId(pinnedPointIndex),
-            TextureFrameId(Render::GenericMipMappedTextureGroups::PinnedPoint, 0),
-            mShipPoints.GetPosition(pinnedPointIndex));
-    }
-}
-
 }
\ No newline at end of file
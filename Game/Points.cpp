@@ -35,7 +35,6 @@ void Points::Add(
     mIsRopeBuffer.emplace_back(isRope);
 
     mPositionBuffer.emplace_back(position);
-    mFactoryPositionBuffer.emplace_back(position);
     mVelocityBuffer.emplace_back(vec2f::zero());
     // First buffer implicitly
     assert(mDynamicForceBuffers.size() >= 1);
@@ -48,6 +47,7 @@ void Points::Add(
     mStressBuffer.emplace_back(0.0f);
     mDecayBuffer.emplace_back(1.0f);
     mFrozenCoefficientBuffer.emplace_back(1.0f);
+    mAwakeCoefficientBuffer.emplace_back(1.0f);
     mIntegrationFactorTimeCoefficientBuffer.emplace_back(CalculateIntegrationFactorTimeCoefficient(mCurrentNumMechanicalDynamicsIterations, 1.0f));
     mBuoyancyCoefficientsBuffer.emplace_back(CalculateBuoyancyCoefficients(
         structuralMaterial.BuoyancyVolumeFill,
@@ -57,23 +57,25 @@ void Points::Add(
     mIntegrationFactorBuffer.emplace_back(vec2f::zero());
 
     mInternalPressureBuffer.emplace_back(internalPressure);
+    mInternalPressureBackBuffer.emplace_back(internalPressure);
     mIsHullBuffer.emplace_back(structuralMaterial.IsHull); // Default is from material
     mMaterialWaterIntakeBuffer.emplace_back(structuralMaterial.WaterIntake);
     mMaterialWaterRestitutionBuffer.emplace_back(1.0f - structuralMaterial.WaterRetention);
     mMaterialWaterDiffusionSpeedBuffer.emplace_back(structuralMaterial.WaterDiffusionSpeed);
 
     mWaterBuffer.emplace_back(water);
+    mWaterBackBuffer.emplace_back(water);
     mWaterVelocityBuffer.emplace_back(vec2f::zero());
     mWaterMomentumBuffer.emplace_back(vec2f::zero());
     mCumulatedIntakenWater.emplace_back(0.0f);
     mLeakingCompositeBuffer.emplace_back(LeakingComposite(isStructurallyLeaking));
     if (isStructurallyLeaking)
         SetStructurallyLeaking(pointIndex);
-    mFactoryIsStructurallyLeakingBuffer.emplace_back(isStructurallyLeaking);
     mTotalFactoryWetPoints += (water > 0.0f ? 1 : 0);
 
     // Heat dynamics
     mTemperatureBuffer.emplace_back(GameParameters::Temperature0);
+    mTemperatureBackBuffer.emplace_back(GameParameters::Temperature0);
     assert(structuralMaterial.GetHeatCapacity() > 0.0f);
     mMaterialHeatCapacityReciprocalBuffer.emplace_back(1.0f / structuralMaterial.GetHeatCapacity());
     mMaterialThermalExpansionCoefficientBuffer.emplace_back(structuralMaterial.ThermalExpansionCoefficient);
@@ -98,20 +100,14 @@ void Points::Add(
     mEphemeralParticleAttributes1Buffer.emplace_back();
     mEphemeralParticleAttributes2Buffer.emplace_back();
 
-    // Structure
-    mConnectedSpringsBuffer.emplace_back();
-    mFactoryConnectedSpringsBuffer.emplace_back();
-    mConnectedTrianglesBuffer.emplace_back();
-    mFactoryConnectedTrianglesBuffer.emplace_back();
-
     // Connectivity
     mConnectedComponentIdBuffer.emplace_back(NoneConnectedComponentId);
     mPlaneIdBuffer.emplace_back(NonePlaneId);
     mPlaneIdFloatBuffer.emplace_back(0.0f);
     mCurrentConnectivityVisitSequenceNumberBuffer.emplace_back();
 
-    // Repair state
-    mRepairStateBuffer.emplace_back();
+    // Cold state
+    mColdAttributesBuffer.emplace_back(position, isStructurallyLeaking);
 
     // Gadgets
     mIsGadgetAttachedBuffer.emplace_back(false);
@@ -135,7 +131,7 @@ void Points::CreateEphemeralParticleAirBubble(
     PlaneId planeId)
 {
     // Get a free slot (but don't steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, false);
+    auto pointIndex = AllocateEphemeralParticle(EphemeralType::AirBubble, false);
     if (NoneElementIndex == pointIndex)
         return; // No luck
 
@@ -193,7 +189,8 @@ void Points::CreateEphemeralParticleAirBubble(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::AirBubble;
+    assert(mEphemeralParticleAttributes1Buffer[pointIndex].Type == EphemeralType::AirBubble);
+    //mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::AirBubble;
     mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
     mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = std::numeric_limits<float>::max();
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::AirBubbleState(
@@ -221,7 +218,7 @@ void Points::CreateEphemeralParticleDebris(
     PlaneId planeId)
 {
     // Get a free slot (or steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, true);
+    auto pointIndex = AllocateEphemeralParticle(EphemeralType::Debris, true);
     assert(NoneElementIndex != pointIndex);
 
     //
@@ -270,7 +267,8 @@ void Points::CreateEphemeralParticleDebris(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::Debris;
+    assert(mEphemeralParticleAttributes1Buffer[pointIndex].Type == EphemeralType::Debris);
+    //mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::Debris;
     mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
     mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::DebrisState();
@@ -299,7 +297,7 @@ void Points::CreateEphemeralParticleSmoke(
     GameParameters const & gameParameters)
 {
     // Get a free slot (or steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, true);
+    auto pointIndex = AllocateEphemeralParticle(EphemeralType::Smoke, true);
     assert(NoneElementIndex != pointIndex);
 
     // Choose a lifetime
@@ -359,7 +357,8 @@ void Points::CreateEphemeralParticleSmoke(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::Smoke;
+    assert(mEphemeralParticleAttributes1Buffer[pointIndex].Type == EphemeralType::Smoke);
+    //mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::Smoke;
     mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
     mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::SmokeState(
@@ -387,7 +386,7 @@ void Points::CreateEphemeralParticleSparkle(
     PlaneId planeId)
 {
     // Get a free slot (or steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, true);
+    auto pointIndex = AllocateEphemeralParticle(EphemeralType::Sparkle, true);
     assert(NoneElementIndex != pointIndex);
 
     //
@@ -436,7 +435,8 @@ void Points::CreateEphemeralParticleSparkle(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::Sparkle;
+    assert(mEphemeralParticleAttributes1Buffer[pointIndex].Type == EphemeralType::Sparkle);
+    //mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::Sparkle;
     mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
     mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::SparkleState();
@@ -457,7 +457,7 @@ void Points::CreateEphemeralParticleWakeBubble(
     GameParameters const & gameParameters)
 {
     // Get a free slot (but don't steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, false);
+    auto pointIndex = AllocateEphemeralParticle(EphemeralType::WakeBubble, false);
     if (NoneElementIndex == pointIndex)
         return; // No luck
 
@@ -511,7 +511,8 @@ void Points::CreateEphemeralParticleWakeBubble(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::WakeBubble;
+    assert(mEphemeralParticleAttributes1Buffer[pointIndex].Type == EphemeralType::WakeBubble);
+    //mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::WakeBubble;
     mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
     mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = 0.4f; // Magic number
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::WakeBubbleState();
@@ -571,7 +572,9 @@ void Points::Restore(ElementIndex pointElementIndex)
 
     // Restore factory-time structural IsLeaking
     mLeakingCompositeBuffer[pointElementIndex].LeakingSources.StructuralLeak =
-        mFactoryIsStructurallyLeakingBuffer[pointElementIndex] ? 1.0f : 0.0f;
+        mColdAttributesBuffer[pointElementIndex].FactoryIsStructurallyLeaking ? 1.0f : 0.0f;
+
+    UpdateLeakingPoints(pointElementIndex);
 
     // Remove point from set of burning points, in case it was burning
     if (mCombustionStateBuffer[pointElementIndex].State != CombustionState::StateType::NotBurning)
@@ -629,6 +632,43 @@ void Points::DestroyEphemeralParticle(
     ExpireEphemeralParticle(pointElementIndex);
 }
 
+void Points::UpdateConnectedSpringsAdjacency()
+{
+    if (!mIsConnectedSpringsAdjacencyDirty)
+    {
+        return;
+    }
+
+    //
+    // Make room in each row for all of the point's factory springs
+    //
+
+    mConnectedSpringsAdjacencyRowBegins.resize(mAlignedShipPointCount + 1);
+    mConnectedSpringsAdjacencyRowEnds.resize(mAlignedShipPointCount);
+
+    ElementIndex rowBegin = 0;
+    for (ElementIndex p = 0; p < mAlignedShipPointCount; ++p)
+    {
+        mConnectedSpringsAdjacencyRowBegins[p] = rowBegin;
+        rowBegin += static_cast<ElementIndex>(mColdAttributesBuffer[p].FactoryConnectedSprings.ConnectedSprings.size());
+    }
+
+    mConnectedSpringsAdjacencyRowBegins[mAlignedShipPointCount] = rowBegin;
+
+    mConnectedSpringsAdjacency.resize(rowBegin);
+
+    //
+    // Populate rows
+    //
+
+    mIsConnectedSpringsAdjacencyDirty = false;
+
+    for (ElementIndex p = 0; p < mAlignedShipPointCount; ++p)
+    {
+        UpdateConnectedSpringsAdjacencyRow(p);
+    }
+}
+
 void Points::UpdateForGameParameters(GameParameters const & gameParameters)
 {
     //
@@ -643,7 +683,7 @@ void Points::UpdateForGameParameters(GameParameters const & gameParameters)
         {
             mIntegrationFactorTimeCoefficientBuffer[i] = CalculateIntegrationFactorTimeCoefficient(
                 numMechanicalDynamicsIterations,
-                mFrozenCoefficientBuffer[i]);
+                mFrozenCoefficientBuffer[i] * mAwakeCoefficientBuffer[i]);
         }
 
         // Remember the new value
@@ -654,12 +694,9 @@ void Points::UpdateForGameParameters(GameParameters const & gameParameters)
     if (cumulatedIntakenWaterThresholdForAirBubbles != mCurrentCumulatedIntakenWaterThresholdForAirBubbles)
     {
         // Randomize cumulated water intaken for each leaking point
-        for (ElementIndex i : RawShipPoints())
+        for (ElementIndex i : mLeakingPoints)
         {
-            if (GetLeakingComposite(i).IsCumulativelyLeaking)
-            {
-                mCumulatedIntakenWater[i] = RandomizeCumulatedIntakenWater(cumulatedIntakenWaterThresholdForAirBubbles);
-            }
+            mCumulatedIntakenWater[i] = RandomizeCumulatedIntakenWater(cumulatedIntakenWaterThresholdForAirBubbles);
         }
 
         // Remember the new value
@@ -900,7 +937,7 @@ void Points::UpdateCombustionLowFrequency(
             // Calculate max development: random and depending on number of springs connected to this point
             // (so chains have smaller flames)
             float const deltaSizeDueToConnectedSprings =
-                static_cast<float>(mConnectedSpringsBuffer[pointIndex].ConnectedSprings.size())
+                static_cast<float>(mColdAttributesBuffer[pointIndex].ConnectedSprings.ConnectedSprings.size())
                 * 0.0625f; // 0.0625 -> 0.50 (@8)
             mCombustionStateBuffer[pointIndex].MaxFlameDevelopment = std::max(
                 0.25f + deltaSizeDueToConnectedSprings + 0.5f * mRandomNormalizedUniformFloatBuffer[pointIndex], // 0.25 + dsdtcs -> 0.75 + dsdtcs
@@ -1441,208 +1478,218 @@ void Points::UpdateEphemeralParticles(
         (gameParameters.DoDisplaceWater ? 1.0f : 0.0f)
         * 1.0f;
 
-    // Visit all ephemeral particles
-    for (ElementIndex pointIndex : this->EphemeralPoints())
+    //
+    // Visit all ephemeral particles, one type at a time; expiring a particle moves
+    // the last particle of its type into its place, hence we visit each type backwards
+    //
+
+    // Air bubbles
     {
-        auto const ephemeralType = GetEphemeralType(pointIndex);
-        if (EphemeralType::None != ephemeralType)
+        auto const & airBubbles = mEphemeralParticleAllocator.GetSlots(ToEphemeralParticleKind(EphemeralType::AirBubble));
+        for (size_t i = airBubbles.size(); i-- > 0; )
         {
-            //
-            // Run this particle's state machine
-            //
+            ElementIndex const pointIndex = airBubbles[i];
+            assert(EphemeralType::AirBubble == GetEphemeralType(pointIndex));
 
-            switch (ephemeralType)
+            // Do not advance air bubble if it's pinned
+            if (!IsPinned(pointIndex))
             {
-                case EphemeralType::AirBubble:
+                float const depth = GetCachedDepth(pointIndex);
+                if (depth <= 0.0f)
                 {
-                    // Do not advance air bubble if it's pinned
-                    if (!IsPinned(pointIndex))
-                    {
-                        float const depth = GetCachedDepth(pointIndex);
-                        if (depth <= 0.0f)
-                        {
-                            // Got to the surface, expire
-                            ExpireEphemeralParticle(pointIndex);
-                        }
-                        else
-                        {
-                            //
-                            // Update state
-                            //
-
-                            auto & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
-
-                            // DeltaY
-
-                            state.CurrentDeltaY = depth;
-
-                            // Simulation lifetime
-
-                            auto const simulationLifetime =
-                                currentSimulationTime
-                                - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-
-                            state.SimulationLifetime = simulationLifetime;
-
-                            //
-                            // Update vortex
-                            //
-
-                            float const vortexValue =
-                                state.VortexAmplitude
-                                * PrecalcLoFreqSin.GetNearestPeriodic(
-                                    state.NormalizedVortexAngularVelocity * simulationLifetime);
-
-                            // Apply vortex to bubble
-                            AddStaticForce(
-                                pointIndex,
-                                vec2f(
-                                    vortexValue,
-                                    0.0f));
-
-                            //
-                            // Displace ocean surface, if surfacing
-                            //
-
-                            if (depth < oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset)
-                            {
-                                mParentWorld.DisplaceOceanSurfaceAt(
-                                    GetPosition(pointIndex).x,
-                                    (oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset - depth) * 0.75f);  // Magic number
-
-                                mGameEventHandler->OnAirBubbleSurfaced(1);
-                            }
-                        }
-                    }
-
-                    break;
+                    // Got to the surface, expire
+                    ExpireEphemeralParticle(pointIndex);
                 }
-
-                case EphemeralType::Debris:
+                else
                 {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime)
-                    {
-                        ExpireEphemeralParticle(pointIndex);
+                    //
+                    // Update state
+                    //
 
-                        // Remember that ephemeral point elements are now dirty
-                        mAreEphemeralPointElementsDirtyForRendering = true;
-                    }
-                    else
-                    {
-                        // Update alpha based off remaining time
+                    auto & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
 
-                        float alpha = std::max(
-                            1.0f - elapsedSimulationLifetime / maxSimulationLifetime,
-                            0.0f);
+                    // DeltaY
 
-                        mColorBuffer[pointIndex].w = alpha;
-                        mIsEphemeralColorBufferDirty = true;
-                    }
+                    state.CurrentDeltaY = depth;
 
-                    break;
-                }
+                    // Simulation lifetime
 
-                case EphemeralType::Smoke:
-                {
-                    // Calculate progress
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    assert(mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime > 0.0f);
-                    float const lifetimeProgress =
-                        elapsedSimulationLifetime
-                        / mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-
-                    // Check if expired
-                    if (lifetimeProgress >= 1.0f
-                        || IsCachedUnderwater(pointIndex))
-                    {
-                        //
-                        /// Expired
-                        //
+                    auto const simulationLifetime =
+                        currentSimulationTime
+                        - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
 
-                        ExpireEphemeralParticle(pointIndex);
-                    }
-                    else
-                    {
-                        //
-                        // Still alive
-                        //
-
-                        // Update progress
-                        mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.LifetimeProgress = lifetimeProgress;
-                        if (EphemeralState::SmokeState::GrowthType::Slow == mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.Growth)
-                        {
-                            mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.ScaleProgress =
-                                std::min(1.0f, elapsedSimulationLifetime / 5.0f);
-                        }
-                        else
-                        {
-                            assert(EphemeralState::SmokeState::GrowthType::Fast == mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.Growth);
-                            mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.ScaleProgress =
-                                1.07f * (1.0f - exp(-3.0f * lifetimeProgress));
-                        }
-
-                        // Inject random walk in direction orthogonal to current velocity
-                        float const randomWalkMagnitude =
-                            0.3f * (static_cast<float>(GameRandomEngine::GetInstance().Choose<int>(2)) - 0.5f);
-                        vec2f const deviationDirection =
-                            GetVelocity(pointIndex).normalise().to_perpendicular();
-                        AddStaticForce(
-                            pointIndex,
-                            deviationDirection * randomWalkMagnitude * randomWalkVelocityImpulseToForceCoefficient);
-                    }
+                    state.SimulationLifetime = simulationLifetime;
 
-                    break;
-                }
+                    //
+                    // Update vortex
+                    //
 
-                case EphemeralType::Sparkle:
-                {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime
-                        || IsCachedUnderwater(pointIndex))
-                    {
-                        ExpireEphemeralParticle(pointIndex);
-                    }
-                    else
-                    {
-                        // Update progress based off remaining time
-                        assert(maxSimulationLifetime > 0.0f);
-                        mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress =
-                            elapsedSimulationLifetime / maxSimulationLifetime;
-                    }
+                    float const vortexValue =
+                        state.VortexAmplitude
+                        * PrecalcLoFreqSin.GetNearestPeriodic(
+                            state.NormalizedVortexAngularVelocity * simulationLifetime);
 
-                    break;
-                }
+                    // Apply vortex to bubble
+                    AddStaticForce(
+                        pointIndex,
+                        vec2f(
+                            vortexValue,
+                            0.0f));
 
-                case EphemeralType::WakeBubble:
-                {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime
-                        || !IsCachedUnderwater(pointIndex))
-                    {
-                        ExpireEphemeralParticle(pointIndex);
-                    }
-                    else
+                    //
+                    // Displace ocean surface, if surfacing
+                    //
+
+                    if (depth < oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset)
                     {
-                        // Update progress based off remaining time
-                        assert(maxSimulationLifetime > 0.0f);
-                        mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble.Progress =
-                            elapsedSimulationLifetime / maxSimulationLifetime;
-                    }
+                        mParentWorld.DisplaceOceanSurfaceAt(
+                            GetPosition(pointIndex).x,
+                            (oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset - depth) * 0.75f);  // Magic number
 
-                    break;
+                        mGameEventHandler->OnAirBubbleSurfaced(1);
+                    }
                 }
+            }
+        }
+    }
+
+    // Debris
+    {
+        auto const & debris = mEphemeralParticleAllocator.GetSlots(ToEphemeralParticleKind(EphemeralType::Debris));
+        for (size_t i = debris.size(); i-- > 0; )
+        {
+            ElementIndex const pointIndex = debris[i];
+            assert(EphemeralType::Debris == GetEphemeralType(pointIndex));
+
+            // Check if expired
+            auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
+            auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
+            if (elapsedSimulationLifetime >= maxSimulationLifetime)
+            {
+                ExpireEphemeralParticle(pointIndex);
+
+                // Remember that ephemeral point elements are now dirty
+                mAreEphemeralPointElementsDirtyForRendering = true;
+            }
+            else
+            {
+                // Update alpha based off remaining time
+
+                float alpha = std::max(
+                    1.0f - elapsedSimulationLifetime / maxSimulationLifetime,
+                    0.0f);
+
+                mColorBuffer[pointIndex].w = alpha;
+                mIsEphemeralColorBufferDirty = true;
+            }
+        }
+    }
+
+    // Smoke
+    {
+        auto const & smoke = mEphemeralParticleAllocator.GetSlots(ToEphemeralParticleKind(EphemeralType::Smoke));
+        for (size_t i = smoke.size(); i-- > 0; )
+        {
+            ElementIndex const pointIndex = smoke[i];
+            assert(EphemeralType::Smoke == GetEphemeralType(pointIndex));
+
+            // Calculate progress
+            auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
+            assert(mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime > 0.0f);
+            float const lifetimeProgress =
+                elapsedSimulationLifetime
+                / mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
+
+            // Check if expired
+            if (lifetimeProgress >= 1.0f
+                || IsCachedUnderwater(pointIndex))
+            {
+                //
+                /// Expired
+                //
 
-                default:
+                ExpireEphemeralParticle(pointIndex);
+            }
+            else
+            {
+                //
+                // Still alive
+                //
+
+                // Update progress
+                mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.LifetimeProgress = lifetimeProgress;
+                if (EphemeralState::SmokeState::GrowthType::Slow == mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.Growth)
+                {
+                    mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.ScaleProgress =
+                        std::min(1.0f, elapsedSimulationLifetime / 5.0f);
+                }
+                else
                 {
-                    // Do nothing
+                    assert(EphemeralState::SmokeState::GrowthType::Fast == mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.Growth);
+                    mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.ScaleProgress =
+                        1.07f * (1.0f - exp(-3.0f * lifetimeProgress));
                 }
+
+                // Inject random walk in direction orthogonal to current velocity
+                float const randomWalkMagnitude =
+                    0.3f * (static_cast<float>(GameRandomEngine::GetInstance().Choose<int>(2)) - 0.5f);
+                vec2f const deviationDirection =
+                    GetVelocity(pointIndex).normalise().to_perpendicular();
+                AddStaticForce(
+                    pointIndex,
+                    deviationDirection * randomWalkMagnitude * randomWalkVelocityImpulseToForceCoefficient);
+            }
+        }
+    }
+
+    // Sparkles
+    {
+        auto const & sparkles = mEphemeralParticleAllocator.GetSlots(ToEphemeralParticleKind(EphemeralType::Sparkle));
+        for (size_t i = sparkles.size(); i-- > 0; )
+        {
+            ElementIndex const pointIndex = sparkles[i];
+            assert(EphemeralType::Sparkle == GetEphemeralType(pointIndex));
+
+            // Check if expired
+            auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
+            auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
+            if (elapsedSimulationLifetime >= maxSimulationLifetime
+                || IsCachedUnderwater(pointIndex))
+            {
+                ExpireEphemeralParticle(pointIndex);
+            }
+            else
+            {
+                // Update progress based off remaining time
+                assert(maxSimulationLifetime > 0.0f);
+                mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress =
+                    elapsedSimulationLifetime / maxSimulationLifetime;
+            }
+        }
+    }
+
+    // Wake bubbles
+    {
+        auto const & wakeBubbles = mEphemeralParticleAllocator.GetSlots(ToEphemeralParticleKind(EphemeralType::WakeBubble));
+        for (size_t i = wakeBubbles.size(); i-- > 0; )
+        {
+            ElementIndex const pointIndex = wakeBubbles[i];
+            assert(EphemeralType::WakeBubble == GetEphemeralType(pointIndex));
+
+            // Check if expired
+            auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
+            auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
+            if (elapsedSimulationLifetime >= maxSimulationLifetime
+                || !IsCachedUnderwater(pointIndex))
+            {
+                ExpireEphemeralParticle(pointIndex);
+            }
+            else
+            {
+                // Update progress based off remaining time
+                assert(maxSimulationLifetime > 0.0f);
+                mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble.Progress =
+                    elapsedSimulationLifetime / maxSimulationLifetime;
             }
         }
     }
@@ -1718,455 +1765,6 @@ void Points::ColorPointForDebugging(
     mIsWholeColorBufferDirty = true;
 }
 
-void Points::UploadAttributes(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
-
-    // Upload immutable attributes, if we haven't uploaded them yet
-    if (mIsTextureCoordinatesBufferDirty)
-    {
-        shipRenderContext.UploadPointImmutableAttributes(mTextureCoordinatesBuffer.data());
-
-        mIsTextureCoordinatesBufferDirty = false;
-    }
-
-    // Upload colors, if dirty
-    if (mIsWholeColorBufferDirty)
-    {
-        renderContext.UploadShipPointColorsAsync(
-            shipId,
-            mColorBuffer.data(),
-            0,
-            mAllPointCount);
-
-        mIsWholeColorBufferDirty = false;
-        mIsEphemeralColorBufferDirty = false;
-    }
-    else if (mIsEphemeralColorBufferDirty)
-    {
-        // Only upload ephemeral particle portion
-        renderContext.UploadShipPointColorsAsync(
-            shipId,
-            &(mColorBuffer.data()[mAlignedShipPointCount]),
-            mAlignedShipPointCount,
-            mEphemeralPointCount);
-
-        mIsEphemeralColorBufferDirty = false;
-    }
-
-    //
-    // Upload mutable attributes
-    //
-
-    shipRenderContext.UploadPointMutableAttributesStart();
-
-    shipRenderContext.UploadPointMutableAttributes(
-        mPositionBuffer.data(),
-        mLightBuffer.data(),
-        mWaterBuffer.data());
-
-    if (mIsPlaneIdBufferNonEphemeralDirty)
-    {
-        if (mIsPlaneIdBufferEphemeralDirty)
-        {
-            // Whole
-
-            shipRenderContext.UploadPointMutableAttributesPlaneId(
-                mPlaneIdFloatBuffer.data(),
-                0,
-                mAllPointCount);
-
-            mIsPlaneIdBufferEphemeralDirty = false;
-        }
-        else
-        {
-            // Just non-ephemeral portion
-
-            shipRenderContext.UploadPointMutableAttributesPlaneId(
-                mPlaneIdFloatBuffer.data(),
-                0,
-                mRawShipPointCount);
-        }
-
-        mIsPlaneIdBufferNonEphemeralDirty = false;
-    }
-    else if (mIsPlaneIdBufferEphemeralDirty)
-    {
-        // Just ephemeral portion
-
-        shipRenderContext.UploadPointMutableAttributesPlaneId(
-            &(mPlaneIdFloatBuffer.data()[mAlignedShipPointCount]),
-            mAlignedShipPointCount,
-            mEphemeralPointCount);
-
-        mIsPlaneIdBufferEphemeralDirty = false;
-    }
-
-    // The following attributes never change for ephemeral particles,
-    // hence after the first upload for reasonable defaults, we only
-    // need to upload them for the ship's (structural == raw) points,
-    // not for the ephemeral ones
-    size_t const partialPointCount = mHaveWholeBuffersBeenUploadedOnce ? mRawShipPointCount : mAllPointCount;
-
-    if (mIsDecayBufferDirty)
-    {
-        shipRenderContext.UploadPointMutableAttributesDecay(
-            mDecayBuffer.data(),
-            0,
-            partialPointCount);
-
-        mIsDecayBufferDirty = false;
-    }
-
-    if (renderContext.GetHeatRenderMode() != HeatRenderModeType::None)
-    {
-        renderContext.UploadShipPointTemperatureAsync(
-            shipId,
-            mTemperatureBuffer.data(),
-            0,
-            partialPointCount);
-    }
-
-    if (renderContext.GetStressRenderMode() != StressRenderModeType::None)
-    {
-        renderContext.UploadShipPointStressAsync(
-            shipId,
-            mStressBuffer.data(),
-            0,
-            partialPointCount);
-    }
-
-    if (renderContext.GetDebugShipRenderMode() == DebugShipRenderModeType::InternalPressure)
-    {
-        renderContext.UploadShipPointAuxiliaryDataAsync(
-            shipId,
-            mInternalPressureBuffer.data(),
-            0,
-            partialPointCount);
-    }
-    else if (renderContext.GetDebugShipRenderMode() == DebugShipRenderModeType::Strength)
-    {
-        renderContext.UploadShipPointAuxiliaryDataAsync(
-            shipId,
-            mStrengthBuffer.data(),
-            0,
-            partialPointCount);
-    }
-
-    shipRenderContext.UploadPointMutableAttributesEnd();
-
-    mHaveWholeBuffersBeenUploadedOnce = true;
-}
-
-void Points::UploadNonEphemeralPointElements(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    bool const doUploadAllPoints = (DebugShipRenderModeType::Points == renderContext.GetDebugShipRenderMode());
-
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
-
-    for (ElementIndex pointIndex : RawShipPoints())
-    {
-        if (doUploadAllPoints
-            || mConnectedSpringsBuffer[pointIndex].ConnectedSprings.empty()) // orphaned
-        {
-            shipRenderContext.UploadElementPoint(pointIndex);
-        }
-    }
-}
-
-void Points::UploadFlames(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    //
-    // Flames are uploaded in this order:
-    //  - Z order (guaranteed by internal sorting of mBurningPoints)
-    //  - Background flames first (i.e. flames on ropes/springs) followed
-    //    by foreground flames
-    //
-    // We use # of triangles as a heuristic for the point being on a chain,
-    // and we use the *factory* ones to avoid sudden depth jumps when triangles are destroyed by fire
-    //
-
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
-
-    shipRenderContext.UploadFlamesStart(mBurningPoints.size());
-
-    // Background
-    for (auto const pointIndex : mBurningPoints)
-    {
-        if (mFactoryConnectedTrianglesBuffer[pointIndex].ConnectedTriangles.empty())
-        {
-            shipRenderContext.UploadBackgroundFlame(
-                GetPlaneId(pointIndex),
-                GetPosition(pointIndex),
-                mCombustionStateBuffer[pointIndex].FlameVector,
-                mCombustionStateBuffer[pointIndex].FlameWindRotationAngle,
-                mCombustionStateBuffer[pointIndex].FlameDevelopment, // scale
-                mRandomNormalizedUniformFloatBuffer[pointIndex]);
-        }
-    }
-
-    // Foreground
-    for (auto const pointIndex : mBurningPoints)
-    {
-        if (!mFactoryConnectedTrianglesBuffer[pointIndex].ConnectedTriangles.empty())
-        {
-            shipRenderContext.UploadForegroundFlame(
-                GetPlaneId(pointIndex),
-                GetPosition(pointIndex),
-                mCombustionStateBuffer[pointIndex].FlameVector,
-                mCombustionStateBuffer[pointIndex].FlameWindRotationAngle,
-                mCombustionStateBuffer[pointIndex].FlameDevelopment, // scale
-                mRandomNormalizedUniformFloatBuffer[pointIndex]);
-        }
-    }
-
-    shipRenderContext.UploadFlamesEnd();
-}
-
-void Points::UploadVectors(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
-
-    vec4f color;
-    vec2f const * vectorBuffer = nullptr;
-    float lengthAdjustment = 0.0f;
-
-    switch (renderContext.GetVectorFieldRenderMode())
-    {
-        case VectorFieldRenderModeType::PointStaticForce:
-        {
-            color = vec4f(0.5f, 0.1f, 0.f, 1.0f);
-            vectorBuffer = mStaticForceBuffer.data();
-            lengthAdjustment = 0.00075f;
-
-            break;
-        }
-
-        case VectorFieldRenderModeType::PointDynamicForce:
-        {
-            color = vec4f(1.0f, 0.266f, 0.16f, 1.0f);
-            // First buffer implicitly
-            assert(mDynamicForceBuffers.size() >= 1);
-            vectorBuffer = mDynamicForceBuffers[0].data();
-            lengthAdjustment = 0.000001f;
-
-            break;
-        }
-
-        case VectorFieldRenderModeType::PointVelocity:
-        {
-            color = vec4f(0.203f, 0.552f, 0.219f, 1.0f);
-            vectorBuffer = mVelocityBuffer.data();
-            lengthAdjustment = 0.25f;
-
-            break;
-        }
-
-        case VectorFieldRenderModeType::PointWaterMomentum:
-        {
-            color = vec4f(0.054f, 0.066f, 0.443f, 1.0f);
-            vectorBuffer = mWaterMomentumBuffer.data();
-            lengthAdjustment = 0.4f;
-
-            break;
-        }
-
-        case VectorFieldRenderModeType::PointWaterVelocity:
-        {
-            color = vec4f(0.094f, 0.509f, 0.925f, 1.0f);
-            vectorBuffer = mWaterVelocityBuffer.data();
-            lengthAdjustment = 1.0f;
-
-            break;
-        }
-
-        case VectorFieldRenderModeType::None:
-        {
-            return;
-        }
-    }
-
-    shipRenderContext.UploadVectorsStart(mElementCount, color);
-
-    for (auto const p : this->RawShipPoints())
-    {
-        shipRenderContext.UploadVector(
-            GetPosition(p),
-            mPlaneIdFloatBuffer[p],
-            vectorBuffer[p],
-            lengthAdjustment);
-    }
-
-    for (auto const p : this->EphemeralPoints())
-    {
-        if (GetEphemeralType(p) != EphemeralType::None)
-        {
-            shipRenderContext.UploadVector(
-                GetPosition(p),
-                mPlaneIdFloatBuffer[p],
-                vectorBuffer[p],
-                lengthAdjustment);
-        }
-    }
-
-    shipRenderContext.UploadVectorsEnd();
-}
-
-void Points::UploadEphemeralParticles(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    //
-    // Upload points and/or textures
-    //
-
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
-
-    if (mAreEphemeralPointElementsDirtyForRendering)
-    {
-        shipRenderContext.UploadElementEphemeralPointsStart();
-    }
-
-    for (ElementIndex pointIndex : this->EphemeralPoints())
-    {
-        switch (GetEphemeralType(pointIndex))
-        {
-            case EphemeralType::AirBubble:
-            {
-                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
-
-                // Calculate scale based on lifetime
-                float constexpr ScaleMax = 0.2f;
-                float constexpr ScaleMin = 0.04f;
-                float const scale =
-                    ScaleMin + (ScaleMax - ScaleMin) * SmoothStep(0.0f, 2.0f, state.SimulationLifetime);
-
-                shipRenderContext.UploadAirBubble(
-                    GetPlaneId(pointIndex),
-                    GetPosition(pointIndex),
-                    scale,
-                    std::min(0.6f, state.CurrentDeltaY)); // Alpha
-
-                break;
-            }
-
-            case EphemeralType::Debris:
-            {
-                // Don't upload point unless there's been a change
-                if (mAreEphemeralPointElementsDirtyForRendering)
-                {
-                    shipRenderContext.UploadElementEphemeralPoint(pointIndex);
-                }
-
-                break;
-            }
-
-            case EphemeralType::Smoke:
-            {
-                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke;
-
-                // Calculate scale
-                float const scale = state.ScaleProgress;
-
-                // Calculate alpha
-                float const lifetimeProgress = state.LifetimeProgress;
-                float const alpha =
-                    SmoothStep(0.0f, 0.05f, lifetimeProgress)
-                    - SmoothStep(0.7f, 1.0f, lifetimeProgress);
-
-                // Upload smoke
-                shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                    GetPlaneId(pointIndex),
-                    state.PersonalitySeed,
-                    state.TextureGroup,
-                    GetPosition(pointIndex),
-                    scale,
-                    alpha);
-
-                break;
-            }
-
-            case EphemeralType::Sparkle:
-            {
-                shipRenderContext.UploadSparkle(
-                    GetPlaneId(pointIndex),
-                    GetPosition(pointIndex),
-                    GetVelocity(pointIndex),
-                    mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress);
-
-                break;
-            }
-
-            case EphemeralType::WakeBubble:
-            {
-                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble;
-
-                shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                    GetPlaneId(pointIndex),
-                    TextureFrameId(Render::GenericMipMappedTextureGroups::EngineWake, 0),
-                    GetPosition(pointIndex),
-                    0.10f + 1.22f * state.Progress, // Scale, magic formula
-                    mRandomNormalizedUniformFloatBuffer[pointIndex] * 2.0f * Pi<float>, // Angle
-                    1.0f - state.Progress); // Alpha
-
-                break;
-            }
-
-            case EphemeralType::None:
-            default:
-            {
-                // Ignore
-                break;
-            }
-        }
-    }
-
-    if (mAreEphemeralPointElementsDirtyForRendering)
-    {
-        shipRenderContext.UploadElementEphemeralPointsEnd();
-
-        // Not dirty anymore
-        mAreEphemeralPointElementsDirtyForRendering = false;
-    }
-}
-
-void Points::UploadHighlights(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
-
-    for (auto const & h : mElectricalElementHighlightedPoints)
-    {
-        shipRenderContext.UploadHighlight(
-            HighlightModeType::ElectricalElement,
-            GetPlaneId(h.PointIndex),
-            GetPosition(h.PointIndex),
-            5.0f, // HalfQuadSize, magic number
-            h.HighlightColor,
-            h.Progress);
-    }
-
-    for (auto const & h : mCircleHighlightedPoints)
-    {
-        shipRenderContext.UploadHighlight(
-            HighlightModeType::Circle,
-            GetPlaneId(h.PointIndex),
-            GetPosition(h.PointIndex),
-            4.0f, // HalfQuadSize, magic number
-            h.HighlightColor,
-            1.0f);
-    }
-}
-
 void Points::AugmentMaterialMass(
     ElementIndex pointElementIndex,
     float offset,
@@ -2179,7 +1777,7 @@ void Points::AugmentMaterialMass(
         + offset;
 
     // Notify all connected springs
-    for (auto connectedSpring : mConnectedSpringsBuffer[pointElementIndex].ConnectedSprings)
+    for (auto connectedSpring : mColdAttributesBuffer[pointElementIndex].ConnectedSprings.ConnectedSprings)
     {
         springs.UpdateForMass(connectedSpring.SpringIndex, *this);
     }
@@ -2307,75 +1905,4 @@ vec2f Points::CalculateIdealFlameVector(
     return Q;
 }
 
-ElementIndex Points::FindFreeEphemeralParticle(
-    float currentSimulationTime,
-    bool doForce)
-{
-    //
-    // Search for the firt free ephemeral particle; if a free one is not found, reuse the
-    // oldest particle
-    //
-
-    ElementIndex oldestParticle = NoneElementIndex;
-    float oldestParticleLifetime = 0.0f;
-
-    assert(mFreeEphemeralParticleSearchStartIndex >= mAlignedShipPointCount
-        && mFreeEphemeralParticleSearchStartIndex < mAllPointCount);
-
-    for (ElementIndex p = mFreeEphemeralParticleSearchStartIndex; ; /*incremented in loop*/)
-    {
-        if (EphemeralType::None == mEphemeralParticleAttributes1Buffer[p].Type)
-        {
-            // Found!
-
-            // Remember to start after this one next time
-            mFreeEphemeralParticleSearchStartIndex = p + 1;
-            if (mFreeEphemeralParticleSearchStartIndex >= mAllPointCount)
-                mFreeEphemeralParticleSearchStartIndex = mAlignedShipPointCount;
-
-            return p;
-        }
-
-        // Check whether it's the oldest
-        auto const lifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[p].StartSimulationTime;
-        if (lifetime >= oldestParticleLifetime)
-        {
-            oldestParticle = p;
-            oldestParticleLifetime = lifetime;
-        }
-
-        // Advance
-        ++p;
-        if (p >= mAllPointCount)
-            p = mAlignedShipPointCount;
-
-        if (p == mFreeEphemeralParticleSearchStartIndex)
-        {
-            // Went around
-            break;
-        }
-    }
-
-    //
-    // No luck
-    //
-
-    if (!doForce)
-        return NoneElementIndex;
-
-
-    //
-    // Steal the oldest
-    //
-
-    assert(NoneElementIndex != oldestParticle);
-
-    // Remember to start after this one next time
-    mFreeEphemeralParticleSearchStartIndex = oldestParticle + 1;
-    if (mFreeEphemeralParticleSearchStartIndex >= mAllPointCount)
-        mFreeEphemeralParticleSearchStartIndex = mAlignedShipPointCount;
-
-    return oldestParticle;
-}
-
 }
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include <GameCore/ElementIndexRangeIterator.h>
 #include <GameCore/EnumFlags.h>
 #include <GameCore/FixedSizeVector.h>
+#include <GameCore/FreeListAllocator.h>
 #include <GameCore/GameRandomEngine.h>
 #include <GameCore/GameTypes.h>
 #include <GameCore/GameWallClock.h>
@@ -26,6 +27,7 @@
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <cmath>
 #include <cstring>
 #include <functional>
 #include <vector>
@@ -57,6 +59,8 @@ public:
         WakeBubble
     };
 
+    static size_t constexpr EphemeralTypeCount = 5; // Excluding None
+
     /*
      * The metadata of a single spring connected to a point.
      */
@@ -130,6 +134,44 @@ public:
         }
     };
 
+    /*
+     * The springs connected to a point, as a row of the connected springs
+     * adjacency; same contents and order as the point's ConnectedSpringsVector.
+     */
+    struct ConnectedSpringsRow
+    {
+        ConnectedSpring const * Begin;
+        ConnectedSpring const * End;
+
+        ConnectedSpringsRow(
+            ConnectedSpring const * begin,
+            ConnectedSpring const * end)
+            : Begin(begin)
+            , End(end)
+        {}
+
+        inline ConnectedSpring const * begin() const noexcept
+        {
+            return Begin;
+        }
+
+        inline ConnectedSpring const * end() const noexcept
+        {
+            return End;
+        }
+
+        inline size_t size() const noexcept
+        {
+            return static_cast<size_t>(End - Begin);
+        }
+
+        inline ConnectedSpring const & operator[](size_t index) const noexcept
+        {
+            assert(index < size());
+            return Begin[index];
+        }
+    };
+
     /*
      * The state required for repairing particles.
      */
@@ -484,6 +526,46 @@ private:
         }
     };
 
+    /*
+     * The per-point state that is only visited when the structure changes,
+     * when repairing, and when rendering; kept in a block of its own, away
+     * from the buffers visited at each simulation step.
+     */
+    struct ColdAttributes
+    {
+        vec2f FactoryPosition;
+        bool FactoryIsStructurallyLeaking;
+
+        ConnectedSpringsVector ConnectedSprings;
+        ConnectedSpringsVector FactoryConnectedSprings;
+        ConnectedTrianglesVector ConnectedTriangles;
+        ConnectedTrianglesVector FactoryConnectedTriangles;
+
+        RepairState Repair;
+
+        ColdAttributes()
+            : FactoryPosition(vec2f::zero())
+            , FactoryIsStructurallyLeaking(false)
+            , ConnectedSprings()
+            , FactoryConnectedSprings()
+            , ConnectedTriangles()
+            , FactoryConnectedTriangles()
+            , Repair()
+        {}
+
+        ColdAttributes(
+            vec2f const & factoryPosition,
+            bool factoryIsStructurallyLeaking)
+            : FactoryPosition(factoryPosition)
+            , FactoryIsStructurallyLeaking(factoryIsStructurallyLeaking)
+            , ConnectedSprings()
+            , FactoryConnectedSprings()
+            , ConnectedTriangles()
+            , FactoryConnectedTriangles()
+            , Repair()
+        {}
+    };
+
     /*
      * The materials of this point.
      */
@@ -572,7 +654,6 @@ public:
         , mIsRopeBuffer(mBufferElementCount, shipPointCount, false)
         // Mechanical dynamics
         , mPositionBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
-        , mFactoryPositionBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
         , mVelocityBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
         , mDynamicForceBuffers() // We'll start later with at least one
         , mDynamicForceRawBuffers()
@@ -585,6 +666,7 @@ public:
         , mDecayBuffer(mBufferElementCount, shipPointCount, 1.0f)
         , mIsDecayBufferDirty(true)
         , mFrozenCoefficientBuffer(mBufferElementCount, shipPointCount, 1.0f)
+        , mAwakeCoefficientBuffer(mBufferElementCount, shipPointCount, 1.0f)
         , mIntegrationFactorTimeCoefficientBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mBuoyancyCoefficientsBuffer(mBufferElementCount, shipPointCount, BuoyancyCoefficients(0.0f, 0.0f))
         , mCachedDepthBuffer(mBufferElementCount, shipPointCount, 0.0f)
@@ -592,18 +674,21 @@ public:
         // Pressure and water dynamics
         , mIsHullBuffer(mBufferElementCount, shipPointCount, false)
         , mInternalPressureBuffer(mBufferElementCount, shipPointCount, 0.0f)
+        , mInternalPressureBackBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mMaterialWaterIntakeBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mMaterialWaterRestitutionBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mMaterialWaterDiffusionSpeedBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mWaterBuffer(mBufferElementCount, shipPointCount, 0.0f)
+        , mWaterBackBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mWaterVelocityBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
         , mWaterMomentumBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
         , mCumulatedIntakenWater(mBufferElementCount, shipPointCount, 0.0f)
         , mLeakingCompositeBuffer(mBufferElementCount, shipPointCount, LeakingComposite(false))
-        , mFactoryIsStructurallyLeakingBuffer(mBufferElementCount, shipPointCount, false)
+        , mLeakingPoints()
         , mTotalFactoryWetPoints(0)
         // Heat dynamics
         , mTemperatureBuffer(mBufferElementCount, shipPointCount, 0.0f)
+        , mTemperatureBackBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mMaterialHeatCapacityReciprocalBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mMaterialThermalExpansionCoefficientBuffer(mBufferElementCount, shipPointCount, 0.0f)
         , mMaterialIgnitionTemperatureBuffer(mBufferElementCount, shipPointCount, 0.0f)
@@ -622,10 +707,10 @@ public:
         , mEphemeralParticleAttributes1Buffer(mBufferElementCount, shipPointCount, EphemeralParticleAttributes1())
         , mEphemeralParticleAttributes2Buffer(mBufferElementCount, shipPointCount, EphemeralParticleAttributes2())
         // Structure
-        , mConnectedSpringsBuffer(mBufferElementCount, shipPointCount, ConnectedSpringsVector())
-        , mFactoryConnectedSpringsBuffer(mBufferElementCount, shipPointCount, ConnectedSpringsVector())
-        , mConnectedTrianglesBuffer(mBufferElementCount, shipPointCount, ConnectedTrianglesVector())
-        , mFactoryConnectedTrianglesBuffer(mBufferElementCount, shipPointCount, ConnectedTrianglesVector())
+        , mConnectedSpringsAdjacency()
+        , mConnectedSpringsAdjacencyRowBegins()
+        , mConnectedSpringsAdjacencyRowEnds()
+        , mIsConnectedSpringsAdjacencyDirty(true)
         // Connected component and plane ID
         , mConnectedComponentIdBuffer(mBufferElementCount, shipPointCount, NoneConnectedComponentId)
         , mPlaneIdBuffer(mBufferElementCount, shipPointCount, NonePlaneId)
@@ -633,8 +718,8 @@ public:
         , mIsPlaneIdBufferNonEphemeralDirty(true)
         , mIsPlaneIdBufferEphemeralDirty(true)
         , mCurrentConnectivityVisitSequenceNumberBuffer(mBufferElementCount, shipPointCount, SequenceNumber())
-        // Repair
-        , mRepairStateBuffer(mBufferElementCount, shipPointCount, RepairState())
+        // Cold state
+        , mColdAttributesBuffer(mBufferElementCount, shipPointCount, ColdAttributes())
         // Highlights
         , mElectricalElementHighlightedPoints()
         , mCircleHighlightedPoints()
@@ -671,7 +756,7 @@ public:
         , mWaterReactionExplosionCandidates(mRawShipPointCount)
         , mBurningPoints()
         , mStoppedBurningPoints()
-        , mFreeEphemeralParticleSearchStartIndex(mAlignedShipPointCount)
+        , mEphemeralParticleAllocator(mAlignedShipPointCount, mEphemeralPointCount)
         , mAreEphemeralPointElementsDirtyForRendering(false)
 #ifdef _DEBUG
         , mDiagnostic_ArePositionsDirty(false)
@@ -968,6 +1053,11 @@ public:
         return mPositionBuffer[pointElementIndex];
     }
 
+    vec2f const * GetPositionBufferAsVec2() const
+    {
+        return mPositionBuffer.data();
+    }
+
     vec2f * GetPositionBufferAsVec2()
     {
         return mPositionBuffer.data();
@@ -999,7 +1089,7 @@ public:
 
     vec2f const & GetFactoryPosition(ElementIndex pointElementIndex) const noexcept
     {
-        return mFactoryPositionBuffer[pointElementIndex];
+        return mColdAttributesBuffer[pointElementIndex].FactoryPosition;
     }
 
     vec2f const & GetVelocity(ElementIndex pointElementIndex) const noexcept
@@ -1007,6 +1097,11 @@ public:
         return mVelocityBuffer[pointElementIndex];
     }
 
+    vec2f const * GetVelocityBufferAsVec2() const
+    {
+        return mVelocityBuffer.data();
+    }
+
     vec2f * GetVelocityBufferAsVec2()
     {
         return mVelocityBuffer.data();
@@ -1095,6 +1190,11 @@ public:
         mDynamicForceBuffers[0].fill(vec2f::zero());
     }
 
+    size_t GetDynamicForceParallelism() const
+    {
+        return mDynamicForceBuffers.size();
+    }
+
     void SetDynamicForceParallelism(size_t parallelism)
     {
         assert(parallelism >= 1);
@@ -1210,6 +1310,11 @@ public:
         mDecayBuffer[pointElementIndex] = value;
     }
 
+    float const * GetDecayBufferAsFloat() const
+    {
+        return mDecayBuffer.data();
+    }
+
     void MarkDecayBufferAsDirty()
     {
         mIsDecayBufferDirty = true;
@@ -1299,7 +1404,7 @@ public:
         // Recalc integration factor time coefficient, freezing point
         mIntegrationFactorTimeCoefficientBuffer[pointElementIndex] = CalculateIntegrationFactorTimeCoefficient(
             mCurrentNumMechanicalDynamicsIterations,
-            mFrozenCoefficientBuffer[pointElementIndex]);
+            mFrozenCoefficientBuffer[pointElementIndex] * mAwakeCoefficientBuffer[pointElementIndex]);
 
         // Also zero-out velocity, wiping all traces of this point moving
         mVelocityBuffer[pointElementIndex] = vec2f(0.0f, 0.0f);
@@ -1314,7 +1419,44 @@ public:
         // Re-populate its integration factor time coefficient, thawing point
         mIntegrationFactorTimeCoefficientBuffer[pointElementIndex] = CalculateIntegrationFactorTimeCoefficient(
             mCurrentNumMechanicalDynamicsIterations,
-            mFrozenCoefficientBuffer[pointElementIndex]);
+            mFrozenCoefficientBuffer[pointElementIndex] * mAwakeCoefficientBuffer[pointElementIndex]);
+    }
+
+    bool IsSleeping(ElementIndex pointElementIndex) const
+    {
+        return (mAwakeCoefficientBuffer[pointElementIndex] == 0.0f);
+    }
+
+    // Like Freeze(), but for points of connected components at rest;
+    // orthogonal to freezing
+    void PutToSleep(ElementIndex pointElementIndex)
+    {
+        assert(!IsSleeping(pointElementIndex));
+
+        mAwakeCoefficientBuffer[pointElementIndex] = 0.0f;
+
+        mIntegrationFactorTimeCoefficientBuffer[pointElementIndex] = CalculateIntegrationFactorTimeCoefficient(
+            mCurrentNumMechanicalDynamicsIterations,
+            mFrozenCoefficientBuffer[pointElementIndex] * mAwakeCoefficientBuffer[pointElementIndex]);
+
+        mVelocityBuffer[pointElementIndex] = vec2f(0.0f, 0.0f);
+    }
+
+    void WakeUp(ElementIndex pointElementIndex)
+    {
+        assert(IsSleeping(pointElementIndex));
+
+        mAwakeCoefficientBuffer[pointElementIndex] = 1.0f;
+
+        mIntegrationFactorTimeCoefficientBuffer[pointElementIndex] = CalculateIntegrationFactorTimeCoefficient(
+            mCurrentNumMechanicalDynamicsIterations,
+            mFrozenCoefficientBuffer[pointElementIndex] * mAwakeCoefficientBuffer[pointElementIndex]);
+
+        // Wipe the dynamic forces accumulated while sleeping
+        for (auto & dynamicForceBuffer : mDynamicForceBuffers)
+        {
+            dynamicForceBuffer[pointElementIndex] = vec2f::zero();
+        }
     }
 
     //
@@ -1333,11 +1475,39 @@ public:
         mInternalPressureBuffer[pointElementIndex] = value;
     }
 
+    float const * GetInternalPressureBufferAsFloat() const
+    {
+        return mInternalPressureBuffer.data();
+    }
+
     float * GetInternalPressureBufferAsFloat()
     {
         return mInternalPressureBuffer.data();
     }
 
+    /*
+     * The buffer where the next internal pressure of ship points is calculated,
+     * before SwapInternalPressureBuffers() makes it current.
+     */
+    float * GetInternalPressureBackBufferAsFloat()
+    {
+        return mInternalPressureBackBuffer.data();
+    }
+
+    /*
+     * Makes the back internal pressure buffer the current one; ephemeral
+     * particles carry over their current internal pressure.
+     */
+    void SwapInternalPressureBuffers()
+    {
+        std::copy(
+            mInternalPressureBuffer.data() + mRawShipPointCount,
+            mInternalPressureBuffer.data() + mBufferElementCount,
+            mInternalPressureBackBuffer.data() + mRawShipPointCount);
+
+        mInternalPressureBuffer.swap(mInternalPressureBackBuffer);
+    }
+
     bool GetIsHull(ElementIndex pointElementIndex) const
     {
         return mIsHullBuffer[pointElementIndex];
@@ -1370,6 +1540,11 @@ public:
         return mMaterialWaterDiffusionSpeedBuffer[pointElementIndex];
     }
 
+    float const * GetMaterialWaterDiffusionSpeedBufferAsFloat() const
+    {
+        return mMaterialWaterDiffusionSpeedBuffer.data();
+    }
+
     float GetWater(ElementIndex pointElementIndex) const
     {
         return mWaterBuffer[pointElementIndex];
@@ -1382,6 +1557,11 @@ public:
         mWaterBuffer[pointElementIndex] = value;
     }
 
+    float const * GetWaterBufferAsFloat() const
+    {
+        return mWaterBuffer.data();
+    }
+
     float * GetWaterBufferAsFloat()
     {
         return mWaterBuffer.data();
@@ -1394,17 +1574,27 @@ public:
         return mWaterBuffer[pointElementIndex] > threshold;
     }
 
-    std::shared_ptr<Buffer<float>> MakeWaterBufferCopy()
+    /*
+     * The buffer where the next water of ship points is calculated,
+     * before SwapWaterBuffers() makes it current.
+     */
+    float * GetWaterBackBufferAsFloat()
     {
-        auto waterBufferCopy = mFloatBufferAllocator.Allocate();
-        waterBufferCopy->copy_from(mWaterBuffer);
-
-        return waterBufferCopy;
+        return mWaterBackBuffer.data();
     }
 
-    void UpdateWaterBuffer(std::shared_ptr<Buffer<float>> newWaterBuffer)
+    /*
+     * Makes the back water buffer the current one; ephemeral particles
+     * carry over their current water.
+     */
+    void SwapWaterBuffers()
     {
-        mWaterBuffer.copy_from(*newWaterBuffer);
+        std::copy(
+            mWaterBuffer.data() + mRawShipPointCount,
+            mWaterBuffer.data() + mBufferElementCount,
+            mWaterBackBuffer.data() + mRawShipPointCount);
+
+        mWaterBuffer.swap(mWaterBackBuffer);
     }
 
     vec2f const & GetWaterVelocity(ElementIndex pointElementIndex) const
@@ -1419,6 +1609,11 @@ public:
         mWaterVelocityBuffer[pointElementIndex] = waterVelocity;
     }
 
+    vec2f const * GetWaterVelocityBufferAsVec2() const
+    {
+        return mWaterVelocityBuffer.data();
+    }
+
     vec2f * GetWaterVelocityBufferAsVec2()
     {
         return mWaterVelocityBuffer.data();
@@ -1486,9 +1681,24 @@ public:
         return mLeakingCompositeBuffer[pointElementIndex];
     }
 
-    LeakingComposite & GetLeakingComposite(ElementIndex pointElementIndex)
+    void SetWaterPumpForce(
+        ElementIndex pointElementIndex,
+        float waterPumpForce)
     {
-        return mLeakingCompositeBuffer[pointElementIndex];
+        assert(waterPumpForce != 0.0f || !std::signbit(waterPumpForce)); // Or else IsCumulativelyLeaking's union trick won't work
+
+        mLeakingCompositeBuffer[pointElementIndex].LeakingSources.WaterPumpForce = waterPumpForce;
+
+        UpdateLeakingPoints(pointElementIndex);
+    }
+
+    /*
+     * The points that are currently leaking, in index order; these are a tiny
+     * fraction of all points.
+     */
+    std::vector<ElementIndex> const & GetLeakingPoints() const
+    {
+        return mLeakingPoints;
     }
 
     ElementCount GetTotalFactoryWetPoints() const
@@ -1525,6 +1735,11 @@ public:
         return mTemperatureBuffer[pointElementIndex];
     }
 
+    float const * GetTemperatureBufferAsFloat() const
+    {
+        return mTemperatureBuffer.data();
+    }
+
     float * GetTemperatureBufferAsFloat()
     {
         return mTemperatureBuffer.data();
@@ -1537,17 +1752,18 @@ public:
         mTemperatureBuffer[pointElementIndex] = value;
     }
 
-    std::shared_ptr<Buffer<float>> MakeTemperatureBufferCopy()
+    /*
+     * The buffer where the next temperature of all points is calculated,
+     * before SwapTemperatureBuffers() makes it current.
+     */
+    float * GetTemperatureBackBufferAsFloat()
     {
-        auto temperatureBufferCopy = mFloatBufferAllocator.Allocate();
-        temperatureBufferCopy->copy_from(mTemperatureBuffer);
-
-        return temperatureBufferCopy;
+        return mTemperatureBackBuffer.data();
     }
 
-    void UpdateTemperatureBuffer(std::shared_ptr<Buffer<float>> newTemperatureBuffer)
+    void SwapTemperatureBuffers()
     {
-        mTemperatureBuffer.copy_from(*newTemperatureBuffer);
+        mTemperatureBuffer.swap(mTemperatureBackBuffer);
     }
 
     float GetMaterialHeatCapacityReciprocal(ElementIndex pointElementIndex) const
@@ -1555,6 +1771,11 @@ public:
         return mMaterialHeatCapacityReciprocalBuffer[pointElementIndex];
     }
 
+    float const * GetMaterialHeatCapacityReciprocalBufferAsFloat() const
+    {
+        return mMaterialHeatCapacityReciprocalBuffer.data();
+    }
+
     /*
      * Checks whether a point is eligible for being extinguished by smothering.
      */
@@ -1667,7 +1888,7 @@ public:
 
     auto const & GetConnectedSprings(ElementIndex pointElementIndex) const
     {
-        return mConnectedSpringsBuffer[pointElementIndex];
+        return mColdAttributesBuffer[pointElementIndex].ConnectedSprings;
     }
 
     void ConnectSpring(
@@ -1675,7 +1896,7 @@ public:
         ElementIndex springElementIndex,
         ElementIndex otherEndpointElementIndex)
     {
-        assert(mFactoryConnectedSpringsBuffer[pointElementIndex].ConnectedSprings.contains(
+        assert(mColdAttributesBuffer[pointElementIndex].FactoryConnectedSprings.ConnectedSprings.contains(
             [springElementIndex](auto const & cs)
             {
                 return cs.SpringIndex == springElementIndex;
@@ -1684,10 +1905,12 @@ public:
         // Make it so that a point owns only those springs whose other endpoint comes later
         bool const isAtOwner = pointElementIndex < otherEndpointElementIndex;
 
-        mConnectedSpringsBuffer[pointElementIndex].ConnectSpring(
+        mColdAttributesBuffer[pointElementIndex].ConnectedSprings.ConnectSpring(
             springElementIndex,
             otherEndpointElementIndex,
             isAtOwner);
+
+        UpdateConnectedSpringsAdjacencyRow(pointElementIndex);
     }
 
     void DisconnectSpring(
@@ -1698,14 +1921,16 @@ public:
         // Make it so that a point owns only those springs whose other endpoint comes later
         bool const isAtOwner = pointElementIndex < otherEndpointElementIndex;
 
-        mConnectedSpringsBuffer[pointElementIndex].DisconnectSpring(
+        mColdAttributesBuffer[pointElementIndex].ConnectedSprings.DisconnectSpring(
             springElementIndex,
             isAtOwner);
+
+        UpdateConnectedSpringsAdjacencyRow(pointElementIndex);
     }
 
     auto const & GetFactoryConnectedSprings(ElementIndex pointElementIndex) const
     {
-        return mFactoryConnectedSpringsBuffer[pointElementIndex];
+        return mColdAttributesBuffer[pointElementIndex].FactoryConnectedSprings;
     }
 
     void AddFactoryConnectedSpring(
@@ -1717,21 +1942,68 @@ public:
         bool const isAtOwner = pointElementIndex < otherEndpointElementIndex;
 
         // Add spring to factory-connected springs
-        mFactoryConnectedSpringsBuffer[pointElementIndex].ConnectSpring(
+        mColdAttributesBuffer[pointElementIndex].FactoryConnectedSprings.ConnectSpring(
             springElementIndex,
             otherEndpointElementIndex,
             isAtOwner);
 
         // Connect spring
-        mConnectedSpringsBuffer[pointElementIndex].ConnectSpring(
+        mColdAttributesBuffer[pointElementIndex].ConnectedSprings.ConnectSpring(
             springElementIndex,
             otherEndpointElementIndex,
             isAtOwner);
+
+        // Rows need to make room for this spring
+        mIsConnectedSpringsAdjacencyDirty = true;
+    }
+
+    /*
+     * Faster alternative to GetConnectedSprings() for visiting the springs connected to
+     * a point; requires the adjacency to be up-to-date (see UpdateConnectedSpringsAdjacency()).
+     */
+    inline ConnectedSpringsRow GetConnectedSpringsRow(ElementIndex pointElementIndex) const noexcept
+    {
+        assert(!mIsConnectedSpringsAdjacencyDirty);
+        assert(pointElementIndex < mAlignedShipPointCount);
+
+        ConnectedSpring const * const adjacency = mConnectedSpringsAdjacency.data();
+        return ConnectedSpringsRow(
+            adjacency + mConnectedSpringsAdjacencyRowBegins[pointElementIndex],
+            adjacency + mConnectedSpringsAdjacencyRowEnds[pointElementIndex]);
+    }
+
+    /*
+     * The adjacency as plain buffers: the springs connected to point p are those in
+     * [RowBegins[p], RowEnds[p]); same requirements as GetConnectedSpringsRow().
+     */
+
+    ConnectedSpring const * GetConnectedSpringsAdjacencyBuffer() const noexcept
+    {
+        assert(!mIsConnectedSpringsAdjacencyDirty);
+        return mConnectedSpringsAdjacency.data();
     }
 
+    ElementIndex const * GetConnectedSpringsAdjacencyRowBeginsBuffer() const noexcept
+    {
+        assert(!mIsConnectedSpringsAdjacencyDirty);
+        return mConnectedSpringsAdjacencyRowBegins.data();
+    }
+
+    ElementIndex const * GetConnectedSpringsAdjacencyRowEndsBuffer() const noexcept
+    {
+        assert(!mIsConnectedSpringsAdjacencyDirty);
+        return mConnectedSpringsAdjacencyRowEnds.data();
+    }
+
+    /*
+     * Lays out the connected springs adjacency anew, if the factory springs have changed
+     * since the last time it was laid out.
+     */
+    void UpdateConnectedSpringsAdjacency();
+
     auto const & GetConnectedTriangles(ElementIndex pointElementIndex) const
     {
-        return mConnectedTrianglesBuffer[pointElementIndex];
+        return mColdAttributesBuffer[pointElementIndex].ConnectedTriangles;
     }
 
     void ConnectTriangle(
@@ -1739,13 +2011,13 @@ public:
         ElementIndex triangleElementIndex,
         bool isAtOwner)
     {
-        assert(mFactoryConnectedTrianglesBuffer[pointElementIndex].ConnectedTriangles.contains(
+        assert(mColdAttributesBuffer[pointElementIndex].FactoryConnectedTriangles.ConnectedTriangles.contains(
             [triangleElementIndex](auto const & ct)
             {
                 return ct == triangleElementIndex;
             }));
 
-        mConnectedTrianglesBuffer[pointElementIndex].ConnectTriangle(
+        mColdAttributesBuffer[pointElementIndex].ConnectedTriangles.ConnectTriangle(
             triangleElementIndex,
             isAtOwner);
     }
@@ -1755,19 +2027,19 @@ public:
         ElementIndex triangleElementIndex,
         bool isAtOwner)
     {
-        mConnectedTrianglesBuffer[pointElementIndex].DisconnectTriangle(
+        mColdAttributesBuffer[pointElementIndex].ConnectedTriangles.DisconnectTriangle(
             triangleElementIndex,
             isAtOwner);
     }
 
     size_t GetConnectedOwnedTrianglesCount(ElementIndex pointElementIndex) const
     {
-        return mConnectedTrianglesBuffer[pointElementIndex].OwnedConnectedTrianglesCount;
+        return mColdAttributesBuffer[pointElementIndex].ConnectedTriangles.OwnedConnectedTrianglesCount;
     }
 
     auto const & GetFactoryConnectedTriangles(ElementIndex pointElementIndex) const
     {
-        return mFactoryConnectedTrianglesBuffer[pointElementIndex];
+        return mColdAttributesBuffer[pointElementIndex].FactoryConnectedTriangles;
     }
 
     void AddFactoryConnectedTriangle(
@@ -1776,7 +2048,7 @@ public:
         bool isAtOwner)
     {
         // Add triangle
-        mFactoryConnectedTrianglesBuffer[pointElementIndex].ConnectTriangle(
+        mColdAttributesBuffer[pointElementIndex].FactoryConnectedTriangles.ConnectTriangle(
             triangleElementIndex,
             isAtOwner);
 
@@ -1846,7 +2118,7 @@ public:
 
     RepairState & GetRepairState(ElementIndex pointElementIndex)
     {
-        return mRepairStateBuffer[pointElementIndex];
+        return mColdAttributesBuffer[pointElementIndex].Repair;
     }
 
     //
@@ -2056,17 +2328,79 @@ private:
         vec2f const & pointVelocity,
         float pointVelocityMagnitudeThreshold);
 
+    inline void UpdateLeakingPoints(ElementIndex pointElementIndex)
+    {
+        auto const it = std::lower_bound(
+            mLeakingPoints.cbegin(),
+            mLeakingPoints.cend(),
+            pointElementIndex);
+
+        bool const isInLeakingPoints = (it != mLeakingPoints.cend() && *it == pointElementIndex);
+
+        if (mLeakingCompositeBuffer[pointElementIndex].IsCumulativelyLeaking)
+        {
+            if (!isInLeakingPoints)
+            {
+                mLeakingPoints.insert(it, pointElementIndex);
+            }
+        }
+        else if (isInLeakingPoints)
+        {
+            mLeakingPoints.erase(it);
+        }
+    }
+
     inline void SetStructurallyLeaking(ElementIndex pointElementIndex)
     {
         mLeakingCompositeBuffer[pointElementIndex].LeakingSources.StructuralLeak = 1.0f;
 
+        UpdateLeakingPoints(pointElementIndex);
+
         // Randomize the initial water intaken, so that air bubbles won't come out all at the same moment
         mCumulatedIntakenWater[pointElementIndex] = RandomizeCumulatedIntakenWater(mCurrentCumulatedIntakenWaterThresholdForAirBubbles);
     }
 
-    inline ElementIndex FindFreeEphemeralParticle(
-        float currentSimulationTime,
-        bool doForce);
+    static inline size_t ToEphemeralParticleKind(EphemeralType ephemeralType)
+    {
+        assert(ephemeralType != EphemeralType::None);
+        return static_cast<size_t>(ephemeralType) - 1;
+    }
+
+    inline ElementIndex AllocateEphemeralParticle(
+        EphemeralType ephemeralType,
+        bool doForce)
+    {
+        ElementIndex const pointElementIndex = mEphemeralParticleAllocator.Allocate(
+            ToEphemeralParticleKind(ephemeralType),
+            doForce);
+
+        if (NoneElementIndex != pointElementIndex)
+        {
+            mEphemeralParticleAttributes1Buffer[pointElementIndex].Type = ephemeralType;
+        }
+
+        return pointElementIndex;
+    }
+
+    inline void UpdateConnectedSpringsAdjacencyRow(ElementIndex pointElementIndex)
+    {
+        if (mIsConnectedSpringsAdjacencyDirty)
+        {
+            // Will be laid out from scratch anyway
+            return;
+        }
+
+        auto const & connectedSprings = mColdAttributesBuffer[pointElementIndex].ConnectedSprings.ConnectedSprings;
+
+        ElementIndex rowEnd = mConnectedSpringsAdjacencyRowBegins[pointElementIndex];
+        for (auto const & cs : connectedSprings)
+        {
+            mConnectedSpringsAdjacency[rowEnd++] = cs;
+        }
+
+        assert(rowEnd <= mConnectedSpringsAdjacencyRowBegins[pointElementIndex + 1]);
+        mConnectedSpringsAdjacencyRowEnds[pointElementIndex] = rowEnd;
+    }
 
     inline void ExpireEphemeralParticle(ElementIndex pointElementIndex)
     {
@@ -2076,8 +2410,10 @@ private:
         // Hide this particle from ephemeral particles; this will prevent this particle from:
         // - Being rendered
         // - Being updated
-        // ...and it will allow its slot to be chosen for a new ephemeral particle
         mEphemeralParticleAttributes1Buffer[pointElementIndex].Type = EphemeralType::None;
+
+        // Allow its slot to be chosen for a new ephemeral particle
+        mEphemeralParticleAllocator.Release(pointElementIndex);
     }
 
 private:
@@ -2100,7 +2436,6 @@ private:
     //
 
     Buffer<vec2f> mPositionBuffer;
-    Buffer<vec2f> mFactoryPositionBuffer;
     Buffer<vec2f> mVelocityBuffer;
     std::vector<Buffer<vec2f>> mDynamicForceBuffers; // Forces that vary across the multiple mechanical iterations (i.e. spring, hydrostatic surface pressure) for each thread; always at least one.
     std::vector<float *> mDynamicForceRawBuffers;
@@ -2113,7 +2448,8 @@ private:
     Buffer<float> mDecayBuffer; // 1.0 -> 0.0 (completely decayed)
     bool mutable mIsDecayBufferDirty; // Only tracks non-ephemerals
     Buffer<float> mFrozenCoefficientBuffer; // 1.0: not frozen; 0.0f: frozen
-    Buffer<float> mIntegrationFactorTimeCoefficientBuffer; // dt^2 or zero when the point is frozen
+    Buffer<float> mAwakeCoefficientBuffer; // 1.0: awake; 0.0f: sleeping
+    Buffer<float> mIntegrationFactorTimeCoefficientBuffer; // dt^2 or zero when the point is frozen or sleeping
     Buffer<BuoyancyCoefficients> mBuoyancyCoefficientsBuffer;
     Buffer<float> mCachedDepthBuffer; // Positive when underwater
 
@@ -2125,6 +2461,7 @@ private:
 
     Buffer<bool> mIsHullBuffer; // Externally-computed resultant of material hullness and dynamic hullness
     Buffer<float> mInternalPressureBuffer; // Pressure at this particle (Pa)
+    Buffer<float> mInternalPressureBackBuffer; // Next internal pressure while equalizing internal pressure
     Buffer<float> mMaterialWaterIntakeBuffer;
     Buffer<float> mMaterialWaterRestitutionBuffer;
     Buffer<float> mMaterialWaterDiffusionSpeedBuffer;
@@ -2132,6 +2469,7 @@ private:
     // Height of a 1m2 column of water which provides a pressure equivalent to the pressure at
     // this point. Quantity of water is max(water, 1.0)
     Buffer<float> mWaterBuffer;
+    Buffer<float> mWaterBackBuffer; // Next water while diffusing water
 
     // Total velocity of the water at this point
     Buffer<vec2f> mWaterVelocityBuffer;
@@ -2145,7 +2483,10 @@ private:
 
     // Indicators of point intaking water
     Buffer<LeakingComposite> mLeakingCompositeBuffer;
-    Buffer<bool> mFactoryIsStructurallyLeakingBuffer;
+
+    // The indices of the points whose IsCumulativelyLeaking is set, sorted;
+    // maintained at each change of the leaking composite
+    std::vector<ElementIndex> mLeakingPoints;
 
     // Total number of points that where wet at factory time
     ElementCount mTotalFactoryWetPoints;
@@ -2155,6 +2496,7 @@ private:
     //
 
     Buffer<float> mTemperatureBuffer; // Kelvin
+    Buffer<float> mTemperatureBackBuffer; // Next temperature while propagating heat
     Buffer<float> mMaterialHeatCapacityReciprocalBuffer;
     Buffer<float> mMaterialThermalExpansionCoefficientBuffer;
     Buffer<float> mMaterialIgnitionTemperatureBuffer;
@@ -2200,10 +2542,14 @@ private:
     // Structure
     //
 
-    Buffer<ConnectedSpringsVector> mConnectedSpringsBuffer;
-    Buffer<ConnectedSpringsVector> mFactoryConnectedSpringsBuffer;
-    Buffer<ConnectedTrianglesVector> mConnectedTrianglesBuffer;
-    Buffer<ConnectedTrianglesVector> mFactoryConnectedTrianglesBuffer;
+    // The connected springs of all ship points, packed into one array of rows -
+    // one per point, in point order. Each row has room for all of its point's
+    // factory springs, so that springs are (dis)connected in-place; the rows
+    // are laid out anew only when the factory springs change
+    std::vector<ConnectedSpring> mConnectedSpringsAdjacency;
+    std::vector<ElementIndex> mConnectedSpringsAdjacencyRowBegins; // One extra at end, for the end of the room of the last row
+    std::vector<ElementIndex> mConnectedSpringsAdjacencyRowEnds;
+    bool mIsConnectedSpringsAdjacencyDirty;
 
     //
     // Connectivity
@@ -2217,10 +2563,10 @@ private:
     Buffer<SequenceNumber> mCurrentConnectivityVisitSequenceNumberBuffer;
 
     //
-    // Repair state
+    // Cold state: factory copies, connected elements, repair state
     //
 
-    Buffer<RepairState> mRepairStateBuffer;
+    Buffer<ColdAttributes> mColdAttributesBuffer;
 
     //
     // Highlights
@@ -2300,9 +2646,9 @@ private:
     // member only to save allocations at use time
     std::vector<ElementIndex> mStoppedBurningPoints;
 
-    // The index at which to start searching for free ephemeral particles
-    // (just an optimization over restarting from zero each time)
-    ElementIndex mFreeEphemeralParticleSearchStartIndex;
+    // The ephemeral particle slots, handed out from a free list and tracked by age
+    // and by ephemeral type
+    FreeListAllocator<EphemeralTypeCount> mEphemeralParticleAllocator;
 
     // Flag remembering whether the set of ephemeral point *elements* is dirty
     // (i.e. whether there are more or less points than previously
@@ -186,101 +186,6 @@ bool RCBombGadget::Update(
     }
 }
 
-void RCBombGadget::Upload(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
-
-    switch (mState)
-    {
-        case State::IdlePingOff:
-        {
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::RcBomb, 0),
-                GetPosition(),
-                1.0,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            break;
-        }
-
-        case State::IdlePingOn:
-        {
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::RcBomb, 0),
-                GetPosition(),
-                1.0,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::RcBombPing, (mPingOnStepCounter - 1) % PingFramesCount),
-                GetPosition(),
-                1.0,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            break;
-        }
-
-        case State::DetonationLeadIn:
-        {
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::RcBomb, 0),
-                GetPosition(),
-                1.0,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::RcBombPing, (mPingOnStepCounter - 1) % PingFramesCount),
-                GetPosition(),
-                1.0,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            break;
-        }
-
-        case State::Exploding:
-        {
-            // Calculate current progress
-            float const progress =
-                static_cast<float>(mExplosionFadeoutCounter + 1)
-                / static_cast<float>(ExplosionFadeoutStepsCount);
-
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                mExplosionPlaneId,
-                TextureFrameId(Render::GenericMipMappedTextureGroups::RcBomb, 0),
-                mExplosionPosition,
-                1.0f, // Scale
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f - progress);  // Alpha
-
-            break;
-        }
-
-        case State::Expired:
-        {
-            // No drawing
-            break;
-        }
-    }
-}
-
 void RCBombGadget::Detonate()
 {
     if (State::IdlePingOff == mState
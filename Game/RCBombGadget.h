@@ -57,9 +57,9 @@ public:
         Detonate();
     }
 
-    virtual void Upload(
+    void Upload(
         ShipId shipId,
-        Render::RenderContext & renderContext) const override;
+        Render::RenderContext & renderContext) const;
 
     void Detonate();
 
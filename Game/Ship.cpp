@@ -5,7 +5,10 @@
  ***************************************************************************************/
 #include "Physics.h"
 
+#include "InternalPressureEqualization.h"
+
 #include "Ship_StateMachines.h"
+#include "WaterFlowKernels.h"
 
 #include <GameCore/AABB.h>
 #include <GameCore/Algorithms.h>
@@ -20,6 +23,7 @@
 #include <cassert>
 #include <cstring>
 #include <limits>
+#include <optional>
 #include <queue>
 #include <set>
 
@@ -84,6 +88,7 @@ Ship::Ship(
     , mMaterialDatabase(materialDatabase)
     , mGameEventHandler(std::move(gameEventDispatcher))
     , mEventRecorder(nullptr)
+    , mRandomStream(GameRandomEngine::CreateStream(1 + static_cast<std::uint32_t>(id)))
     , mPoints(std::move(points))
     , mSprings(std::move(springs))
     , mTriangles(std::move(triangles))
@@ -110,7 +115,13 @@ Ship::Ship(
     , mMaxMaxPlaneId(0)
     , mCurrentElectricalVisitSequenceNumber()
     , mConnectedComponentSizes()
+    , mPlaneTriangleCounts()
+    , mConnectedComponentMaxPointIndices()
+    , mUnusedConnectedComponentIdsCount(0)
+    , mConnectivityVisitSeedPoints()
+    , mIsFullConnectivityVisitNeeded(true)
     , mIsStructureDirty(true)
+    , mHasStructureChangedSinceConnectivityVisit(true)
     , mDamagedPointsCount(0)
     , mBrokenSpringsCount(0)
     , mBrokenTrianglesCount(0)
@@ -119,15 +130,56 @@ Ship::Ship(
     , mLastLuminiscenceAdjustmentDiffused(-1.0f)
     , mRepairGracePeriodMultiplier(1.0f)
     , mLastQueriedPointIndex(NoneElementIndex)
+    , mPointGrid(PointGridCellSize)
+    , mIsPointGridDirty(true)
+    , mMaxSpringLength(0.0f)
+    , mIsMaxSpringLengthDirty(true)
+    , mSpringQueryResults()
     , mWindField()
     , mAirBubblesCreatedCount(0)
     , mCurrentSimulationParallelism(0) // We'll detect a difference on first run
-    // Static pressure
-    , mStaticPressureBuffer(mPoints.GetAlignedShipPointCount())
+    // Internal pressure
+    , mInternalPressureEqualizationNeighborCountBuffer(mPoints.GetBufferElementCount())
+    , mInternalPressureEqualizationSpringFluxBuffer(mSprings.GetBufferElementCount())
+    // Frontier forces
+    , mFrontierForcesTaskStates()
+    , mFrontierForcesTasks()
     , mStaticPressureNetForceMagnitudeSum(0.0f)
     , mStaticPressureNetForceMagnitudeCount(0.0f)
     , mStaticPressureIterationsPercentagesSum(0.0f)
     , mStaticPressureIterationsCount(0.0f)
+    // Water velocities
+    , mWaterVelocitiesOutboundFlowTasks()
+    , mWaterVelocitiesInboundFlowTasks()
+    , mWaterVelocitiesTaskWaterSplashed()
+    , mSpringOutboundWaterQuantityBuffer(mSprings.GetBufferElementCount() * 2)
+    , mSpringOutboundWaterMomentumBuffer(mSprings.GetBufferElementCount() * 2)
+    // Heat propagation
+    , mHeatOutflowNormalizationFactorBuffer(mPoints.GetBufferElementCount())
+    , mSpringHeatConductanceBuffer(mSprings.GetBufferElementCount())
+    // Light diffusion
+    , mLightDiffusionChangeDetectionTasks()
+    , mLightDiffusionTasks()
+    , mLightDiffusionTaskDirtyBatchCounts()
+    , mLightDiffusionLastPointPositionBuffer(mPoints.GetBufferElementCount())
+    , mLightDiffusionLampHistory()
+    , mLightDiffusionLastConnectivityVisitSequenceNumber()
+    , mLightDiffusionDirtyRegions()
+    , mLightDiffusionDirtyBatchBuffer(mPoints.GetBufferElementCount() / vectorization_float_count<size_t>)
+    , mLightDiffusionTiles()
+    , mIsLightDiffusionTiled(false)
+    // Sleeping
+    , mConnectedComponentSleepStates()
+    , mHaveConnectedComponentsBeenWokenUpByConnectivityVisit(false)
+    , mSleepingPointCount(0)
+    , mSleepingPointPositionBuffer(mPoints.GetBufferElementCount())
+    , mSleepingPointStaticForceBuffer(mPoints.GetBufferElementCount())
+    , mIsSpringBlockAwakeBuffer((mSprings.GetElementCount() + SleepingBlockSize - 1) / SleepingBlockSize)
+    , mIsPointBlockAwakeBuffer((mPoints.GetBufferElementCount() + SleepingBlockSize - 1) / SleepingBlockSize)
+    // Update task graph
+    , mUpdateTaskGraph()
+    , mIsUpdateTaskGraphRunning(false)
+    , mPendingWatertightDoorUpdates()
     // Render
     , mLastUploadedDebugShipRenderMode()
     , mPlaneTriangleIndicesToRender()
@@ -140,6 +192,9 @@ Ship::Ship(
     mTriangles.RegisterShipPhysicsHandler(this);
     mElectricalElements.RegisterShipPhysicsHandler(this);
 
+    // Describe the state touched by the update task graph
+    RegisterUpdateTaskGraphResources();
+
     // Finalize
     Finalize();
 }
@@ -211,21 +266,22 @@ void Ship::Update(
     GameParameters const & gameParameters,
     StressRenderModeType stressRenderMode,
     Geometry::AABBSet & externalAabbSet,
-    ThreadManager & threadManager,
+    ThreadPool & threadPool,
     PerfStats & perfStats)
 {
     /////////////////////////////////////////////////////////////////
     //         This is where most of the magic happens             //
     /////////////////////////////////////////////////////////////////
 
-    std::vector<ThreadPool::Task> parallelTasks;
-
     /////////////////////////////////////////////////////////////////
     // At this moment:
     //  - Particle positions are within world boundaries
     //  - Particle non-spring forces contain (some of) interaction-provided forces
     /////////////////////////////////////////////////////////////////
 
+    // Draw random values from this ship's own stream, regardless of the thread we're running on
+    GameRandomEngine::StreamScope const randomStreamScope(mRandomStream);
+
     // Get the current wall clock time
     auto const currentWallClockTime = GameWallClock::GetInstance().Now();
     auto const currentWallClockTimeFloat = GameWallClock::GetInstance().AsFloat(currentWallClockTime);
@@ -253,7 +309,7 @@ void Ship::Update(
 
     UpdateForSimulationParallelism(
         gameParameters,
-        threadManager);
+        threadPool);
 
     ///////////////////////////////////////////////////////////////////
     // Calculate some widely-used physical constants
@@ -267,6 +323,15 @@ void Ship::Update(
         gameParameters.WaterTemperature,
         gameParameters);
 
+    ///////////////////////////////////////////////////////////////////
+    // Put to sleep connected components at rest, and wake up disturbed ones;
+    // needs to come before masses as it changes integration factors
+    ///////////////////////////////////////////////////////////////////
+
+    // - Inputs: P.Position, P.Velocity, P.StaticForce, S.IsStressed
+    // - Outputs: P.IntegrationFactorTimeCoefficient, P.Velocity
+    UpdateSleepingConnectedComponents();
+
     ///////////////////////////////////////////////////////////////////
     // Recalculate current masses and everything else that derives from them
     ///////////////////////////////////////////////////////////////////
@@ -283,7 +348,7 @@ void Ship::Update(
     {
         auto const springsStartTime = std::chrono::steady_clock::now();
 
-        RunSpringRelaxationAndDynamicForcesIntegration(gameParameters, threadManager);
+        RunSpringRelaxationAndDynamicForcesIntegration(gameParameters, threadPool);
 
         perfStats.TotalShipsSpringsUpdateDuration.Update(std::chrono::steady_clock::now() - springsStartTime);
     }
@@ -297,6 +362,7 @@ void Ship::Update(
     TrimForWorldBounds(gameParameters);
 
     // We're done with changing positions for the rest of the Update() loop
+    mIsPointGridDirty = true;
 #ifdef _DEBUG
     mPoints.Diagnostic_ClearDirtyPositions();
 #endif
@@ -318,9 +384,23 @@ void Ship::Update(
     }
 
     // - Inputs: P.Position, S.SpringDeletion, S.ResetLength, S.BreakingElongation
+    // - Outputs: S.StrainState
+    threadPool.Run(mSpringStrainTasks);
+
+    // The strain calculation has measured all springs at their final positions for this step
+    mMaxSpringLength = 0.0f;
+    for (auto const & strainResults : mSpringStrainResults)
+    {
+        mMaxSpringLength = std::max(mMaxSpringLength, strainResults.MaxSpringLength);
+    }
+
+    mIsMaxSpringLengthDirty = false;
+
+    // - Inputs: S.StrainState
     // - Outputs: S.Destroy(), P.Stress
     // - Fires events, updates frontiers
-    mSprings.UpdateForStrains(
+    mSprings.ApplyStrains(
+        mSpringStrainResults,
         gameParameters,
         mPoints,
         stressRenderMode);
@@ -349,7 +429,8 @@ void Ship::Update(
         effectiveAirDensity,
         effectiveWaterDensity,
         gameParameters,
-        externalAabbSet);
+        externalAabbSet,
+        threadPool);
 
     // Cached depths are valid from now on --------------------------->
 
@@ -435,77 +516,122 @@ void Ship::Update(
         mGameEventHandler->OnWaterTaken(waterTakenInStep);
     }
 
-    ///////////////////////////////
-    // Parallel run 1 START
-    ///////////////////////////////
+    // The remaining phases visit connected springs via the adjacency
+    mPoints.UpdateConnectedSpringsAdjacency();
+
+    ///////////////////////////////////////////////////////////////////
+    // Run the remaining phases as a task graph; each phase declares the
+    // state it reads and writes, and phases that do not conflict with
+    // each other run concurrently
+    //
+    // Phases that draw random values declare the ship's random stream as
+    // written, so that they draw from it one at a time and in a fixed order;
+    // they bind the stream to whichever thread they happen to run on
+    //
+    // Phases may run on thread pool threads; the events they fire there are
+    // published by the dispatcher on the main thread, at the next Flush()
+    ///////////////////////////////////////////////////////////////////
+
+    using R = UpdateTaskGraphResource;
+
+#ifdef _DEBUG
+    // Verify declared accesses every now and then, as it's expensive
+    mUpdateTaskGraph.SetVerificationEnabled(mCurrentSimulationSequenceNumber.IsStepOf(0, GameParameters::ParticleUpdateLowFrequencyPeriod));
+#endif
 
-    assert(parallelTasks.empty()); // We want the first task to run on the main thread
+    // Deterministic runs need a fixed order of side effects (random draws, events)
+    mUpdateTaskGraph.SetSequential(gameParameters.DoRunDeterministically);
+
+    //
+    // Diffuse water (Cost: 14)
+    //
 
-    parallelTasks.emplace_back(
+    // - Inputs: Position, Water, WaterVelocity, WaterMomentum, ConnectedSprings
+    // - Outpus: Water, WaterVelocity, WaterMomentum
+    mUpdateTaskGraph.AddTask(
+        "UpdateWaterVelocities",
+        TaskGraph::Resources(R::PointPositions, R::Structure),
+        TaskGraph::Resources(R::PointWater, R::PointWaterDynamics),
         [&]()
         {
-            //
-            // Diffuse water (Cost: 14)
-            //
-
             float waterSplashedInStep = 0.f;
 
-            // - Inputs: Position, Water, WaterVelocity, WaterMomentum, ConnectedSprings
-            // - Outpus: Water, WaterVelocity, WaterMomentum
-            UpdateWaterVelocities(gameParameters, waterSplashedInStep);
+            UpdateWaterVelocities(threadPool, waterSplashedInStep);
 
             // Notify
             mGameEventHandler->OnWaterSplashed(waterSplashedInStep);
-        });
+        },
+        true);
+
+    //
+    // Equalize internal pressure (Cost: 1.5)
+    //
 
-    parallelTasks.emplace_back(
+    // - Inputs: InternalPressure, ConnectedSprings, P.IsHull
+    // - Outputs: InternalPressure
+    // - Visits points in parallel
+    mUpdateTaskGraph.AddTask(
+        "EqualizeInternalPressure",
+        TaskGraph::Resources(R::Structure),
+        TaskGraph::Resources(R::PointInternalPressure),
         [&]()
         {
-            //
-            // Equalize internal pressure (Cost: 1.5)
-            //
+            EqualizeInternalPressure(
+                gameParameters,
+                threadPool);
+        },
+        true);
 
-            // - Inputs: InternalPressure, ConnectedSprings
-            // - Outpus: InternalPressure
-            EqualizeInternalPressure(gameParameters);
-
-            //
-            // Apply static pressure forces (Cost: 10)
-            //
+    //
+    // Apply static pressure forces (Cost: 10)
+    //
 
+    // - Inputs: InternalPressure, frontiers, P.Position
+    // - Outputs: P.DynamicForces
+    // - Visits frontiers in parallel
+    mUpdateTaskGraph.AddTask(
+        "ApplyStaticPressureForces",
+        TaskGraph::Resources(R::PointPositions, R::Structure, R::PointInternalPressure),
+        TaskGraph::Resources(R::PointDynamicForces, R::StaticPressureState),
+        [&]()
+        {
             if (gameParameters.StaticPressureForceAdjustment > 0.0f)
             {
-                // - Inputs: frontiers, P.Position, P.InternalPressure
-                // - Outputs: P.DynamicForces
                 ApplyStaticPressureForces(
                     effectiveAirDensity,
                     effectiveWaterDensity,
-                    gameParameters);
+                    gameParameters,
+                    threadPool);
             }
 
-            //
-            // Propagate heat (Cost: 4)
-            //
+            // Publish static pressure stats
+            mGameEventHandler->OnStaticPressureUpdated(
+                mStaticPressureNetForceMagnitudeCount != 0.0f ? mStaticPressureNetForceMagnitudeSum / mStaticPressureNetForceMagnitudeCount : 0.0f,
+                mStaticPressureIterationsCount != 0.0f ? mStaticPressureIterationsPercentagesSum / mStaticPressureIterationsCount : 0.0f);
+        },
+        true);
 
-            // - Inputs: P.Position, P.Temperature, P.ConnectedSprings, P.Water
-            // - Outputs: P.Temperature
+    //
+    // Propagate heat (Cost: 4)
+    //
+
+    // - Inputs: P.Position, P.Temperature, P.ConnectedSprings, P.Water
+    // - Outputs: P.Temperature
+    // - Visits points in parallel
+    mUpdateTaskGraph.AddTask(
+        "PropagateHeat",
+        TaskGraph::Resources(R::PointPositions, R::PointWater, R::PointCachedDepths, R::Structure),
+        TaskGraph::Resources(R::PointTemperature),
+        [&]()
+        {
             PropagateHeat(
                 currentSimulationTime,
                 GameParameters::SimulationStepTimeDuration<float>,
                 stormParameters,
-                gameParameters);
-        });
-
-    threadManager.GetSimulationThreadPool().RunAndClear(parallelTasks);
-
-    // Publish static pressure stats
-    mGameEventHandler->OnStaticPressureUpdated(
-        mStaticPressureNetForceMagnitudeCount != 0.0f ? mStaticPressureNetForceMagnitudeSum / mStaticPressureNetForceMagnitudeCount : 0.0f,
-        mStaticPressureIterationsCount != 0.0f ? mStaticPressureIterationsPercentagesSum / mStaticPressureIterationsCount : 0.0f);
-
-    ///////////////////////////////
-    // Parallel run 1 END
-    ///////////////////////////////
+                gameParameters,
+                threadPool);
+        },
+        true);
 
     //
     // Run sinking/unsinking detection
@@ -513,13 +639,16 @@ void Ship::Update(
 
     if (mCurrentSimulationSequenceNumber.IsStepOf(UpdateSinkingStep, GameParameters::ParticleUpdateLowFrequencyPeriod))
     {
-        UpdateSinking();
+        mUpdateTaskGraph.AddTask(
+            "UpdateSinking",
+            TaskGraph::Resources(R::PointWater),
+            TaskGraph::Resources(R::SinkingState),
+            [&]()
+            {
+                UpdateSinking();
+            });
     }
 
-#ifdef _DEBUG
-    Verify(!mPoints.Diagnostic_ArePositionsDirty());
-#endif
-
     //
     // Update electrical dynamics
     //
@@ -527,16 +656,29 @@ void Ship::Update(
     // Generate a new visit sequence number
     ++mCurrentElectricalVisitSequenceNumber;
 
-    mElectricalElements.Update(
-        currentWallClockTime,
-        currentSimulationTime,
-        mCurrentElectricalVisitSequenceNumber,
-        mPoints,
-        mSprings,
-        effectiveAirDensity,
-        effectiveWaterDensity,
-        stormParameters,
-        gameParameters);
+    // - Inputs: P.Position, P.CachedDepth, P.Water (wet failures), P.ConnectedSprings and P.PlaneId (engines)
+    // - Outputs: EL state, P.Temperature (heat), P.StaticForces (engines), P.Leaking (water pumps),
+    //   ephemeral particles (smoke, bubbles)
+    // - Watertight doors change hullness and water; their updates are deferred until after the graph
+    mUpdateTaskGraph.AddTask(
+        "UpdateElectricalElements",
+        TaskGraph::Resources(R::PointPositions, R::PointCachedDepths, R::PointWater, R::Structure),
+        TaskGraph::Resources(R::ElectricalElements, R::PointTemperature, R::PointStaticForces, R::PointLeaking, R::EphemeralParticles, R::RandomStream),
+        [&]()
+        {
+            GameRandomEngine::StreamScope const randomStreamScope(mRandomStream);
+
+            mElectricalElements.Update(
+                currentWallClockTime,
+                currentSimulationTime,
+                mCurrentElectricalVisitSequenceNumber,
+                mPoints,
+                mSprings,
+                effectiveAirDensity,
+                effectiveWaterDensity,
+                stormParameters,
+                gameParameters);
+        });
 
     //
     // Diffuse light
@@ -545,114 +687,177 @@ void Ship::Update(
     // - Inputs: P.Position, P.PlaneId, EL.AvailableLight
     //      - EL.AvailableLight depends on electricals which depend on water
     // - Outputs: P.Light
-    DiffuseLight(
-        gameParameters, 
-        threadManager);
+    mUpdateTaskGraph.AddTask(
+        "DiffuseLight",
+        TaskGraph::Resources(R::PointPositions, R::Structure, R::ElectricalElements),
+        TaskGraph::Resources(R::PointLight),
+        [&]()
+        {
+            DiffuseLight(
+                gameParameters,
+                threadPool,
+                perfStats);
+        },
+        true); // Uses thread pool
 
     //
-    // Update slow combustion state machine
+    // Update slow and fast combustion state machines
     //
 
-    if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep1, GameParameters::ParticleUpdateLowFrequencyPeriod))
-    {
-        mPoints.UpdateCombustionLowFrequency(
-            0,
-            4,
-            currentWallClockTimeFloat,
-            currentSimulationTime,
-            stormParameters,
-            gameParameters);
-    }
-    else if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep2, GameParameters::ParticleUpdateLowFrequencyPeriod))
-    {
-        mPoints.UpdateCombustionLowFrequency(
-            1,
-            4,
-            currentWallClockTimeFloat,
-            currentSimulationTime,
-            stormParameters,
-            gameParameters);
-    }
-    else if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep3, GameParameters::ParticleUpdateLowFrequencyPeriod))
-    {
-        mPoints.UpdateCombustionLowFrequency(
-            2,
-            4,
-            currentWallClockTimeFloat,
-            currentSimulationTime,
-            stormParameters,
-            gameParameters);
-    }
-    else if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep4, GameParameters::ParticleUpdateLowFrequencyPeriod))
-    {
-        mPoints.UpdateCombustionLowFrequency(
-            3,
-            4,
-            currentWallClockTimeFloat,
-            currentSimulationTime,
-            stormParameters,
-            gameParameters);
-    }
+    // - Outputs: P.Temperature, P.Decay, P.Combustion, ephemeral particles (smoke),
+    //   state machines (explosions)
+    mUpdateTaskGraph.AddTask(
+        "UpdateCombustion",
+        TaskGraph::Resources(R::PointPositions, R::PointWater, R::PointCachedDepths, R::Structure),
+        TaskGraph::Resources(R::PointTemperature, R::PointDecay, R::PointCombustion, R::EphemeralParticles, R::StateMachines, R::RandomStream),
+        [&]()
+        {
+            GameRandomEngine::StreamScope const randomStreamScope(mRandomStream);
 
-    //
-    // Update fast combustion state machine
-    //
+            if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep1, GameParameters::ParticleUpdateLowFrequencyPeriod))
+            {
+                mPoints.UpdateCombustionLowFrequency(
+                    0,
+                    4,
+                    currentWallClockTimeFloat,
+                    currentSimulationTime,
+                    stormParameters,
+                    gameParameters);
+            }
+            else if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep2, GameParameters::ParticleUpdateLowFrequencyPeriod))
+            {
+                mPoints.UpdateCombustionLowFrequency(
+                    1,
+                    4,
+                    currentWallClockTimeFloat,
+                    currentSimulationTime,
+                    stormParameters,
+                    gameParameters);
+            }
+            else if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep3, GameParameters::ParticleUpdateLowFrequencyPeriod))
+            {
+                mPoints.UpdateCombustionLowFrequency(
+                    2,
+                    4,
+                    currentWallClockTimeFloat,
+                    currentSimulationTime,
+                    stormParameters,
+                    gameParameters);
+            }
+            else if (mCurrentSimulationSequenceNumber.IsStepOf(CombustionStateMachineSlowStep4, GameParameters::ParticleUpdateLowFrequencyPeriod))
+            {
+                mPoints.UpdateCombustionLowFrequency(
+                    3,
+                    4,
+                    currentWallClockTimeFloat,
+                    currentSimulationTime,
+                    stormParameters,
+                    gameParameters);
+            }
 
-    mPoints.UpdateCombustionHighFrequency(
-        currentSimulationTime,
-        GameParameters::SimulationStepTimeDuration<float>,
-        mParentWorld.GetCurrentWindSpeed(),
-        mWindField,
-        gameParameters);
+            mPoints.UpdateCombustionHighFrequency(
+                currentSimulationTime,
+                GameParameters::SimulationStepTimeDuration<float>,
+                mParentWorld.GetCurrentWindSpeed(),
+                mWindField,
+                gameParameters);
+        });
 
     //
     // Update highlights
     //
 
-    mPoints.UpdateHighlights(currentWallClockTimeFloat);
+    mUpdateTaskGraph.AddTask(
+        "UpdateHighlights",
+        0,
+        TaskGraph::Resources(R::PointHighlights),
+        [&]()
+        {
+            mPoints.UpdateHighlights(currentWallClockTimeFloat);
+        });
 
     //
     // Update electric sparks
     //
 
-    mElectricSparks.Update();
+    mUpdateTaskGraph.AddTask(
+        "UpdateElectricSparks",
+        0,
+        TaskGraph::Resources(R::ElectricSparks),
+        [&]()
+        {
+            mElectricSparks.Update();
+        });
 
-    ///////////////////////////////////////////////////////////////////
+    //
     // Update spring parameters
-    ///////////////////////////////////////////////////////////////////
+    //
 
+    // - Inputs: P.Decay, P.Temperature
+    // - Outputs: S.Parameters
+    std::optional<ElementIndex> springsPartition;
     if (mCurrentSimulationSequenceNumber.IsStepOf(SpringDecayAndTemperatureStep1, GameParameters::ParticleUpdateLowFrequencyPeriod))
     {
-        mSprings.UpdateForDecayAndTemperature(
-            0, 4,
-            mPoints);
+        springsPartition = 0;
     }
     else if (mCurrentSimulationSequenceNumber.IsStepOf(SpringDecayAndTemperatureStep2, GameParameters::ParticleUpdateLowFrequencyPeriod))
     {
-        mSprings.UpdateForDecayAndTemperature(
-            1, 4,
-            mPoints);
+        springsPartition = 1;
     }
     else if (mCurrentSimulationSequenceNumber.IsStepOf(SpringDecayAndTemperatureStep3, GameParameters::ParticleUpdateLowFrequencyPeriod))
     {
-        mSprings.UpdateForDecayAndTemperature(
-            2, 4,
-            mPoints);
+        springsPartition = 2;
     }
     else if (mCurrentSimulationSequenceNumber.IsStepOf(SpringDecayAndTemperatureStep4, GameParameters::ParticleUpdateLowFrequencyPeriod))
     {
-        mSprings.UpdateForDecayAndTemperature(
-            3, 4,
-            mPoints);
+        springsPartition = 3;
     }
 
-    ///////////////////////////////////////////////////////////////////
+    if (springsPartition.has_value())
+    {
+        mUpdateTaskGraph.AddTask(
+            "UpdateSpringsForDecayAndTemperature",
+            TaskGraph::Resources(R::PointDecay, R::PointTemperature),
+            TaskGraph::Resources(R::SpringParameters),
+            [this, partition = *springsPartition]()
+            {
+                mSprings.UpdateForDecayAndTemperature(
+                    partition, 4,
+                    mPoints);
+            });
+    }
+
+    //
     // Update ephemeral particles
-    ///////////////////////////////////////////////////////////////////
+    //
 
-    mPoints.UpdateEphemeralParticles(
-        currentSimulationTime,
-        gameParameters);
+    mUpdateTaskGraph.AddTask(
+        "UpdateEphemeralParticles",
+        0,
+        TaskGraph::Resources(R::EphemeralParticles, R::RandomStream),
+        [&]()
+        {
+            GameRandomEngine::StreamScope const randomStreamScope(mRandomStream);
+
+            mPoints.UpdateEphemeralParticles(
+                currentSimulationTime,
+                gameParameters);
+        });
+
+    mIsUpdateTaskGraphRunning = true;
+    mUpdateTaskGraph.RunAndClear(threadPool);
+    mIsUpdateTaskGraphRunning = false;
+
+    perfStats.TotalShipsUpdateTaskGraphDuration.Update(mUpdateTaskGraph.GetLastRunStatistics().ElapsedDuration);
+    perfStats.TotalShipsUpdateTaskGraphTasksDuration.Update(mUpdateTaskGraph.GetLastRunStatistics().TasksDuration);
+
+    // Apply watertight door updates raised while running the graph
+    for (auto const & update : mPendingWatertightDoorUpdates)
+    {
+        HandleWatertightDoorUpdated(update.PointIndex, update.IsOpen);
+    }
+
+    mPendingWatertightDoorUpdates.clear();
 
     ///////////////////////////////////////////////////////////////////
     // Diagnostics
@@ -683,302 +888,174 @@ void Ship::Update(
     mWindField.reset();
 }
 
-void Ship::RenderUpload(Render::RenderContext & renderContext)
+///////////////////////////////////////////////////////////////////////////////////
+// Private Helpers
+///////////////////////////////////////////////////////////////////////////////////
+
+void Ship::Finalize()
 {
     //
-    // Run all tasks that need to run when connectivity has changed
-    // (i.e. when the connected components have changed, e.g. because
-    // of particle or spring deletion)
-    //
-    // Note: we have to do this here, at render time rather than
-    // at update time, because the structure might have been dirtied
-    // by an interactive tool while the game is paused
+    // 1. Propagate (ship) point materials' hullness
     //
 
-    if (mIsStructureDirty)
+    for (auto const pointIndex : mPoints.RawShipPoints())
     {
-        // Re-calculate connected components
-        RunConnectivityVisit();
-
-        // Notify electrical elements
-        mElectricalElements.OnPhysicalStructureChanged(mPoints);
+        if (mPoints.GetStructuralMaterial(pointIndex).IsHull)
+        {
+            SetAndPropagateResultantPointHullness(pointIndex, true);
+        }
     }
 
+
     //
-    // Initialize upload
+    // 2. Do a first connectivity pass (for the first Update)
     //
 
-    auto & shipRenderContext = renderContext.GetShipRenderContext(mId);
-
-    shipRenderContext.UploadStart(mMaxMaxPlaneId);
-
-    //////////////////////////////////////////////////////////////////////////////
+    RunConnectivityVisit();
+}
 
+void Ship::RegisterUpdateTaskGraphResources()
+{
     //
-    // Upload points's immutable and mutable attributes
+    // Register fingerprints of the point buffers touched by the update task graph,
+    // so that undeclared writes may be detected while verifying the graph
     //
 
-    mPoints.UploadAttributes(
-        mId,
-        renderContext);
+    using R = UpdateTaskGraphResource;
 
-    //
-    // Upload elements, if needed
-    //
+    auto const registerShipPointBuffer = [this](R resource, std::string name, auto bufferGetter)
+    {
+        mUpdateTaskGraph.RegisterResource(
+            resource,
+            std::move(name),
+            [this, bufferGetter]()
+            {
+                auto const * const buffer = bufferGetter(mPoints);
+                return TaskGraph::Fingerprint(buffer, mPoints.GetAlignedShipPointCount() * sizeof(*buffer));
+            });
+    };
+
+    registerShipPointBuffer(R::PointPositions, "PointPositions", [](Points & p) { return p.GetPositionBufferAsVec2(); });
+    registerShipPointBuffer(R::PointWater, "PointWater", [](Points & p) { return p.GetWaterBufferAsFloat(); });
+    registerShipPointBuffer(R::PointInternalPressure, "PointInternalPressure", [](Points & p) { return p.GetInternalPressureBufferAsFloat(); });
+    registerShipPointBuffer(R::PointDynamicForces, "PointDynamicForces", [](Points & p) { return p.GetDynamicForceBufferAsVec2(); });
+    registerShipPointBuffer(R::PointStaticForces, "PointStaticForces", [](Points & p) { return p.GetStaticForceBufferAsVec2(); });
+    registerShipPointBuffer(R::PointTemperature, "PointTemperature", [](Points & p) { return p.GetTemperatureBufferAsFloat(); });
+    registerShipPointBuffer(R::PointLight, "PointLight", [](Points & p) { return p.GetLightBufferAsFloat(); });
+    registerShipPointBuffer(R::PointCachedDepths, "PointCachedDepths", [](Points & p) { return p.GetCachedDepthBufferAsFloat(); });
+
+    mUpdateTaskGraph.RegisterResource(
+        R::PointWaterDynamics,
+        "PointWaterDynamics",
+        [this]()
+        {
+            size_t const size = mPoints.GetAlignedShipPointCount() * sizeof(vec2f);
+            return TaskGraph::Fingerprint(mPoints.GetWaterVelocityBufferAsVec2(), size)
+                ^ (TaskGraph::Fingerprint(mPoints.GetWaterMomentumBufferAsVec2f(), size) * 31);
+        });
 
-    if (mIsStructureDirty
-        || !mLastUploadedDebugShipRenderMode
-        || *mLastUploadedDebugShipRenderMode != renderContext.GetDebugShipRenderMode())
+    mUpdateTaskGraph.RegisterResource(
+        R::EphemeralParticles,
+        "EphemeralParticles",
+        [this]()
+        {
+            ElementIndex const start = mPoints.GetAlignedShipPointCount();
+            size_t const count = mPoints.GetElementCount() - start;
+            return TaskGraph::Fingerprint(mPoints.GetPositionBufferAsVec2() + start, count * sizeof(vec2f))
+                ^ (TaskGraph::Fingerprint(mPoints.GetTemperatureBufferAsFloat() + start, count * sizeof(float)) * 31);
+        });
+
+    mUpdateTaskGraph.RegisterResource(
+        R::RandomStream,
+        "RandomStream",
+        [this]()
+        {
+            return mRandomStream.GetStateFingerprint();
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// Mechanical Dynamics
+///////////////////////////////////////////////////////////////////////////////////
+
+void Ship::ApplyQueuedInteractionForces()
+{
+    for (auto const & interaction : mQueuedInteractions)
     {
-        shipRenderContext.UploadElementsStart();
+        switch (interaction.Type)
+        {
+            case Interaction::InteractionType::Blast:
+            {
+                ApplyBlastAt(interaction.Arguments.Blast);
 
-        //
-        // Upload point elements (either orphaned only or all, depending
-        // on the debug render mode)
-        //
+                break;
+            }
 
-        mPoints.UploadNonEphemeralPointElements(
-            mId,
-            renderContext);
+            case Interaction::InteractionType::Draw:
+            {
+                DrawTo(interaction.Arguments.Draw);
 
-        //
-        // Upload spring elements (including ropes) (edge or all, depending
-        // on the debug render mode)
-        //
+                break;
+            }
 
-        mSprings.UploadElements(
-            mId,
-            renderContext);
+            case Interaction::InteractionType::Pull:
+            {
+                Pull(interaction.Arguments.Pull);
 
-        //
-        // Upload triangles, but only if structure is dirty
-        // (we can't upload more frequently as mPlaneTriangleIndicesToRender is a one-time use)
-        //
+                break;
+            }
 
-        if (mIsStructureDirty)
-        {
-            assert(mPlaneTriangleIndicesToRender.size() >= 1);
+            case Interaction::InteractionType::Swirl:
+            {
+                SwirlAt(interaction.Arguments.Swirl);
 
-            shipRenderContext.UploadElementTrianglesStart(mPlaneTriangleIndicesToRender.back());
+                break;
+            }
 
-            mTriangles.UploadElements(
-                mId,
-                mPlaneTriangleIndicesToRender,
-                mPoints,
-                renderContext);
+            case Interaction::InteractionType::RadialWind:
+            {
+                ApplyRadialWindFrom(interaction.Arguments.RadialWind);
 
-            shipRenderContext.UploadElementTrianglesEnd();
+                break;
+            }
         }
-
-        shipRenderContext.UploadElementsEnd();
     }
 
+    mQueuedInteractions.clear();
+}
+
+void Ship::ApplyWorldForces(
+    float effectiveAirDensity,
+    float effectiveWaterDensity,
+    GameParameters const & gameParameters,
+    Geometry::AABBSet & externalAabbSet,
+    ThreadPool & threadPool)
+{
+    // New buffer to which new cached depths will be written to
+    std::shared_ptr<Buffer<float>> newCachedPointDepths = mPoints.AllocateWorkBufferFloat();
+
     //
-    // Upload stressed springs
-    //
-    // We do this regardless of whether or not elements are dirty,
-    // as the set of stressed springs is bound to change from frame to frame
+    // Depths
     //
 
-    shipRenderContext.UploadElementStressedSpringsStart();
-
-    if (renderContext.GetShowStressedSprings())
     {
-        mSprings.UploadStressedSpringElements(
-            mId,
-            renderContext);
-    }
-
-    shipRenderContext.UploadElementStressedSpringsEnd();
-
-    //
-    // Upload electrical elements
-    //
-
-    mElectricalElements.Upload(
-        shipRenderContext,
-        mPoints);
-
-    //
-    // Upload electric sparks
-    //
-
-    mElectricSparks.Upload(
-        mPoints,
-        mId,
-        renderContext);
-
-    //
-    // Upload frontiers
-    //
-
-    mFrontiers.Upload(
-        mId,
-        renderContext);
-
-    //
-    // Upload flames
-    //
-
-    mPoints.UploadFlames(
-        mId,
-        renderContext);
-
-    //
-    // Upload gadgets
-    //
-
-    mGadgets.Upload(
-        mId,
-        renderContext);
-
-    //
-    // Upload pinned points
-    //
-
-    mPinnedPoints.Upload(
-        mId,
-        renderContext);
-
-    //
-    // Upload ephemeral points and textures
-    //
-
-    mPoints.UploadEphemeralParticles(
-        mId,
-        renderContext);
-
-    //
-    // Upload highlights
-    //
-
-    mPoints.UploadHighlights(
-        mId,
-        renderContext);
-
-    //
-    // Upload vector fields
-    //
-
-    mPoints.UploadVectors(
-        mId,
-        renderContext);
-
-    //
-    // Upload state machines
-    //
-
-    UploadStateMachines(renderContext);
-
-    //
-    // Upload overlays
-    //
-
-    mOverlays.Upload(
-        mId,
-        renderContext);
-
-    //////////////////////////////////////////////////////////////////////////////
-
-    //
-    // Finalize upload
-    //
-
-    shipRenderContext.UploadEnd();
-
-    //
-    // Reset render state
-    //
-
-    mIsStructureDirty = false;
-    mLastUploadedDebugShipRenderMode = renderContext.GetDebugShipRenderMode();
-}
-
-///////////////////////////////////////////////////////////////////////////////////
-// Private Helpers
-///////////////////////////////////////////////////////////////////////////////////
-
-void Ship::Finalize()
-{
-    //
-    // 1. Propagate (ship) point materials' hullness
-    //
-
-    for (auto const pointIndex : mPoints.RawShipPoints())
-    {
-        if (mPoints.GetStructuralMaterial(pointIndex).IsHull)
-        {
-            SetAndPropagateResultantPointHullness(pointIndex, true);
-        }
-    }
-
-
-    //
-    // 2. Do a first connectivity pass (for the first Update)
-    //
-
-    RunConnectivityVisit();
-}
-
-///////////////////////////////////////////////////////////////////////////////////
-// Mechanical Dynamics
-///////////////////////////////////////////////////////////////////////////////////
-
-void Ship::ApplyQueuedInteractionForces()
-{
-    for (auto const & interaction : mQueuedInteractions)
-    {
-        switch (interaction.Type)
-        {
-            case Interaction::InteractionType::Blast:
-            {
-                ApplyBlastAt(interaction.Arguments.Blast);
-
-                break;
-            }
-
-            case Interaction::InteractionType::Draw:
-            {
-                DrawTo(interaction.Arguments.Draw);
-
-                break;
-            }
-
-            case Interaction::InteractionType::Pull:
-            {
-                Pull(interaction.Arguments.Pull);
-
-                break;
-            }
-
-            case Interaction::InteractionType::Swirl:
-            {
-                SwirlAt(interaction.Arguments.Swirl);
-
-                break;
-            }
+        OceanSurface const & oceanSurface = mParentWorld.GetOceanSurface();
+        vec2f const * const positionsBuffer = mPoints.GetPositionBufferAsVec2();
+        float * const newCachedPointDepthsBuffer = newCachedPointDepths->data();
 
-            case Interaction::InteractionType::RadialWind:
+        threadPool.ParallelFor(
+            0,
+            mPoints.GetBufferElementCount(),
+            OceanDepthsMinPointsPerChunk,
+            [&](size_t begin, size_t end)
             {
-                ApplyRadialWindFrom(interaction.Arguments.RadialWind);
-
-                break;
-            }
-        }
+                oceanSurface.GetDepths(
+                    positionsBuffer + begin,
+                    end - begin,
+                    newCachedPointDepthsBuffer + begin);
+            });
     }
 
-    mQueuedInteractions.clear();
-}
-
-void Ship::ApplyWorldForces(
-    float effectiveAirDensity,
-    float effectiveWaterDensity,
-    GameParameters const & gameParameters,
-    Geometry::AABBSet & externalAabbSet)
-{
-    // New buffer to which new cached depths will be written to
-    std::shared_ptr<Buffer<float>> newCachedPointDepths = mPoints.AllocateWorkBufferFloat();
-
     //
     // Particle forces
     //
@@ -990,9 +1067,9 @@ void Ship::ApplyWorldForces(
     //
 
     if (gameParameters.DoDisplaceWater)
-        ApplyWorldSurfaceForces<true>(effectiveAirDensity, effectiveWaterDensity, *newCachedPointDepths, gameParameters, externalAabbSet);
+        ApplyWorldSurfaceForces<true>(effectiveAirDensity, effectiveWaterDensity, *newCachedPointDepths, gameParameters, externalAabbSet, threadPool);
     else
-        ApplyWorldSurfaceForces<false>(effectiveAirDensity, effectiveWaterDensity, *newCachedPointDepths, gameParameters, externalAabbSet);
+        ApplyWorldSurfaceForces<false>(effectiveAirDensity, effectiveWaterDensity, *newCachedPointDepths, gameParameters, externalAabbSet, threadPool);
 
     // Commit new particle depth buffer
     mPoints.SwapCachedDepthBuffer(*newCachedPointDepths);
@@ -1001,7 +1078,7 @@ void Ship::ApplyWorldForces(
 void Ship::ApplyWorldParticleForces(
     float effectiveAirDensity,
     float effectiveWaterDensity,
-    Buffer<float> & newCachedPointDepths,
+    Buffer<float> const & newCachedPointDepths,
     GameParameters const & gameParameters)
 {
     // Wind force:
@@ -1023,21 +1100,13 @@ void Ship::ApplyWorldParticleForces(
         GameParameters::WaterFrictionDragCoefficient
         * gameParameters.WaterFrictionDragAdjustment;
 
-    OceanSurface const & oceanSurface = mParentWorld.GetOceanSurface();
-
-    float * const restrict newCachedPointDepthsBuffer = newCachedPointDepths.data();
+    float const * const restrict newCachedPointDepthsBuffer = newCachedPointDepths.data();
     vec2f * const restrict staticForcesBuffer = mPoints.GetStaticForceBufferAsVec2();
 
     for (auto pointIndex : mPoints.BufferElements())
     {
         vec2f staticForce = vec2f::zero();
 
-        //
-        // Calculate and store depth
-        //
-
-        newCachedPointDepthsBuffer[pointIndex] = oceanSurface.GetDepth(mPoints.GetPosition(pointIndex));
-
         //
         // Calculate above/under-water coefficient
         //
@@ -1105,10 +1174,9 @@ void Ship::ApplyWorldSurfaceForces(
     float effectiveWaterDensity,
     Buffer<float> & newCachedPointDepths,
     GameParameters const & gameParameters,
-    Geometry::AABBSet & externalAabbSet)
+    Geometry::AABBSet & externalAabbSet,
+    ThreadPool & threadPool)
 {
-    float totalWaterDisplacementMagnitude = 0.0f;
-
     //
     // Drag constants
     //
@@ -1153,251 +1221,298 @@ void Ship::ApplyWorldSurfaceForces(
     float const wdmQuadraticB = 2.0f * wdmY0 / wdmX0 - wdmLinearSlope;
 
     //
-    // Visit all frontiers
+    // Visit all frontiers, in parallel
+    //
+    // Each task only writes its own frontiers and its own task state
     //
 
-    for (FrontierId frontierId : mFrontiers.GetFrontierIds())
+    auto const visitFrontiers = [&](FrontierForcesTaskState & taskState)
     {
-        // Initialize AABB and geometric center
-        Geometry::AABB aabb;
-        vec2f geometricCenter = vec2f::zero();
+        for (FrontierId frontierId : taskState.FrontierIds)
+        {
+            // Initialize AABB and geometric center
+            Geometry::AABB aabb;
+            vec2f geometricCenter = vec2f::zero();
 
-        auto & frontier = mFrontiers.GetFrontier(frontierId);
+            auto & frontier = mFrontiers.GetFrontier(frontierId);
 
-        // We only apply velocity drag and displace water for *external* frontiers,
-        // not for internal ones
-        if (frontier.Type == FrontierType::External)
-        {
-            //
-            // Visit all edges of this frontier
-            //
+            // We only apply velocity drag and displace water for *external* frontiers,
+            // not for internal ones
+            if (frontier.Type == FrontierType::External)
+            {
+                //
+                // Visit all edges of this frontier
+                //
 
-            assert(frontier.Size >= 3);
+                assert(frontier.Size >= 3);
 
-            ElementIndex const startEdgeIndex = frontier.StartingEdgeIndex;
+                ElementIndex const startEdgeIndex = frontier.StartingEdgeIndex;
 
-            // Take previous point
-            auto const & previousFrontierEdge = mFrontiers.GetFrontierEdge(startEdgeIndex);
-            vec2f previousPointPosition = mPoints.GetPosition(previousFrontierEdge.PointAIndex);
+                // Take previous point
+                auto const & previousFrontierEdge = mFrontiers.GetFrontierEdge(startEdgeIndex);
+                vec2f previousPointPosition = mPoints.GetPosition(previousFrontierEdge.PointAIndex);
 
-            // Take this point
-            auto const & thisFrontierEdge = mFrontiers.GetFrontierEdge(previousFrontierEdge.NextEdgeIndex);
-            ElementIndex thisPointIndex = thisFrontierEdge.PointAIndex;
-            vec2f thisPointPosition = mPoints.GetPosition(thisPointIndex);
+                // Take this point
+                auto const & thisFrontierEdge = mFrontiers.GetFrontierEdge(previousFrontierEdge.NextEdgeIndex);
+                ElementIndex thisPointIndex = thisFrontierEdge.PointAIndex;
+                vec2f thisPointPosition = mPoints.GetPosition(thisPointIndex);
 
 #ifdef _DEBUG
-            size_t visitedPoints = 0;
+                size_t visitedPoints = 0;
 #endif
 
-            ElementIndex const visitStartEdgeIndex = thisFrontierEdge.NextEdgeIndex;
+                ElementIndex const visitStartEdgeIndex = thisFrontierEdge.NextEdgeIndex;
 
-            for (ElementIndex nextEdgeIndex = visitStartEdgeIndex; /*checked in loop*/; /*advanced in loop*/)
-            {
+                for (ElementIndex nextEdgeIndex = visitStartEdgeIndex; /*checked in loop*/; /*advanced in loop*/)
+                {
 
 #ifdef _DEBUG
-                ++visitedPoints;
+                    ++visitedPoints;
 #endif
 
-                // Update AABB and geometric center with this point
-                aabb.ExtendTo(thisPointPosition);
-                geometricCenter += thisPointPosition;
-
-                // Get next edge and point
-                auto const & nextFrontierEdge = mFrontiers.GetFrontierEdge(nextEdgeIndex);
-                ElementIndex const nextPointIndex = nextFrontierEdge.PointAIndex;
-                vec2f const nextPointPosition = mPoints.GetPosition(nextPointIndex);
-
-                // Get point depth (positive at greater depths, negative over-water)
-                float const thisPointDepth = newCachedPointDepths[thisPointIndex];
-
-                //
-                // Drag force
-                //
-                // We would like to use a square law (i.e. drag force proportional to square
-                // of velocity), but then particles at high velocities become subject to
-                // enormous forces, which, for small masses - such as cloth - mean astronomical
-                // accelerations.
-                //
-                // We have to recourse then, again, to a linear law:
-                //
-                // F = - C * |V| * cos(a) * Nn
-                //
-                //      cos(a) == cos(angle between velocity and surface normal) == Vn dot Nn
-                //
-                // With this law, a particle's velocity is overcome by the drag force when its
-                // mass is <= C * dt, i.e. ~78Kg with water drag. Since this mass we do have in our sytem,
-                // we have to cap the force to prevent velocity overcome.
-                //
-
-                // Normal to surface - calculated between p1 and p3; points outside
-                vec2f const surfaceNormal = (nextPointPosition - previousPointPosition).normalise().to_perpendicular();
-
-                // Velocity along normal - capped to the same direction as velocity, to avoid suction force
-                // (i.e. drag force attracting surface facing opposite of velocity)
-                float const velocityMagnitudeAlongNormal = std::max(
-                    mPoints.GetVelocity(thisPointIndex).dot(surfaceNormal),
-                    0.0f);
-
-                // Max drag force magnitude: m * (V dot Nn) / dt
-                float const maxDragForceMagnitude =
-                    mPoints.GetMass(thisPointIndex) * velocityMagnitudeAlongNormal
-                    / GameParameters::SimulationStepTimeDuration<float>;
-
-                // Calculate drag coefficient: air or water, with soft transition
-                // to avoid discontinuities in drag force close to the air-water interface
-                float const dragCoefficient = Mix(
-                    airPressureDragCoefficient,
-                    waterPressureDragCoefficient,
-                    Clamp(thisPointDepth, 0.0f, 1.0f));
-
-                // Calculate magnitude of drag force (opposite sign), capped by max drag force
-                //  - C * |V| * cos(a) == - C * |V| * (Vn dot Nn) == -C * (V dot Nn)
-                float const dragForceMagnitude = std::min(
-                    dragCoefficient * velocityMagnitudeAlongNormal,
-                    maxDragForceMagnitude);
+                    // Update AABB and geometric center with this point
+                    aabb.ExtendTo(thisPointPosition);
+                    geometricCenter += thisPointPosition;
 
-                //
-                // Impact force
-                //
-                // Impact force is proportional to kinetic energy, and we only apply it
-                // when there's a discontinuity in the "underwaterness" of a frontier
-                // particle, i.e. when this is the first frame in which the particle
-                // gets underwater.
-                //
+                    // Get next edge and point
+                    auto const & nextFrontierEdge = mFrontiers.GetFrontierEdge(nextEdgeIndex);
+                    ElementIndex const nextPointIndex = nextFrontierEdge.PointAIndex;
+                    vec2f const nextPointPosition = mPoints.GetPosition(nextPointIndex);
 
-                float const kineticEnergy =
-                    velocityMagnitudeAlongNormal * velocityMagnitudeAlongNormal
-                    * mPoints.GetMass(thisPointIndex);
+                    // Get point depth (positive at greater depths, negative over-water)
+                    float const thisPointDepth = newCachedPointDepths[thisPointIndex];
 
-                float const waterImpactForceMagnitude =
-                    kineticEnergy
-                    * waterImpactForceCoefficient
-                    * Step(mPoints.GetCachedDepth(thisPointIndex), 0.0f) * Step(0.0f, newCachedPointDepths[thisPointIndex]);
+                    //
+                    // Drag force
+                    //
+                    // We would like to use a square law (i.e. drag force proportional to square
+                    // of velocity), but then particles at high velocities become subject to
+                    // enormous forces, which, for small masses - such as cloth - mean astronomical
+                    // accelerations.
+                    //
+                    // We have to recourse then, again, to a linear law:
+                    //
+                    // F = - C * |V| * cos(a) * Nn
+                    //
+                    //      cos(a) == cos(angle between velocity and surface normal) == Vn dot Nn
+                    //
+                    // With this law, a particle's velocity is overcome by the drag force when its
+                    // mass is <= C * dt, i.e. ~78Kg with water drag. Since this mass we do have in our sytem,
+                    // we have to cap the force to prevent velocity overcome.
+                    //
 
-                //
-                // Apply drag and impact forces
-                //
+                    // Normal to surface - calculated between p1 and p3; points outside
+                    vec2f const surfaceNormal = (nextPointPosition - previousPointPosition).normalise().to_perpendicular();
+
+                    // Velocity along normal - capped to the same direction as velocity, to avoid suction force
+                    // (i.e. drag force attracting surface facing opposite of velocity)
+                    float const velocityMagnitudeAlongNormal = std::max(
+                        mPoints.GetVelocity(thisPointIndex).dot(surfaceNormal),
+                        0.0f);
+
+                    // Max drag force magnitude: m * (V dot Nn) / dt
+                    float const maxDragForceMagnitude =
+                        mPoints.GetMass(thisPointIndex) * velocityMagnitudeAlongNormal
+                        / GameParameters::SimulationStepTimeDuration<float>;
+
+                    // Calculate drag coefficient: air or water, with soft transition
+                    // to avoid discontinuities in drag force close to the air-water interface
+                    float const dragCoefficient = Mix(
+                        airPressureDragCoefficient,
+                        waterPressureDragCoefficient,
+                        Clamp(thisPointDepth, 0.0f, 1.0f));
+
+                    // Calculate magnitude of drag force (opposite sign), capped by max drag force
+                    //  - C * |V| * cos(a) == - C * |V| * (Vn dot Nn) == -C * (V dot Nn)
+                    float const dragForceMagnitude = std::min(
+                        dragCoefficient * velocityMagnitudeAlongNormal,
+                        maxDragForceMagnitude);
 
-                mPoints.AddStaticForce(
-                    thisPointIndex,
-                    -surfaceNormal * (dragForceMagnitude + waterImpactForceMagnitude));
+                    //
+                    // Impact force
+                    //
+                    // Impact force is proportional to kinetic energy, and we only apply it
+                    // when there's a discontinuity in the "underwaterness" of a frontier
+                    // particle, i.e. when this is the first frame in which the particle
+                    // gets underwater.
+                    //
 
-                //
-                // Water displacement
-                //
-                // * The magnitude of water displacement is proportional to the square root of
-                //   the kinetic energy of the particle, thus it is proportional to the square
-                //   root of the particle mass, and linearly to the particle's velocity
-                //      * However, in order to generate visible waves also for very small velocities,
-                //        we want the contribution of small velocities to be more than linear wrt
-                //        the contribution of higher velocities, and so we'll be using a piecewise
-                //        function: quadratic for small velocities, and linear for higher
-                // * The deeper the particle is, the less it contributes to displacement
-                //
+                    float const kineticEnergy =
+                        velocityMagnitudeAlongNormal * velocityMagnitudeAlongNormal
+                        * mPoints.GetMass(thisPointIndex);
 
-                if constexpr (DoDisplaceWater)
-                {
-                    // Calculate vertical velocity, clamping it to a maximum to prevent
-                    // ocean surface instabilities with extremely high velocities
-                    float const verticalVelocity = mPoints.GetVelocity(thisPointIndex).y;
-                    float const absVerticalVelocity = std::min(
-                        std::abs(verticalVelocity),
-                        10000.0f); // Magic number
+                    float const waterImpactForceMagnitude =
+                        kineticEnergy
+                        * waterImpactForceCoefficient
+                        * Step(mPoints.GetCachedDepth(thisPointIndex), 0.0f) * Step(0.0f, newCachedPointDepths[thisPointIndex]);
 
                     //
-                    // Displacement magnitude calculation
+                    // Apply drag and impact forces
                     //
 
-                    float const linearDisplacementMagnitude = wdmY0 + wdmLinearSlope * (absVerticalVelocity - wdmX0);
-                    float const quadraticDisplacementMagnitude = wdmQuadraticA * absVerticalVelocity * absVerticalVelocity + wdmQuadraticB * absVerticalVelocity;
+                    taskState.PointForces.emplace_back(
+                        thisPointIndex,
+                        -surfaceNormal * (dragForceMagnitude + waterImpactForceMagnitude));
 
                     //
-                    // Depth attenuation: tapers down displacement the deeper the point is
+                    // Water displacement
+                    //
+                    // * The magnitude of water displacement is proportional to the square root of
+                    //   the kinetic energy of the particle, thus it is proportional to the square
+                    //   root of the particle mass, and linearly to the particle's velocity
+                    //      * However, in order to generate visible waves also for very small velocities,
+                    //        we want the contribution of small velocities to be more than linear wrt
+                    //        the contribution of higher velocities, and so we'll be using a piecewise
+                    //        function: quadratic for small velocities, and linear for higher
+                    // * The deeper the particle is, the less it contributes to displacement
                     //
 
-                    // Depth at which the point stops contributing: rises quadratically, asymptotically, and asymmetric wrt sinking or rising
-                    float constexpr MaxVel = 35.0f;
-                    float constexpr a2 = -0.5f / (MaxVel * MaxVel);
-                    float constexpr b2 = 1.0f / MaxVel;
-                    float const clampedAbsVerticalVelocity = std::min(absVerticalVelocity, MaxVel);
-                    float const maxDepth =
-                        (a2 * clampedAbsVerticalVelocity * clampedAbsVerticalVelocity + b2 * clampedAbsVerticalVelocity + 0.5f)
-                        * (verticalVelocity <= 0.0f ? 12.0f : 4.0f); // Keep up-push low or else bodies keep jumping up and down forever
+                    if constexpr (DoDisplaceWater)
+                    {
+                        // Calculate vertical velocity, clamping it to a maximum to prevent
+                        // ocean surface instabilities with extremely high velocities
+                        float const verticalVelocity = mPoints.GetVelocity(thisPointIndex).y;
+                        float const absVerticalVelocity = std::min(
+                            std::abs(verticalVelocity),
+                            10000.0f); // Magic number
+
+                        //
+                        // Displacement magnitude calculation
+                        //
+
+                        float const linearDisplacementMagnitude = wdmY0 + wdmLinearSlope * (absVerticalVelocity - wdmX0);
+                        float const quadraticDisplacementMagnitude = wdmQuadraticA * absVerticalVelocity * absVerticalVelocity + wdmQuadraticB * absVerticalVelocity;
+
+                        //
+                        // Depth attenuation: tapers down displacement the deeper the point is
+                        //
 
-                    // Linear attenuation up to maxDepth
-                    float const depthAttenuation = 1.0f - LinearStep(0.0f, maxDepth, thisPointDepth); // Tapers down contribution the deeper the point is
+                        // Depth at which the point stops contributing: rises quadratically, asymptotically, and asymmetric wrt sinking or rising
+                        float constexpr MaxVel = 35.0f;
+                        float constexpr a2 = -0.5f / (MaxVel * MaxVel);
+                        float constexpr b2 = 1.0f / MaxVel;
+                        float const clampedAbsVerticalVelocity = std::min(absVerticalVelocity, MaxVel);
+                        float const maxDepth =
+                            (a2 * clampedAbsVerticalVelocity * clampedAbsVerticalVelocity + b2 * clampedAbsVerticalVelocity + 0.5f)
+                            * (verticalVelocity <= 0.0f ? 12.0f : 4.0f); // Keep up-push low or else bodies keep jumping up and down forever
+
+                        // Linear attenuation up to maxDepth
+                        float const depthAttenuation = 1.0f - LinearStep(0.0f, maxDepth, thisPointDepth); // Tapers down contribution the deeper the point is
+
+                        //
+                        // Displacement
+                        //
+
+                        float const displacement =
+                            (absVerticalVelocity < wdmX0 ? quadraticDisplacementMagnitude : linearDisplacementMagnitude)
+                            * depthAttenuation
+                            * SignStep(0.0f, verticalVelocity) // Displacement has same sign as vertical velocity
+                            * Step(0.0f, thisPointDepth) // No displacement for above-water points
+                            * 0.4f; // Magic number
+
+                        taskState.OceanSurfaceDisplacements.emplace_back(thisPointPosition.x, displacement);
+
+                        taskState.TotalWaterDisplacementMagnitude += std::abs(displacement);
+                    }
 
                     //
-                    // Displacement
+                    // Advance edge in the frontier visit
                     //
 
-                    float const displacement =
-                        (absVerticalVelocity < wdmX0 ? quadraticDisplacementMagnitude : linearDisplacementMagnitude)
-                        * depthAttenuation
-                        * SignStep(0.0f, verticalVelocity) // Displacement has same sign as vertical velocity
-                        * Step(0.0f, thisPointDepth) // No displacement for above-water points
-                        * 0.4f; // Magic number
-
-                    mParentWorld.DisplaceOceanSurfaceAt(thisPointPosition.x, displacement);
+                    nextEdgeIndex = nextFrontierEdge.NextEdgeIndex;
+                    if (nextEdgeIndex == visitStartEdgeIndex)
+                        break;
 
-                    totalWaterDisplacementMagnitude += std::abs(displacement);
+                    previousPointPosition = thisPointPosition;
+                    thisPointPosition = nextPointPosition;
+                    thisPointIndex = nextPointIndex;
                 }
 
+#ifdef _DEBUG
+                assert(visitedPoints == frontier.Size);
+#endif
+            }
+            else
+            {
                 //
-                // Advance edge in the frontier visit
+                // Simply update AABB and geometric center
                 //
 
-                nextEdgeIndex = nextFrontierEdge.NextEdgeIndex;
-                if (nextEdgeIndex == visitStartEdgeIndex)
-                    break;
+                ElementIndex const frontierStartEdge = frontier.StartingEdgeIndex;
 
-                previousPointPosition = thisPointPosition;
-                thisPointPosition = nextPointPosition;
-                thisPointIndex = nextPointIndex;
+                for (ElementIndex edgeIndex = frontierStartEdge; /*checked in loop*/; /*advanced in loop*/)
+                {
+                    auto const & frontierEdge = mFrontiers.GetFrontierEdge(edgeIndex);
+
+                    // Update AABB and geometric center with this point
+                    auto const pointPosition = mPoints.GetPosition(frontierEdge.PointAIndex);
+                    aabb.ExtendTo(pointPosition);
+                    geometricCenter += pointPosition;
+
+                    // Advance
+                    edgeIndex = frontierEdge.NextEdgeIndex;
+                    if (edgeIndex == frontierStartEdge)
+                        break;
+                }
             }
 
-#ifdef _DEBUG
-            assert(visitedPoints == frontier.Size);
-#endif
-        }
-        else
-        {
             //
-            // Simply update AABB and geometric center
+            // Finalize AABB and geometric center update
             //
 
-            ElementIndex const frontierStartEdge = frontier.StartingEdgeIndex;
+            geometricCenter /= static_cast<float>(frontier.Size);
 
-            for (ElementIndex edgeIndex = frontierStartEdge; /*checked in loop*/; /*advanced in loop*/)
+            // Store AABB and geometric center in frontier
+            frontier.AABB = aabb;
+            frontier.GeometricCenterPosition = geometricCenter;
+        }
+    };
+
+    size_t const taskCount = PrepareFrontierForcesTaskStates(false);
+    for (size_t t = 0; t < taskCount; ++t)
+    {
+        mFrontierForcesTasks.emplace_back(
+            [this, t, &visitFrontiers]()
             {
-                auto const & frontierEdge = mFrontiers.GetFrontierEdge(edgeIndex);
+                visitFrontiers(mFrontierForcesTaskStates[t]);
+            });
+    }
 
-                // Update AABB and geometric center with this point
-                auto const pointPosition = mPoints.GetPosition(frontierEdge.PointAIndex);
-                aabb.ExtendTo(pointPosition);
-                geometricCenter += pointPosition;
+    threadPool.RunAndClear(mFrontierForcesTasks);
 
-                // Advance
-                edgeIndex = frontierEdge.NextEdgeIndex;
-                if (edgeIndex == frontierStartEdge)
-                    break;
-            }
-        }
+    //
+    // Apply the tasks' results, in task order
+    //
 
-        //
-        // Finalize AABB and geometric center update
-        //
+    float totalWaterDisplacementMagnitude = 0.0f;
+
+    for (size_t t = 0; t < taskCount; ++t)
+    {
+        auto const & taskState = mFrontierForcesTaskStates[t];
+
+        for (auto const & pointForce : taskState.PointForces)
+        {
+            mPoints.AddStaticForce(pointForce.PointIndex, pointForce.Force);
+        }
 
-        geometricCenter /= static_cast<float>(frontier.Size);
+        if constexpr (DoDisplaceWater)
+        {
+            for (auto const & displacement : taskState.OceanSurfaceDisplacements)
+            {
+                mParentWorld.DisplaceOceanSurfaceAt(displacement.X, displacement.Displacement);
+            }
 
-        // Store AABB and geometric center in frontier
-        frontier.AABB = aabb;
-        frontier.GeometricCenterPosition = geometricCenter;
+            totalWaterDisplacementMagnitude += taskState.TotalWaterDisplacementMagnitude;
+        }
+    }
 
-        // Store AABB in AABB set, but only if external
+    // Store AABBs of external frontiers in AABB set
+    for (FrontierId frontierId : mFrontiers.GetFrontierIds())
+    {
+        auto const & frontier = mFrontiers.GetFrontier(frontierId);
         if (frontier.Type == FrontierType::External)
         {
-            externalAabbSet.Add(aabb);
+            externalAabbSet.Add(frontier.AABB);
         }
     }
 
@@ -1410,7 +1525,8 @@ void Ship::ApplyWorldSurfaceForces(
 void Ship::ApplyStaticPressureForces(
     float effectiveAirDensity,
     float effectiveWaterDensity,
-    GameParameters const & gameParameters)
+    GameParameters const & gameParameters,
+    ThreadPool & threadPool)
 {
     //
     // At this moment, dynamic forces are all zero - we are the first populating those
@@ -1424,26 +1540,50 @@ void Ship::ApplyStaticPressureForces(
             return v == vec2f::zero();
         }));
 
-    // Initialize stats
+    // Visit all external frontiers in parallel, and calculate static pressure forces on each
+    size_t const taskCount = PrepareFrontierForcesTaskStates(true);
+    for (size_t t = 0; t < taskCount; ++t)
+    {
+        mFrontierForcesTasks.emplace_back(
+            [this, t, effectiveAirDensity, effectiveWaterDensity, &gameParameters]()
+            {
+                auto & taskState = mFrontierForcesTaskStates[t];
+                for (FrontierId const frontierId : taskState.FrontierIds)
+                {
+                    ApplyStaticPressureForces(
+                        mFrontiers.GetFrontier(frontierId),
+                        effectiveAirDensity,
+                        effectiveWaterDensity,
+                        gameParameters,
+                        taskState);
+                }
+            });
+    }
+
+    threadPool.RunAndClear(mFrontierForcesTasks);
+
+    //
+    // Apply the tasks' results, in task order
+    //
+
     mStaticPressureNetForceMagnitudeSum = 0.0f;
     mStaticPressureNetForceMagnitudeCount = 0.0f;
     mStaticPressureIterationsPercentagesSum = 0.0f;
     mStaticPressureIterationsCount = 0.0f;
 
-    // Visit all frontiers and apply static pressure forces on each
-    for (FrontierId const frontierId : mFrontiers.GetFrontierIds())
+    for (size_t t = 0; t < taskCount; ++t)
     {
-        auto const & frontier = mFrontiers.GetFrontier(frontierId);
+        auto const & taskState = mFrontierForcesTaskStates[t];
 
-        // Only consider external frontiers
-        if (frontier.Type == FrontierType::External)
+        for (auto const & pointForce : taskState.PointForces)
         {
-            ApplyStaticPressureForces(
-                frontier,
-                effectiveAirDensity,
-                effectiveWaterDensity,
-                gameParameters);
+            mPoints.AddDynamicForce(pointForce.PointIndex, pointForce.Force);
         }
+
+        mStaticPressureNetForceMagnitudeSum += taskState.StaticPressureNetForceMagnitudeSum;
+        mStaticPressureNetForceMagnitudeCount += taskState.StaticPressureNetForceMagnitudeCount;
+        mStaticPressureIterationsPercentagesSum += taskState.StaticPressureIterationsPercentagesSum;
+        mStaticPressureIterationsCount += taskState.StaticPressureIterationsCount;
     }
 }
 
@@ -1451,7 +1591,8 @@ void Ship::ApplyStaticPressureForces(
     Frontiers::Frontier const & frontier,
     float effectiveAirDensity,
     float effectiveWaterDensity,
-    GameParameters const & gameParameters)
+    GameParameters const & gameParameters,
+    FrontierForcesTaskState & taskState)
 {
     //
     // The hydrostatic pressure force acting on point P, between edges
@@ -1522,7 +1663,8 @@ void Ship::ApplyStaticPressureForces(
     // proportional to its length
     //
 
-    mStaticPressureBuffer.clear();
+    auto & staticPressureBuffer = taskState.StaticPressureBuffer;
+    staticPressureBuffer.clear();
 
     vec2f netForce = vec2f::zero();
     float netTorque = 0.0f;
@@ -1575,7 +1717,7 @@ void Ship::ApplyStaticPressureForces(
             vec2f const forceVector = (edge1PerpVector + edge2PerpVector) / 2.0f * internalPressureCounterbalanceFactor;
             vec2f const torqueArm = mPoints.GetPosition(thisPointIndex) - geometricCenterPosition;
 
-            mStaticPressureBuffer.emplace_back(
+            staticPressureBuffer.emplace_back(
                 thisPointIndex,
                 forceVector,
                 torqueArm);
@@ -1632,9 +1774,9 @@ void Ship::ApplyStaticPressureForces(
 
             float minNetForceMagnitude = std::numeric_limits<float>::max();
             float minNetTorqueMagnitude = std::numeric_limits<float>::max();
-            for (size_t hpi = 0; hpi < mStaticPressureBuffer.GetCurrentPopulatedSize(); ++hpi)
+            for (size_t hpi = 0; hpi < staticPressureBuffer.size(); ++hpi)
             {
-                auto const & hp = mStaticPressureBuffer[hpi];
+                auto const & hp = staticPressureBuffer[hpi];
 
                 vec2f const & thisForce = hp.ForceVector;
 
@@ -1673,9 +1815,9 @@ void Ship::ApplyStaticPressureForces(
 
             float minNetForceMagnitude = std::numeric_limits<float>::max();
             float minNetTorqueMagnitude = std::numeric_limits<float>::max();
-            for (size_t hpi = 0; hpi < mStaticPressureBuffer.GetCurrentPopulatedSize(); ++hpi)
+            for (size_t hpi = 0; hpi < staticPressureBuffer.size(); ++hpi)
             {
-                auto const & hp = mStaticPressureBuffer[hpi];
+                auto const & hp = staticPressureBuffer[hpi];
 
                 vec2f const & thisForce = hp.ForceVector;
                 float const thisTorque = hp.TorqueArm.cross(thisForce);
@@ -1712,11 +1854,11 @@ void Ship::ApplyStaticPressureForces(
             break;
         }
 
-        vec2f const thisForce = mStaticPressureBuffer[*bestHPIndex].ForceVector;
-        float const thisTorque = mStaticPressureBuffer[*bestHPIndex].TorqueArm.cross(thisForce);
+        vec2f const thisForce = staticPressureBuffer[*bestHPIndex].ForceVector;
+        float const thisTorque = staticPressureBuffer[*bestHPIndex].TorqueArm.cross(thisForce);
 
         // Adjust force vector of optimal particle
-        mStaticPressureBuffer[*bestHPIndex].ForceVector *= bestLambda;
+        staticPressureBuffer[*bestHPIndex].ForceVector *= bestLambda;
 
         // Update net force and torque
         netForce -= thisForce * (1.0f - bestLambda);
@@ -1724,10 +1866,10 @@ void Ship::ApplyStaticPressureForces(
     }
 
     // Update stats
-    mStaticPressureNetForceMagnitudeSum += netForce.length();
-    mStaticPressureNetForceMagnitudeCount += 1.0f;
-    mStaticPressureIterationsPercentagesSum += static_cast<float>(iter + 1) / static_cast<float>(frontier.Size);
-    mStaticPressureIterationsCount += 1.0f;
+    taskState.StaticPressureNetForceMagnitudeSum += netForce.length();
+    taskState.StaticPressureNetForceMagnitudeCount += 1.0f;
+    taskState.StaticPressureIterationsPercentagesSum += static_cast<float>(iter + 1) / static_cast<float>(frontier.Size);
+    taskState.StaticPressureIterationsCount += 1.0f;
 
     //
     // 3. Apply forces as dynamic forces - so they only apply to current positions,
@@ -1740,13 +1882,91 @@ void Ship::ApplyStaticPressureForces(
         * gameParameters.StaticPressureForceAdjustment
         * mRepairGracePeriodMultiplier; // Static pressure hinders the repair process
 
-    size_t const particleCount = mStaticPressureBuffer.GetCurrentPopulatedSize();
+    size_t const particleCount = staticPressureBuffer.size();
     for (size_t hpi = 0; hpi < particleCount; ++hpi)
     {
-        mPoints.AddDynamicForce(
-            mStaticPressureBuffer[hpi].PointIndex,
-            mStaticPressureBuffer[hpi].ForceVector * forceMultiplier);
+        taskState.PointForces.emplace_back(
+            staticPressureBuffer[hpi].PointIndex,
+            staticPressureBuffer[hpi].ForceVector * forceMultiplier);
+    }
+}
+
+void Ship::RecalculateFrontierForcesParallelism(size_t simulationParallelism)
+{
+    //
+    // The number of frontiers changes continuously, hence here we only prepare
+    // the states of the maximum number of tasks, and at each visit we decide
+    // how many of them to use
+    //
+
+    LogMessage("Ship::RecalculateFrontierForcesParallelism: simulationParallelism=", simulationParallelism);
+
+    mFrontierForcesTaskStates.clear();
+    mFrontierForcesTaskStates.resize(simulationParallelism);
+}
+
+size_t Ship::PrepareFrontierForcesTaskStates(bool externalOnly)
+{
+    assert(!mFrontierForcesTaskStates.empty());
+
+    //
+    // Calculate the number of tasks, based on the number of edges to visit
+    //
+
+    ElementCount totalEdgeCount = 0;
+    for (FrontierId const frontierId : mFrontiers.GetFrontierIds())
+    {
+        auto const & frontier = mFrontiers.GetFrontier(frontierId);
+        if (!externalOnly || frontier.Type == FrontierType::External)
+        {
+            totalEdgeCount += frontier.Size;
+        }
+    }
+
+    size_t const taskCount = std::max(
+        std::min(static_cast<size_t>(totalEdgeCount / FrontierForcesMinEdgesPerTask), mFrontierForcesTaskStates.size()),
+        size_t(1));
+
+    for (size_t t = 0; t < taskCount; ++t)
+    {
+        auto & taskState = mFrontierForcesTaskStates[t];
+
+        taskState.FrontierIds.clear();
+        taskState.PointForces.clear();
+        taskState.OceanSurfaceDisplacements.clear();
+        taskState.TotalWaterDisplacementMagnitude = 0.0f;
+        taskState.StaticPressureNetForceMagnitudeSum = 0.0f;
+        taskState.StaticPressureNetForceMagnitudeCount = 0.0f;
+        taskState.StaticPressureIterationsPercentagesSum = 0.0f;
+        taskState.StaticPressureIterationsCount = 0.0f;
+    }
+
+    //
+    // Distribute frontiers in consecutive runs, each run having about the same
+    // number of edges; a frontier is never split, hence a single huge frontier
+    // might leave some tasks empty
+    //
+
+    size_t currentTask = 0;
+    ElementCount currentEdgeCount = 0;
+    for (FrontierId const frontierId : mFrontiers.GetFrontierIds())
+    {
+        auto const & frontier = mFrontiers.GetFrontier(frontierId);
+        if (!externalOnly || frontier.Type == FrontierType::External)
+        {
+            mFrontierForcesTaskStates[currentTask].FrontierIds.push_back(frontierId);
+            currentEdgeCount += frontier.Size;
+
+            // Move on to next task once this one has its share of the edges
+            if (currentTask < taskCount - 1
+                && static_cast<size_t>(currentEdgeCount) * taskCount >= static_cast<size_t>(totalEdgeCount) * (currentTask + 1))
+            {
+                ++currentTask;
+            }
+        }
     }
+
+    return taskCount;
 }
 
 void Ship::HandleCollisionsWithSeaFloor(
@@ -1910,6 +2130,57 @@ void Ship::TrimForWorldBounds(GameParameters const & gameParameters)
 #endif
 }
 
+void Ship::RecalculateSpringStrainsParallelism(size_t simulationParallelism)
+{
+    // Clear threading state
+    mSpringStrainTasks.clear();
+
+    //
+    // Given the available simulation parallelism as a constraint (max), calculate
+    // the best parallelism for the strain calculation
+    //
+
+    ElementCount const numberOfSprings = mSprings.GetElementCount();
+
+    size_t const springStrainsParallelism = std::max(
+        std::min(static_cast<size_t>(numberOfSprings) / 10000, simulationParallelism),
+        size_t(1));
+
+    LogMessage("Ship::RecalculateSpringStrainsParallelism: springs=", numberOfSprings, " simulationParallelism=", simulationParallelism,
+        " springStrainsParallelism=", springStrainsParallelism);
+
+    mSpringStrainResults.resize(springStrainsParallelism);
+
+    //
+    // Prepare tasks
+    //
+    // Tasks work on consecutive ranges, so that the concatenation of their results
+    // is in spring index order
+    //
+
+    ElementCount const numberOfSpringsPerThread = numberOfSprings / static_cast<ElementCount>(springStrainsParallelism);
+
+    ElementIndex springStart = 0;
+    for (size_t t = 0; t < springStrainsParallelism; ++t)
+    {
+        ElementIndex const springEnd = (t < springStrainsParallelism - 1)
+            ? springStart + numberOfSpringsPerThread
+            : numberOfSprings;
+
+        mSpringStrainTasks.emplace_back(
+            [this, t, springStart, springEnd]()
+            {
+                mSprings.CalculateStrains(
+                    springStart,
+                    springEnd,
+                    mPoints,
+                    mSpringStrainResults[t]);
+            });
+
+        springStart = springEnd;
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////
 // Pressure and water Dynamics
 ///////////////////////////////////////////////////////////////////////////////////
@@ -1948,582 +2219,413 @@ void Ship::UpdatePressureAndWaterInflow(
     float const cumulatedIntakenWaterThresholdForAirBubbles =
         GameParameters::AirBubblesDensityToCumulatedIntakenWater(gameParameters.AirBubblesDensity);
 
-    for (auto pointIndex : mPoints.RawShipPoints())
+    // We expect a tiny fraction of all points to be leaking at any moment,
+    // hence we only visit the points that are
+    for (auto pointIndex : mPoints.GetLeakingPoints())
     {
-        // This is one of the few cases in which we prefer branching over calculating
-        // for all points, mostly because we expect a tiny fraction of all points to
-        // be leaking at any moment
         auto const & pointCompositeLeaking = mPoints.GetLeakingComposite(pointIndex);
-        if (pointCompositeLeaking.IsCumulativelyLeaking)
-        {
-            assert(!mPoints.GetIsHull(pointIndex)); // Hull points are never leaking
-
-            float const pointDepth = mPoints.GetCachedDepth(pointIndex);
-
-            // External water height
-            //
-            // We also incorporate rain in the sources of external water height:
-            // - If point is below water surface: external water height is due to depth
-            // - If point is above water surface: external water height is due to rain
-            float const externalWaterHeight = std::max(
-                pointDepth + 0.1f, // Magic number to force flotsam to take some water in and eventually sink
-                rainEquivalentWaterHeight); // At most is one meter, so does not interfere with underwater pressure
-
-            // Internal water height
-            float const internalWaterHeight = mPoints.GetWater(pointIndex);
-
-            float totalDeltaWater = 0.0f;
+        assert(pointCompositeLeaking.IsCumulativelyLeaking);
 
-            if (pointCompositeLeaking.LeakingSources.StructuralLeak != 0.0f)
-            {
-                //
-                // 1. Update water due to structural leaks (holes)
-                //
-
-                {
-                    //
-                    // 1.1) Calculate velocity of incoming water, based off Bernoulli's equation applied to point:
-                    //  v**2/2 + p/density = c (assuming y of incoming water does not change along the intake)
-                    //      With: p = pressure of water at point = d*wh*g (d = water density, wh = water height in point)
-                    //
-                    // Considering that at equilibrium we have v=0 and p=external_pressure,
-                    // then c=external_pressure/density;
-                    // external_pressure is height_of_water_at_y*g*density, then c=height_of_water_at_y*g;
-                    // hence, the velocity of water incoming at point p, when the "water height" in the point is already
-                    // wh and the external water pressure is d*height_of_water_at_y*g, is:
-                    //  v = +/- sqrt(2*g*|height_of_water_at_y-wh|)
-                    //
-
-                    float incomingWaterVelocity_Structural;
-                    if (externalWaterHeight >= internalWaterHeight)
-                    {
-                        // Incoming water
-                        incomingWaterVelocity_Structural = sqrtf(2.0f * GameParameters::GravityMagnitude * (externalWaterHeight - internalWaterHeight));
-                    }
-                    else
-                    {
-                        // Outgoing water
-                        incomingWaterVelocity_Structural = -sqrtf(2.0f * GameParameters::GravityMagnitude * (internalWaterHeight - externalWaterHeight));
-                    }
+        assert(!mPoints.GetIsHull(pointIndex)); // Hull points are never leaking
 
-                    //
-                    // 1.2) In/Outtake water according to velocity:
-                    // - During dt, we move a volume of water Vw equal to A*v*dt; the equivalent change in water
-                    //   height is thus Vw/A, i.e. v*dt
-                    //
+        float const pointDepth = mPoints.GetCachedDepth(pointIndex);
 
-                    float deltaWater_Structural =
-                        incomingWaterVelocity_Structural
-                        * GameParameters::SimulationStepTimeDuration<float>
-                        * mPoints.GetMaterialWaterIntake(pointIndex)
-                        * gameParameters.WaterIntakeAdjustment;
-
-                    //
-                    // 1.3) Update water
-                    //
-
-                    if (deltaWater_Structural < 0.0f)
-                    {
-                        // Outgoing water
-
-                        // Make sure we don't over-drain the point
-                        deltaWater_Structural = std::max(-mPoints.GetWater(pointIndex), deltaWater_Structural);
-
-                        // Honor the water retention of this material
-                        deltaWater_Structural *= mPoints.GetMaterialWaterRestitution(pointIndex);
-                    }
-
-                    // Adjust water
-                    mPoints.SetWater(
-                        pointIndex,
-                        mPoints.GetWater(pointIndex) + deltaWater_Structural);
-
-                    totalDeltaWater += deltaWater_Structural;
-                }
+        // External water height
+        //
+        // We also incorporate rain in the sources of external water height:
+        // - If point is below water surface: external water height is due to depth
+        // - If point is above water surface: external water height is due to rain
+        float const externalWaterHeight = std::max(
+            pointDepth + 0.1f, // Magic number to force flotsam to take some water in and eventually sink
+            rainEquivalentWaterHeight); // At most is one meter, so does not interfere with underwater pressure
 
-                //
-                // 2. Update internal pressure due to structural leaks (holes)
-                //    (positive is incoming)
-                //
-                //    Structural delta pressure is independent from structural delta water
-                //
+        // Internal water height
+        float const internalWaterHeight = mPoints.GetWater(pointIndex);
 
-                {
-                    float const externalPressure = Formulae::CalculateTotalPressureAt(
-                        mPoints.GetPosition(pointIndex).y,
-                        mPoints.GetPosition(pointIndex).y + pointDepth, // oceanSurfaceY
-                        effectiveAirDensity,
-                        effectiveWaterDensity,
-                        gameParameters);
+        float totalDeltaWater = 0.0f;
 
-                    mPoints.SetInternalPressure(
-                        pointIndex,
-                        externalPressure);
-                }
-            }
+        if (pointCompositeLeaking.LeakingSources.StructuralLeak != 0.0f)
+        {
+            //
+            // 1. Update water due to structural leaks (holes)
+            //
 
-            float const waterPumpForce = pointCompositeLeaking.LeakingSources.WaterPumpForce;
-            if (waterPumpForce != 0.0f)
             {
                 //
-                // 3) Update water due to forced leaks (pumps)
-                //    (positive is incoming)
+                // 1.1) Calculate velocity of incoming water, based off Bernoulli's equation applied to point:
+                //  v**2/2 + p/density = c (assuming y of incoming water does not change along the intake)
+                //      With: p = pressure of water at point = d*wh*g (d = water density, wh = water height in point)
+                //
+                // Considering that at equilibrium we have v=0 and p=external_pressure,
+                // then c=external_pressure/density;
+                // external_pressure is height_of_water_at_y*g*density, then c=height_of_water_at_y*g;
+                // hence, the velocity of water incoming at point p, when the "water height" in the point is already
+                // wh and the external water pressure is d*height_of_water_at_y*g, is:
+                //  v = +/- sqrt(2*g*|height_of_water_at_y-wh|)
                 //
 
-                float deltaWater_Forced = 0.0f;
-                if (waterPumpForce > 0.0f)
+                float incomingWaterVelocity_Structural;
+                if (externalWaterHeight >= internalWaterHeight)
                 {
-                    // Inward pump: only works if underwater
-                    deltaWater_Forced = (externalWaterHeight > 0.0f)
-                        ? waterPumpForce * waterPumpPowerMultiplier // No need to cap as sea is infinite
-                        : 0.0f;
+                    // Incoming water
+                    incomingWaterVelocity_Structural = sqrtf(2.0f * GameParameters::GravityMagnitude * (externalWaterHeight - internalWaterHeight));
                 }
                 else
                 {
-                    // Outward pump: only works if water inside
-                    deltaWater_Forced = (internalWaterHeight > 0.0f)
-                        ? waterPumpForce * waterPumpPowerMultiplier // We'll cap it
-                        : 0.0f;
+                    // Outgoing water
+                    incomingWaterVelocity_Structural = -sqrtf(2.0f * GameParameters::GravityMagnitude * (internalWaterHeight - externalWaterHeight));
                 }
 
-                // Make sure we don't over-drain the point
-                deltaWater_Forced = std::max(-mPoints.GetWater(pointIndex), deltaWater_Forced);
-
-                // Adjust water
-                mPoints.SetWater(
-                    pointIndex,
-                    mPoints.GetWater(pointIndex) + deltaWater_Forced);
+                //
+                // 1.2) In/Outtake water according to velocity:
+                // - During dt, we move a volume of water Vw equal to A*v*dt; the equivalent change in water
+                //   height is thus Vw/A, i.e. v*dt
+                //
 
-                totalDeltaWater += deltaWater_Forced;
+                float deltaWater_Structural =
+                    incomingWaterVelocity_Structural
+                    * GameParameters::SimulationStepTimeDuration<float>
+                    * mPoints.GetMaterialWaterIntake(pointIndex)
+                    * gameParameters.WaterIntakeAdjustment;
 
                 //
-                // 4) Update pressure due to forced leaks (pumps)
-                //    (positive is incoming)
-                //
-                //    Forced delta pressure depends on (effective) forced delta water only
+                // 1.3) Update water
                 //
 
-                float const deltaPressure_Forced = deltaWater_Forced * volumetricWaterPressure;
+                if (deltaWater_Structural < 0.0f)
+                {
+                    // Outgoing water
 
-                mPoints.SetInternalPressure(
+                    // Make sure we don't over-drain the point
+                    deltaWater_Structural = std::max(-mPoints.GetWater(pointIndex), deltaWater_Structural);
+
+                    // Honor the water retention of this material
+                    deltaWater_Structural *= mPoints.GetMaterialWaterRestitution(pointIndex);
+                }
+
+                // Adjust water
+                mPoints.SetWater(
                     pointIndex,
-                    std::max(mPoints.GetInternalPressure(pointIndex) + deltaPressure_Forced, 0.0f)); // Make sure we don't over-drain the point
+                    mPoints.GetWater(pointIndex) + deltaWater_Structural);
+
+                totalDeltaWater += deltaWater_Structural;
             }
 
             //
-            // 5) Check if it's time to produce air bubbles
+            // 2. Update internal pressure due to structural leaks (holes)
+            //    (positive is incoming)
+            //
+            //    Structural delta pressure is independent from structural delta water
             //
 
-            mPoints.GetCumulatedIntakenWater(pointIndex) += totalDeltaWater;
-            if (mPoints.GetCumulatedIntakenWater(pointIndex) > cumulatedIntakenWaterThresholdForAirBubbles)
             {
-                // Generate air bubbles - but not on ropes as that looks awful
-                if (doGenerateAirBubbles
-                    && !mPoints.IsRope(pointIndex))
-                {
-                    GenerateAirBubble(
-                        mPoints.GetPosition(pointIndex),
-                        pointDepth,
-                        mPoints.GetTemperature(pointIndex),
-                        currentSimulationTime,
-                        mPoints.GetPlaneId(pointIndex),
-                        gameParameters);
-                }
-
-                // Consume all cumulated water
-                mPoints.GetCumulatedIntakenWater(pointIndex) = 0.0f;
-            }
+                float const externalPressure = Formulae::CalculateTotalPressureAt(
+                    mPoints.GetPosition(pointIndex).y,
+                    mPoints.GetPosition(pointIndex).y + pointDepth, // oceanSurfaceY
+                    effectiveAirDensity,
+                    effectiveWaterDensity,
+                    gameParameters);
 
-            // Adjust total water taken during this step, but not counting
-            // ropes, to prevent "rushing water" sound from playing for
-            // ropes, and also to prevent rope-only ships from playing
-            // "farewell"
-            if (!mPoints.IsRope(pointIndex))
-            {
-                waterTakenInStep += totalDeltaWater;
+                mPoints.SetInternalPressure(
+                    pointIndex,
+                    externalPressure);
             }
         }
-    }
-}
-
-void Ship::EqualizeInternalPressure(GameParameters const & /*gameParameters*/)
-{
-    // Local cache of indices of other endpoints
-    FixedSizeVector<ElementIndex, GameParameters::MaxSpringsPerPoint> otherEndpoints;
-
-    //
-    // For each (non-ephemeral) point, equalize its internal pressure with its
-    // neighbors
-    //
 
-    float * restrict internalPressureBufferData = mPoints.GetInternalPressureBufferAsFloat();
-    bool const * restrict isHullBufferData = mPoints.GetIsHullBuffer();
-
-    for (auto pointIndex : mPoints.RawShipPoints()) // No need to visit ephemeral points as they have no springs
-    {
-        if (!isHullBufferData[pointIndex])
+        float const waterPumpForce = pointCompositeLeaking.LeakingSources.WaterPumpForce;
+        if (waterPumpForce != 0.0f)
         {
             //
-            // Non-hull particle: flow its surplus pressure to its neighbors
+            // 3) Update water due to forced leaks (pumps)
+            //    (positive is incoming)
             //
 
-            float const internalPressure = internalPressureBufferData[pointIndex];
-
-            //
-            // 1. Calculate average internal pressure among this particle and all its neighbors that have
-            // lower internal pressure
-            //
-
-            float averageInternalPressure = internalPressure;
-            float targetEndpointsCount = 1.0f;
-
-            for (auto const & cs : mPoints.GetConnectedSprings(pointIndex).ConnectedSprings)
+            float deltaWater_Forced = 0.0f;
+            if (waterPumpForce > 0.0f)
+            {
+                // Inward pump: only works if underwater
+                deltaWater_Forced = (externalWaterHeight > 0.0f)
+                    ? waterPumpForce * waterPumpPowerMultiplier // No need to cap as sea is infinite
+                    : 0.0f;
+            }
+            else
             {
-                ElementIndex const otherEndpointIndex = cs.OtherEndpointIndex;
+                // Outward pump: only works if water inside
+                deltaWater_Forced = (internalWaterHeight > 0.0f)
+                    ? waterPumpForce * waterPumpPowerMultiplier // We'll cap it
+                    : 0.0f;
+            }
 
-                // We only consider outgoing pressure, not towards hull points
-                float const otherEndpointInternalPressure = internalPressureBufferData[otherEndpointIndex];
-                if (internalPressure > otherEndpointInternalPressure
-                    && !isHullBufferData[otherEndpointIndex])
-                {
-                    averageInternalPressure += otherEndpointInternalPressure;
-                    targetEndpointsCount += 1.0f;
+            // Make sure we don't over-drain the point
+            deltaWater_Forced = std::max(-mPoints.GetWater(pointIndex), deltaWater_Forced);
 
-                    otherEndpoints.emplace_back(otherEndpointIndex);
-                }
-            }
+            // Adjust water
+            mPoints.SetWater(
+                pointIndex,
+                mPoints.GetWater(pointIndex) + deltaWater_Forced);
 
-            averageInternalPressure /= targetEndpointsCount;
+            totalDeltaWater += deltaWater_Forced;
 
             //
-            // 2. Distribute surplus pressure
+            // 4) Update pressure due to forced leaks (pumps)
+            //    (positive is incoming)
+            //
+            //    Forced delta pressure depends on (effective) forced delta water only
             //
 
-            internalPressureBufferData[pointIndex] = averageInternalPressure;
-
-            for (auto const & otherEndpointIndex : otherEndpoints)
-            {
-                internalPressureBufferData[otherEndpointIndex] = averageInternalPressure;
-            }
+            float const deltaPressure_Forced = deltaWater_Forced * volumetricWaterPressure;
 
-            otherEndpoints.clear();
+            mPoints.SetInternalPressure(
+                pointIndex,
+                std::max(mPoints.GetInternalPressure(pointIndex) + deltaPressure_Forced, 0.0f)); // Make sure we don't over-drain the point
         }
-        else
-        {
-            //
-            // Hull particle: set its internal pressure to the average internal pressure
-            // of all its non-hull neighbors
-            //
 
-            float averageInternalPressure = 0.0f;
-            float neighborsCount = 0.0f;
+        //
+        // 5) Check if it's time to produce air bubbles
+        //
 
-            for (auto const & cs : mPoints.GetConnectedSprings(pointIndex).ConnectedSprings)
+        mPoints.GetCumulatedIntakenWater(pointIndex) += totalDeltaWater;
+        if (mPoints.GetCumulatedIntakenWater(pointIndex) > cumulatedIntakenWaterThresholdForAirBubbles)
+        {
+            // Generate air bubbles - but not on ropes as that looks awful
+            if (doGenerateAirBubbles
+                && !mPoints.IsRope(pointIndex))
             {
-                ElementIndex const otherEndpointIndex = cs.OtherEndpointIndex;
-                if (!isHullBufferData[otherEndpointIndex])
-                {
-                    averageInternalPressure += internalPressureBufferData[otherEndpointIndex];
-                    neighborsCount += 1.0f;
-                }
+                GenerateAirBubble(
+                    mPoints.GetPosition(pointIndex),
+                    pointDepth,
+                    mPoints.GetTemperature(pointIndex),
+                    currentSimulationTime,
+                    mPoints.GetPlaneId(pointIndex),
+                    gameParameters);
             }
 
-            if (neighborsCount != 0.0f)
-            {
-                internalPressureBufferData[pointIndex] = averageInternalPressure / neighborsCount;
-            }
+            // Consume all cumulated water
+            mPoints.GetCumulatedIntakenWater(pointIndex) = 0.0f;
+        }
+
+        // Adjust total water taken during this step, but not counting
+        // ropes, to prevent "rushing water" sound from playing for
+        // ropes, and also to prevent rope-only ships from playing
+        // "farewell"
+        if (!mPoints.IsRope(pointIndex))
+        {
+            waterTakenInStep += totalDeltaWater;
         }
     }
 }
 
-void Ship::UpdateWaterVelocities(
-    GameParameters const & gameParameters,
-    float & waterSplashed)
+void Ship::EqualizeInternalPressure(
+    GameParameters const & /*gameParameters*/,
+    ThreadPool & threadPool)
 {
     //
-    // For each (non-ephemeral) point, move each spring's outgoing water momentum to
-    // its destination point
+    // For each (non-ephemeral) point, equalize its internal pressure with its
+    // neighbors
     //
-    // Implementation of https://gabrielegiuseppini.wordpress.com/2018/09/08/momentum-based-simulation-of-water-flooding-2d-spaces/
+    // Pressure flows along springs (see InternalPressureEqualization); we first calculate
+    // the flux of each spring from the current pressures, and then gather at each point
+    // its inflows and outflows into the back buffer, so that each point only ever
+    // writes its own pressure
     //
 
-    // Calculate water momenta
-    mPoints.UpdateWaterMomentaFromVelocities();
-
-    // Source and result water buffers
-    auto oldPointWaterBuffer = mPoints.MakeWaterBufferCopy();
-    float const * restrict oldPointWaterBufferData = oldPointWaterBuffer->data();
-    float * restrict newPointWaterBufferData = mPoints.GetWaterBufferAsFloat();
-    vec2f * restrict oldPointWaterVelocityBufferData = mPoints.GetWaterVelocityBufferAsVec2();
-    vec2f * restrict newPointWaterMomentumBufferData = mPoints.GetWaterMomentumBufferAsVec2f();
-
-    // Weights of outbound water flows along each spring, including impermeable ones;
-    // set to zero for springs whose resultant scalar water velocities are
-    // directed towards the point being visited
-    std::array<float, GameParameters::MaxSpringsPerPoint> springOutboundWaterFlowWeights;
-
-    // Total weight
-    float totalOutboundWaterFlowWeight;
+    float const * restrict const oldInternalPressureBufferData = mPoints.GetInternalPressureBufferAsFloat();
+    float * restrict const newInternalPressureBufferData = mPoints.GetInternalPressureBackBufferAsFloat();
+    bool const * restrict const isHullBufferData = mPoints.GetIsHullBuffer();
+    Springs::Endpoints const * restrict const endpointsBufferData = mSprings.GetEndpointsBuffer();
 
-    // Resultant water velocities along each spring
-    std::array<vec2f, GameParameters::MaxSpringsPerPoint> springOutboundWaterVelocities;
+    float * restrict const nonHullNeighborCountBufferData = mInternalPressureEqualizationNeighborCountBuffer.data();
+    float * restrict const springFluxBufferData = mInternalPressureEqualizationSpringFluxBuffer.data();
 
     //
-    // Precalculate point "freeness factors", i.e. how much each point's
-    // quantity of water "suppresses" splashes from adjacent kinetic energy losses:
+    // 1) Count the non-hull neighbors of each point
     //
-    //  1.0f: point has no water
-    //  0.0f: point has water
-    //
-
-    auto pointFreenessFactorBuffer = mPoints.AllocateWorkBufferFloat();
-    float * restrict pointFreenessFactorBufferData = pointFreenessFactorBuffer->data();
-    for (auto pointIndex : mPoints.RawShipPoints())
-    {
-        pointFreenessFactorBufferData[pointIndex] =
-            FastExp(-oldPointWaterBufferData[pointIndex] * 10.0f);
-    }
 
+    threadPool.ParallelFor(
+        0,
+        mPoints.GetRawShipPointCount(), // No need to visit ephemeral points as they have no springs
+        InternalPressureMinPointsPerChunk,
+        [&](size_t begin, size_t end)
+        {
+            for (ElementIndex pointIndex = static_cast<ElementIndex>(begin); pointIndex < end; ++pointIndex)
+            {
+                nonHullNeighborCountBufferData[pointIndex] = InternalPressureEqualization::CalculateNonHullNeighborCount(
+                    mPoints.GetConnectedSpringsRow(pointIndex),
+                    isHullBufferData);
+            }
+        });
 
     //
-    // Visit all non-ephemeral points and move water and its momenta
+    // 2) Calculate the flux of each spring; deleted springs are not connected
+    //    to any point, hence their fluxes are never gathered
     //
-    // No need to visit ephemeral points as they have no springs
-    //
-
-    for (auto pointIndex : mPoints.RawShipPoints())
-    {
-        //
-        // 1) Calculate water momenta along *all* springs connected to this point,
-        //    including impermeable ones - as we'll eventually bounce back along those
-        //
-
-        // A higher crazyness gives more emphasys to bernoulli's velocity, as if pressures
-        // and gravity were exaggerated
-        //
-        // WV[t] = WV[t-1] + alpha * Bernoulli
-        //
-        // WaterCrazyness=0   -> alpha=1
-        // WaterCrazyness=0.5 -> alpha=0.5 + 0.5*Wh
-        // WaterCrazyness=1   -> alpha=Wh
-        float const alphaCrazyness = 1.0f + gameParameters.WaterCrazyness * (oldPointWaterBufferData[pointIndex] - 1.0f);
 
-        // Count of non-hull free and drowned neighbor points
-        float pointSplashNeighbors = 0.0f;
-        float pointSplashFreeNeighbors = 0.0f;
-
-        totalOutboundWaterFlowWeight = 0.0f;
-
-        size_t const connectedSpringCount = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.size();
-        for (size_t s = 0; s < connectedSpringCount; ++s)
+    threadPool.ParallelFor(
+        0,
+        mSprings.GetElementCount(),
+        InternalPressureMinSpringsPerChunk,
+        [&](size_t begin, size_t end)
         {
-            auto const & cs = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings[s];
-
-            // Normalized spring vector, oriented point -> other endpoint
-            vec2f const springNormalizedVector = (mPoints.GetPosition(cs.OtherEndpointIndex) - mPoints.GetPosition(pointIndex)).normalise_approx();
-
-            // Component of the point's own water velocity along the spring
-            float const pointWaterVelocityAlongSpring =
-                oldPointWaterVelocityBufferData[pointIndex]
-                .dot(springNormalizedVector);
-
-            //
-            // Calulate Bernoulli's velocity gained along this spring, from this point to
-            // the other endpoint
-            //
-
-            // Pressure difference (positive implies point -> other endpoint flow)
-            float const dw = oldPointWaterBufferData[pointIndex] - oldPointWaterBufferData[cs.OtherEndpointIndex];
-
-            // Gravity potential difference (positive implies point -> other endpoint flow)
-            float const dy = mPoints.GetPosition(pointIndex).y - mPoints.GetPosition(cs.OtherEndpointIndex).y;
-
-            // Calculate gained water velocity along this spring, from point to other endpoint
-            // (Bernoulli, 1738)
-            float bernoulliVelocityAlongSpring;
-            float const dwy = dw + dy;
-            if (dwy >= 0.0f)
-            {
-                // Gained velocity goes from point to other endpoint
-                bernoulliVelocityAlongSpring = sqrtf(2.0f * GameParameters::GravityMagnitude * dwy);
-            }
-            else
+            for (ElementIndex springIndex = static_cast<ElementIndex>(begin); springIndex < end; ++springIndex)
             {
-                // Gained velocity goes from other endpoint to point
-                bernoulliVelocityAlongSpring = -sqrtf(2.0f * GameParameters::GravityMagnitude * -dwy);
+                springFluxBufferData[springIndex] = InternalPressureEqualization::CalculateSpringFlux(
+                    endpointsBufferData[springIndex].PointAIndex,
+                    endpointsBufferData[springIndex].PointBIndex,
+                    oldInternalPressureBufferData,
+                    isHullBufferData,
+                    nonHullNeighborCountBufferData);
             }
+        });
 
-            // Resultant scalar velocity along spring; outbound only, as
-            // if this were inbound it wouldn't result in any movement of the point's
-            // water between these two springs. Morevoer, Bernoulli's velocity injected
-            // along this spring will be picked up later also by the other endpoint,
-            // and at that time it would move water if it agrees with its velocity
-            float const springOutboundScalarWaterVelocity = std::max(
-                pointWaterVelocityAlongSpring + bernoulliVelocityAlongSpring * alphaCrazyness,
-                0.0f);
-
-            // Store weight along spring, scaling for the greater distance traveled along
-            // diagonal springs
-            springOutboundWaterFlowWeights[s] =
-                springOutboundScalarWaterVelocity
-                / mSprings.GetFactoryRestLength(cs.SpringIndex);
-
-            // Resultant outbound velocity along spring
-            springOutboundWaterVelocities[s] =
-                springNormalizedVector
-                * springOutboundScalarWaterVelocity;
-
-            // Update total outbound flow weight
-            totalOutboundWaterFlowWeight += springOutboundWaterFlowWeights[s];
-
-            //
-            // Update splash neighbors counts
-            //
-
-            pointSplashFreeNeighbors +=
-                mSprings.GetWaterPermeability(cs.SpringIndex)
-                * pointFreenessFactorBufferData[cs.OtherEndpointIndex];
-
-            pointSplashNeighbors += mSprings.GetWaterPermeability(cs.SpringIndex);
-        }
-
-        //
-        // 2) Calculate normalization factor for water flows:
-        //    the quantity of water along a spring is proportional to the weight of the spring
-        //    (resultant velocity along that spring), and the sum of all outbound water flows must
-        //    match the water currently at the point times the water speed fraction and the adjustment
-        //
-
-        assert(totalOutboundWaterFlowWeight >= 0.0f);
+    //
+    // 3) Gather the new internal pressures
+    //
 
-        float waterQuantityNormalizationFactor = 0.0f;
-        if (totalOutboundWaterFlowWeight != 0.0f)
+    threadPool.ParallelFor(
+        0,
+        mPoints.GetRawShipPointCount(),
+        InternalPressureMinPointsPerChunk,
+        [&](size_t begin, size_t end)
         {
-            waterQuantityNormalizationFactor =
-                oldPointWaterBufferData[pointIndex]
-                * mPoints.GetMaterialWaterDiffusionSpeed(pointIndex) * gameParameters.WaterDiffusionSpeedAdjustment
-                / totalOutboundWaterFlowWeight;
-        }
-
-        //
-        // 3) Move water along all springs according to their flows,
-        //    and update destination's momenta accordingly
-        //
-
-        // Kinetic energy lost at this point
-        float pointKineticEnergyLoss = 0.0f;
+            for (ElementIndex pointIndex = static_cast<ElementIndex>(begin); pointIndex < end; ++pointIndex)
+            {
+                newInternalPressureBufferData[pointIndex] = InternalPressureEqualization::GatherInternalPressure(
+                    pointIndex,
+                    mPoints.GetConnectedSpringsRow(pointIndex),
+                    oldInternalPressureBufferData,
+                    isHullBufferData,
+                    springFluxBufferData);
+            }
+        });
 
-        for (size_t s = 0; s < connectedSpringCount; ++s)
-        {
-            auto const & cs = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings[s];
+    // The back internal pressure buffer is now complete
+    mPoints.SwapInternalPressureBuffers();
+}
 
-            // Calculate quantity of water directed outwards
-            float const springOutboundQuantityOfWater =
-                springOutboundWaterFlowWeights[s]
-                * waterQuantityNormalizationFactor;
+namespace {
 
-            assert(springOutboundQuantityOfWater >= 0.0f);
+    // Note: the water buffers are swapped at each step, hence the input has to be made anew each time
+    WaterFlowKernels::WaterFlowInput MakeWaterFlowInput(
+        Points const & points,
+        Springs const & springs,
+        GameParameters const & gameParameters)
+    {
+        return WaterFlowKernels::WaterFlowInput{
+            points.GetPositionBufferAsVec2(),
+            points.GetWaterBufferAsFloat(),
+            points.GetWaterVelocityBufferAsVec2(),
+            points.GetMaterialWaterDiffusionSpeedBufferAsFloat(),
+            points.GetConnectedSpringsAdjacencyBuffer(),
+            points.GetConnectedSpringsAdjacencyRowBeginsBuffer(),
+            points.GetConnectedSpringsAdjacencyRowEndsBuffer(),
+            springs.GetEndpointsBuffer(),
+            springs.GetFactoryRestLengthBuffer(),
+            springs.GetWaterPermeabilityBuffer(),
+            gameParameters.WaterCrazyness,
+            gameParameters.WaterDiffusionSpeedAdjustment };
+    }
+}
 
-            if (mSprings.GetWaterPermeability(cs.SpringIndex) != 0.0f)
-            {
-                //
-                // Water - and momentum - move from point to endpoint
-                //
+void Ship::RecalculateWaterVelocitiesParallelism(
+    size_t simulationParallelism,
+    GameParameters const & gameParameters)
+{
+    // Clear threading state
+    mWaterVelocitiesOutboundFlowTasks.clear();
+    mWaterVelocitiesInboundFlowTasks.clear();
 
-                // Move water quantity
-                newPointWaterBufferData[pointIndex] -= springOutboundQuantityOfWater;
-                newPointWaterBufferData[cs.OtherEndpointIndex] += springOutboundQuantityOfWater;
+    //
+    // Given the available simulation parallelism as a constraint (max), calculate
+    // the best parallelism for the water velocities algorithm
+    //
 
-                // Remove "old momentum" (old velocity) from point
-                newPointWaterMomentumBufferData[pointIndex] -=
-                    oldPointWaterVelocityBufferData[pointIndex]
-                    * springOutboundQuantityOfWater;
+    ElementCount const numberOfPoints = mPoints.GetRawShipPointCount(); // Ephemeral points have no springs
 
-                // Add "new momentum" (old velocity + velocity gained) to other endpoint
-                newPointWaterMomentumBufferData[cs.OtherEndpointIndex] +=
-                    springOutboundWaterVelocities[s]
-                    * springOutboundQuantityOfWater;
+    size_t const waterVelocitiesParallelism = std::max(
+        std::min(static_cast<size_t>(numberOfPoints) / 2000, simulationParallelism),
+        size_t(1));
 
+    LogMessage("Ship::RecalculateWaterVelocitiesParallelism: points=", numberOfPoints, " simulationParallelism=", simulationParallelism,
+        " waterVelocitiesParallelism=", waterVelocitiesParallelism);
 
-                //
-                // Update point's kinetic energy loss:
-                // splintered water colliding with whole other endpoint
-                //
+    mWaterVelocitiesTaskWaterSplashed.assign(waterVelocitiesParallelism, 0.0f);
 
-                // FUTURE: get rid of this re-calculation once we pre-calculate all spring normalized vectors
-                vec2f const springNormalizedVector = (mPoints.GetPosition(cs.OtherEndpointIndex) - mPoints.GetPosition(pointIndex)).normalise_approx();
+    //
+    // Prepare tasks
+    //
 
-                float ma = springOutboundQuantityOfWater;
-                float va = springOutboundWaterVelocities[s].length();
-                float mb = oldPointWaterBufferData[cs.OtherEndpointIndex];
-                float vb = oldPointWaterVelocityBufferData[cs.OtherEndpointIndex].dot(springNormalizedVector);
+    ElementCount const numberOfPointsPerThread = numberOfPoints / static_cast<ElementCount>(waterVelocitiesParallelism);
 
-                float vf = 0.0f;
-                if (ma + mb != 0.0f)
-                    vf = (ma * va + mb * vb) / (ma + mb);
+    ElementIndex pointStart = 0;
+    for (size_t t = 0; t < waterVelocitiesParallelism; ++t)
+    {
+        ElementIndex const pointEnd = (t < waterVelocitiesParallelism - 1)
+            ? pointStart + numberOfPointsPerThread
+            : numberOfPoints;
 
-                float deltaKa =
-                    0.5f
-                    * ma
-                    * (va * va - vf * vf);
+        // Note: we store a reference to GameParameters in the lambda; this is only safe
+        // if GameParameters is never re-created
 
-                // Note: deltaKa might be negative, in which case deltaKb would have been
-                // more positive (perfectly inelastic -> deltaK == max); we will pickup
-                // deltaKb later
-                pointKineticEnergyLoss += std::max(deltaKa, 0.0f);
-            }
-            else
+        mWaterVelocitiesOutboundFlowTasks.emplace_back(
+            [this, t, pointStart, pointEnd, &gameParameters]()
             {
-                // Wall hit
-
-                // Deleted springs are removed from points' connected springs
-                assert(!mSprings.IsDeleted(cs.SpringIndex));
+                mWaterVelocitiesTaskWaterSplashed[t] = CalculateOutboundWaterFlows(
+                    pointStart,
+                    pointEnd,
+                    gameParameters);
+            });
 
-                //
-                // New momentum (old velocity + velocity gained) bounces back
-                // (and zeroes outgoing), assuming perfectly inelastic collision
-                //
-                // No changes to other endpoint
-                //
+        mWaterVelocitiesInboundFlowTasks.emplace_back(
+            [this, pointStart, pointEnd, &gameParameters]()
+            {
+                GatherInboundWaterFlows(
+                    pointStart,
+                    pointEnd,
+                    gameParameters);
+            });
 
-                newPointWaterMomentumBufferData[pointIndex] -=
-                    springOutboundWaterVelocities[s]
-                    * springOutboundQuantityOfWater;
+        pointStart = pointEnd;
+    }
+}
 
+void Ship::UpdateWaterVelocities(
+    ThreadPool & threadPool,
+    float & waterSplashed)
+{
+    //
+    // For each (non-ephemeral) point, move each spring's outgoing water momentum to
+    // its destination point
+    //
+    // Implementation of https://gabrielegiuseppini.wordpress.com/2018/09/08/momentum-based-simulation-of-water-flooding-2d-spaces/
+    //
+    // We run in two passes, so that each point only ever writes its own state and
+    // points may be visited in parallel:
+    //  1) Each point calculates its outbound flows along its springs, and removes them from itself
+    //  2) Each point gathers the inbound flows from its springs' other endpoints
+    //
 
-                //
-                // Update point's kinetic energy loss:
-                // entire splintered water
-                //
+    // Calculate water momenta
+    mPoints.UpdateWaterMomentaFromVelocities();
 
-                float ma = springOutboundQuantityOfWater;
-                float va = springOutboundWaterVelocities[s].length();
+    //
+    // 1) Outbound flows, from the current water into the back water buffer
+    //
 
-                float deltaKa =
-                    0.5f
-                    * ma
-                    * va * va;
+    threadPool.Run(mWaterVelocitiesOutboundFlowTasks);
 
-                assert(deltaKa >= 0.0f);
-                pointKineticEnergyLoss += deltaKa;
-            }
-        }
+    for (float const taskWaterSplashed : mWaterVelocitiesTaskWaterSplashed)
+    {
+        waterSplashed += taskWaterSplashed;
+    }
 
-        //
-        // 4) Update water splash
-        //
+    //
+    // 2) Inbound flows
+    //
 
-        if (pointSplashNeighbors != 0.0f)
-        {
-            // Water splashed is proportional to kinetic energy loss that took
-            // place near free points (i.e. not drowned by water)
-            waterSplashed +=
-                pointKineticEnergyLoss
-                * pointSplashFreeNeighbors
-                / pointSplashNeighbors;
-        }
-    }
+    threadPool.Run(mWaterVelocitiesInboundFlowTasks);
 
+    // The back water buffer is now complete
+    mPoints.SwapWaterBuffers();
 
     //
     // Average kinetic energy loss
@@ -2539,6 +2641,38 @@ void Ship::UpdateWaterVelocities(
     mPoints.UpdateWaterVelocitiesFromMomenta();
 }
 
+float Ship::CalculateOutboundWaterFlows(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    GameParameters const & gameParameters)
+{
+    return WaterFlowKernels::CalculateOutboundWaterFlows(
+        MakeWaterFlowInput(mPoints, mSprings, gameParameters),
+        WaterFlowKernels::WaterFlowOutput{
+            mPoints.GetWaterBackBufferAsFloat(),
+            mPoints.GetWaterMomentumBufferAsVec2f(),
+            mSpringOutboundWaterQuantityBuffer.data(),
+            mSpringOutboundWaterMomentumBuffer.data() },
+        startPointIndex,
+        endPointIndex);
+}
+
+void Ship::GatherInboundWaterFlows(
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    GameParameters const & gameParameters)
+{
+    WaterFlowKernels::GatherInboundWaterFlows(
+        MakeWaterFlowInput(mPoints, mSprings, gameParameters),
+        WaterFlowKernels::WaterFlowOutput{
+            mPoints.GetWaterBackBufferAsFloat(),
+            mPoints.GetWaterMomentumBufferAsVec2f(),
+            mSpringOutboundWaterQuantityBuffer.data(),
+            mSpringOutboundWaterMomentumBuffer.data() },
+        startPointIndex,
+        endPointIndex);
+}
+
 void Ship::UpdateSinking()
 {
     //
@@ -2580,7 +2714,9 @@ void Ship::UpdateSinking()
 void Ship::RecalculateLightDiffusionParallelism(size_t simulationParallelism)
 {
     // Clear threading state
+    mLightDiffusionChangeDetectionTasks.clear();
     mLightDiffusionTasks.clear();
+    mLightDiffusionTaskDirtyBatchCounts.clear();
 
     //
     // Given the available simulation parallelism as a constraint (max), calculate 
@@ -2615,33 +2751,47 @@ void Ship::RecalculateLightDiffusionParallelism(size_t simulationParallelism)
 
         assert(((pointEnd - pointStart) % vectorization_float_count<ElementCount>) == 0);
 
+        mLightDiffusionChangeDetectionTasks.emplace_back(
+            [this, t, pointStart, pointEnd]()
+            {
+                mLightDiffusionTaskDirtyBatchCounts[t] = LightDiffusionKernels::DetectDirtyPointBatches(
+                    MakeLightDiffusionInput(),
+                    mLightDiffusionLastPointPositionBuffer.data(),
+                    mLightDiffusionDirtyRegions,
+                    pointStart,
+                    pointEnd,
+                    mLightDiffusionDirtyBatchBuffer.data());
+            });
+
         mLightDiffusionTasks.emplace_back(
             [this, pointStart, pointEnd]()
             {
-                Algorithms::DiffuseLight(
+                LightDiffusionKernels::DiffuseLightOnDirtyPoints(
+                    MakeLightDiffusionInput(),
+                    mLightDiffusionDirtyBatchBuffer.data(),
                     pointStart,
                     pointEnd,
-                    mPoints.GetPositionBufferAsVec2(),
-                    mPoints.GetPlaneIdBufferAsPlaneId(),
-                    mElectricalElements.GetLampPositionWorkBuffer().data(),
-                    mElectricalElements.GetLampPlaneIdWorkBuffer().data(),
-                    mElectricalElements.GetLampDistanceCoefficientWorkBuffer().data(),
-                    mElectricalElements.GetLampLightSpreadMaxDistanceBufferAsFloat(),
-                    mElectricalElements.GetBufferLampCount(),
+                    mLightDiffusionLastPointPositionBuffer.data(),
                     mPoints.GetLightBufferAsFloat());
             });
 
+        mLightDiffusionTaskDirtyBatchCounts.emplace_back(0);
+
         pointStart = pointEnd;
     }
 }
 
 void Ship::DiffuseLight(
     GameParameters const & gameParameters,
-    ThreadManager & threadManager)
+    ThreadPool & threadPool,
+    PerfStats & perfStats)
 {
     //
     // Diffuse light from each lamp to all points on the same or lower plane ID,
-    // inverse-proportionally to the lamp-point distance
+    // inverse-proportionally to the lamp-point distance.
+    //
+    // We only re-diffuse the points that have moved, and the points reached by
+    // the lamps that have changed, since the last time they have been diffused
     //
 
     // Shortcut
@@ -2673,15 +2823,114 @@ void Ship::DiffuseLight(
     }
 
     //
-    // 2. Diffuse light
+    // 2. Detect changes
+    //
+    // Changes to the structure (and thus to plane IDs) invalidate everything; otherwise,
+    // each lamp that has changed dirties the areas reached by its light before and after
+    // the change
+    //
+
+    bool isFullDiffusion =
+        mIsStructureDirty
+        || !mLightDiffusionLastConnectivityVisitSequenceNumber
+        || mLightDiffusionLastConnectivityVisitSequenceNumber != mCurrentConnectivityVisitSequenceNumber
+        || mLightDiffusionLampHistory.Positions.size() != static_cast<size_t>(lampCount);
+
+    mLightDiffusionDirtyRegions.clear();
+
+    if (!isFullDiffusion)
+    {
+        LightDiffusionKernels::DetectLampChanges(
+            MakeLightDiffusionInput(),
+            mLightDiffusionLampHistory,
+            mLightDiffusionDirtyRegions);
+
+        if (mLightDiffusionDirtyRegions.size() > MaxLightDiffusionDirtyRegions)
+        {
+            isFullDiffusion = true;
+        }
+    }
+
+    ElementCount const batchCount = mPoints.GetAlignedShipPointCount() / vectorization_float_count<ElementCount>;
+
+    if (isFullDiffusion)
+    {
+        std::fill(
+            mLightDiffusionDirtyBatchBuffer.data(),
+            mLightDiffusionDirtyBatchBuffer.data() + batchCount,
+            true);
+
+        // Remember the state of all lamps
+        mLightDiffusionLampHistory.RememberAll(MakeLightDiffusionInput());
+        mLightDiffusionLastConnectivityVisitSequenceNumber = mCurrentConnectivityVisitSequenceNumber;
+
+        perfStats.LightDiffusionMisses.Increment();
+    }
+    else
+    {
+        // Find the points that have moved or are in dirty regions
+        threadPool.Run(mLightDiffusionChangeDetectionTasks);
+
+        ElementCount dirtyBatchCount = 0;
+        for (ElementCount const taskDirtyBatchCount : mLightDiffusionTaskDirtyBatchCounts)
+        {
+            dirtyBatchCount += taskDirtyBatchCount;
+        }
+
+        if (dirtyBatchCount == 0)
+        {
+            // Nothing to do
+            perfStats.LightDiffusionHits.Increment();
+            mLastLuminiscenceAdjustmentDiffused = gameParameters.LuminiscenceAdjustment;
+            return;
+        }
+
+        perfStats.LightDiffusionPartialHits.Increment();
+    }
+
+    //
+    // 3. Bin lamps into tiles, if there are enough lamps for culling to pay off
+    //
+
+    mIsLightDiffusionTiled = (mElectricalElements.GetBufferLampCount() >= MinLampsForTiledLightDiffusion);
+    if (mIsLightDiffusionTiled)
+    {
+        Algorithms::PrepareDiffuseLightTiles(
+            mPoints.GetAlignedShipPointCount(),
+            mPoints.GetPositionBufferAsVec2(),
+            mPoints.GetPlaneIdBufferAsPlaneId(),
+            lampPositions.data(),
+            lampPlaneIds.data(),
+            lampDistanceCoeffs.data(),
+            mElectricalElements.GetLampLightSpreadMaxDistanceBufferAsFloat(),
+            mElectricalElements.GetBufferLampCount(),
+            mLightDiffusionTiles);
+    }
+
+    //
+    // 4. Diffuse light on dirty points
     //
 
-    threadManager.GetSimulationThreadPool().Run(mLightDiffusionTasks);
+    threadPool.Run(mLightDiffusionTasks);
 
     // Remember that we've diffused light with this luminiscence adjustment
     mLastLuminiscenceAdjustmentDiffused = gameParameters.LuminiscenceAdjustment;
 }
 
+LightDiffusionKernels::LightDiffusionInput Ship::MakeLightDiffusionInput()
+{
+    return LightDiffusionKernels::LightDiffusionInput{
+        mPoints.GetPositionBufferAsVec2(),
+        mPoints.GetPlaneIdBufferAsPlaneId(),
+        mElectricalElements.GetLampPositionWorkBuffer().data(),
+        mElectricalElements.GetLampPlaneIdWorkBuffer().data(),
+        mElectricalElements.GetLampDistanceCoefficientWorkBuffer().data(),
+        mElectricalElements.GetLampLightSpreadMaxDistanceBufferAsFloat(),
+        mElectricalElements.GetLampCount(),
+        mElectricalElements.GetBufferLampCount(),
+        mIsLightDiffusionTiled ? &mLightDiffusionTiles : nullptr };
+}
+
 ///////////////////////////////////////////////////////////////////////////////////
 // Heat
 ///////////////////////////////////////////////////////////////////////////////////
@@ -2690,19 +2939,47 @@ void Ship::PropagateHeat(
     float /*currentSimulationTime*/,
     float dt,
     Storm::Parameters const & stormParameters,
-    GameParameters const & gameParameters)
+    GameParameters const & gameParameters,
+    ThreadPool & threadPool)
 {
     //
-    // Propagate temperature (via heat), and dissipate temperature
+    // Propagate temperature (via heat), and dissipate temperature
+    //
+    // We calculate the new temperatures into the back buffer, gathering at each
+    // point the heat flowing into it, so that each point only ever writes its own
+    // temperature and points may be visited in parallel
+    //
+
+    // Source and result temperature buffers
+    float const * restrict const oldPointTemperatureBufferData = mPoints.GetTemperatureBufferAsFloat();
+    float * restrict const newPointTemperatureBufferData = mPoints.GetTemperatureBackBufferAsFloat();
+
+    float const * restrict const heatCapacityReciprocalBufferData = mPoints.GetMaterialHeatCapacityReciprocalBufferAsFloat();
+
+    float * restrict const heatOutflowNormalizationFactorBufferData = mHeatOutflowNormalizationFactorBuffer.data();
+
+    //
+    // 0) Calculate the conductance of each spring for this time quantum:
+    //
+    //    q = Ki * (Tp - Tpi) * dt / Li = Ci * (Tp - Tpi)
     //
 
-    // Source and result temperature buffers
-    auto oldPointTemperatureBuffer = mPoints.MakeTemperatureBufferCopy();
-    float const * restrict const oldPointTemperatureBufferData = oldPointTemperatureBuffer->data();
-    float * restrict const newPointTemperatureBufferData = mPoints.GetTemperatureBufferAsFloat();
+    {
+        float const * restrict const thermalConductivityBufferData = mSprings.GetMaterialThermalConductivityBuffer();
+        float const * restrict const factoryRestLengthBufferData = mSprings.GetFactoryRestLengthBuffer();
+        float * restrict const springHeatConductanceBufferData = mSpringHeatConductanceBuffer.data();
+
+        float const conductanceFactor = gameParameters.ThermalConductivityAdjustment * dt;
+
+        for (ElementIndex s = 0; s < mSprings.GetElementCount(); ++s)
+        {
+            springHeatConductanceBufferData[s] =
+                thermalConductivityBufferData[s] * conductanceFactor
+                / factoryRestLengthBufferData[s];
+        }
+    }
 
-    // Outbound heat flows along each spring
-    std::array<float, GameParameters::MaxSpringsPerPoint> springOutboundHeatFlows;
+    float const * restrict const springHeatConductanceBufferData = mSpringHeatConductanceBuffer.data();
 
     //
     // Visit all non-ephemeral points
@@ -2711,81 +2988,100 @@ void Ship::PropagateHeat(
     // that at the moment ephemeral particles are not connected to each other
     //
 
-    for (auto pointIndex : mPoints.RawShipPoints())
-    {
-        // Temperature of this point
-        float const pointTemperature = oldPointTemperatureBufferData[pointIndex];
+    //
+    // 1) Calculate the total outgoing heat of each point, and from it its normalization
+    //    factor - to ensure that point's temperature won't go below zero (Kelvin)
+    //
 
-        //
-        // 1) Calculate total outgoing heat
-        //
+    threadPool.ParallelFor(
+        0,
+        mPoints.GetRawShipPointCount(),
+        HeatPropagationMinPointsPerChunk,
+        [&](size_t begin, size_t end)
+        {
+            for (ElementIndex pointIndex = static_cast<ElementIndex>(begin); pointIndex < end; ++pointIndex)
+            {
+                // Temperature of this point
+                float const pointTemperature = oldPointTemperatureBufferData[pointIndex];
 
-        float totalOutgoingHeat = 0.0f;
+                float totalOutgoingHeat = 0.0f;
 
-        // Visit all springs
-        size_t const connectedSpringCount = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.size();
-        for (size_t s = 0; s < connectedSpringCount; ++s)
-        {
-            auto const & cs = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings[s];
+                // Visit all springs
+                for (auto const & cs : mPoints.GetConnectedSpringsRow(pointIndex))
+                {
+                    // Outgoing heat flow in this time quantum
+                    totalOutgoingHeat +=
+                        springHeatConductanceBufferData[cs.SpringIndex]
+                        * std::max(pointTemperature - oldPointTemperatureBufferData[cs.OtherEndpointIndex], 0.0f); // DeltaT, positive if going out
+                }
 
-            // Calculate outgoing heat flow per unit of time
-            //
-            // q = Ki * (Tp - Tpi) * dt / Li
-            float const outgoingHeatFlow =
-                mSprings.GetMaterialThermalConductivity(cs.SpringIndex) * gameParameters.ThermalConductivityAdjustment
-                * std::max(pointTemperature - oldPointTemperatureBufferData[cs.OtherEndpointIndex], 0.0f) // DeltaT, positive if going out
-                * dt
-                / mSprings.GetFactoryRestLength(cs.SpringIndex);
-
-            // Store flow
-            springOutboundHeatFlows[s] = outgoingHeatFlow;
-
-            // Update total outgoing heat
-            totalOutgoingHeat += outgoingHeatFlow;
-        }
+                float normalizationFactor;
+                if (totalOutgoingHeat > 0.0f)
+                {
+                    // Q = Kp * Tp
+                    float const pointHeat =
+                        pointTemperature
+                        / heatCapacityReciprocalBufferData[pointIndex];
+
+                    normalizationFactor = std::min(
+                        pointHeat / totalOutgoingHeat,
+                        1.0f);
+                }
+                else
+                {
+                    normalizationFactor = 0.0f;
+                }
 
+                heatOutflowNormalizationFactorBufferData[pointIndex] = normalizationFactor;
+            }
+        });
 
-        //
-        // 2) Calculate normalization factor - to ensure that point's temperature won't go below zero (Kelvin)
-        //
+    //
+    // 2) Transfer heat: lower the temperature of each point by its outgoing heat, and
+    //    raise it by the heat flowing in from its neighbors
+    //
 
-        float normalizationFactor;
-        if (totalOutgoingHeat > 0.0f)
-        {
-            // Q = Kp * Tp
-            float const pointHeat =
-                pointTemperature
-                / mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
-
-            normalizationFactor = std::min(
-                pointHeat / totalOutgoingHeat,
-                1.0f);
-        }
-        else
+    threadPool.ParallelFor(
+        0,
+        mPoints.GetRawShipPointCount(),
+        HeatPropagationMinPointsPerChunk,
+        [&](size_t begin, size_t end)
         {
-            normalizationFactor = 0.0f;
-        }
+            for (ElementIndex pointIndex = static_cast<ElementIndex>(begin); pointIndex < end; ++pointIndex)
+            {
+                // Temperature of this point
+                float const pointTemperature = oldPointTemperatureBufferData[pointIndex];
 
+                float totalOutgoingHeat = 0.0f;
+                float totalIncomingHeat = 0.0f;
 
-        //
-        // 3) Transfer outgoing heat, lowering temperature of point and increasing temperature of target points
-        //
+                for (auto const & cs : mPoints.GetConnectedSpringsRow(pointIndex))
+                {
+                    float const conductance = springHeatConductanceBufferData[cs.SpringIndex];
+                    float const otherEndpointTemperature = oldPointTemperatureBufferData[cs.OtherEndpointIndex];
 
-        for (size_t s = 0; s < connectedSpringCount; ++s)
-        {
-            auto const & cs = mPoints.GetConnectedSprings(pointIndex).ConnectedSprings[s];
+                    totalOutgoingHeat +=
+                        conductance
+                        * std::max(pointTemperature - otherEndpointTemperature, 0.0f);
 
-            // Raise target temperature due to this flow
-            newPointTemperatureBufferData[cs.OtherEndpointIndex] +=
-                springOutboundHeatFlows[s] * normalizationFactor
-                * mPoints.GetMaterialHeatCapacityReciprocal(cs.OtherEndpointIndex);
-        }
+                    totalIncomingHeat +=
+                        conductance
+                        * std::max(otherEndpointTemperature - pointTemperature, 0.0f)
+                        * heatOutflowNormalizationFactorBufferData[cs.OtherEndpointIndex];
+                }
 
-        // Update point's temperature due to total flow
-        newPointTemperatureBufferData[pointIndex] -=
-            totalOutgoingHeat * normalizationFactor
-            * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
-    }
+                newPointTemperatureBufferData[pointIndex] =
+                    pointTemperature
+                    + (totalIncomingHeat - totalOutgoingHeat * heatOutflowNormalizationFactorBufferData[pointIndex])
+                    * heatCapacityReciprocalBufferData[pointIndex];
+            }
+        });
+
+    // Points with no springs keep their temperature
+    std::copy(
+        oldPointTemperatureBufferData + mPoints.GetRawShipPointCount(),
+        oldPointTemperatureBufferData + mPoints.GetBufferElementCount(),
+        newPointTemperatureBufferData + mPoints.GetRawShipPointCount());
 
     //
     // Dissipate heat
@@ -2851,6 +3147,9 @@ void Ship::PropagateHeat(
                 std::max(dissipationDeltaT, deltaT);
         }
     }
+
+    // The back temperature buffer is now complete
+    mPoints.SwapTemperatureBuffers();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////
@@ -2950,14 +3249,29 @@ void Ship::RotPoints(
 
 void Ship::UpdateForSimulationParallelism(
     GameParameters const & gameParameters,
-    ThreadManager & threadManager)
+    ThreadPool & threadPool)
 {
-    size_t const simulationParallelism = threadManager.GetSimulationParallelism();
+    // When running deterministically, work is partitioned independently of the
+    // actual number of threads, so that the order of floating-point reductions
+    // does not change with it
+    size_t const simulationParallelism = gameParameters.DoRunDeterministically
+        ? GameParameters::DeterministicSimulationParallelism
+        : threadPool.GetParallelism();
+
     if (simulationParallelism != mCurrentSimulationParallelism)
     {
         // Re-calculate spring relaxation parallelism
         RecalculateSpringRelaxationParallelism(simulationParallelism, gameParameters);
 
+        // Re-calculate spring strains parallelism
+        RecalculateSpringStrainsParallelism(simulationParallelism);
+
+        // Re-calculate frontier forces parallelism
+        RecalculateFrontierForcesParallelism(simulationParallelism);
+
+        // Re-calculate water velocities parallelism
+        RecalculateWaterVelocitiesParallelism(simulationParallelism, gameParameters);
+
         // Re-calculate light diffusion parallelism
         RecalculateLightDiffusionParallelism(simulationParallelism);
 
@@ -2966,13 +3280,37 @@ void Ship::UpdateForSimulationParallelism(
     }
 }
 
-//#define RENDER_FLOOD_DISTANCE
+std::uint64_t Ship::CalculateStateHash() const
+{
+    std::uint64_t hash = 0;
+
+    auto const combine = [&hash](void const * data, size_t size)
+    {
+        hash = (hash * 1099511628211ull) ^ TaskGraph::Fingerprint(data, size);
+    };
+
+    // Points, including ephemeral particles
+    size_t const pointCount = mPoints.GetElementCount();
+    combine(mPoints.GetPositionBufferAsVec2(), pointCount * sizeof(vec2f));
+    combine(mPoints.GetVelocityBufferAsVec2(), pointCount * sizeof(vec2f));
+    combine(mPoints.GetWaterBufferAsFloat(), pointCount * sizeof(float));
+    combine(mPoints.GetInternalPressureBufferAsFloat(), pointCount * sizeof(float));
+    combine(mPoints.GetTemperatureBufferAsFloat(), pointCount * sizeof(float));
+    combine(mPoints.GetDecayBufferAsFloat(), pointCount * sizeof(float));
+
+    // Springs
+    size_t const springCount = mSprings.GetElementCount();
+    combine(mSprings.GetIsDeletedBuffer(), springCount * sizeof(bool));
+    combine(mSprings.GetRestLengthBuffer(), springCount * sizeof(float));
+
+    return hash;
+}
 
 void Ship::RunConnectivityVisit()
 {
     //
     //
-    // Here we visit the entire network of points (NOT including the ephemerals - they'll be assigned
+    // Here we visit the network of points (NOT including the ephemerals - they'll be assigned
     // their own plane ID's at creation time) and propagate connectivity information:
     //
     // - PlaneID: all points belonging to the same connected component, including "strings",
@@ -2985,122 +3323,330 @@ void Ship::RunConnectivityVisit()
     //
     // At the end of a visit *ALL* (non-ephemeral) points will have a Plane ID.
     //
-    // We also piggyback the visit to create the array containing the counts of triangles in each plane,
-    // so that we can later upload triangles in {PlaneID, Tessellation Order} order.
+    // The first visit floods the entire ship; subsequent visits only re-flood the connected
+    // components that contain the endpoints of springs destroyed or restored since the
+    // previous visit, leaving all other components (and their IDs) untouched.
+    //
+    // Plane IDs determine render order, lamp culling, and burning order, hence we take care
+    // that pieces do not change their relative order:
+    //
+    // - The full visit assigns IDs in reverse point order, i.e. in decreasing order of the
+    //   highest point index of each component
+    // - When a component is re-flooded, the piece containing its highest point keeps its ID,
+    //   while other pieces that break off get new IDs above all others, i.e. they go on top
+    //   of all existing pieces. Note that this is not the order a full visit would give them,
+    //   as with a full visit a new piece would sit below any component with a higher highest
+    //   point; we prefer that pieces keep the order they were given over having to re-number
+    //   untouched components
+    // - IDs left unused are eventually compacted, preserving their order
+    //
+    // We also maintain the counts of triangles in each plane, so that we can later upload
+    // triangles in {PlaneID, Tessellation Order} order.
     //
 
     // Generate a new visit sequence number
     auto const visitSequenceNumber = ++mCurrentConnectivityVisitSequenceNumber;
 
-    // Initialize plane ID
-    PlaneId currentPlaneId = 0; // Also serves as Connected Component ID
-    float currentPlaneIdFloat = 0.0f;
+    if (mIsFullConnectivityVisitNeeded)
+    {
+        RunFullConnectivityVisit(visitSequenceNumber);
+    }
+    else
+    {
+        RunIncrementalConnectivityVisit(visitSequenceNumber);
 
-    // Reset count of points per connected component
-    mConnectedComponentSizes.clear();
+        // Compact IDs when incremental visits have left more unused IDs than used ones
+        if (mUnusedConnectedComponentIdsCount * 2 > mConnectedComponentSizes.size())
+        {
+            CompactConnectedComponentIds();
+        }
+    }
 
-#ifdef RENDER_FLOOD_DISTANCE
-    std::optional<float> floodDistanceColor;
-#endif
+    mConnectivityVisitSeedPoints.clear();
+    mIsFullConnectivityVisitNeeded = false;
+
+    // Calculate per-plane triangle indices
+    size_t totalPlaneTrianglesCount = 0;
+    mPlaneTriangleIndicesToRender.clear();
+    mPlaneTriangleIndicesToRender.push_back(totalPlaneTrianglesCount); // First plane starts at zero
+    for (size_t const planeTrianglesCount : mPlaneTriangleCounts)
+    {
+        totalPlaneTrianglesCount += planeTrianglesCount;
+        mPlaneTriangleIndicesToRender.push_back(totalPlaneTrianglesCount);
+    }
+
+    // Remember non-ephemeral portion of plane IDs is dirty
+    mPoints.MarkPlaneIdBufferNonEphemeralAsDirty();
+
+    //
+    // Re-order burning points, as their plane IDs might have changed
+    //
+
+    mPoints.ReorderBurningPointsForDepth();
+
+    // Connected component IDs are now current
+    mHasStructureChangedSinceConnectivityVisit = false;
+}
+
+void Ship::RunFullConnectivityVisit(SequenceNumber visitSequenceNumber)
+{
+    // All connected components are going to be re-assigned, hence they all start awake
+    WakeUp();
+
+    // Reset connected components
+    mConnectedComponentSizes.clear();
+    mPlaneTriangleCounts.clear();
+    mConnectedComponentMaxPointIndices.clear();
+    mConnectedComponentSleepStates.clear();
+    mUnusedConnectedComponentIdsCount = 0;
 
     // The set of (already) marked points, from which we still
     // have to propagate out
     std::queue<ElementIndex> pointsToPropagateFrom;
 
-    // Reset per-plane triangle indices
-    size_t totalPlaneTrianglesCount = 0;
-    mPlaneTriangleIndicesToRender.clear();
-    mPlaneTriangleIndicesToRender.push_back(totalPlaneTrianglesCount); // First plane starts at zero, and we have zero triangles
-
     // Visit all non-ephemeral points
     for (auto pointIndex : mPoints.RawShipPointsReverse())
     {
         // Don't re-visit already-visited points
         if (mPoints.GetCurrentConnectivityVisitSequenceNumber(pointIndex) != visitSequenceNumber)
         {
-            //
-            // Flood a new plane from this point
-            //
+            FloodConnectedComponent(
+                pointIndex,
+                AllocateConnectedComponentId(),
+                visitSequenceNumber,
+                pointsToPropagateFrom);
+        }
+    }
+}
 
-            // Visit this point first
-            mPoints.SetPlaneId(pointIndex, currentPlaneId, currentPlaneIdFloat);
-            mPoints.SetConnectedComponentId(pointIndex, static_cast<ConnectedComponentId>(currentPlaneId));
-            mPoints.SetCurrentConnectivityVisitSequenceNumber(pointIndex, visitSequenceNumber);
+void Ship::RunIncrementalConnectivityVisit(SequenceNumber visitSequenceNumber)
+{
+    //
+    // 1. Dissolve the connected components of all the seed points
+    //
+    // Each of the components we end up with after the structure has changed either
+    // contains a seed point, or it is one of the components we had before and that
+    // has not been touched; hence, re-flooding from the seed points re-visits all
+    // the points of the components we dissolve here
+    //
 
-            // Add point to queue
-            assert(pointsToPropagateFrom.empty());
-            pointsToPropagateFrom.push(pointIndex);
+    std::vector<ConnectedComponentId> dissolvedConnectedComponentIds;
 
-            // Initialize count of points in this connected component
-            size_t currentConnectedComponentPointCount = 1;
+    for (auto const pointIndex : mConnectivityVisitSeedPoints)
+    {
+        auto const connectedComponentId = mPoints.GetConnectedComponentId(pointIndex);
+        assert(connectedComponentId < mConnectedComponentSizes.size());
 
-            // Visit all points reachable from this point via springs
-            while (!pointsToPropagateFrom.empty())
+        if (mConnectedComponentSizes[connectedComponentId] != 0) // Not dissolved yet
+        {
+            mConnectedComponentSizes[connectedComponentId] = 0;
+            mPlaneTriangleCounts[connectedComponentId] = 0;
+            dissolvedConnectedComponentIds.push_back(connectedComponentId);
+            ++mUnusedConnectedComponentIdsCount;
+
+            // The pieces of this component start awake; its points might still be
+            // sleeping if the structure has changed while the simulation was paused
+            if (mConnectedComponentSleepStates[connectedComponentId].IsSleeping)
             {
-                // Pop point that we have to propagate from
-                auto const currentPointIndex = pointsToPropagateFrom.front();
-                pointsToPropagateFrom.pop();
+                mHaveConnectedComponentsBeenWokenUpByConnectivityVisit = true;
+            }
+
+            mConnectedComponentSleepStates[connectedComponentId] = ConnectedComponentSleepState();
+        }
+    }
+
+    // The set of (already) marked points, from which we still
+    // have to propagate out
+    std::queue<ElementIndex> pointsToPropagateFrom;
+
+    //
+    // 2. Flood the pieces containing the highest point of each dissolved component,
+    //    keeping the component's ID
+    //
+    // Going in decreasing order of highest point, as the full visit does, a piece
+    // merging multiple components gets the ID of the component that comes first
+    //
+
+    std::sort(
+        dissolvedConnectedComponentIds.begin(),
+        dissolvedConnectedComponentIds.end(),
+        [this](ConnectedComponentId const & c1, ConnectedComponentId const & c2)
+        {
+            return mConnectedComponentMaxPointIndices[c1] > mConnectedComponentMaxPointIndices[c2];
+        });
+
+    for (auto const connectedComponentId : dissolvedConnectedComponentIds)
+    {
+        ElementIndex const pointIndex = mConnectedComponentMaxPointIndices[connectedComponentId];
+
+        // Don't re-visit already-visited points
+        if (mPoints.GetCurrentConnectivityVisitSequenceNumber(pointIndex) != visitSequenceNumber)
+        {
+            FloodConnectedComponent(
+                pointIndex,
+                connectedComponentId,
+                visitSequenceNumber,
+                pointsToPropagateFrom);
+
+            --mUnusedConnectedComponentIdsCount;
+        }
+    }
+
+    //
+    // 3. Flood the pieces that have broken off, giving them new IDs above all existing
+    //    ones - in decreasing order of the seed point from which we reach them, which is
+    //    not necessarily their highest point
+    //
+
+    std::sort(
+        mConnectivityVisitSeedPoints.begin(),
+        mConnectivityVisitSeedPoints.end(),
+        std::greater<ElementIndex>());
+
+    for (auto const pointIndex : mConnectivityVisitSeedPoints)
+    {
+        // Don't re-visit already-visited points
+        if (mPoints.GetCurrentConnectivityVisitSequenceNumber(pointIndex) != visitSequenceNumber)
+        {
+            FloodConnectedComponent(
+                pointIndex,
+                AllocateConnectedComponentId(),
+                visitSequenceNumber,
+                pointsToPropagateFrom);
+        }
+    }
+}
+
+ConnectedComponentId Ship::AllocateConnectedComponentId()
+{
+    assert(mConnectedComponentSizes.size() == mPlaneTriangleCounts.size());
+    assert(mConnectedComponentSizes.size() == mConnectedComponentMaxPointIndices.size());
+    assert(mConnectedComponentSizes.size() == mConnectedComponentSleepStates.size());
+
+    mConnectedComponentSizes.push_back(0);
+    mPlaneTriangleCounts.push_back(0);
+    mConnectedComponentMaxPointIndices.push_back(NoneElementIndex);
+    mConnectedComponentSleepStates.emplace_back();
+
+    return static_cast<ConnectedComponentId>(mConnectedComponentSizes.size() - 1);
+}
+
+void Ship::CompactConnectedComponentIds()
+{
+    //
+    // Re-number the IDs in use, preserving their order
+    //
+
+    std::vector<ConnectedComponentId> newConnectedComponentIds(mConnectedComponentSizes.size());
+
+    ConnectedComponentId newConnectedComponentId = 0;
+    for (size_t c = 0; c < mConnectedComponentSizes.size(); ++c)
+    {
+        if (mConnectedComponentSizes[c] != 0)
+        {
+            newConnectedComponentIds[c] = newConnectedComponentId;
+
+            mConnectedComponentSizes[newConnectedComponentId] = mConnectedComponentSizes[c];
+            mPlaneTriangleCounts[newConnectedComponentId] = mPlaneTriangleCounts[c];
+            mConnectedComponentMaxPointIndices[newConnectedComponentId] = mConnectedComponentMaxPointIndices[c];
+            mConnectedComponentSleepStates[newConnectedComponentId] = mConnectedComponentSleepStates[c];
+
+            ++newConnectedComponentId;
+        }
+    }
+
+    mConnectedComponentSizes.resize(newConnectedComponentId);
+    mPlaneTriangleCounts.resize(newConnectedComponentId);
+    mConnectedComponentMaxPointIndices.resize(newConnectedComponentId);
+    mConnectedComponentSleepStates.resize(newConnectedComponentId);
+    mUnusedConnectedComponentIdsCount = 0;
+
+    for (auto const pointIndex : mPoints.RawShipPoints())
+    {
+        ConnectedComponentId const connectedComponentId = newConnectedComponentIds[mPoints.GetConnectedComponentId(pointIndex)];
+
+        mPoints.SetPlaneId(pointIndex, static_cast<PlaneId>(connectedComponentId), static_cast<float>(connectedComponentId));
+        mPoints.SetConnectedComponentId(pointIndex, connectedComponentId);
+    }
+}
+
+//#define RENDER_FLOOD_DISTANCE
 
-                // This point has been visited already
-                assert(visitSequenceNumber == mPoints.GetCurrentConnectivityVisitSequenceNumber(currentPointIndex));
+void Ship::FloodConnectedComponent(
+    ElementIndex startPointIndex,
+    ConnectedComponentId connectedComponentId,
+    SequenceNumber visitSequenceNumber,
+    std::queue<ElementIndex> & pointsToPropagateFrom)
+{
+    PlaneId const planeId = static_cast<PlaneId>(connectedComponentId);
+    float const planeIdFloat = static_cast<float>(planeId);
 
 #ifdef RENDER_FLOOD_DISTANCE
-                if (!floodDistanceColor)
-                {
-                    mPoints.GetColor(currentPointIndex) = vec4f(0.0f, 0.0f, 0.75f, 1.0f);
-                    floodDistanceColor = 0.0f;
-                }
-                else
-                    mPoints.GetColor(currentPointIndex) = vec4f(*floodDistanceColor, 0.0f, 0.0f, 1.0f);
-                floodDistanceColor = *floodDistanceColor + 1.0f / 128.0f;
-                if (*floodDistanceColor > 1.0f)
-                    floodDistanceColor = 0.0f;
+    std::optional<float> floodDistanceColor;
 #endif
 
-                // Visit all its non-visited connected points
-                for (auto const & cs : mPoints.GetConnectedSprings(currentPointIndex).ConnectedSprings)
-                {
-                    if (visitSequenceNumber != mPoints.GetCurrentConnectivityVisitSequenceNumber(cs.OtherEndpointIndex))
-                    {
-                        //
-                        // Visit point
-                        //
+    // Visit this point first
+    mPoints.SetPlaneId(startPointIndex, planeId, planeIdFloat);
+    mPoints.SetConnectedComponentId(startPointIndex, connectedComponentId);
+    mPoints.SetCurrentConnectivityVisitSequenceNumber(startPointIndex, visitSequenceNumber);
 
-                        mPoints.SetPlaneId(cs.OtherEndpointIndex, currentPlaneId, currentPlaneIdFloat);
-                        mPoints.SetConnectedComponentId(cs.OtherEndpointIndex, static_cast<ConnectedComponentId>(currentPlaneId));
-                        mPoints.SetCurrentConnectivityVisitSequenceNumber(cs.OtherEndpointIndex, visitSequenceNumber);
+    // Add point to queue
+    assert(pointsToPropagateFrom.empty());
+    pointsToPropagateFrom.push(startPointIndex);
 
-                        // Add point to queue
-                        pointsToPropagateFrom.push(cs.OtherEndpointIndex);
+    // Initialize counts of points and triangles in this connected component
+    size_t connectedComponentPointCount = 1;
+    size_t planeTrianglesCount = 0;
+    ElementIndex maxPointIndex = startPointIndex;
 
-                        // Update count of points in this connected component
-                        ++currentConnectedComponentPointCount;
-                    }
-                }
+    // Visit all points reachable from this point via springs
+    while (!pointsToPropagateFrom.empty())
+    {
+        // Pop point that we have to propagate from
+        auto const currentPointIndex = pointsToPropagateFrom.front();
+        pointsToPropagateFrom.pop();
 
-                // Update count of triangles with this points's triangles
-                totalPlaneTrianglesCount += mPoints.GetConnectedOwnedTrianglesCount(currentPointIndex);
-            }
+        // This point has been visited already
+        assert(visitSequenceNumber == mPoints.GetCurrentConnectivityVisitSequenceNumber(currentPointIndex));
 
-            // Remember count of points in this connected component
-            assert(mConnectedComponentSizes.size() == static_cast<size_t>(currentPlaneId));
-            mConnectedComponentSizes.push_back(currentConnectedComponentPointCount);
+#ifdef RENDER_FLOOD_DISTANCE
+        if (!floodDistanceColor)
+        {
+            mPoints.GetColor(currentPointIndex) = vec4f(0.0f, 0.0f, 0.75f, 1.0f);
+            floodDistanceColor = 0.0f;
+        }
+        else
+            mPoints.GetColor(currentPointIndex) = vec4f(*floodDistanceColor, 0.0f, 0.0f, 1.0f);
+        floodDistanceColor = *floodDistanceColor + 1.0f / 128.0f;
+        if (*floodDistanceColor > 1.0f)
+            floodDistanceColor = 0.0f;
+#endif
 
-            // Remember the starting index of the triangles in the next plane
-            assert(mPlaneTriangleIndicesToRender.size() == static_cast<size_t>(currentPlaneId + 1));
-            mPlaneTriangleIndicesToRender.push_back(totalPlaneTrianglesCount);
+        // Visit all its non-visited connected points
+        for (auto const & cs : mPoints.GetConnectedSprings(currentPointIndex).ConnectedSprings)
+        {
+            if (visitSequenceNumber != mPoints.GetCurrentConnectivityVisitSequenceNumber(cs.OtherEndpointIndex))
+            {
+                //
+                // Visit point
+                //
 
-            //
-            // Flood completed
-            //
+                mPoints.SetPlaneId(cs.OtherEndpointIndex, planeId, planeIdFloat);
+                mPoints.SetConnectedComponentId(cs.OtherEndpointIndex, connectedComponentId);
+                mPoints.SetCurrentConnectivityVisitSequenceNumber(cs.OtherEndpointIndex, visitSequenceNumber);
+
+                // Add point to queue
+                pointsToPropagateFrom.push(cs.OtherEndpointIndex);
 
-            // Remember max plane ID ever
-            mMaxMaxPlaneId = std::max(mMaxMaxPlaneId, currentPlaneId);
+                // Update count of points in this connected component
+                ++connectedComponentPointCount;
 
-            // Next we begin a new plane and connected component
-            ++currentPlaneId;
-            currentPlaneIdFloat = static_cast<float>(currentPlaneId);
+                maxPointIndex = std::max(maxPointIndex, cs.OtherEndpointIndex);
+            }
         }
+
+        // Update count of triangles with this points's triangles
+        planeTrianglesCount += mPoints.GetConnectedOwnedTrianglesCount(currentPointIndex);
     }
 
 #ifdef RENDER_FLOOD_DISTANCE
@@ -3108,14 +3654,14 @@ void Ship::RunConnectivityVisit()
     mPoints.MarkColorBufferAsDirty();
 #endif
 
-    // Remember non-ephemeral portion of plane IDs is dirty
-    mPoints.MarkPlaneIdBufferNonEphemeralAsDirty();
-
-    //
-    // Re-order burning points, as their plane IDs might have changed
-    //
+    // Remember counts of points and triangles in this connected component
+    assert(connectedComponentId < mConnectedComponentSizes.size());
+    mConnectedComponentSizes[connectedComponentId] = connectedComponentPointCount;
+    mPlaneTriangleCounts[connectedComponentId] = planeTrianglesCount;
+    mConnectedComponentMaxPointIndices[connectedComponentId] = maxPointIndex;
 
-    mPoints.ReorderBurningPointsForDepth();
+    // Remember max plane ID ever
+    mMaxMaxPlaneId = std::max(mMaxMaxPlaneId, planeId);
 }
 
 void Ship::SetAndPropagateResultantPointHullness(
@@ -3253,26 +3799,32 @@ void Ship::GenerateDebris(
         auto const pointWater = mPoints.GetWater(sourcePointElementIndex);
         auto const pointPlaneId = mPoints.GetPlaneId(sourcePointElementIndex);
 
-        for (unsigned int d = 0; d < debrisParticleCount; ++d)
-        {
-            // Choose velocity
-            vec2f const velocity = GameRandomEngine::GetInstance().GenerateUniformRadialVector(
-                GameParameters::MinDebrisParticlesVelocity,
-                GameParameters::MaxDebrisParticlesVelocity);
+        // Choose velocities and lifetimes
+
+        std::array<vec2f, GameParameters::MaxDebrisParticlesPerEvent> velocities;
+        GameRandomEngine::GetInstance().GenerateUniformRadialVectors(
+            velocities.data(),
+            debrisParticleCount,
+            GameParameters::MinDebrisParticlesVelocity,
+            GameParameters::MaxDebrisParticlesVelocity);
 
-            // Choose a lifetime
-            float const maxLifetime = GameRandomEngine::GetInstance().GenerateUniformReal(
-                GameParameters::MinDebrisParticlesLifetime,
-                GameParameters::MaxDebrisParticlesLifetime);
+        std::array<float, GameParameters::MaxDebrisParticlesPerEvent> maxLifetimes;
+        GameRandomEngine::GetInstance().GenerateUniformReals(
+            maxLifetimes.data(),
+            debrisParticleCount,
+            GameParameters::MinDebrisParticlesLifetime,
+            GameParameters::MaxDebrisParticlesLifetime);
 
+        for (unsigned int d = 0; d < debrisParticleCount; ++d)
+        {
             mPoints.CreateEphemeralParticleDebris(
                 pointPosition,
-                velocity,
+                velocities[d],
                 pointDepth,
                 pointWater,
                 debrisStructuralMaterial,
                 currentSimulationTime,
-                maxLifetime,
+                maxLifetimes[d],
                 pointPlaneId);
         }
     }
@@ -3456,6 +4008,7 @@ void Ship::HandlePointDetach(
 
         // Remember the structure is now dirty
         mIsStructureDirty = true;
+        mHasStructureChangedSinceConnectivityVisit = true;
     }
 }
 
@@ -3587,6 +4140,10 @@ void Ship::HandleSpringDestroy(
 
     // Remember our structure is now dirty
     mIsStructureDirty = true;
+    mHasStructureChangedSinceConnectivityVisit = true;
+
+    // Re-flood the connected component of the endpoints at the next connectivity visit
+    AddConnectivityVisitSeedPoints(pointAIndex, pointBIndex);
 
     // Update count of broken springs
     ++mBrokenSpringsCount;
@@ -3650,6 +4207,10 @@ void Ship::HandleSpringRestore(
 
     // Remember our structure is now dirty
     mIsStructureDirty = true;
+    mHasStructureChangedSinceConnectivityVisit = true;
+
+    // Re-flood the connected components of the endpoints at the next connectivity visit
+    AddConnectivityVisitSeedPoints(pointAIndex, pointBIndex);
 
     // Update count of broken springs
     assert(mBrokenSpringsCount > 0);
@@ -3702,6 +4263,15 @@ void Ship::HandleTriangleDestroy(ElementIndex triangleElementIndex)
 
     // Remember our structure is now dirty
     mIsStructureDirty = true;
+    mHasStructureChangedSinceConnectivityVisit = true;
+
+    // Update count of triangles in the plane of the triangle's owner
+    if (!mIsFullConnectivityVisitNeeded)
+    {
+        PlaneId const planeId = mPoints.GetPlaneId(mTriangles.GetPointAIndex(triangleElementIndex));
+        assert(planeId < mPlaneTriangleCounts.size() && mPlaneTriangleCounts[planeId] > 0);
+        --mPlaneTriangleCounts[planeId];
+    }
 
     // Update count of broken triangles
     ++mBrokenTrianglesCount;
@@ -3752,6 +4322,15 @@ void Ship::HandleTriangleRestore(ElementIndex triangleElementIndex)
 
     // Remember our structure is now dirty
     mIsStructureDirty = true;
+    mHasStructureChangedSinceConnectivityVisit = true;
+
+    // Update count of triangles in the plane of the triangle's owner
+    if (!mIsFullConnectivityVisitNeeded)
+    {
+        PlaneId const planeId = mPoints.GetPlaneId(mTriangles.GetPointAIndex(triangleElementIndex));
+        assert(planeId < mPlaneTriangleCounts.size());
+        ++mPlaneTriangleCounts[planeId];
+    }
 
     // Update count of broken triangles
     assert(mBrokenTrianglesCount > 0);
@@ -3960,6 +4539,13 @@ void Ship::HandleWatertightDoorUpdated(
     ElementIndex pointElementIndex,
     bool isOpen)
 {
+    if (mIsUpdateTaskGraphRunning)
+    {
+        // Apply after the graph, as other tasks are reading hullness and water
+        mPendingWatertightDoorUpdates.emplace_back(pointElementIndex, isOpen);
+        return;
+    }
+
     // Update point and springs
     bool const isHull = !isOpen;
     SetAndPropagateResultantPointHullness(pointElementIndex, isHull);
@@ -4148,6 +4734,86 @@ void Ship::VerifyInvariants()
     }
 
 
+    //
+    // Connectivity
+    //
+    // As long as the structure hasn't changed since the last (incremental) connectivity
+    // visit, connected components must be the same as those found by a full visit
+    //
+
+    if (!mHasStructureChangedSinceConnectivityVisit)
+    {
+        Verify(mConnectedComponentSizes.size() == mPlaneTriangleCounts.size());
+        Verify(mConnectedComponentSizes.size() == mConnectedComponentMaxPointIndices.size());
+
+        size_t unusedConnectedComponentIdsCount = 0;
+        for (size_t c = 0; c < mConnectedComponentSizes.size(); ++c)
+        {
+            if (mConnectedComponentSizes[c] == 0)
+            {
+                Verify(mPlaneTriangleCounts[c] == 0);
+                ++unusedConnectedComponentIdsCount;
+            }
+        }
+
+        Verify(mUnusedConnectedComponentIdsCount == unusedConnectedComponentIdsCount);
+
+        std::vector<bool> isPointVisited(mPoints.GetRawShipPointCount(), false);
+        std::vector<bool> isConnectedComponentSeen(mConnectedComponentSizes.size(), false);
+        std::vector<ElementIndex> pointsToPropagateFrom;
+
+        for (auto pointIndex : mPoints.RawShipPoints())
+        {
+            if (isPointVisited[pointIndex])
+                continue;
+
+            // Flood this component, checking that all of its points have the same ID
+            ConnectedComponentId const connectedComponentId = mPoints.GetConnectedComponentId(pointIndex);
+            Verify(connectedComponentId < mConnectedComponentSizes.size());
+            Verify(!isConnectedComponentSeen[connectedComponentId]);
+            isConnectedComponentSeen[connectedComponentId] = true;
+
+            size_t connectedComponentPointCount = 0;
+            size_t planeTrianglesCount = 0;
+            ElementIndex maxPointIndex = pointIndex;
+
+            isPointVisited[pointIndex] = true;
+            pointsToPropagateFrom.push_back(pointIndex);
+
+            while (!pointsToPropagateFrom.empty())
+            {
+                auto const currentPointIndex = pointsToPropagateFrom.back();
+                pointsToPropagateFrom.pop_back();
+
+                Verify(mPoints.GetConnectedComponentId(currentPointIndex) == connectedComponentId);
+                Verify(mPoints.GetPlaneId(currentPointIndex) == static_cast<PlaneId>(connectedComponentId));
+
+                ++connectedComponentPointCount;
+                planeTrianglesCount += mPoints.GetConnectedOwnedTrianglesCount(currentPointIndex);
+                maxPointIndex = std::max(maxPointIndex, currentPointIndex);
+
+                for (auto const & cs : mPoints.GetConnectedSprings(currentPointIndex).ConnectedSprings)
+                {
+                    if (!isPointVisited[cs.OtherEndpointIndex])
+                    {
+                        isPointVisited[cs.OtherEndpointIndex] = true;
+                        pointsToPropagateFrom.push_back(cs.OtherEndpointIndex);
+                    }
+                }
+            }
+
+            Verify(mConnectedComponentSizes[connectedComponentId] == connectedComponentPointCount);
+            Verify(mPlaneTriangleCounts[connectedComponentId] == planeTrianglesCount);
+            Verify(mConnectedComponentMaxPointIndices[connectedComponentId] == maxPointIndex);
+        }
+
+        // All IDs in use have been found
+        for (size_t c = 0; c < mConnectedComponentSizes.size(); ++c)
+        {
+            Verify(isConnectedComponentSeen[c] == (mConnectedComponentSizes[c] != 0));
+        }
+    }
+
     //
     // Frontiers
     //
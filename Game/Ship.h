@@ -8,6 +8,7 @@
 #include "EventRecorder.h"
 #include "GameEventDispatcher.h"
 #include "GameParameters.h"
+#include "LightDiffusionKernels.h"
 #include "MaterialDatabase.h"
 #include "Physics.h"
 #include "PerfStats.h"
@@ -17,15 +18,21 @@
 #include "ShipOverlays.h"
 
 #include <GameCore/AABBSet.h>
+#include <GameCore/Algorithms.h>
 #include <GameCore/Buffer.h>
+#include <GameCore/GameRandomEngine.h>
 #include <GameCore/GameTypes.h>
 #include <GameCore/RunningAverage.h>
-#include <GameCore/ThreadManager.h>
+#include <GameCore/TaskGraph.h>
+#include <GameCore/ThreadPool.h>
+#include <GameCore/UniformGrid.h>
 #include <GameCore/Vectors.h>
 
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <optional>
+#include <queue>
 #include <vector>
 
 namespace Physics
@@ -60,6 +67,8 @@ public:
     inline auto const & GetPoints() const { return mPoints; }
     inline auto & GetPoints() { return mPoints; }
 
+    inline auto const & GetSprings() const { return mSprings; }
+
     bool IsUnderwater(ElementIndex pointElementIndex) const
     {
         return mParentWorld.GetOceanSurface().IsUnderwater(mPoints.GetPosition(pointElementIndex));
@@ -77,11 +86,23 @@ public:
         GameParameters const & gameParameters,
         StressRenderModeType stressRenderMode,
         Geometry::AABBSet & externalAabbSet,
-        ThreadManager & threadManager,
+        ThreadPool & threadPool,
         PerfStats & perfStats);
 
     void RenderUpload(Render::RenderContext & renderContext);
 
+    /*
+     * Wakes up all sleeping connected components, e.g. after the world
+     * around them has changed.
+     */
+    void WakeUp();
+
+    /*
+     * Calculates a hash of the state of the ship's simulation, for telling whether
+     * two deterministic runs have produced the same results.
+     */
+    std::uint64_t CalculateStateHash() const;
+
 public:
 
     void Finalize();
@@ -480,12 +501,13 @@ private:
         float effectiveAirDensity,
         float effectiveWaterDensity,
         GameParameters const & gameParameters,
-        Geometry::AABBSet & externalAabbSet);
+        Geometry::AABBSet & externalAabbSet,
+        ThreadPool & threadPool);
 
     void ApplyWorldParticleForces(
         float effectiveAirDensity,
         float effectiveWaterDensity,
-        Buffer<float> & newCachedPointDepths,
+        Buffer<float> const & newCachedPointDepths,
         GameParameters const & gameParameters);
 
     template<bool DoDisplaceWater>
@@ -494,26 +516,48 @@ private:
         float effectiveWaterDensity,
         Buffer<float> & newCachedPointDepths,
         GameParameters const & gameParameters,
-        Geometry::AABBSet & externalAabbSet);
+        Geometry::AABBSet & externalAabbSet,
+        ThreadPool & threadPool);
 
     void ApplyStaticPressureForces(
         float effectiveAirDensity,
         float effectiveWaterDensity,
-        GameParameters const & gameParameters);
+        GameParameters const & gameParameters,
+        ThreadPool & threadPool);
+
+    struct FrontierForcesTaskState;
 
     void ApplyStaticPressureForces(
         Frontiers::Frontier const & frontier,
         float effectiveAirDensity,
         float effectiveWaterDensity,
-        GameParameters const & gameParameters);
+        GameParameters const & gameParameters,
+        FrontierForcesTaskState & taskState);
+
+    void RecalculateFrontierForcesParallelism(size_t simulationParallelism);
+
+    // Distributes the frontiers - all of them, or only the external ones - among the
+    // frontier forces task states, in consecutive runs, and resets the states' results;
+    // returns the number of tasks that have been assigned frontiers
+    size_t PrepareFrontierForcesTaskStates(bool externalOnly);
 
     void RecalculateSpringRelaxationParallelism(size_t simulationParallelism, GameParameters const & gameParameters);
     void RecalculateSpringRelaxationSpringForcesParallelism(size_t simulationParallelism);
+    void PrepareColoredSpringRelaxationSpringForcesTasks(size_t springRelaxationParallelism);
     void RecalculateSpringRelaxationIntegrationAndSeaFloorCollisionParallelism(size_t simulationParallelism, GameParameters const & gameParameters);
 
     void RunSpringRelaxationAndDynamicForcesIntegration(
         GameParameters const & gameParameters,
-        ThreadManager & threadManager);
+        ThreadPool & threadPool);
+
+    // Invokes the action on the runs of awake blocks within [start, end),
+    // or on [start, end) itself when no points are sleeping
+    template<typename TAction>
+    inline void ForEachAwakeRange(
+        ElementIndex start,
+        ElementIndex end,
+        Buffer<bool> const & isBlockAwakeBuffer,
+        TAction && action) const;
 
     void ApplySpringsForces(
         ElementIndex startSpringIndex,
@@ -525,6 +569,9 @@ private:
         ElementIndex endPointIndex,
         GameParameters const & gameParameters);
 
+    // Integrates with the AVX kernels when the CPU supports them; returns false otherwise
+    bool TryIntegrateAndResetDynamicForces_AVX(ElementIndex startPointIndex, ElementIndex endPointIndex, GameParameters const & gameParameters);
+
     inline float CalculateIntegrationVelocityFactor(float dt, GameParameters const & gameParameters) const;
     inline void IntegrateAndResetDynamicForces_1(ElementIndex startPointIndex, ElementIndex endPointIndex, GameParameters const & gameParameters);
     inline void IntegrateAndResetDynamicForces_2(ElementIndex startPointIndex, ElementIndex endPointIndex, GameParameters const & gameParameters);
@@ -539,6 +586,16 @@ private:
 
     void TrimForWorldBounds(GameParameters const & gameParameters);
 
+    // Strains
+
+    void RecalculateSpringStrainsParallelism(size_t simulationParallelism);
+
+    // Sleeping
+
+    void UpdateSleepingConnectedComponents();
+
+    void RecalculateAwakeBlocks();
+
     // Pressure and water
 
     void UpdatePressureAndWaterInflow(
@@ -549,12 +606,29 @@ private:
         GameParameters const & gameParameters,
         float & waterTakenInStep);
 
-    void EqualizeInternalPressure(GameParameters const & gameParameters);
+    void EqualizeInternalPressure(
+        GameParameters const & gameParameters,
+        ThreadPool & threadPool);
+
+    void RecalculateWaterVelocitiesParallelism(
+        size_t simulationParallelism,
+        GameParameters const & gameParameters);
 
     void UpdateWaterVelocities(
-        GameParameters const & gameParameters,
+        ThreadPool & threadPool,
         float & waterSplashed);
 
+    // Returns the water splashed at the visited points
+    float CalculateOutboundWaterFlows(
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex,
+        GameParameters const & gameParameters);
+
+    void GatherInboundWaterFlows(
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex,
+        GameParameters const & gameParameters);
+
     void UpdateSinking();
 
     // Electrical
@@ -563,7 +637,10 @@ private:
 
     void DiffuseLight(
         GameParameters const & gameParameters,
-        ThreadManager & threadManager);
+        ThreadPool & threadPool,
+        PerfStats & perfStats);
+
+    LightDiffusionKernels::LightDiffusionInput MakeLightDiffusionInput();
 
     // Heat
 
@@ -571,7 +648,8 @@ private:
         float currentSimulationTime,
         float dt,
 		Storm::Parameters const & stormParameters,
-        GameParameters const & gameParameters);
+        GameParameters const & gameParameters,
+        ThreadPool & threadPool);
 
     // Misc
 
@@ -587,6 +665,8 @@ private:
 
     void UploadStateMachines(Render::RenderContext & renderContext);
 
+    void RegisterUpdateTaskGraphResources();
+
 private:
 
     /////////////////////////////////////////////////////////////////////////
@@ -607,6 +687,56 @@ private:
         vec2f const & centerPosition,
         float strength);
 
+private:
+
+    /////////////////////////////////////////////////////////////////////////
+    // Spatial queries
+    /////////////////////////////////////////////////////////////////////////
+
+    // Returns the grid of the (non-ephemeral) ship points, re-building it if points have moved
+    // since it was last built
+    UniformGrid const & GetPointGrid() const;
+
+    // Visits the ship points that might be within the radius, followed by all ephemeral points;
+    // ephemeral points are not indexed, as they come, go, and move at each step
+    template<typename TVisitor>
+    void VisitPointsInRadius(
+        vec2f const & center,
+        float radius,
+        TVisitor && visitor) const
+    {
+        GetPointGrid().VisitInRadius(center, radius, visitor);
+
+        for (auto const p : mPoints.EphemeralPoints())
+        {
+            visitor(p);
+        }
+    }
+
+    // Visits the ship points that might be within the distance of the segment, followed by all
+    // ephemeral points
+    template<typename TVisitor>
+    void VisitPointsNearSegment(
+        vec2f const & startPos,
+        vec2f const & endPos,
+        float radius,
+        TVisitor && visitor) const
+    {
+        GetPointGrid().VisitNearSegment(startPos, endPos, radius, visitor);
+
+        for (auto const p : mPoints.EphemeralPoints())
+        {
+            visitor(p);
+        }
+    }
+
+    // Populates the vector with the indices - sorted - of the non-deleted springs that might intersect
+    // the segment
+    void FindSpringsNearSegment(
+        vec2f const & startPos,
+        vec2f const & endPos,
+        std::vector<ElementIndex> & springIndices) const;
+
 private:
 
     /////////////////////////////////////////////////////////////////////////
@@ -615,10 +745,35 @@ private:
 
     inline void UpdateForSimulationParallelism(
         GameParameters const & gameParameters,
-        ThreadManager & threadManager);
+        ThreadPool & threadPool);
 
     void RunConnectivityVisit();
 
+    void RunFullConnectivityVisit(SequenceNumber visitSequenceNumber);
+
+    void RunIncrementalConnectivityVisit(SequenceNumber visitSequenceNumber);
+
+    ConnectedComponentId AllocateConnectedComponentId();
+
+    void CompactConnectedComponentIds();
+
+    void FloodConnectedComponent(
+        ElementIndex startPointIndex,
+        ConnectedComponentId connectedComponentId,
+        SequenceNumber visitSequenceNumber,
+        std::queue<ElementIndex> & pointsToPropagateFrom);
+
+    inline void AddConnectivityVisitSeedPoints(
+        ElementIndex pointAIndex,
+        ElementIndex pointBIndex)
+    {
+        if (!mIsFullConnectivityVisitNeeded)
+        {
+            mConnectivityVisitSeedPoints.push_back(pointAIndex);
+            mConnectivityVisitSeedPoints.push_back(pointBIndex);
+        }
+    }
+
     inline void SetAndPropagateResultantPointHullness(
         ElementIndex pointElementIndex,
         bool isHull);
@@ -834,6 +989,10 @@ private:
     std::shared_ptr<GameEventDispatcher> mGameEventHandler;
     EventRecorder * mEventRecorder;
 
+    // The random stream drawn from while this ship is being updated; streams are
+    // identified by 1 + ship ID, as stream 0 is the ocean surface's
+    GameRandomEngine mRandomStream;
+
     // All the ship elements - never removed, the repositories maintain their own size forever
     Points mPoints;
     Springs mSprings;
@@ -865,15 +1024,39 @@ private:
     // The current electrical connectivity visit sequence number
     SequenceNumber mCurrentElectricalVisitSequenceNumber;
 
-    // The number of points in each connected component
+    // The number of points in each connected component; IDs of components
+    // dissolved by incremental connectivity visits have zero points
     std::vector<size_t> mConnectedComponentSizes;
 
+    // The number of triangles in each plane
+    std::vector<size_t> mPlaneTriangleCounts;
+
+    // The highest index of the points in each connected component; a full visit
+    // assigns IDs in decreasing order of this index
+    std::vector<ElementIndex> mConnectedComponentMaxPointIndices;
+
+    // The number of connected component (and plane) IDs that are not currently in use
+    size_t mUnusedConnectedComponentIdsCount;
+
+    // The (non-ephemeral) points whose connected components have to be re-flooded
+    // at the next connectivity visit - the endpoints of the springs destroyed
+    // or restored since the last visit
+    std::vector<ElementIndex> mConnectivityVisitSeedPoints;
+
+    // Flag remembering whether the next connectivity visit has to visit the
+    // whole ship, rather than re-flooding the components of the seed points only
+    bool mIsFullConnectivityVisitNeeded;
+
     // Flag remembering whether the structure of the ship (i.e. the connectivity between elements)
     // has changed since the last step.
     // When this flag is set, we'll re-detect connected components and planes, and re-upload elements
     // to the rendering context
     bool mIsStructureDirty;
 
+    // Flag remembering whether the structure of the ship has changed since the last
+    // connectivity visit, i.e. whether connected component IDs are stale
+    bool mHasStructureChangedSinceConnectivityVisit;
+
     // Counts of elements currently broken - updated each time an element is broken
     // or restored
     ElementCount mDamagedPointsCount;
@@ -898,6 +1081,21 @@ private:
     // Index of last-queried point - used as an aid to debugging
     ElementIndex mutable mLastQueriedPointIndex;
 
+    // Spatial index of the ship points, for the queries of tools and force fields; built
+    // on-demand, and dirtied whenever ship points move
+    static float constexpr PointGridCellSize = 2.0f; // Points are about 1m apart
+    UniformGrid mutable mPointGrid;
+    bool mutable mIsPointGridDirty;
+
+    // The length of the longest spring, or more; a spring intersecting a segment has both
+    // its endpoints within this distance from the segment. Taken from the strain calculation
+    // at each step, and rescanned on-demand only after springs are stretched outside of it
+    float mutable mMaxSpringLength;
+    bool mutable mIsMaxSpringLengthDirty;
+
+    // Scratch for spring queries
+    std::vector<ElementIndex> mSpringQueryResults;
+
     // Last-applied (interactive) wind field
     std::optional<WindField> mWindField;
 
@@ -914,11 +1112,43 @@ private:
 
     // The spring relaxation tasks
     std::vector<typename ThreadPool::Task> mSpringRelaxationSpringForcesTasks;
+    std::vector<std::vector<typename ThreadPool::Task>> mSpringRelaxationSpringForcesColorTasks; // One batch per spring color - or per run of consecutive colors too small to be split; used in lieu of the above when springs are colored
     std::vector<typename ThreadPool::Task> mSpringRelaxationIntegrationTasks;
     std::vector<typename ThreadPool::Task> mSpringRelaxationIntegrationAndSeaFloorCollisionTasks;
 
     //
-    // Static pressure
+    // Spring strains
+    //
+
+    // The strain calculation tasks, and the results of each; the tasks work on
+    // consecutive ranges of springs
+    std::vector<typename ThreadPool::Task> mSpringStrainTasks;
+    std::vector<Springs::StrainCalculationResults> mSpringStrainResults;
+
+    //
+    // Ocean depths
+    //
+
+    // Below this number of points per chunk, it's not worth to sample ocean depths in parallel
+    static size_t constexpr OceanDepthsMinPointsPerChunk = 4096;
+
+    //
+    // Internal pressure
+    //
+
+    // Below this number of points per chunk, it's not worth to equalize internal pressure in parallel
+    static size_t constexpr InternalPressureMinPointsPerChunk = 2048;
+    static size_t constexpr InternalPressureMinSpringsPerChunk = 8192;
+
+    // The number of non-hull neighbors of each point
+    Buffer<float> mInternalPressureEqualizationNeighborCountBuffer;
+
+    // The internal pressure flowing through each spring, from its lower-index
+    // endpoint towards its higher-index endpoint
+    Buffer<float> mInternalPressureEqualizationSpringFluxBuffer;
+
+    //
+    // Frontier forces (surface forces and static pressure)
     //
 
     struct StaticPressureOnPoint
@@ -937,12 +1167,82 @@ private:
         {}
     };
 
-    // Buffer of StaticPressureOnPoint structs, aiding static pressure calculations.
+    // The state of each frontier forces task.
     //
-    // Note: index in this buffer is _not_ point index, this is simply a container.
-    // Note: may be populated for the same point multiple times, once for each crossing of
-    // the frontier through that point.
-    Buffer<StaticPressureOnPoint> mStaticPressureBuffer;
+    // Frontiers may share points, hence tasks do not apply forces to points directly;
+    // they accumulate them here instead, and after all tasks are done we apply them
+    // in task order - which, as tasks visit consecutive runs of frontiers, is the order
+    // of a serial visit.
+    struct FrontierForcesTaskState
+    {
+        struct PointForce
+        {
+            ElementIndex PointIndex;
+            vec2f Force;
+
+            PointForce(
+                ElementIndex pointIndex,
+                vec2f const & force)
+                : PointIndex(pointIndex)
+                , Force(force)
+            {}
+        };
+
+        struct OceanSurfaceDisplacement
+        {
+            float X;
+            float Displacement;
+
+            OceanSurfaceDisplacement(
+                float x,
+                float displacement)
+                : X(x)
+                , Displacement(displacement)
+            {}
+        };
+
+        // The frontiers visited by this task
+        std::vector<FrontierId> FrontierIds;
+
+        std::vector<PointForce> PointForces;
+        std::vector<OceanSurfaceDisplacement> OceanSurfaceDisplacements;
+        float TotalWaterDisplacementMagnitude;
+
+        // Aids static pressure calculations.
+        //
+        // Note: index in this buffer is _not_ point index, this is simply a container.
+        // Note: may be populated for the same point multiple times, once for each crossing of
+        // the frontier through that point.
+        std::vector<StaticPressureOnPoint> StaticPressureBuffer;
+
+        // For statistics
+        float StaticPressureNetForceMagnitudeSum;
+        float StaticPressureNetForceMagnitudeCount;
+        float StaticPressureIterationsPercentagesSum;
+        float StaticPressureIterationsCount;
+
+        FrontierForcesTaskState()
+            : FrontierIds()
+            , PointForces()
+            , OceanSurfaceDisplacements()
+            , TotalWaterDisplacementMagnitude(0.0f)
+            , StaticPressureBuffer()
+            , StaticPressureNetForceMagnitudeSum(0.0f)
+            , StaticPressureNetForceMagnitudeCount(0.0f)
+            , StaticPressureIterationsPercentagesSum(0.0f)
+            , StaticPressureIterationsCount(0.0f)
+        {}
+    };
+
+    // Below this number of frontier edges per task, it's not worth to run in parallel
+    static ElementCount constexpr FrontierForcesMinEdgesPerTask = 1000;
+
+    // One state per task, the maximum number of tasks being the simulation parallelism
+    std::vector<FrontierForcesTaskState> mFrontierForcesTaskStates;
+
+    // The tasks of the current frontier visit, re-created at each visit as the
+    // frontiers change
+    std::vector<typename ThreadPool::Task> mFrontierForcesTasks;
 
     // For statistics
     float mStaticPressureNetForceMagnitudeSum;
@@ -950,13 +1250,187 @@ private:
     float mStaticPressureIterationsPercentagesSum;
     float mStaticPressureIterationsCount;
 
+    //
+    // Water velocities
+    //
+
+    // The water velocities tasks, one batch per pass
+    std::vector<typename ThreadPool::Task> mWaterVelocitiesOutboundFlowTasks;
+    std::vector<typename ThreadPool::Task> mWaterVelocitiesInboundFlowTasks;
+
+    // The water splashed at each outbound flow task
+    std::vector<float> mWaterVelocitiesTaskWaterSplashed;
+
+    // Water quantity and momentum flowing out of each endpoint of each spring, towards
+    // the other endpoint; indexed by spring index * 2, + 1 for endpoint B
+    Buffer<float> mSpringOutboundWaterQuantityBuffer;
+    Buffer<vec2f> mSpringOutboundWaterMomentumBuffer;
+
+    //
+    // Heat propagation
+    //
+
+    // The fraction of its outgoing heat that each point may actually give away
+    // without going below zero Kelvin
+    Buffer<float> mHeatOutflowNormalizationFactorBuffer;
+
+    // The heat conductance of each spring in the current time quantum
+    Buffer<float> mSpringHeatConductanceBuffer;
+
+    // Below this number of points per chunk, it's not worth to propagate heat in parallel
+    static size_t constexpr HeatPropagationMinPointsPerChunk = 2048;
+
     //
     // Light diffusion
     //
 
     // The light diffusion tasks
+    std::vector<typename ThreadPool::Task> mLightDiffusionChangeDetectionTasks;
     std::vector<typename ThreadPool::Task> mLightDiffusionTasks;
 
+    // The number of dirty point batches found by each change detection task
+    std::vector<ElementCount> mLightDiffusionTaskDirtyBatchCounts;
+
+    // Above this number of dirty regions, checking points costs more than
+    // diffusing all of them
+    static size_t constexpr MaxLightDiffusionDirtyRegions = 16;
+
+    // The state of the points and of the lamps at the last time they have been diffused
+    Buffer<vec2f> mLightDiffusionLastPointPositionBuffer;
+    LightDiffusionKernels::LampHistory mLightDiffusionLampHistory;
+    SequenceNumber mLightDiffusionLastConnectivityVisitSequenceNumber; // None when last state is not valid
+
+    // The areas reached by the lamps that have changed, before and after the change
+    std::vector<LightDiffusionKernels::DirtyRegion> mLightDiffusionDirtyRegions;
+
+    // Whether each batch of vectorization_float_count points needs to be diffused
+    Buffer<bool> mLightDiffusionDirtyBatchBuffer;
+
+    // Below this number of lamps, binning lamps into tiles costs more than it saves
+    static ElementCount constexpr MinLampsForTiledLightDiffusion = 16;
+
+    // The lamps binned by tile, when light diffusion is tiled
+    Algorithms::DiffuseLightTiles<vec2f> mLightDiffusionTiles;
+    bool mIsLightDiffusionTiled;
+
+    //
+    // Sleeping
+    //
+    // Connected components whose points are slow and whose springs are not stressed
+    // for a while are put to sleep: their points are frozen, and spring relaxation
+    // skips the blocks of springs and points that are entirely asleep.
+    // Sleeping components wake up when any of their points is moved, when the
+    // static force on any of their points changes, or when any of their springs
+    // is destroyed or restored
+    //
+
+    // Below this velocity a point is at rest
+    static float constexpr SleepingMaxVelocity = 0.05f; // m/s
+
+    // The number of consecutive steps a connected component must be at rest for to fall asleep
+    static std::uint32_t constexpr SleepingRestStepsCount = 128;
+
+    // Changes of the static force larger than this fraction of a point's weight wake up the point
+    static float constexpr SleepingMaxStaticForceChange = 0.1f;
+
+    // The granularity of the skipping of springs and points; a multiple of all vectorization
+    // word sizes and of the perfect square size
+    static ElementCount constexpr SleepingBlockSize = 16;
+
+    struct ConnectedComponentSleepState
+    {
+        std::uint32_t RestingStepsCount;
+        bool IsSleeping;
+
+        // Scratch, for the current step
+        float MaxVelocitySquared;
+        bool HasStressedSprings;
+        bool IsDisturbed;
+
+        ConnectedComponentSleepState()
+            : RestingStepsCount(0)
+            , IsSleeping(false)
+            , MaxVelocitySquared(0.0f)
+            , HasStressedSprings(false)
+            , IsDisturbed(false)
+        {}
+    };
+
+    // Indexed by connected component ID, and maintained by connectivity visits together with
+    // the other per-component vectors: components that are re-flooded start awake, while all
+    // other components keep their state
+    std::vector<ConnectedComponentSleepState> mConnectedComponentSleepStates;
+
+    // Set when a connectivity visit has woken up components that were sleeping, whose points
+    // have thus to be woken up at the next update
+    bool mHaveConnectedComponentsBeenWokenUpByConnectivityVisit;
+
+    ElementCount mSleepingPointCount;
+
+    // The position and static force of each sleeping point when it fell asleep
+    Buffer<vec2f> mSleepingPointPositionBuffer;
+    Buffer<vec2f> mSleepingPointStaticForceBuffer;
+
+    // Whether each block of springs and points has at least one awake element;
+    // only valid when there are sleeping points
+    Buffer<bool> mIsSpringBlockAwakeBuffer;
+    Buffer<bool> mIsPointBlockAwakeBuffer;
+
+    //
+    // Update task graph
+    //
+
+    // The state read and written by the tasks of the update task graph;
+    // "Point" resources only cover non-ephemeral points
+    enum class UpdateTaskGraphResource : size_t
+    {
+        PointPositions = 0,
+        PointWater,
+        PointWaterDynamics, // Water velocities and momenta
+        PointInternalPressure,
+        PointDynamicForces,
+        PointStaticForces,
+        PointTemperature,
+        PointDecay,
+        PointCombustion,
+        PointLight,
+        PointHighlights,
+        PointCachedDepths,
+        PointLeaking,
+        Structure, // Connectivity, frontiers, hullness
+        EphemeralParticles, // All state of ephemeral particles
+        SpringParameters,
+        ElectricalElements,
+        ElectricSparks,
+        StateMachines,
+        SinkingState,
+        StaticPressureState,
+        RandomStream
+    };
+
+    // The graph of the tasks run at each update after the water intake
+    TaskGraph mUpdateTaskGraph;
+
+    // Set while the update task graph runs
+    bool mIsUpdateTaskGraphRunning;
+
+    // Watertight door updates raised by electrical elements while the update task
+    // graph runs; they change hullness and water, hence they are applied after the graph
+    struct PendingWatertightDoorUpdate
+    {
+        ElementIndex PointIndex;
+        bool IsOpen;
+
+        PendingWatertightDoorUpdate(
+            ElementIndex pointIndex,
+            bool isOpen)
+            : PointIndex(pointIndex)
+            , IsOpen(isOpen)
+        {}
+    };
+
+    std::vector<PendingWatertightDoorUpdate> mPendingWatertightDoorUpdates;
+
     //
     // Render members
     //
@@ -82,35 +82,6 @@ void ShipElectricSparks::Update()
     mAreSparksPopulatedBeforeNextUpdate = false;
 }
 
-void ShipElectricSparks::Upload(
-    Points const & points,
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
-
-    shipRenderContext.UploadElectricSparksStart(mSparksToRender.size());
-
-    for (auto const & electricSpark : mSparksToRender)
-    {
-        shipRenderContext.UploadElectricSpark(
-            points.GetPlaneId(electricSpark.StartPointIndex),
-            electricSpark.StartPointPosition,
-            electricSpark.StartSize,
-            electricSpark.EndPointPosition,
-            electricSpark.EndSize,
-            electricSpark.Direction,
-            electricSpark.PreviousSparkIndex.has_value()
-                ? mSparksToRender[*electricSpark.PreviousSparkIndex].Direction
-                : electricSpark.Direction,
-            electricSpark.NextSparkIndex.has_value()
-                ? mSparksToRender[*electricSpark.NextSparkIndex].Direction
-                : electricSpark.Direction);
-    }
-
-    shipRenderContext.UploadElectricSparksEnd();
-}
-
 /// //////////////////////////////////////////////////////////////
 
 void ShipElectricSparks::PropagateSparks(
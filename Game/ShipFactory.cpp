@@ -19,6 +19,7 @@
 #include <chrono>
 #include <set>
 #include <sstream>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 
@@ -285,10 +286,11 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData> ShipFactory::Create(
 
     float originalSpringACMR = CalculateACMR(springInfos1);
 
-    auto [pointInfos2, pointIndexRemap, springInfos2, springIndexRemap, perfectSquareCount] = OptimizeLayout(
+    auto [pointInfos2, pointIndexRemap, springInfos2, springIndexRemap, perfectSquareCount, springColorEnds] = OptimizeLayout(
         pointIndexMatrix,
         pointInfos1,
-        springInfos1);
+        springInfos1,
+        gameParameters.DoColorSpringsForParallelism);
 
     float optimizedSpringACMR = CalculateACMR(springInfos2);
 
@@ -358,6 +360,7 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData> ShipFactory::Create(
     Springs springs = CreateSprings(
         springInfos2,
         perfectSquareCount,
+        std::move(springColorEnds),
         points,
         parentWorld,
         gameEventDispatcher,
@@ -883,7 +886,8 @@ void ShipFactory::ConnectPointsToTriangles(
 ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
     ShipFactoryPointIndexMatrix const & pointIndexMatrix,
     std::vector<ShipFactoryPoint> const & pointInfos1,
-    std::vector<ShipFactorySpring> const & springInfos1)
+    std::vector<ShipFactorySpring> const & springInfos1,
+    bool doColorSprings)
 {
     IndexRemap optimalPointRemap(pointInfos1.size());
     IndexRemap optimalSpringRemap(springInfos1.size());
@@ -929,6 +933,10 @@ ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
 
     ElementCount perfectSquareCount = 0;
 
+    // The color of each perfect square, for spring coloring; squares with the same
+    // color (i.e. the same x and y parities) never share a point
+    std::vector<int> perfectSquareColors;
+
     for (int y = 0; y < pointIndexMatrix.height; ++y)
     {
         for (int x = 0; x < pointIndexMatrix.width; ++x)
@@ -1129,6 +1137,8 @@ ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
                     remappedPointMask[d] = true;
                 }
 
+                perfectSquareColors.push_back((x % 2) + 2 * (y % 2));
+
                 ++perfectSquareCount;
             }
         }
@@ -1157,6 +1167,21 @@ ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
         }
     }
 
+    //
+    // Color springs, if requested
+    //
+
+    std::vector<ElementCount> springColorEnds;
+
+    if (doColorSprings)
+    {
+        std::tie(optimalSpringRemap, springColorEnds) = ColorSprings(
+            optimalSpringRemap,
+            perfectSquareColors,
+            pointInfos1,
+            springInfos1);
+    }
+
     //
     // Remap
     //
@@ -1192,7 +1217,108 @@ ShipFactory::LayoutOptimizationResults ShipFactory::OptimizeLayout(
         optimalPointRemap,
         springInfos2,
         optimalSpringRemap,
-        perfectSquareCount);
+        perfectSquareCount,
+        springColorEnds);
+}
+
+std::tuple<IndexRemap, std::vector<ElementCount>> ShipFactory::ColorSprings(
+    IndexRemap const & springRemap,
+    std::vector<int> const & perfectSquareColors,
+    std::vector<ShipFactoryPoint> const & pointInfos1,
+    std::vector<ShipFactorySpring> const & springInfos1)
+{
+    //
+    // Re-orders springs into "colors", i.e. contiguous ranges of springs such that
+    // no two springs in the same range share an endpoint; this way the springs
+    // of a color may apply their forces concurrently, without conflicts.
+    //
+    // Perfect squares come first, grouped into four colors based on the parity of
+    // their coordinates, so that the perfect square layout is maintained; the
+    // leftover springs follow, colored greedily.
+    //
+
+    size_t constexpr PerfectSquareColorCount = 4;
+
+    IndexRemap coloredSpringRemap(springInfos1.size());
+    std::vector<ElementCount> springColorEnds;
+
+    auto const & oldSpringIndices = springRemap.GetOldIndices();
+
+    // 1. Perfect squares
+
+    ElementCount const perfectSquareCount = static_cast<ElementCount>(perfectSquareColors.size());
+
+    for (size_t c = 0; c < PerfectSquareColorCount; ++c)
+    {
+        for (ElementIndex ps = 0; ps < perfectSquareCount; ++ps)
+        {
+            if (perfectSquareColors[ps] == static_cast<int>(c))
+            {
+                for (ElementIndex s = ps * 4; s < ps * 4 + 4; ++s)
+                {
+                    coloredSpringRemap.AddOld(oldSpringIndices[s]);
+                }
+            }
+        }
+
+        // Skip empty colors
+        ElementCount const colorEnd = static_cast<ElementCount>(coloredSpringRemap.GetOldIndices().size());
+        if (colorEnd > (springColorEnds.empty() ? 0 : springColorEnds.back()))
+        {
+            springColorEnds.push_back(colorEnd);
+        }
+    }
+
+    // 2. Leftovers
+
+    std::vector<std::uint32_t> pointColorMasks(pointInfos1.size(), 0);
+    std::vector<std::vector<ElementIndex>> leftoverSpringsByColor;
+
+    for (size_t s = perfectSquareCount * 4; s < oldSpringIndices.size(); ++s)
+    {
+        ElementIndex const oldSpringIndex = oldSpringIndices[s];
+        ElementIndex const pointAIndex = springInfos1[oldSpringIndex].PointAIndex;
+        ElementIndex const pointBIndex = springInfos1[oldSpringIndex].PointBIndex;
+
+        // Find first color not used yet by either endpoint
+        std::uint32_t const usedColors = pointColorMasks[pointAIndex] | pointColorMasks[pointBIndex];
+        size_t color = 0;
+        while ((usedColors & (std::uint32_t(1) << color)) != 0)
+        {
+            ++color;
+        }
+
+        // A point has at most GameParameters::MaxSpringsPerPoint springs
+        assert(color < 32);
+
+        pointColorMasks[pointAIndex] |= std::uint32_t(1) << color;
+        pointColorMasks[pointBIndex] |= std::uint32_t(1) << color;
+
+        if (color >= leftoverSpringsByColor.size())
+        {
+            leftoverSpringsByColor.resize(color + 1);
+        }
+
+        leftoverSpringsByColor[color].push_back(oldSpringIndex);
+    }
+
+    for (auto const & colorSprings : leftoverSpringsByColor)
+    {
+        for (ElementIndex oldSpringIndex : colorSprings)
+        {
+            coloredSpringRemap.AddOld(oldSpringIndex);
+        }
+
+        springColorEnds.push_back(static_cast<ElementCount>(coloredSpringRemap.GetOldIndices().size()));
+    }
+
+    assert(coloredSpringRemap.GetOldIndices().size() == oldSpringIndices.size());
+
+    LogMessage("LayoutOptimizer: ", springColorEnds.size(), " spring colors (", leftoverSpringsByColor.size(), " for leftover springs)");
+
+    return std::make_tuple(
+        coloredSpringRemap,
+        springColorEnds);
 }
 
 void ShipFactory::ConnectSpringsAndTriangles(
@@ -1677,6 +1803,7 @@ Physics::Points ShipFactory::CreatePoints(
 Physics::Springs ShipFactory::CreateSprings(
     std::vector<ShipFactorySpring> const & springInfos2,
     ElementCount perfectSquareCount,
+    std::vector<ElementCount> && springColorEnds,
     Physics::Points & points,
     Physics::World & parentWorld,
     std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
@@ -1685,6 +1812,7 @@ Physics::Springs ShipFactory::CreateSprings(
     Physics::Springs springs(
         static_cast<ElementIndex>(springInfos2.size()),
         perfectSquareCount,
+        std::move(springColorEnds),
         parentWorld,
         std::move(gameEventDispatcher),
         gameParameters);
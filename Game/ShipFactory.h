@@ -156,11 +156,18 @@ private:
         std::vector<ShipFactoryPoint> & pointInfos1,
         std::vector<ShipFactoryTriangle> const & triangleInfos1);
 
-    using LayoutOptimizationResults = std::tuple<std::vector<ShipFactoryPoint>, IndexRemap, std::vector<ShipFactorySpring>, IndexRemap, ElementCount>;
+    using LayoutOptimizationResults = std::tuple<std::vector<ShipFactoryPoint>, IndexRemap, std::vector<ShipFactorySpring>, IndexRemap, ElementCount, std::vector<ElementCount>>;
 
     static LayoutOptimizationResults OptimizeLayout(
         ShipFactoryPointIndexMatrix const & pointIndexMatrix,
         std::vector<ShipFactoryPoint> const & pointInfos1,
+        std::vector<ShipFactorySpring> const & springInfos1,
+        bool doColorSprings);
+
+    static std::tuple<IndexRemap, std::vector<ElementCount>> ColorSprings(
+        IndexRemap const & springRemap,
+        std::vector<int> const & perfectSquareColors,
+        std::vector<ShipFactoryPoint> const & pointInfos1,
         std::vector<ShipFactorySpring> const & springInfos1);
 
     static void ConnectSpringsAndTriangles(
@@ -198,6 +205,7 @@ private:
     static Physics::Springs CreateSprings(
         std::vector<ShipFactorySpring> const & springInfos2,
         ElementCount perfectSquareCount,
+        std::vector<ElementCount> && springColorEnds,
         Physics::Points & points,
         Physics::World & parentWorld,
         std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
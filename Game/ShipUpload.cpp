@@ -0,0 +1,1523 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-17
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "Physics.h"
+
+#include "RenderContext.h"
+#include "Ship_StateMachines.h"
+
+#include <GameCore/GameMath.h>
+#include <GameCore/Log.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace Physics {
+
+///////////////////////////////////////////////////////////////////////////////////
+// Ship
+///////////////////////////////////////////////////////////////////////////////////
+
+void Ship::RenderUpload(Render::RenderContext & renderContext)
+{
+    //
+    // Run all tasks that need to run when connectivity has changed
+    // (i.e. when the connected components have changed, e.g. because
+    // of particle or spring deletion)
+    //
+    // Note: we have to do this here, at render time rather than
+    // at update time, because the structure might have been dirtied
+    // by an interactive tool while the game is paused
+    //
+
+    if (mIsStructureDirty)
+    {
+        // Re-calculate connected components
+        RunConnectivityVisit();
+
+        // Notify electrical elements
+        mElectricalElements.OnPhysicalStructureChanged(mPoints);
+    }
+
+    //
+    // Initialize upload
+    //
+
+    auto & shipRenderContext = renderContext.GetShipRenderContext(mId);
+
+    shipRenderContext.UploadStart(mMaxMaxPlaneId);
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    //
+    // Upload points's immutable and mutable attributes
+    //
+
+    mPoints.UploadAttributes(
+        mId,
+        renderContext);
+
+    //
+    // Upload elements, if needed
+    //
+
+    if (mIsStructureDirty
+        || !mLastUploadedDebugShipRenderMode
+        || *mLastUploadedDebugShipRenderMode != renderContext.GetDebugShipRenderMode())
+    {
+        shipRenderContext.UploadElementsStart();
+
+        //
+        // Upload point elements (either orphaned only or all, depending
+        // on the debug render mode)
+        //
+
+        mPoints.UploadNonEphemeralPointElements(
+            mId,
+            renderContext);
+
+        //
+        // Upload spring elements (including ropes) (edge or all, depending
+        // on the debug render mode)
+        //
+
+        mSprings.UploadElements(
+            mId,
+            renderContext);
+
+        //
+        // Upload triangles, but only if structure is dirty
+        // (we can't upload more frequently as mPlaneTriangleIndicesToRender is a one-time use)
+        //
+
+        if (mIsStructureDirty)
+        {
+            assert(mPlaneTriangleIndicesToRender.size() >= 1);
+
+            shipRenderContext.UploadElementTrianglesStart(mPlaneTriangleIndicesToRender.back());
+
+            mTriangles.UploadElements(
+                mId,
+                mPlaneTriangleIndicesToRender,
+                mPoints,
+                renderContext);
+
+            shipRenderContext.UploadElementTrianglesEnd();
+        }
+
+        shipRenderContext.UploadElementsEnd();
+    }
+
+    //
+    // Upload stressed springs
+    //
+    // We do this regardless of whether or not elements are dirty,
+    // as the set of stressed springs is bound to change from frame to frame
+    //
+
+    shipRenderContext.UploadElementStressedSpringsStart();
+
+    if (renderContext.GetShowStressedSprings())
+    {
+        mSprings.UploadStressedSpringElements(
+            mId,
+            renderContext);
+    }
+
+    shipRenderContext.UploadElementStressedSpringsEnd();
+
+    //
+    // Upload electrical elements
+    //
+
+    mElectricalElements.Upload(
+        shipRenderContext,
+        mPoints);
+
+    //
+    // Upload electric sparks
+    //
+
+    mElectricSparks.Upload(
+        mPoints,
+        mId,
+        renderContext);
+
+    //
+    // Upload frontiers
+    //
+
+    mFrontiers.Upload(
+        mId,
+        renderContext);
+
+    //
+    // Upload flames
+    //
+
+    mPoints.UploadFlames(
+        mId,
+        renderContext);
+
+    //
+    // Upload gadgets
+    //
+
+    mGadgets.Upload(
+        mId,
+        renderContext);
+
+    //
+    // Upload pinned points
+    //
+
+    mPinnedPoints.Upload(
+        mId,
+        renderContext);
+
+    //
+    // Upload ephemeral points and textures
+    //
+
+    mPoints.UploadEphemeralParticles(
+        mId,
+        renderContext);
+
+    //
+    // Upload highlights
+    //
+
+    mPoints.UploadHighlights(
+        mId,
+        renderContext);
+
+    //
+    // Upload vector fields
+    //
+
+    mPoints.UploadVectors(
+        mId,
+        renderContext);
+
+    //
+    // Upload state machines
+    //
+
+    UploadStateMachines(renderContext);
+
+    //
+    // Upload overlays
+    //
+
+    mOverlays.Upload(
+        mId,
+        renderContext);
+
+    //////////////////////////////////////////////////////////////////////////////
+
+    //
+    // Finalize upload
+    //
+
+    shipRenderContext.UploadEnd();
+
+    //
+    // Reset render state
+    //
+
+    mIsStructureDirty = false;
+    mLastUploadedDebugShipRenderMode = renderContext.GetDebugShipRenderMode();
+}
+
+void Ship::UploadExplosionStateMachine(
+    ExplosionStateMachine const & explosionStateMachine,
+    Render::RenderContext & renderContext)
+{
+    auto & shipRenderContext = renderContext.GetShipRenderContext(mId);
+
+    shipRenderContext.UploadExplosion(
+        explosionStateMachine.Plane,
+        explosionStateMachine.CenterPosition,
+        explosionStateMachine.BlastRadius,
+        explosionStateMachine.Type,
+        explosionStateMachine.PersonalitySeed,
+        explosionStateMachine.CurrentProgress);
+}
+
+void Ship::UploadStateMachines(Render::RenderContext & renderContext)
+{
+    for (auto const & sm : mStateMachines)
+    {
+        switch (sm->Type)
+        {
+            case StateMachineType::Explosion:
+            {
+                UploadExplosionStateMachine(
+                    dynamic_cast<ExplosionStateMachine const &>(*sm),
+                    renderContext);
+
+                break;
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// Points
+///////////////////////////////////////////////////////////////////////////////////
+
+void Points::UploadAttributes(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    // Upload immutable attributes, if we haven't uploaded them yet
+    if (mIsTextureCoordinatesBufferDirty)
+    {
+        shipRenderContext.UploadPointImmutableAttributes(mTextureCoordinatesBuffer.data());
+
+        mIsTextureCoordinatesBufferDirty = false;
+    }
+
+    // Upload colors, if dirty
+    if (mIsWholeColorBufferDirty)
+    {
+        renderContext.UploadShipPointColorsAsync(
+            shipId,
+            mColorBuffer.data(),
+            0,
+            mAllPointCount);
+
+        mIsWholeColorBufferDirty = false;
+        mIsEphemeralColorBufferDirty = false;
+    }
+    else if (mIsEphemeralColorBufferDirty)
+    {
+        // Only upload ephemeral particle portion
+        renderContext.UploadShipPointColorsAsync(
+            shipId,
+            &(mColorBuffer.data()[mAlignedShipPointCount]),
+            mAlignedShipPointCount,
+            mEphemeralPointCount);
+
+        mIsEphemeralColorBufferDirty = false;
+    }
+
+    //
+    // Upload mutable attributes
+    //
+
+    shipRenderContext.UploadPointMutableAttributesStart();
+
+    shipRenderContext.UploadPointMutableAttributes(
+        mPositionBuffer.data(),
+        mLightBuffer.data(),
+        mWaterBuffer.data());
+
+    if (mIsPlaneIdBufferNonEphemeralDirty)
+    {
+        if (mIsPlaneIdBufferEphemeralDirty)
+        {
+            // Whole
+
+            shipRenderContext.UploadPointMutableAttributesPlaneId(
+                mPlaneIdFloatBuffer.data(),
+                0,
+                mAllPointCount);
+
+            mIsPlaneIdBufferEphemeralDirty = false;
+        }
+        else
+        {
+            // Just non-ephemeral portion
+
+            shipRenderContext.UploadPointMutableAttributesPlaneId(
+                mPlaneIdFloatBuffer.data(),
+                0,
+                mRawShipPointCount);
+        }
+
+        mIsPlaneIdBufferNonEphemeralDirty = false;
+    }
+    else if (mIsPlaneIdBufferEphemeralDirty)
+    {
+        // Just ephemeral portion
+
+        shipRenderContext.UploadPointMutableAttributesPlaneId(
+            &(mPlaneIdFloatBuffer.data()[mAlignedShipPointCount]),
+            mAlignedShipPointCount,
+            mEphemeralPointCount);
+
+        mIsPlaneIdBufferEphemeralDirty = false;
+    }
+
+    // The following attributes never change for ephemeral particles,
+    // hence after the first upload for reasonable defaults, we only
+    // need to upload them for the ship's (structural == raw) points,
+    // not for the ephemeral ones
+    size_t const partialPointCount = mHaveWholeBuffersBeenUploadedOnce ? mRawShipPointCount : mAllPointCount;
+
+    if (mIsDecayBufferDirty)
+    {
+        shipRenderContext.UploadPointMutableAttributesDecay(
+            mDecayBuffer.data(),
+            0,
+            partialPointCount);
+
+        mIsDecayBufferDirty = false;
+    }
+
+    if (renderContext.GetHeatRenderMode() != HeatRenderModeType::None)
+    {
+        renderContext.UploadShipPointTemperatureAsync(
+            shipId,
+            mTemperatureBuffer.data(),
+            0,
+            partialPointCount);
+    }
+
+    if (renderContext.GetStressRenderMode() != StressRenderModeType::None)
+    {
+        renderContext.UploadShipPointStressAsync(
+            shipId,
+            mStressBuffer.data(),
+            0,
+            partialPointCount);
+    }
+
+    if (renderContext.GetDebugShipRenderMode() == DebugShipRenderModeType::InternalPressure)
+    {
+        renderContext.UploadShipPointAuxiliaryDataAsync(
+            shipId,
+            mInternalPressureBuffer.data(),
+            0,
+            partialPointCount);
+    }
+    else if (renderContext.GetDebugShipRenderMode() == DebugShipRenderModeType::Strength)
+    {
+        renderContext.UploadShipPointAuxiliaryDataAsync(
+            shipId,
+            mStrengthBuffer.data(),
+            0,
+            partialPointCount);
+    }
+
+    shipRenderContext.UploadPointMutableAttributesEnd();
+
+    mHaveWholeBuffersBeenUploadedOnce = true;
+}
+
+void Points::UploadNonEphemeralPointElements(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    bool const doUploadAllPoints = (DebugShipRenderModeType::Points == renderContext.GetDebugShipRenderMode());
+
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    for (ElementIndex pointIndex : RawShipPoints())
+    {
+        if (doUploadAllPoints
+            || mColdAttributesBuffer[pointIndex].ConnectedSprings.ConnectedSprings.empty()) // orphaned
+        {
+            shipRenderContext.UploadElementPoint(pointIndex);
+        }
+    }
+}
+
+void Points::UploadFlames(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    //
+    // Flames are uploaded in this order:
+    //  - Z order (guaranteed by internal sorting of mBurningPoints)
+    //  - Background flames first (i.e. flames on ropes/springs) followed
+    //    by foreground flames
+    //
+    // We use # of triangles as a heuristic for the point being on a chain,
+    // and we use the *factory* ones to avoid sudden depth jumps when triangles are destroyed by fire
+    //
+
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    shipRenderContext.UploadFlamesStart(mBurningPoints.size());
+
+    // Background
+    for (auto const pointIndex : mBurningPoints)
+    {
+        if (mColdAttributesBuffer[pointIndex].FactoryConnectedTriangles.ConnectedTriangles.empty())
+        {
+            shipRenderContext.UploadBackgroundFlame(
+                GetPlaneId(pointIndex),
+                GetPosition(pointIndex),
+                mCombustionStateBuffer[pointIndex].FlameVector,
+                mCombustionStateBuffer[pointIndex].FlameWindRotationAngle,
+                mCombustionStateBuffer[pointIndex].FlameDevelopment, // scale
+                mRandomNormalizedUniformFloatBuffer[pointIndex]);
+        }
+    }
+
+    // Foreground
+    for (auto const pointIndex : mBurningPoints)
+    {
+        if (!mColdAttributesBuffer[pointIndex].FactoryConnectedTriangles.ConnectedTriangles.empty())
+        {
+            shipRenderContext.UploadForegroundFlame(
+                GetPlaneId(pointIndex),
+                GetPosition(pointIndex),
+                mCombustionStateBuffer[pointIndex].FlameVector,
+                mCombustionStateBuffer[pointIndex].FlameWindRotationAngle,
+                mCombustionStateBuffer[pointIndex].FlameDevelopment, // scale
+                mRandomNormalizedUniformFloatBuffer[pointIndex]);
+        }
+    }
+
+    shipRenderContext.UploadFlamesEnd();
+}
+
+void Points::UploadVectors(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    vec4f color;
+    vec2f const * vectorBuffer = nullptr;
+    float lengthAdjustment = 0.0f;
+
+    switch (renderContext.GetVectorFieldRenderMode())
+    {
+        case VectorFieldRenderModeType::PointStaticForce:
+        {
+            color = vec4f(0.5f, 0.1f, 0.f, 1.0f);
+            vectorBuffer = mStaticForceBuffer.data();
+            lengthAdjustment = 0.00075f;
+
+            break;
+        }
+
+        case VectorFieldRenderModeType::PointDynamicForce:
+        {
+            color = vec4f(1.0f, 0.266f, 0.16f, 1.0f);
+            // First buffer implicitly
+            assert(mDynamicForceBuffers.size() >= 1);
+            vectorBuffer = mDynamicForceBuffers[0].data();
+            lengthAdjustment = 0.000001f;
+
+            break;
+        }
+
+        case VectorFieldRenderModeType::PointVelocity:
+        {
+            color = vec4f(0.203f, 0.552f, 0.219f, 1.0f);
+            vectorBuffer = mVelocityBuffer.data();
+            lengthAdjustment = 0.25f;
+
+            break;
+        }
+
+        case VectorFieldRenderModeType::PointWaterMomentum:
+        {
+            color = vec4f(0.054f, 0.066f, 0.443f, 1.0f);
+            vectorBuffer = mWaterMomentumBuffer.data();
+            lengthAdjustment = 0.4f;
+
+            break;
+        }
+
+        case VectorFieldRenderModeType::PointWaterVelocity:
+        {
+            color = vec4f(0.094f, 0.509f, 0.925f, 1.0f);
+            vectorBuffer = mWaterVelocityBuffer.data();
+            lengthAdjustment = 1.0f;
+
+            break;
+        }
+
+        case VectorFieldRenderModeType::None:
+        {
+            return;
+        }
+    }
+
+    shipRenderContext.UploadVectorsStart(mElementCount, color);
+
+    for (auto const p : this->RawShipPoints())
+    {
+        shipRenderContext.UploadVector(
+            GetPosition(p),
+            mPlaneIdFloatBuffer[p],
+            vectorBuffer[p],
+            lengthAdjustment);
+    }
+
+    for (auto const p : this->EphemeralPoints())
+    {
+        if (GetEphemeralType(p) != EphemeralType::None)
+        {
+            shipRenderContext.UploadVector(
+                GetPosition(p),
+                mPlaneIdFloatBuffer[p],
+                vectorBuffer[p],
+                lengthAdjustment);
+        }
+    }
+
+    shipRenderContext.UploadVectorsEnd();
+}
+
+void Points::UploadEphemeralParticles(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    //
+    // Upload points and/or textures
+    //
+
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    if (mAreEphemeralPointElementsDirtyForRendering)
+    {
+        shipRenderContext.UploadElementEphemeralPointsStart();
+    }
+
+    for (ElementIndex pointIndex : this->EphemeralPoints())
+    {
+        switch (GetEphemeralType(pointIndex))
+        {
+            case EphemeralType::AirBubble:
+            {
+                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
+
+                // Calculate scale based on lifetime
+                float constexpr ScaleMax = 0.2f;
+                float constexpr ScaleMin = 0.04f;
+                float const scale =
+                    ScaleMin + (ScaleMax - ScaleMin) * SmoothStep(0.0f, 2.0f, state.SimulationLifetime);
+
+                shipRenderContext.UploadAirBubble(
+                    GetPlaneId(pointIndex),
+                    GetPosition(pointIndex),
+                    scale,
+                    std::min(0.6f, state.CurrentDeltaY)); // Alpha
+
+                break;
+            }
+
+            case EphemeralType::Debris:
+            {
+                // Don't upload point unless there's been a change
+                if (mAreEphemeralPointElementsDirtyForRendering)
+                {
+                    shipRenderContext.UploadElementEphemeralPoint(pointIndex);
+                }
+
+                break;
+            }
+
+            case EphemeralType::Smoke:
+            {
+                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke;
+
+                // Calculate scale
+                float const scale = state.ScaleProgress;
+
+                // Calculate alpha
+                float const lifetimeProgress = state.LifetimeProgress;
+                float const alpha =
+                    SmoothStep(0.0f, 0.05f, lifetimeProgress)
+                    - SmoothStep(0.7f, 1.0f, lifetimeProgress);
+
+                // Upload smoke
+                shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                    GetPlaneId(pointIndex),
+                    state.PersonalitySeed,
+                    state.TextureGroup,
+                    GetPosition(pointIndex),
+                    scale,
+                    alpha);
+
+                break;
+            }
+
+            case EphemeralType::Sparkle:
+            {
+                shipRenderContext.UploadSparkle(
+                    GetPlaneId(pointIndex),
+                    GetPosition(pointIndex),
+                    GetVelocity(pointIndex),
+                    mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress);
+
+                break;
+            }
+
+            case EphemeralType::WakeBubble:
+            {
+                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble;
+
+                shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                    GetPlaneId(pointIndex),
+                    TextureFrameId(Render::GenericMipMappedTextureGroups::EngineWake, 0),
+                    GetPosition(pointIndex),
+                    0.10f + 1.22f * state.Progress, // Scale, magic formula
+                    mRandomNormalizedUniformFloatBuffer[pointIndex] * 2.0f * Pi<float>, // Angle
+                    1.0f - state.Progress); // Alpha
+
+                break;
+            }
+
+            case EphemeralType::None:
+            default:
+            {
+                // Ignore
+                break;
+            }
+        }
+    }
+
+    if (mAreEphemeralPointElementsDirtyForRendering)
+    {
+        shipRenderContext.UploadElementEphemeralPointsEnd();
+
+        // Not dirty anymore
+        mAreEphemeralPointElementsDirtyForRendering = false;
+    }
+}
+
+void Points::UploadHighlights(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    for (auto const & h : mElectricalElementHighlightedPoints)
+    {
+        shipRenderContext.UploadHighlight(
+            HighlightModeType::ElectricalElement,
+            GetPlaneId(h.PointIndex),
+            GetPosition(h.PointIndex),
+            5.0f, // HalfQuadSize, magic number
+            h.HighlightColor,
+            h.Progress);
+    }
+
+    for (auto const & h : mCircleHighlightedPoints)
+    {
+        shipRenderContext.UploadHighlight(
+            HighlightModeType::Circle,
+            GetPlaneId(h.PointIndex),
+            GetPosition(h.PointIndex),
+            4.0f, // HalfQuadSize, magic number
+            h.HighlightColor,
+            1.0f);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// Springs
+///////////////////////////////////////////////////////////////////////////////////
+
+void Springs::UploadElements(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    // Either upload all springs, or just the edge springs
+    bool const doUploadAllSprings =
+        DebugShipRenderModeType::Springs == renderContext.GetDebugShipRenderMode();
+
+    // Ropes are uploaded as springs only if DebugRenderMode is springs or edge springs
+    bool const doUploadRopesAsSprings =
+        DebugShipRenderModeType::Springs == renderContext.GetDebugShipRenderMode()
+        || DebugShipRenderModeType::EdgeSprings == renderContext.GetDebugShipRenderMode();
+
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    for (ElementIndex i : *this)
+    {
+        // Only upload non-deleted springs that are not covered by two super-triangles, unless
+        // we are in springs render mode
+        if (!mIsDeletedBuffer[i])
+        {
+            if (IsRope(i) && !doUploadRopesAsSprings)
+            {
+                shipRenderContext.UploadElementRope(
+                    GetEndpointAIndex(i),
+                    GetEndpointBIndex(i));
+            }
+            else if (
+                mCoveringTrianglesCountBuffer[i] < 2
+                || doUploadAllSprings
+                || IsRope(i))
+            {
+                shipRenderContext.UploadElementSpring(
+                    GetEndpointAIndex(i),
+                    GetEndpointBIndex(i));
+            }
+        }
+    }
+}
+
+void Springs::UploadStressedSpringElements(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    for (ElementIndex i : *this)
+    {
+        if (!mIsDeletedBuffer[i])
+        {
+            if (mStrainStateBuffer[i].IsStressed)
+            {
+                shipRenderContext.UploadElementStressedSpring(
+                    GetEndpointAIndex(i),
+                    GetEndpointBIndex(i));
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// ElectricalElements
+///////////////////////////////////////////////////////////////////////////////////
+
+void ElectricalElements::Upload(
+    Render::ShipRenderContext & shipRenderContext,
+    Points const & points) const
+{
+    //
+    // Upload jet engine flames
+    //
+
+    shipRenderContext.UploadJetEngineFlamesStart();
+
+    for (auto const jetEngineElementIndex : mJetEnginesSortedByPlaneId)
+    {
+        auto const & engineState = mElementStateBuffer[jetEngineElementIndex].Engine;
+        if (engineState.CurrentJetEngineFlameVector != vec2f::zero())
+        {
+            auto const pointIndex = mPointIndexBuffer[jetEngineElementIndex];
+
+            shipRenderContext.UploadJetEngineFlame(
+                points.GetPlaneId(pointIndex),
+                points.GetPosition(pointIndex),
+                engineState.CurrentJetEngineFlameVector,
+                points.GetRandomNormalizedUniformPersonalitySeed(pointIndex));
+        }
+    }
+
+    shipRenderContext.UploadJetEngineFlamesEnd();
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// Frontiers
+///////////////////////////////////////////////////////////////////////////////////
+
+void Frontiers::Upload(
+    ShipId shipId,
+    Render::RenderContext & renderContext)
+{
+    if (renderContext.GetShowFrontiers()
+        && mIsDirtyForRendering)
+    {
+        //
+        // Upload frontier point colors
+        //
+
+        // Generate point colors
+        RegeneratePointColors();
+
+        // Upload point colors
+        renderContext.UploadShipPointFrontierColorsAsync(shipId, mPointColors.data());
+
+        //
+        // Upload frontier point indices
+        //
+
+        auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+        size_t const totalSize = std::accumulate(
+            mFrontiers.cbegin(),
+            mFrontiers.cend(),
+            size_t(0),
+            [](size_t total, auto const & f)
+            {
+                return total + (f.has_value() ? f->Size : 0);
+            });
+
+        shipRenderContext.UploadElementFrontierEdgesStart(totalSize);
+
+        for (auto const & frontier : mFrontiers)
+        {
+            if (frontier.has_value())
+            {
+                assert(frontier->Size > 0);
+
+                ElementIndex const startingEdgeIndex = frontier->StartingEdgeIndex;
+                ElementIndex edgeIndex = startingEdgeIndex;
+
+                do
+                {
+                    auto const nextEdgeIndex = mFrontierEdges[edgeIndex].NextEdgeIndex;
+
+                    // Upload
+                    shipRenderContext.UploadElementFrontierEdge(
+                        mFrontierEdges[edgeIndex].PointAIndex,
+                        mFrontierEdges[nextEdgeIndex].PointAIndex);
+
+                    // Advance
+                    edgeIndex = nextEdgeIndex;
+
+                } while (edgeIndex != startingEdgeIndex);
+            }
+        }
+
+        shipRenderContext.UploadElementFrontierEdgesEnd();
+
+        // We are not dirty anymore
+        mIsDirtyForRendering = false;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// PinnedPoints
+///////////////////////////////////////////////////////////////////////////////////
+
+void PinnedPoints::Upload(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    for (auto pinnedPointIndex : mCurrentPinnedPoints)
+    {
+        assert(mShipPoints.IsPinned(pinnedPointIndex));
+
+        shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+            mShipPoints.GetPlaneId(pinnedPointIndex),
+            TextureFrameId(Render::GenericMipMappedTextureGroups::PinnedPoint, 0),
+            mShipPoints.GetPosition(pinnedPointIndex));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// ShipElectricSparks
+///////////////////////////////////////////////////////////////////////////////////
+
+void ShipElectricSparks::Upload(
+    Points const & points,
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    shipRenderContext.UploadElectricSparksStart(mSparksToRender.size());
+
+    for (auto const & electricSpark : mSparksToRender)
+    {
+        shipRenderContext.UploadElectricSpark(
+            points.GetPlaneId(electricSpark.StartPointIndex),
+            electricSpark.StartPointPosition,
+            electricSpark.StartSize,
+            electricSpark.EndPointPosition,
+            electricSpark.EndSize,
+            electricSpark.Direction,
+            electricSpark.PreviousSparkIndex.has_value()
+                ? mSparksToRender[*electricSpark.PreviousSparkIndex].Direction
+                : electricSpark.Direction,
+            electricSpark.NextSparkIndex.has_value()
+                ? mSparksToRender[*electricSpark.NextSparkIndex].Direction
+                : electricSpark.Direction);
+    }
+
+    shipRenderContext.UploadElectricSparksEnd();
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// ShipOverlays
+///////////////////////////////////////////////////////////////////////////////////
+
+void ShipOverlays::Upload(
+    ShipId shipId,
+    Render::RenderContext & renderContext)
+{
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+    auto const & viewModel = renderContext.GetViewModel();
+
+    if (mIsCentersBufferDirty)
+    {
+        // Sort centers by plane ID
+        std::sort(
+            mCenters.begin(),
+            mCenters.end(),
+            [](auto const & l, auto const & r)
+            {
+                return l.Plane < r.Plane;
+            });
+
+        shipRenderContext.UploadCentersStart(mCenters.size());
+
+        for (auto const & c : mCenters)
+        {
+            shipRenderContext.UploadCenter(
+                c.Plane,
+                c.Position,
+                viewModel);
+        }
+
+        shipRenderContext.UploadCentersEnd();
+
+        if (!mCenters.empty())
+        {
+            // Reset now for next time
+            mCenters.clear();
+
+            // We stay dirty so next time we'll upload emptyness
+            assert(mIsCentersBufferDirty);
+        }
+        else
+        {
+            mIsCentersBufferDirty = false;
+        }
+    }
+
+    if (mIsPointToPointArrowsBufferDirty)
+    {
+        shipRenderContext.UploadPointToPointArrowsStart(mPointToPointArrows.size());
+
+        for (auto const & p : mPointToPointArrows)
+        {
+            shipRenderContext.UploadPointToPointArrow(
+                p.Plane,
+                p.StartPoint,
+                p.EndPoint,
+                p.Color);
+        }
+
+        shipRenderContext.UploadPointToPointArrowsEnd();
+
+        if (!mPointToPointArrows.empty())
+        {
+            // Reset now for next time
+            mPointToPointArrows.clear();
+
+            // We stay dirty so next time we'll upload emptyness
+            assert(mIsPointToPointArrowsBufferDirty);
+        }
+        else
+        {
+            mIsPointToPointArrowsBufferDirty = false;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// Gadgets
+///////////////////////////////////////////////////////////////////////////////////
+
+void Gadgets::Upload(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    for (auto & gadget : mCurrentGadgets)
+    {
+        gadget->Upload(shipId, renderContext);
+    }
+
+    if (mCurrentPhysicsProbeGadget)
+    {
+        mCurrentPhysicsProbeGadget->Upload(shipId, renderContext);
+    }
+}
+
+void Gadget::Upload(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    // Upload is not virtual, so that the gadgets' vtables - which live with the simulation -
+    // do not reference the render library
+    switch (GetType())
+    {
+        case GadgetType::AntiMatterBomb:
+        {
+            static_cast<AntiMatterBombGadget const &>(*this).Upload(shipId, renderContext);
+            break;
+        }
+
+        case GadgetType::ImpactBomb:
+        {
+            static_cast<ImpactBombGadget const &>(*this).Upload(shipId, renderContext);
+            break;
+        }
+
+        case GadgetType::PhysicsProbe:
+        {
+            static_cast<PhysicsProbeGadget const &>(*this).Upload(shipId, renderContext);
+            break;
+        }
+
+        case GadgetType::RCBomb:
+        {
+            static_cast<RCBombGadget const &>(*this).Upload(shipId, renderContext);
+            break;
+        }
+
+        case GadgetType::TimerBomb:
+        {
+            static_cast<TimerBombGadget const &>(*this).Upload(shipId, renderContext);
+            break;
+        }
+    }
+}
+
+void AntiMatterBombGadget::Upload(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    switch (mState)
+    {
+        case State::Contained_1:
+        case State::TriggeringPreImploding_2:
+        {
+            // Armor
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombArmor, 0),
+                GetPosition(),
+                1.0f,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            // Sphere
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombSphere, 0),
+                GetPosition(),
+                1.0f,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            // Rotating cloud
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombSphereCloud, 0),
+                GetPosition(),
+                1.0f,
+                mCurrentCloudRotationAngle,
+                1.0f);
+
+            break;
+        }
+
+        case State::PreImploding_3:
+        {
+            // Armor
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombArmor, 0),
+                GetPosition(),
+                1.0f,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            // Sphere
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombSphere, 0),
+                GetPosition(),
+                1.0f,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            // Rotating cloud
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombSphereCloud, 0),
+                GetPosition(),
+                1.0f,
+                mCurrentCloudRotationAngle,
+                1.0f);
+
+            // Pre-implosion
+            renderContext.UploadAMBombPreImplosion(
+                GetPosition(),
+                mCurrentStateProgress,
+                CalculatePreImplosionRadius(mCurrentStateProgress));
+
+            break;
+        }
+
+        case State::PreImplodingToImplodingPause_4:
+        case State::Imploding_5:
+        {
+            // Armor
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombArmor, 0),
+                GetPosition(),
+                1.0f,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            // Sphere
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombSphere, 0),
+                GetPosition(),
+                1.0f,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            // Rotating cloud
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::AntiMatterBombSphereCloud, 0),
+                GetPosition(),
+                1.0f,
+                mCurrentCloudRotationAngle,
+                1.0f);
+
+            break;
+        }
+
+        case State::PreExploding_6:
+        {
+            // Cross-of-light
+            renderContext.UploadCrossOfLight(
+                mExplosionPosition,
+                mCurrentStateProgress);
+
+            break;
+        }
+
+        case State::Exploding_7:
+        case State::Expired_8:
+        default:
+        {
+            // No drawing
+            break;
+        }
+    }
+}
+
+void ImpactBombGadget::Upload(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    switch (mState)
+    {
+        case State::Idle:
+        case State::TriggeringExplosion:
+        {
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::ImpactBomb, 0),
+                GetPosition(),
+                1.0,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            break;
+        }
+
+        case State::Exploding:
+        {
+            // Calculate current progress
+            float const progress =
+                static_cast<float>(mExplosionFadeoutCounter + 1)
+                / static_cast<float>(ExplosionFadeoutStepsCount);
+
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                mExplosionPlaneId,
+                TextureFrameId(Render::GenericMipMappedTextureGroups::ImpactBomb, 0),
+                mExplosionPosition,
+                1.0f, // Scale
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f - progress);  // Alpha
+
+            break;
+        }
+
+        case State::Expired:
+        {
+            // No drawing
+            break;
+        }
+    }
+}
+
+void PhysicsProbeGadget::Upload(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    switch (mState)
+    {
+        case State::PingOff:
+        {
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::PhysicsProbe, 0),
+                GetPosition(),
+                1.0,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            break;
+        }
+
+        case State::PingOn:
+        {
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::PhysicsProbe, 0),
+                GetPosition(),
+                1.0,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::PhysicsProbePing, 0),
+                GetPosition(),
+                1.0,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            break;
+        }
+
+    }
+}
+
+void RCBombGadget::Upload(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    switch (mState)
+    {
+        case State::IdlePingOff:
+        {
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::RcBomb, 0),
+                GetPosition(),
+                1.0,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            break;
+        }
+
+        case State::IdlePingOn:
+        {
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::RcBomb, 0),
+                GetPosition(),
+                1.0,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::RcBombPing, (mPingOnStepCounter - 1) % PingFramesCount),
+                GetPosition(),
+                1.0,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            break;
+        }
+
+        case State::DetonationLeadIn:
+        {
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::RcBomb, 0),
+                GetPosition(),
+                1.0,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::RcBombPing, (mPingOnStepCounter - 1) % PingFramesCount),
+                GetPosition(),
+                1.0,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            break;
+        }
+
+        case State::Exploding:
+        {
+            // Calculate current progress
+            float const progress =
+                static_cast<float>(mExplosionFadeoutCounter + 1)
+                / static_cast<float>(ExplosionFadeoutStepsCount);
+
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                mExplosionPlaneId,
+                TextureFrameId(Render::GenericMipMappedTextureGroups::RcBomb, 0),
+                mExplosionPosition,
+                1.0f, // Scale
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f - progress);  // Alpha
+
+            break;
+        }
+
+        case State::Expired:
+        {
+            // No drawing
+            break;
+        }
+    }
+}
+
+void TimerBombGadget::Upload(
+    ShipId shipId,
+    Render::RenderContext & renderContext) const
+{
+    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+
+    switch (mState)
+    {
+        case State::SlowFuseBurning:
+        case State::FastFuseBurning:
+        {
+            // Render bomb
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::TimerBomb, mFuseStepCounter / FuseFramesPerFuseLengthCount),
+                GetPosition(),
+                1.0,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            // Render fuse
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::TimerBombFuse, mFuseFlameFrameIndex),
+                GetPosition(),
+                1.0,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            break;
+        }
+
+        case State::DetonationLeadIn:
+        {
+            static constexpr float ShakeOffset = 0.3f;
+            vec2f shakenPosition =
+                GetPosition()
+                + (0 == (mDetonationLeadInShapeFrameCounter % 2)
+                    ? vec2f(-ShakeOffset, 0.0f)
+                    : vec2f(ShakeOffset, 0.0f));
+
+            // Render bomb
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::TimerBomb, FuseLengthStepCount),
+                shakenPosition,
+                1.0,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            break;
+        }
+
+        case State::Defusing:
+        {
+            // Render bomb
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::TimerBomb, mFuseStepCounter / FuseFramesPerFuseLengthCount),
+                GetPosition(),
+                1.0f,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            break;
+        }
+
+        case State::Defused:
+        {
+            // Render inert bomb
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                GetPlaneId(),
+                TextureFrameId(Render::GenericMipMappedTextureGroups::TimerBomb, mFuseStepCounter / FuseFramesPerFuseLengthCount),
+                GetPosition(),
+                1.0f,
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f);
+
+            break;
+        }
+
+        case State::Exploding:
+        {
+            // Calculate current progress
+            float const progress =
+                static_cast<float>(mExplosionFadeoutCounter + 1)
+                / static_cast<float>(ExplosionFadeoutStepsCount);
+
+            // Render disappearing bomb
+            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
+                mExplosionPlaneId,
+                TextureFrameId(Render::GenericMipMappedTextureGroups::TimerBomb, mFuseStepCounter / FuseFramesPerFuseLengthCount),
+                mExplosionPosition,
+                1.0f, // Scale
+                GetRotationBaseAxis(),
+                GetRotationOffsetAxis(),
+                1.0f - progress);  // Alpha
+
+            break;
+        }
+
+        case State::Expired:
+        {
+            // No drawing
+            break;
+        }
+    }
+}
+
+}
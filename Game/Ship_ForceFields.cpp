@@ -17,22 +17,26 @@ void Ship::ApplyRadialSpaceWarpForceField(
     float radiusThickness,
     float strength)
 {
-    for (auto pointIndex : mPoints)
-    {
-        vec2f const pointRadius = mPoints.GetPosition(pointIndex) - centerPosition;
-        float const pointDistanceFromRadius = pointRadius.length() - radius;
-        float const absolutePointDistanceFromRadius = std::abs(pointDistanceFromRadius);
-        if (absolutePointDistanceFromRadius <= radiusThickness)
+    // Only points within the outer radius may be affected
+    VisitPointsInRadius(
+        centerPosition,
+        radius + radiusThickness,
+        [&](ElementIndex pointIndex)
         {
-            float const forceDirection = pointDistanceFromRadius >= 0.0f ? 1.0f : -1.0f;
+            vec2f const pointRadius = mPoints.GetPosition(pointIndex) - centerPosition;
+            float const pointDistanceFromRadius = pointRadius.length() - radius;
+            float const absolutePointDistanceFromRadius = std::abs(pointDistanceFromRadius);
+            if (absolutePointDistanceFromRadius <= radiusThickness)
+            {
+                float const forceDirection = pointDistanceFromRadius >= 0.0f ? 1.0f : -1.0f;
 
-            float const forceStrength = strength * (1.0f - absolutePointDistanceFromRadius / radiusThickness);
+                float const forceStrength = strength * (1.0f - absolutePointDistanceFromRadius / radiusThickness);
 
-            mPoints.AddStaticForce(
-                pointIndex,
-                pointRadius.normalise() * forceStrength * forceDirection);
-        }
-    }
+                mPoints.AddStaticForce(
+                    pointIndex,
+                    pointRadius.normalise() * forceStrength * forceDirection);
+            }
+        });
 }
 
 void Ship::ApplyImplosionForceField(
@@ -47,29 +47,32 @@ std::optional<ElementIndex> Ship::PickPointToMove(
     float bestOrphanedSquareDistance = std::numeric_limits<float>::max();
     ElementIndex bestOrphanedPoint = NoneElementIndex;
 
-    for (auto p : mPoints.RawShipPoints())
-    {
-        float const squareDistance = (mPoints.GetPosition(p) - pickPosition).squareLength();
-        if (squareDistance < squareSearchRadius)
+    GetPointGrid().VisitInRadius(
+        pickPosition,
+        gameParameters.ToolSearchRadius,
+        [&](ElementIndex p)
         {
-            if (!mPoints.GetConnectedSprings(p).ConnectedSprings.empty())
+            float const squareDistance = (mPoints.GetPosition(p) - pickPosition).squareLength();
+            if (squareDistance < squareSearchRadius)
             {
-                if (squareDistance < bestNonOrphanedSquareDistance)
+                if (!mPoints.GetConnectedSprings(p).ConnectedSprings.empty())
                 {
-                    bestNonOrphanedSquareDistance = squareDistance;
-                    bestNonOrphanedPoint = p;
+                    if (squareDistance < bestNonOrphanedSquareDistance)
+                    {
+                        bestNonOrphanedSquareDistance = squareDistance;
+                        bestNonOrphanedPoint = p;
+                    }
                 }
-            }
-            else
-            {
-                if (squareDistance < bestOrphanedSquareDistance)
+                else
                 {
-                    bestOrphanedSquareDistance = squareDistance;
-                    bestOrphanedPoint = p;
+                    if (squareDistance < bestOrphanedSquareDistance)
+                    {
+                        bestOrphanedSquareDistance = squareDistance;
+                        bestOrphanedPoint = p;
+                    }
                 }
             }
-        }
-    }
+        });
 
     if (bestNonOrphanedPoint != NoneElementIndex)
         return bestNonOrphanedPoint;
@@ -114,6 +117,8 @@ void Ship::MoveBy(
         }
 
         TrimForWorldBounds(gameParameters);
+
+        mIsPointGridDirty = true;
     }
 }
 
@@ -145,6 +150,8 @@ void Ship::MoveBy(
     }
 
     TrimForWorldBounds(gameParameters);
+
+    mIsPointGridDirty = true;
 }
 
 void Ship::RotateBy(
@@ -191,6 +198,8 @@ void Ship::RotateBy(
         }
 
         TrimForWorldBounds(gameParameters);
+
+        mIsPointGridDirty = true;
     }
 }
 
@@ -232,6 +241,8 @@ void Ship::RotateBy(
     }
 
     TrimForWorldBounds(gameParameters);
+
+    mIsPointGridDirty = true;
 }
 
 std::optional<ElementIndex> Ship::PickObjectForPickAndPull(
@@ -248,18 +259,21 @@ std::optional<ElementIndex> Ship::PickObjectForPickAndPull(
     float bestSquareDistance = std::numeric_limits<float>::max();
     ElementIndex bestPoint = NoneElementIndex;
 
-    for (auto p : mPoints)
-    {
-        float const squareDistance = (mPoints.GetPosition(p) - pickPosition).squareLength();
-        if (squareDistance < SquareSearchRadius
-            && squareDistance < bestSquareDistance
-            && mPoints.IsActive(p)
-            && !mPoints.IsPinned(p))
+    VisitPointsInRadius(
+        pickPosition,
+        SearchRadius,
+        [&](ElementIndex p)
         {
-            bestSquareDistance = squareDistance;
-            bestPoint = p;
-        }
-    }
+            float const squareDistance = (mPoints.GetPosition(p) - pickPosition).squareLength();
+            if (squareDistance < SquareSearchRadius
+                && squareDistance < bestSquareDistance
+                && mPoints.IsActive(p)
+                && !mPoints.IsPinned(p))
+            {
+                bestSquareDistance = squareDistance;
+                bestPoint = p;
+            }
+        });
 
     if (bestPoint != NoneElementIndex)
         return bestPoint;
@@ -410,57 +424,60 @@ bool Ship::DestroyAt(
     float const largerSearchSquareRadius = std::max(squareRadius, FallbackSquareRadius);
 
     // Detach/destroy all active, attached points within the radius
-    for (auto const pointIndex : mPoints)
-    {
-        float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-
-        if (mPoints.IsActive(pointIndex)
-            && pointSquareDistance < largerSearchSquareRadius)
+    VisitPointsInRadius(
+        targetPos,
+        std::sqrt(largerSearchSquareRadius),
+        [&](ElementIndex pointIndex)
         {
-            //
-            // - Air bubble ephemeral points: destroy
-            // - Non-ephemeral, attached points: detach probabilistically
-            //
+            float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
 
-            if (Points::EphemeralType::None == mPoints.GetEphemeralType(pointIndex)
-                && mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.size() > 0)
+            if (mPoints.IsActive(pointIndex)
+                && pointSquareDistance < largerSearchSquareRadius)
             {
-                if (pointSquareDistance < squareRadius)
+                //
+                // - Air bubble ephemeral points: destroy
+                // - Non-ephemeral, attached points: detach probabilistically
+                //
+
+                if (Points::EphemeralType::None == mPoints.GetEphemeralType(pointIndex)
+                    && mPoints.GetConnectedSprings(pointIndex).ConnectedSprings.size() > 0)
                 {
-                    //
-                    // Calculate probability: 1.0 at distance = 0.0 and 0.0 at distance = radius;
-                    // however, we always destroy if we're in a very small fraction of the radius
-                    //
+                    if (pointSquareDistance < squareRadius)
+                    {
+                        //
+                        // Calculate probability: 1.0 at distance = 0.0 and 0.0 at distance = radius;
+                        // however, we always destroy if we're in a very small fraction of the radius
+                        //
 
-                    float destroyProbability =
-                        (pointSquareDistance < 1.0f)
-                        ? 1.0f
-                        : (1.0f - (pointSquareDistance / squareRadius)) * (1.0f - (pointSquareDistance / squareRadius));
+                        float destroyProbability =
+                            (pointSquareDistance < 1.0f)
+                            ? 1.0f
+                            : (1.0f - (pointSquareDistance / squareRadius)) * (1.0f - (pointSquareDistance / squareRadius));
 
-                    if (GameRandomEngine::GetInstance().GenerateNormalizedUniformReal() <= destroyProbability)
-                    {
-                        doDestroyPoint(pointIndex);
+                        if (GameRandomEngine::GetInstance().GenerateNormalizedUniformReal() <= destroyProbability)
+                        {
+                            doDestroyPoint(pointIndex);
 
-                        hasDestroyed = true;
+                            hasDestroyed = true;
+                        }
                     }
-                }
 
-                if (pointSquareDistance < nearestFallbackPointRadius)
-                {
-                    nearestFallbackPointInRadiusIndex = pointIndex;
-                    nearestFallbackPointRadius = pointSquareDistance;
+                    if (pointSquareDistance < nearestFallbackPointRadius)
+                    {
+                        nearestFallbackPointInRadiusIndex = pointIndex;
+                        nearestFallbackPointRadius = pointSquareDistance;
+                    }
                 }
-            }
-            else if (Points::EphemeralType::AirBubble == mPoints.GetEphemeralType(pointIndex)
-                && pointSquareDistance < squareRadius)
-            {
-                // Destroy
-                mPoints.DestroyEphemeralParticle(pointIndex);
+                else if (Points::EphemeralType::AirBubble == mPoints.GetEphemeralType(pointIndex)
+                    && pointSquareDistance < squareRadius)
+                {
+                    // Destroy
+                    mPoints.DestroyEphemeralParticle(pointIndex);
 
-                hasDestroyed = true;
+                    hasDestroyed = true;
+                }
             }
-        }
-    }
+        });
 
     // Make sure we always destroy something, if we had a particle in-radius
     if (!hasDestroyed && NoneElementIndex != nearestFallbackPointInRadiusIndex)
@@ -491,7 +508,9 @@ bool Ship::SawThrough(
     unsigned int metalsSawed = 0;
     unsigned int nonMetalsSawed = 0;
 
-    for (auto springIndex : mSprings)
+    FindSpringsNearSegment(adjustedStartPos, endPos, mSpringQueryResults);
+
+    for (auto const springIndex : mSpringQueryResults)
     {
         if (!mSprings.IsDeleted(springIndex))
         {
@@ -558,37 +577,40 @@ bool Ship::ApplyHeatBlasterAt(
     //
     // We also do ephemeral points in order to change buoyancy of air bubbles
     bool atLeastOnePointFound = false;
-    for (auto const pointIndex : mPoints)
-    {
-        float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-        if (pointSquareDistance < squareRadius
-            && mPoints.IsActive(pointIndex))
+    VisitPointsInRadius(
+        targetPos,
+        radius,
+        [&](ElementIndex pointIndex)
         {
-            //
-            // Inject/remove heat at this point
-            //
+            float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
+            if (pointSquareDistance < squareRadius
+                && mPoints.IsActive(pointIndex))
+            {
+                //
+                // Inject/remove heat at this point
+                //
 
-            // Smooth heat out for radius
-            float const smoothing = 1.0f - SmoothStep(
-                0.0f,
-                radius,
-                sqrt(pointSquareDistance));
+                // Smooth heat out for radius
+                float const smoothing = 1.0f - SmoothStep(
+                    0.0f,
+                    radius,
+                    sqrt(pointSquareDistance));
 
-            // Calc temperature delta
-            // T = Q/HeatCapacity
-            float deltaT =
-                heatBlasterHeat * smoothing
-                * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
+                // Calc temperature delta
+                // T = Q/HeatCapacity
+                float deltaT =
+                    heatBlasterHeat * smoothing
+                    * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
 
-            // Increase/lower temperature
-            mPoints.SetTemperature(
-                pointIndex,
-                std::max(mPoints.GetTemperature(pointIndex) + deltaT, 0.1f)); // 3rd principle of thermodynamics
+                // Increase/lower temperature
+                mPoints.SetTemperature(
+                    pointIndex,
+                    std::max(mPoints.GetTemperature(pointIndex) + deltaT, 0.1f)); // 3rd principle of thermodynamics
 
-            // Remember we've found a point
-            atLeastOnePointFound = true;
-        }
-    }
+                // Remember we've found a point
+                atLeastOnePointFound = true;
+            }
+        });
 
     return atLeastOnePointFound;
 }
@@ -609,39 +631,42 @@ bool Ship::ExtinguishFireAt(
     // No real reason to ignore ephemeral points, other than they're currently
     // not expected to burn
     bool atLeastOnePointFound = false;
-    for (auto const pointIndex : mPoints.RawShipPoints())
-    {
-        float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-        if (pointSquareDistance < squareRadius)
+    GetPointGrid().VisitInRadius(
+        targetPos,
+        radius,
+        [&](ElementIndex pointIndex)
         {
-            // Check if the point is in a state in which we can smother its combustion
-            if (mPoints.IsBurningForSmothering(pointIndex))
+            float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
+            if (pointSquareDistance < squareRadius)
             {
-                //
-                // Extinguish point - fake it's with water
-                //
+                // Check if the point is in a state in which we can smother its combustion
+                if (mPoints.IsBurningForSmothering(pointIndex))
+                {
+                    //
+                    // Extinguish point - fake it's with water
+                    //
 
-                mPoints.SmotherCombustion(pointIndex, true);
-            }
+                    mPoints.SmotherCombustion(pointIndex, true);
+                }
 
-            // Check if the point is in a state in which we can lower its temperature, so that
-            // it won't start burning again right away
-            if (mPoints.IsBurningForExtinguisherHeatSubtraction(pointIndex))
-            {
-                float const strength = 1.0f - SmoothStep(
-                    squareRadius * 3.0f / 4.0f,
-                    squareRadius,
-                    pointSquareDistance);
+                // Check if the point is in a state in which we can lower its temperature, so that
+                // it won't start burning again right away
+                if (mPoints.IsBurningForExtinguisherHeatSubtraction(pointIndex))
+                {
+                    float const strength = 1.0f - SmoothStep(
+                        squareRadius * 3.0f / 4.0f,
+                        squareRadius,
+                        pointSquareDistance);
+
+                    mPoints.AddHeat(
+                        pointIndex,
+                        -heatRemoved * strength);
+                }
 
-                mPoints.AddHeat(
-                    pointIndex,
-                    -heatRemoved * strength);
+                // Remember we've found a point
+                atLeastOnePointFound = true;
             }
-
-            // Remember we've found a point
-            atLeastOnePointFound = true;
-        }
-    }
+        });
 
     return atLeastOnePointFound;
 }
@@ -671,26 +696,29 @@ void Ship::ApplyBlastAt(Interaction::ArgumentsUnion::BlastArguments const & args
 {
     float const squareRadius = args.Radius * args.Radius;
 
-    // Visit all points
-    for (auto pointIndex : mPoints)
-    {
-        vec2f const pointRadius = mPoints.GetPosition(pointIndex) - args.CenterPos;
-        float const squarePointDistance = pointRadius.squareLength();
-        if (squarePointDistance < squareRadius)
+    // Visit all points in the radius
+    VisitPointsInRadius(
+        args.CenterPos,
+        args.Radius,
+        [&](ElementIndex pointIndex)
         {
-            float const pointRadiusLength = std::sqrt(squarePointDistance);
+            vec2f const pointRadius = mPoints.GetPosition(pointIndex) - args.CenterPos;
+            float const squarePointDistance = pointRadius.squareLength();
+            if (squarePointDistance < squareRadius)
+            {
+                float const pointRadiusLength = std::sqrt(squarePointDistance);
 
-            //
-            // Apply blast force
-            //
-            // (inversely proportional to square root of distance, not second power as one would expect though)
-            //
+                //
+                // Apply blast force
+                //
+                // (inversely proportional to square root of distance, not second power as one would expect though)
+                //
 
-            mPoints.AddStaticForce(
-                pointIndex,
-                pointRadius.normalise(pointRadiusLength) * args.Magnitude / std::sqrt(std::max((pointRadiusLength * 0.4f) + 0.6f, 1.0f)));
-        }
-    }
+                mPoints.AddStaticForce(
+                    pointIndex,
+                    pointRadius.normalise(pointRadiusLength) * args.Magnitude / std::sqrt(std::max((pointRadiusLength * 0.4f) + 0.6f, 1.0f)));
+            }
+        });
 }
 
 bool Ship::ApplyElectricSparkAt(
@@ -756,8 +784,10 @@ bool Ship::ApplyLaserCannonThrough(
     //
 
     int cutCount = 0;
-    
-    for (auto springIndex : mSprings)
+
+    FindSpringsNearSegment(startPos, endPos, mSpringQueryResults);
+
+    for (auto const springIndex : mSpringQueryResults)
     {
         if (!mSprings.IsDeleted(springIndex)
             && GameRandomEngine::GetInstance().GenerateUniformBoolean(10.0f * strength / mSprings.GetBaseStructuralMaterial(springIndex).GetMass()))
@@ -797,27 +827,31 @@ bool Ship::ApplyLaserCannonThrough(
 
     float constexpr SearchRadius = 0.75f; // Magic number
 
-    for (auto p : mPoints)
-    {
-        float const distance = Segment::DistanceToPoint(startPos, endPos, mPoints.GetPosition(p));
-        if (distance < SearchRadius)
+    VisitPointsNearSegment(
+        startPos,
+        endPos,
+        SearchRadius,
+        [&](ElementIndex p)
         {
-            //
-            // Inject/remove heat at this point
-            //
+            float const distance = Segment::DistanceToPoint(startPos, endPos, mPoints.GetPosition(p));
+            if (distance < SearchRadius)
+            {
+                //
+                // Inject/remove heat at this point
+                //
 
-            // Calc temperature delta
-            // T = Q/HeatCapacity
-            float deltaT =
-                effectiveLaserHeat
-                * mPoints.GetMaterialHeatCapacityReciprocal(p);
+                // Calc temperature delta
+                // T = Q/HeatCapacity
+                float deltaT =
+                    effectiveLaserHeat
+                    * mPoints.GetMaterialHeatCapacityReciprocal(p);
 
-            // Increase/lower temperature
-            mPoints.SetTemperature(
-                p,
-                mPoints.GetTemperature(p) + deltaT);
-        }
-    }
+                // Increase/lower temperature
+                mPoints.SetTemperature(
+                    p,
+                    mPoints.GetTemperature(p) + deltaT);
+            }
+        });
 
     mGameEventHandler->OnLaserCut(cutCount);
 
@@ -995,16 +1029,19 @@ std::optional<ToolApplicationLocus> Ship::InjectPressureAt(
     float bestSquareDistance = 1.2F;
     ElementIndex bestPointIndex = NoneElementIndex;
 
-    for (auto const pointIndex : mPoints.RawShipPoints())
-    {
-        float const squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-        if (squareDistance < bestSquareDistance
-            && !mPoints.GetIsHull(pointIndex))
+    GetPointGrid().VisitInRadius(
+        targetPos,
+        std::sqrt(bestSquareDistance),
+        [&](ElementIndex pointIndex)
         {
-            bestSquareDistance = squareDistance;
-            bestPointIndex = pointIndex;
-        }
-    }
+            float const squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
+            if (squareDistance < bestSquareDistance
+                && !mPoints.GetIsHull(pointIndex))
+            {
+                bestSquareDistance = squareDistance;
+                bestPointIndex = pointIndex;
+            }
+        });
 
     if (bestPointIndex == NoneElementIndex)
     {
@@ -1107,38 +1144,41 @@ bool Ship::FloodAt(
     float const searchSquareRadius = searchRadius * searchRadius;
 
     bool anyWasApplied = false;
-    for (auto const pointIndex : mPoints.RawShipPoints())
-    {
-        if (!mPoints.GetIsHull(pointIndex))
+    GetPointGrid().VisitInRadius(
+        targetPos,
+        searchRadius,
+        [&](ElementIndex pointIndex)
         {
-            float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-            if (squareDistance < searchSquareRadius)
+            if (!mPoints.GetIsHull(pointIndex))
             {
-                //
-                // Update water
-                //
+                float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
+                if (squareDistance < searchSquareRadius)
+                {
+                    //
+                    // Update water
+                    //
 
-                // Make sure we don't remove more water than available
-                float const actualQuantityOfWaterDelta = std::max(-mPoints.GetWater(pointIndex), quantityOfWaterDelta);
+                    // Make sure we don't remove more water than available
+                    float const actualQuantityOfWaterDelta = std::max(-mPoints.GetWater(pointIndex), quantityOfWaterDelta);
 
-                mPoints.SetWater(
-                    pointIndex,
-                    mPoints.GetWater(pointIndex) + actualQuantityOfWaterDelta);
+                    mPoints.SetWater(
+                        pointIndex,
+                        mPoints.GetWater(pointIndex) + actualQuantityOfWaterDelta);
 
-                //
-                // Update internal pressure
-                //
+                    //
+                    // Update internal pressure
+                    //
 
-                float const actualInternalPressureDelta = actualQuantityOfWaterDelta * volumetricWaterPressure;
+                    float const actualInternalPressureDelta = actualQuantityOfWaterDelta * volumetricWaterPressure;
 
-                mPoints.SetInternalPressure(
-                    pointIndex,
-                    std::max(mPoints.GetInternalPressure(pointIndex) + actualInternalPressureDelta, 0.0f));
+                    mPoints.SetInternalPressure(
+                        pointIndex,
+                        std::max(mPoints.GetInternalPressure(pointIndex) + actualInternalPressureDelta, 0.0f));
 
-                anyWasApplied = true;
+                    anyWasApplied = true;
+                }
             }
-        }
-    }
+        });
 
     return anyWasApplied;
 }
@@ -1228,34 +1268,40 @@ bool Ship::ScrubThrough(
     // Visit all points (excluding ephemerals, they don't rot and
     // thus we don't need to scrub them!)
     bool hasScrubbed = false;
-    for (auto const pointIndex : mPoints.RawShipPoints())
-    {
-        auto const & pointPosition = mPoints.GetPosition(pointIndex);
-
-        // First check whether the point is in the bounding box
-        if (boundingBox.Contains(pointPosition))
+    // Points in the bounding box within the radius of the segment's line are within
+    // radius * sqrt(2) of the segment
+    GetPointGrid().VisitNearSegment(
+        startPos,
+        endPos,
+        scrubRadius * 1.4143f,
+        [&](ElementIndex pointIndex)
         {
-            // Distance = projection of (start->point) vector on segment normal
-            float const distance = std::abs((pointPosition - startPos).dot(segmentNormal));
+            auto const & pointPosition = mPoints.GetPosition(pointIndex);
 
-            // Check whether this point is in the radius
-            if (distance <= scrubRadius)
+            // First check whether the point is in the bounding box
+            if (boundingBox.Contains(pointPosition))
             {
-                //
-                // Scrub this point, with magnitude dependent from distance
-                //
+                // Distance = projection of (start->point) vector on segment normal
+                float const distance = std::abs((pointPosition - startPos).dot(segmentNormal));
 
-                float const newDecay =
-                    mPoints.GetDecay(pointIndex)
-                    + 0.5f * (1.0f - mPoints.GetDecay(pointIndex)) * (scrubRadius - distance) / scrubRadius;
+                // Check whether this point is in the radius
+                if (distance <= scrubRadius)
+                {
+                    //
+                    // Scrub this point, with magnitude dependent from distance
+                    //
 
-                mPoints.SetDecay(pointIndex, newDecay);
+                    float const newDecay =
+                        mPoints.GetDecay(pointIndex)
+                        + 0.5f * (1.0f - mPoints.GetDecay(pointIndex)) * (scrubRadius - distance) / scrubRadius;
 
-                // Remember at least one point has been scrubbed
-                hasScrubbed |= true;
+                    mPoints.SetDecay(pointIndex, newDecay);
+
+                    // Remember at least one point has been scrubbed
+                    hasScrubbed |= true;
+                }
             }
-        }
-    }
+        });
 
     if (hasScrubbed)
     {
@@ -1295,39 +1341,45 @@ bool Ship::RotThrough(
     // Visit all points (excluding ephemerals, they don't rot and
     // thus we don't need to rot them!)
     bool hasRotted = false;
-    for (auto const pointIndex : mPoints.RawShipPoints())
-    {
-        auto const & pointPosition = mPoints.GetPosition(pointIndex);
-
-        // First check whether the point is in the bounding box
-        if (boundingBox.Contains(pointPosition))
+    // Points in the bounding box within the radius of the segment's line are within
+    // radius * sqrt(2) of the segment
+    GetPointGrid().VisitNearSegment(
+        startPos,
+        endPos,
+        rotRadius * 1.4143f,
+        [&](ElementIndex pointIndex)
         {
-            // Distance = projection of (start->point) vector on segment normal
-            float const distance = std::abs((pointPosition - startPos).dot(segmentNormal));
+            auto const & pointPosition = mPoints.GetPosition(pointIndex);
 
-            // Check whether this point is in the radius
-            if (distance <= rotRadius)
+            // First check whether the point is in the bounding box
+            if (boundingBox.Contains(pointPosition))
             {
-                //
-                // Rot this point, with magnitude dependent from distance,
-                // and more pronounced when the point is underwater or has water
-                //
+                // Distance = projection of (start->point) vector on segment normal
+                float const distance = std::abs((pointPosition - startPos).dot(segmentNormal));
 
-                float const decayCoeff = (mParentWorld.GetOceanSurface().IsUnderwater(pointPosition) || mPoints.GetWater(pointIndex) >= 1.0f)
-                    ? 0.0175f
-                    : 0.010f;
+                // Check whether this point is in the radius
+                if (distance <= rotRadius)
+                {
+                    //
+                    // Rot this point, with magnitude dependent from distance,
+                    // and more pronounced when the point is underwater or has water
+                    //
+
+                    float const decayCoeff = (mParentWorld.GetOceanSurface().IsUnderwater(pointPosition) || mPoints.GetWater(pointIndex) >= 1.0f)
+                        ? 0.0175f
+                        : 0.010f;
 
-                float const newDecay =
-                    mPoints.GetDecay(pointIndex)
-                    * (1.0f - decayCoeff * decayCoeffMultiplier * (rotRadius - distance) / rotRadius);
+                    float const newDecay =
+                        mPoints.GetDecay(pointIndex)
+                        * (1.0f - decayCoeff * decayCoeffMultiplier * (rotRadius - distance) / rotRadius);
 
-                mPoints.SetDecay(pointIndex, newDecay);
+                    mPoints.SetDecay(pointIndex, newDecay);
 
-                // Remember at least one point has been rotted
-                hasRotted |= true;
+                    // Remember at least one point has been rotted
+                    hasRotted |= true;
+                }
             }
-        }
-    }
+        });
 
     if (hasRotted)
     {
@@ -1427,18 +1479,21 @@ ElementIndex Ship::GetNearestPointAt(
     ElementIndex bestPointIndex = NoneElementIndex;
     float bestSquareDistance = std::numeric_limits<float>::max();
 
-    for (auto const pointIndex : mPoints)
-    {
-        if (mPoints.IsActive(pointIndex))
+    VisitPointsInRadius(
+        targetPos,
+        radius,
+        [&](ElementIndex pointIndex)
         {
-            float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-            if (squareDistance < squareRadius && squareDistance < bestSquareDistance)
+            if (mPoints.IsActive(pointIndex))
             {
-                bestPointIndex = pointIndex;
-                bestSquareDistance = squareDistance;
+                float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
+                if (squareDistance < squareRadius && squareDistance < bestSquareDistance)
+                {
+                    bestPointIndex = pointIndex;
+                    bestSquareDistance = squareDistance;
+                }
             }
-        }
-    }
+        });
 
     return bestPointIndex;
 }
@@ -1458,18 +1513,21 @@ bool Ship::QueryNearestPointAt(
     ElementIndex bestPointIndex = NoneElementIndex;
     float bestSquareDistance = std::numeric_limits<float>::max();
 
-    for (auto const pointIndex : mPoints)
-    {
-        if (mPoints.IsActive(pointIndex))
+    VisitPointsInRadius(
+        targetPos,
+        radius,
+        [&](ElementIndex pointIndex)
         {
-            float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-            if (squareDistance < squareRadius && squareDistance < bestSquareDistance)
+            if (mPoints.IsActive(pointIndex))
             {
-                bestPointIndex = pointIndex;
-                bestSquareDistance = squareDistance;
+                float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
+                if (squareDistance < squareRadius && squareDistance < bestSquareDistance)
+                {
+                    bestPointIndex = pointIndex;
+                    bestSquareDistance = squareDistance;
+                }
             }
-        }
-    }
+        });
 
     if (NoneElementIndex != bestPointIndex)
     {
@@ -1599,81 +1657,84 @@ void Ship::ApplyLightning(
     float const searchSquareRadiusBlast = searchSquareRadius / 2.0f;
     float const searchSquareRadiusHeat = searchSquareRadius;
 
-    for (auto const pointIndex : mPoints.RawShipPoints())
-    {
-        float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
-
-        bool wasDestroyed = false;
-
-        if (squareDistance < searchSquareRadiusBlast)
+    GetPointGrid().VisitInRadius(
+        targetPos,
+        searchRadius,
+        [&](ElementIndex pointIndex)
         {
-            //
-            // Calculate destroy probability: 1.0 at distance = 0.0 and 0.0 at distance = radius;
-            // however, we always destroy if we're in a very small fraction of the radius
-            //
+            float squareDistance = (mPoints.GetPosition(pointIndex) - targetPos).squareLength();
 
-            float destroyProbability =
-                (searchSquareRadiusBlast < 1.0f)
-                ? 1.0f
-                : (1.0f - (squareDistance / searchSquareRadiusBlast)) * (1.0f - (squareDistance / searchSquareRadiusBlast));
+            bool wasDestroyed = false;
 
-            if (GameRandomEngine::GetInstance().GenerateNormalizedUniformReal() <= destroyProbability)
+            if (squareDistance < searchSquareRadiusBlast)
             {
                 //
-                // Destroy
+                // Calculate destroy probability: 1.0 at distance = 0.0 and 0.0 at distance = radius;
+                // however, we always destroy if we're in a very small fraction of the radius
                 //
 
-                // Choose a detach velocity - using the same distribution as Debris
-                vec2f detachVelocity = GameRandomEngine::GetInstance().GenerateUniformRadialVector(
-                    GameParameters::MinDebrisParticlesVelocity,
-                    GameParameters::MaxDebrisParticlesVelocity);
+                float destroyProbability =
+                    (searchSquareRadiusBlast < 1.0f)
+                    ? 1.0f
+                    : (1.0f - (squareDistance / searchSquareRadiusBlast)) * (1.0f - (squareDistance / searchSquareRadiusBlast));
 
-                // Detach
-                mPoints.Detach(
-                    pointIndex,
-                    detachVelocity,
-                    Points::DetachOptions::GenerateDebris,
-                    currentSimulationTime,
-                    gameParameters);
+                if (GameRandomEngine::GetInstance().GenerateNormalizedUniformReal() <= destroyProbability)
+                {
+                    //
+                    // Destroy
+                    //
 
-                // Generate sparkles
-                GenerateSparklesForLightning(
-                    pointIndex,
-                    currentSimulationTime,
-                    gameParameters);
+                    // Choose a detach velocity - using the same distribution as Debris
+                    vec2f detachVelocity = GameRandomEngine::GetInstance().GenerateUniformRadialVector(
+                        GameParameters::MinDebrisParticlesVelocity,
+                        GameParameters::MaxDebrisParticlesVelocity);
+
+                    // Detach
+                    mPoints.Detach(
+                        pointIndex,
+                        detachVelocity,
+                        Points::DetachOptions::GenerateDebris,
+                        currentSimulationTime,
+                        gameParameters);
+
+                    // Generate sparkles
+                    GenerateSparklesForLightning(
+                        pointIndex,
+                        currentSimulationTime,
+                        gameParameters);
 
-                // Notify
-                mGameEventHandler->OnLightningHit(mPoints.GetStructuralMaterial(pointIndex));
+                    // Notify
+                    mGameEventHandler->OnLightningHit(mPoints.GetStructuralMaterial(pointIndex));
 
-                wasDestroyed = true;
+                    wasDestroyed = true;
+                }
             }
-        }
 
-        if (!wasDestroyed
-            && squareDistance < searchSquareRadiusHeat)
-        {
-            //
-            // Apply heat
-            //
+            if (!wasDestroyed
+                && squareDistance < searchSquareRadiusHeat)
+            {
+                //
+                // Apply heat
+                //
 
-            // Smooth heat out for radius
-            float const smoothing = 1.0f - SmoothStep(
-                searchSquareRadiusHeat * 3.0f / 4.0f,
-                searchSquareRadiusHeat,
-                squareDistance);
+                // Smooth heat out for radius
+                float const smoothing = 1.0f - SmoothStep(
+                    searchSquareRadiusHeat * 3.0f / 4.0f,
+                    searchSquareRadiusHeat,
+                    squareDistance);
 
-            // Calc temperature delta
-            // T = Q/HeatCapacity
-            float deltaT =
-                lightningHeat * smoothing
-                * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
+                // Calc temperature delta
+                // T = Q/HeatCapacity
+                float deltaT =
+                    lightningHeat * smoothing
+                    * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
 
-            // Increase/lower temperature
-            mPoints.SetTemperature(
-                pointIndex,
-                std::max(mPoints.GetTemperature(pointIndex) + deltaT, 0.1f)); // 3rd principle of thermodynamics
-        }
-    }
+                // Increase/lower temperature
+                mPoints.SetTemperature(
+                    pointIndex,
+                    std::max(mPoints.GetTemperature(pointIndex) + deltaT, 0.1f)); // 3rd principle of thermodynamics
+            }
+        });
 }
 
 void Ship::HighlightElectricalElement(ElectricalElementId electricalElementId)
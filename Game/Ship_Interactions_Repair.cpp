@@ -175,6 +175,10 @@ void Ship::RepairAt(
 
     // Reset grace period
     mRepairGracePeriodMultiplier = 0.0f;
+
+    // We have moved points and restored springs
+    mIsPointGridDirty = true;
+    mIsMaxSpringLengthDirty = true;
 }
 
 void Ship::StraightenOneSpringChains(ElementIndex pointIndex)
@@ -0,0 +1,225 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-16
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "Physics.h"
+
+#include <algorithm>
+
+namespace Physics {
+
+void Ship::WakeUp()
+{
+    if (mSleepingPointCount == 0)
+    {
+        // Nothing to do
+        return;
+    }
+
+    for (auto const p : mPoints.RawShipPoints())
+    {
+        if (mPoints.IsSleeping(p))
+        {
+            mPoints.WakeUp(p);
+        }
+    }
+
+    for (auto & state : mConnectedComponentSleepStates)
+    {
+        state.RestingStepsCount = 0;
+        state.IsSleeping = false;
+    }
+
+    mSleepingPointCount = 0;
+}
+
+void Ship::UpdateSleepingConnectedComponents()
+{
+    if (mIsFullConnectivityVisitNeeded)
+    {
+        // No connected components yet
+        return;
+    }
+
+    assert(mConnectedComponentSleepStates.size() == mConnectedComponentSizes.size());
+
+    //
+    // 1. Gather the current state of each connected component
+    //
+
+    for (auto & state : mConnectedComponentSleepStates)
+    {
+        state.MaxVelocitySquared = 0.0f;
+        state.HasStressedSprings = false;
+        state.IsDisturbed = false;
+    }
+
+    for (auto const p : mPoints.RawShipPoints())
+    {
+        ConnectedComponentId const connectedComponentId = mPoints.GetConnectedComponentId(p);
+        assert(connectedComponentId < mConnectedComponentSleepStates.size());
+        auto & state = mConnectedComponentSleepStates[connectedComponentId];
+
+        if (mPoints.IsSleeping(p))
+        {
+            // Check whether anybody has moved this point, or changed the forces acting on it
+            float const maxStaticForceChange = SleepingMaxStaticForceChange * mPoints.GetMass(p) * GameParameters::GravityMagnitude;
+            if (mPoints.GetPosition(p) != mSleepingPointPositionBuffer[p]
+                || mPoints.GetVelocity(p) != vec2f::zero()
+                || (mPoints.GetStaticForce(p) - mSleepingPointStaticForceBuffer[p]).squareLength() > maxStaticForceChange * maxStaticForceChange)
+            {
+                state.IsDisturbed = true;
+            }
+        }
+        else
+        {
+            state.MaxVelocitySquared = std::max(state.MaxVelocitySquared, mPoints.GetVelocity(p).squareLength());
+        }
+    }
+
+    // Connected components whose structure has changed since the last connectivity visit
+    // are disturbed until the visit re-floods them; the endpoints of the changed springs
+    // still have the IDs of the components they belonged to, which are thus the only
+    // components we wake up
+    for (auto const pointIndex : mConnectivityVisitSeedPoints)
+    {
+        ConnectedComponentId const connectedComponentId = mPoints.GetConnectedComponentId(pointIndex);
+        assert(connectedComponentId < mConnectedComponentSleepStates.size());
+        mConnectedComponentSleepStates[connectedComponentId].IsDisturbed = true;
+    }
+
+    // Stressed springs only matter to components that are sleeping or at rest
+    bool const hasRestingConnectedComponents = std::any_of(
+        mConnectedComponentSleepStates.cbegin(),
+        mConnectedComponentSleepStates.cend(),
+        [](ConnectedComponentSleepState const & state)
+        {
+            return state.IsSleeping || state.MaxVelocitySquared < SleepingMaxVelocity * SleepingMaxVelocity;
+        });
+
+    if (hasRestingConnectedComponents)
+    {
+        for (auto const s : mSprings)
+        {
+            if (!mSprings.IsDeleted(s) && mSprings.IsStressed(s))
+            {
+                // Both endpoints are in the same connected component - unless the spring has been
+                // restored since the last connectivity visit, in which case both are disturbed anyway
+                ConnectedComponentId const connectedComponentId = mPoints.GetConnectedComponentId(mSprings.GetEndpointAIndex(s));
+                assert(connectedComponentId < mConnectedComponentSleepStates.size());
+                mConnectedComponentSleepStates[connectedComponentId].HasStressedSprings = true;
+            }
+        }
+    }
+
+    //
+    // 2. Decide which connected components fall asleep and which wake up
+    //
+
+    bool hasChanged = false;
+
+    for (auto & state : mConnectedComponentSleepStates)
+    {
+        if (state.IsSleeping)
+        {
+            if (state.IsDisturbed || state.HasStressedSprings)
+            {
+                state.IsSleeping = false;
+                state.RestingStepsCount = 0;
+                hasChanged = true;
+            }
+        }
+        else
+        {
+            if (state.MaxVelocitySquared < SleepingMaxVelocity * SleepingMaxVelocity
+                && !state.HasStressedSprings
+                && !state.IsDisturbed)
+            {
+                ++state.RestingStepsCount;
+                if (state.RestingStepsCount >= SleepingRestStepsCount)
+                {
+                    state.IsSleeping = true;
+                    hasChanged = true;
+                }
+            }
+            else
+            {
+                state.RestingStepsCount = 0;
+            }
+        }
+    }
+
+    if (mHaveConnectedComponentsBeenWokenUpByConnectivityVisit)
+    {
+        mHaveConnectedComponentsBeenWokenUpByConnectivityVisit = false;
+        hasChanged = true;
+    }
+
+    if (!hasChanged)
+    {
+        return;
+    }
+
+    //
+    // 3. Apply the decisions to the points
+    //
+
+    for (auto const p : mPoints.RawShipPoints())
+    {
+        bool const isSleeping = mConnectedComponentSleepStates[mPoints.GetConnectedComponentId(p)].IsSleeping;
+        if (isSleeping != mPoints.IsSleeping(p))
+        {
+            if (isSleeping)
+            {
+                mPoints.PutToSleep(p);
+
+                mSleepingPointPositionBuffer[p] = mPoints.GetPosition(p);
+                mSleepingPointStaticForceBuffer[p] = mPoints.GetStaticForce(p);
+
+                ++mSleepingPointCount;
+            }
+            else
+            {
+                mPoints.WakeUp(p);
+
+                assert(mSleepingPointCount > 0);
+                --mSleepingPointCount;
+            }
+        }
+    }
+
+    if (mSleepingPointCount > 0)
+    {
+        RecalculateAwakeBlocks();
+    }
+}
+
+void Ship::RecalculateAwakeBlocks()
+{
+    // Points
+
+    mIsPointBlockAwakeBuffer.fill(false);
+
+    for (auto const p : mPoints.BufferElements())
+    {
+        if (!mPoints.IsSleeping(p))
+        {
+            mIsPointBlockAwakeBuffer[p / SleepingBlockSize] = true;
+        }
+    }
+
+    // Springs
+
+    mIsSpringBlockAwakeBuffer.fill(false);
+
+    for (auto const s : mSprings)
+    {
+        if (!mSprings.IsDeleted(s) && !mPoints.IsSleeping(mSprings.GetEndpointAIndex(s)))
+        {
+            mIsSpringBlockAwakeBuffer[s / SleepingBlockSize] = true;
+        }
+    }
+}
+
+}
@@ -0,0 +1,70 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-16
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "Physics.h"
+
+#include <algorithm>
+
+namespace Physics {
+
+UniformGrid const & Ship::GetPointGrid() const
+{
+    if (mIsPointGridDirty)
+    {
+        mPointGrid.Build(
+            mPoints.GetPositionBufferAsVec2(),
+            mPoints.GetRawShipPointCount());
+
+        mIsPointGridDirty = false;
+    }
+
+    if (mIsMaxSpringLengthDirty)
+    {
+        mMaxSpringLength = 0.0f;
+        for (auto const s : mSprings)
+        {
+            if (!mSprings.IsDeleted(s))
+            {
+                mMaxSpringLength = std::max(mMaxSpringLength, mSprings.GetLength(s, mPoints));
+            }
+        }
+
+        mIsMaxSpringLengthDirty = false;
+    }
+
+    return mPointGrid;
+}
+
+void Ship::FindSpringsNearSegment(
+    vec2f const & startPos,
+    vec2f const & endPos,
+    std::vector<ElementIndex> & springIndices) const
+{
+    springIndices.clear();
+
+    UniformGrid const & pointGrid = GetPointGrid();
+
+    // Visit each spring from its endpoint A only, so that we visit it once
+    pointGrid.VisitNearSegment(
+        startPos,
+        endPos,
+        mMaxSpringLength,
+        [&](ElementIndex pointIndex)
+        {
+            for (auto const & cs : mPoints.GetConnectedSprings(pointIndex).ConnectedSprings)
+            {
+                if (mSprings.GetEndpointAIndex(cs.SpringIndex) == pointIndex)
+                {
+                    assert(!mSprings.IsDeleted(cs.SpringIndex));
+                    springIndices.push_back(cs.SpringIndex);
+                }
+            }
+        });
+
+    // Visit springs in the same order as a linear scan would
+    std::sort(springIndices.begin(), springIndices.end());
+}
+
+}
@@ -215,21 +215,6 @@ bool Ship::UpdateExplosionStateMachine(
     return false;
 }
 
-void Ship::UploadExplosionStateMachine(
-    ExplosionStateMachine const & explosionStateMachine,
-    Render::RenderContext & renderContext)
-{
-    auto & shipRenderContext = renderContext.GetShipRenderContext(mId);
-
-    shipRenderContext.UploadExplosion(
-        explosionStateMachine.Plane,
-        explosionStateMachine.CenterPosition,
-        explosionStateMachine.BlastRadius,
-        explosionStateMachine.Type,
-        explosionStateMachine.PersonalitySeed,
-        explosionStateMachine.CurrentProgress);
-}
-
 ////////////////////////////////////////////////////////////////////
 
 void Ship::UpdateStateMachines(
@@ -260,22 +245,4 @@ void Ship::UpdateStateMachines(
     }
 }
 
-void Ship::UploadStateMachines(Render::RenderContext & renderContext)
-{
-    for (auto const & sm : mStateMachines)
-    {
-        switch (sm->Type)
-        {
-            case StateMachineType::Explosion:
-            {
-                UploadExplosionStateMachine(
-                    dynamic_cast<ExplosionStateMachine const &>(*sm),
-                    renderContext);
-
-                break;
-            }
-        }
-    }
-}
-
 }
\ No newline at end of file
@@ -0,0 +1,1132 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-16
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "SpringRelaxationKernels.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace Physics {
+namespace SpringRelaxationKernels {
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+static_assert(sizeof(Springs::Endpoints) == 2 * sizeof(ElementIndex));
+
+namespace {
+
+    inline void ApplySpringForces(
+        SpringForcesInput const & input,
+        ElementIndex s,
+        vec2f * restrict dynamicForceBuffer)
+    {
+        vec2f const * restrict const positionBuffer = input.PositionBuffer;
+        vec2f const * restrict const velocityBuffer = input.VelocityBuffer;
+
+        auto const pointAIndex = input.EndpointsBuffer[s].PointAIndex;
+        auto const pointBIndex = input.EndpointsBuffer[s].PointBIndex;
+
+        vec2f const displacement = positionBuffer[pointBIndex] - positionBuffer[pointAIndex];
+        float const displacementLength = displacement.length();
+        vec2f const springDir = displacement.normalise(displacementLength);
+
+        //
+        // 1. Hooke's law
+        //
+
+        // Calculate spring force on point A
+        float const fSpring =
+            (displacementLength - input.RestLengthBuffer[s])
+            * input.StiffnessCoefficientBuffer[s];
+
+        //
+        // 2. Damper forces
+        //
+        // Damp the velocities of each endpoint pair, as if the points were also connected by a damper
+        // along the same direction as the spring
+        //
+
+        // Calculate damp force on point A
+        vec2f const relVelocity = velocityBuffer[pointBIndex] - velocityBuffer[pointAIndex];
+        float const fDamp =
+            relVelocity.dot(springDir)
+            * input.DampingCoefficientBuffer[s];
+
+        //
+        // 3. Apply forces
+        //
+
+        vec2f const forceA = springDir * (fSpring + fDamp);
+        dynamicForceBuffer[pointAIndex] += forceA;
+        dynamicForceBuffer[pointBIndex] -= forceA;
+    }
+
+    //
+    // Adds the forces of the four springs of the perfect square at s, given the
+    // forces on their A endpoints - see the SSE variant for the layout
+    //
+    inline void AddPerfectSquareForces(
+        Springs::Endpoints const * endpoints,
+        float const * forceX,
+        float const * forceY,
+        vec2f * restrict dynamicForceBuffer)
+    {
+        ElementIndex const pointJIndex = endpoints[0].PointAIndex;
+        ElementIndex const pointKIndex = endpoints[1].PointBIndex;
+        ElementIndex const pointLIndex = endpoints[0].PointBIndex;
+        ElementIndex const pointMIndex = endpoints[1].PointAIndex;
+
+        vec2f const s0_forceA(forceX[0], forceY[0]);
+        vec2f const s1_forceA(forceX[1], forceY[1]);
+        vec2f const s2_forceA(forceX[2], forceY[2]);
+        vec2f const s3_forceA(forceX[3], forceY[3]);
+
+        dynamicForceBuffer[pointJIndex] += (s0_forceA + s2_forceA);
+        dynamicForceBuffer[pointMIndex] += (s1_forceA + s3_forceA);
+        dynamicForceBuffer[pointLIndex] -= (s0_forceA + s3_forceA);
+        dynamicForceBuffer[pointKIndex] -= (s1_forceA + s2_forceA);
+    }
+
+    inline void AddSpringForces(
+        size_t springCount,
+        Springs::Endpoints const * endpoints,
+        float const * forceX,
+        float const * forceY,
+        vec2f * restrict dynamicForceBuffer)
+    {
+        for (size_t i = 0; i < springCount; ++i)
+        {
+            vec2f const forceA(forceX[i], forceY[i]);
+            dynamicForceBuffer[endpoints[i].PointAIndex] += forceA;
+            dynamicForceBuffer[endpoints[i].PointBIndex] -= forceA;
+        }
+    }
+
+    // Loads two vectors, the first one going low
+    inline __m128 LoadVectorPair(
+        vec2f const * restrict buffer,
+        ElementIndex i0,
+        ElementIndex i1)
+    {
+        return _mm_loadh_pi(
+            _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const *>(buffer + i0))),
+            reinterpret_cast<__m64 const *>(buffer + i1));
+    }
+
+    // Loads the differences (B - A) of two springs' endpoint vectors, the first spring going low
+    inline __m128 LoadSpringVectorPair(
+        vec2f const * restrict buffer,
+        Springs::Endpoints const * endpoints)
+    {
+        return _mm_sub_ps(
+            LoadVectorPair(buffer, endpoints[0].PointBIndex, endpoints[1].PointBIndex),
+            LoadVectorPair(buffer, endpoints[0].PointAIndex, endpoints[1].PointAIndex));
+    }
+
+    //
+    // Calculates the forces on the A endpoints of the springs at s, given their
+    // displacements and relative velocities.
+    //
+    // Input vectors have x and y interleaved, with springs in the following order
+    // in each 128-bit lane:
+    //  lo: s+0 s+1 | s+4 s+5 | ...
+    //  hi: s+2 s+3 | s+6 s+7 | ...
+    // hence de-interleaving them within lanes yields the springs in order.
+    //
+
+    FS_TARGET_AVX2 inline void CalculateSpringForces_AVX2(
+        __m256 const dis_lo,
+        __m256 const dis_hi,
+        __m256 const rvel_lo,
+        __m256 const rvel_hi,
+        SpringForcesInput const & input,
+        ElementIndex s,
+        float * restrict forceX,
+        float * restrict forceY)
+    {
+        __m256 const Zero = _mm256_setzero_ps();
+
+        //
+        // Calculate spring lengths and spring directions
+        //
+
+        __m256 const dis_x = _mm256_shuffle_ps(dis_lo, dis_hi, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 const dis_y = _mm256_shuffle_ps(dis_lo, dis_hi, _MM_SHUFFLE(3, 1, 3, 1));
+
+        __m256 const sq_len = _mm256_fmadd_ps(dis_x, dis_x, _mm256_mul_ps(dis_y, dis_y));
+
+        __m256 const validMask = _mm256_cmp_ps(sq_len, Zero, _CMP_NEQ_OQ); // SL==0 => 1/SL==0, to maintain "normalized == (0, 0)", as in vec2f
+
+        __m256 const springLength_inv = _mm256_and_ps(_mm256_rsqrt_ps(sq_len), validMask);
+        __m256 const springLength = _mm256_and_ps(_mm256_rcp_ps(springLength_inv), validMask);
+
+        __m256 const sdir_x = _mm256_mul_ps(dis_x, springLength_inv);
+        __m256 const sdir_y = _mm256_mul_ps(dis_y, springLength_inv);
+
+        //
+        // 1. Hooke's law
+        //
+
+        __m256 const hooke_forceModuli = _mm256_mul_ps(
+            _mm256_sub_ps(springLength, _mm256_loadu_ps(input.RestLengthBuffer + s)),
+            _mm256_loadu_ps(input.StiffnessCoefficientBuffer + s));
+
+        //
+        // 2. Damper forces
+        //
+
+        __m256 const rvel_x = _mm256_shuffle_ps(rvel_lo, rvel_hi, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 const rvel_y = _mm256_shuffle_ps(rvel_lo, rvel_hi, _MM_SHUFFLE(3, 1, 3, 1));
+
+        __m256 const damping_forceModuli = _mm256_mul_ps(
+            _mm256_fmadd_ps(rvel_x, sdir_x, _mm256_mul_ps(rvel_y, sdir_y)),
+            _mm256_loadu_ps(input.DampingCoefficientBuffer + s));
+
+        //
+        // 3. Forces on A endpoints
+        //
+
+        __m256 const tForceModuli = _mm256_add_ps(hooke_forceModuli, damping_forceModuli);
+
+        _mm256_store_ps(forceX, _mm256_mul_ps(sdir_x, tForceModuli));
+        _mm256_store_ps(forceY, _mm256_mul_ps(sdir_y, tForceModuli));
+    }
+
+    FS_TARGET_AVX512 inline void CalculateSpringForces_AVX512(
+        __m512 const dis_lo,
+        __m512 const dis_hi,
+        __m512 const rvel_lo,
+        __m512 const rvel_hi,
+        SpringForcesInput const & input,
+        ElementIndex s,
+        float * restrict forceX,
+        float * restrict forceY)
+    {
+        __m512 const Zero = _mm512_setzero_ps();
+
+        //
+        // Calculate spring lengths and spring directions
+        //
+
+        __m512 const dis_x = _mm512_shuffle_ps(dis_lo, dis_hi, _MM_SHUFFLE(2, 0, 2, 0));
+        __m512 const dis_y = _mm512_shuffle_ps(dis_lo, dis_hi, _MM_SHUFFLE(3, 1, 3, 1));
+
+        __m512 const sq_len = _mm512_fmadd_ps(dis_x, dis_x, _mm512_mul_ps(dis_y, dis_y));
+
+        __mmask16 const validMask = _mm512_cmp_ps_mask(sq_len, Zero, _CMP_NEQ_OQ); // SL==0 => 1/SL==0, to maintain "normalized == (0, 0)", as in vec2f
+
+        __m512 const springLength_inv = _mm512_maskz_rsqrt14_ps(validMask, sq_len);
+        __m512 const springLength = _mm512_maskz_rcp14_ps(validMask, springLength_inv);
+
+        __m512 const sdir_x = _mm512_mul_ps(dis_x, springLength_inv);
+        __m512 const sdir_y = _mm512_mul_ps(dis_y, springLength_inv);
+
+        //
+        // 1. Hooke's law
+        //
+
+        __m512 const hooke_forceModuli = _mm512_mul_ps(
+            _mm512_sub_ps(springLength, _mm512_loadu_ps(input.RestLengthBuffer + s)),
+            _mm512_loadu_ps(input.StiffnessCoefficientBuffer + s));
+
+        //
+        // 2. Damper forces
+        //
+
+        __m512 const rvel_x = _mm512_shuffle_ps(rvel_lo, rvel_hi, _MM_SHUFFLE(2, 0, 2, 0));
+        __m512 const rvel_y = _mm512_shuffle_ps(rvel_lo, rvel_hi, _MM_SHUFFLE(3, 1, 3, 1));
+
+        __m512 const damping_forceModuli = _mm512_mul_ps(
+            _mm512_fmadd_ps(rvel_x, sdir_x, _mm512_mul_ps(rvel_y, sdir_y)),
+            _mm512_loadu_ps(input.DampingCoefficientBuffer + s));
+
+        //
+        // 3. Forces on A endpoints
+        //
+
+        __m512 const tForceModuli = _mm512_add_ps(hooke_forceModuli, damping_forceModuli);
+
+        _mm512_store_ps(forceX, _mm512_mul_ps(sdir_x, tForceModuli));
+        _mm512_store_ps(forceY, _mm512_mul_ps(sdir_y, tForceModuli));
+    }
+
+    // Makes a vector out of four vector pairs, one per 128-bit lane
+    FS_TARGET_AVX512 inline __m512 MakeVector_AVX512(
+        __m128 v0,
+        __m128 v1,
+        __m128 v2,
+        __m128 v3)
+    {
+        return _mm512_insertf32x4(
+            _mm512_insertf32x4(
+                _mm512_insertf32x4(
+                    _mm512_zextps128_ps512(v0),
+                    v1,
+                    1),
+                v2,
+                2),
+            v3,
+            3);
+    }
+
+    //
+    // Perfect squares only need the four points J, K, L, M (see the SSE variant):
+    //  jm: J M     lk: L K
+    //  s0 = L - J, s1 = K - M, s2 = K - J, s3 = L - M
+    //
+
+    inline __m128 LoadPerfectSquareJM(
+        vec2f const * restrict buffer,
+        Springs::Endpoints const * endpoints)
+    {
+        return LoadVectorPair(buffer, endpoints[0].PointAIndex, endpoints[1].PointAIndex);
+    }
+
+    inline __m128 LoadPerfectSquareLK(
+        vec2f const * restrict buffer,
+        Springs::Endpoints const * endpoints)
+    {
+        return LoadVectorPair(buffer, endpoints[0].PointBIndex, endpoints[1].PointBIndex);
+    }
+
+    //
+    // Integrates the four points (eight floats) starting at float i
+    //
+    FS_TARGET_AVX2 inline void IntegrateAndResetEightDynamicForces_AVX2(
+        DynamicForcesIntegrationInput const & input,
+        size_t i)
+    {
+        __m256 springForce = _mm256_loadu_ps(input.DynamicForceBuffers[0] + i);
+        for (size_t b = 1; b < input.DynamicForceBufferCount; ++b)
+        {
+            springForce = _mm256_add_ps(springForce, _mm256_loadu_ps(input.DynamicForceBuffers[b] + i));
+        }
+
+        // vec2f const deltaPos =
+        //    velocityBuffer[i] * dt
+        //    + (springForceBuffer[i] + externalForceBuffer[i]) * integrationFactorBuffer[i];
+        __m256 const deltaPos = _mm256_fmadd_ps(
+            _mm256_loadu_ps(input.VelocityBuffer + i),
+            _mm256_set1_ps(input.Dt),
+            _mm256_mul_ps(
+                _mm256_add_ps(springForce, _mm256_loadu_ps(input.StaticForceBuffer + i)),
+                _mm256_loadu_ps(input.IntegrationFactorBuffer + i)));
+
+        _mm256_storeu_ps(input.PositionBuffer + i, _mm256_add_ps(_mm256_loadu_ps(input.PositionBuffer + i), deltaPos));
+        _mm256_storeu_ps(input.VelocityBuffer + i, _mm256_mul_ps(deltaPos, _mm256_set1_ps(input.VelocityFactor)));
+
+        // Zero out spring forces now that we've integrated them
+        for (size_t b = 0; b < input.DynamicForceBufferCount; ++b)
+        {
+            _mm256_storeu_ps(input.DynamicForceBuffers[b] + i, _mm256_setzero_ps());
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////
+// SSE
+///////////////////////////////////////////////////////////////
+
+void ApplySpringsForces_SSE(
+    SpringForcesInput const & input,
+    ElementIndex startSpringIndex,
+    ElementIndex endSpringIndex, // Excluded
+    vec2f * restrict dynamicForceBuffer)
+{
+    // This implementation is for 4-float SSE
+    static_assert(vectorization_float_count<int> >= 4);
+
+    vec2f const * restrict const positionBuffer = input.PositionBuffer;
+    vec2f const * restrict const velocityBuffer = input.VelocityBuffer;
+
+    Springs::Endpoints const * restrict const endpointsBuffer = input.EndpointsBuffer;
+    float const * restrict const restLengthBuffer = input.RestLengthBuffer;
+    float const * restrict const stiffnessCoefficientBuffer = input.StiffnessCoefficientBuffer;
+    float const * restrict const dampingCoefficientBuffer = input.DampingCoefficientBuffer;
+
+    __m128 const Zero = _mm_setzero_ps();
+    aligned_to_vword vec2f tmpSpringForces[4];
+
+    ElementIndex s = startSpringIndex;
+
+    //
+    // 1. Perfect squares
+    //
+
+    ElementCount const endSpringIndexPerfectSquare = std::min(endSpringIndex, input.PerfectSquareCount * 4);
+
+    for (; s < endSpringIndexPerfectSquare; s += 4)
+    {
+        // XMM register notation:
+        //   low (left, or top) -> height (right, or bottom)
+
+        //
+        //    J          M   ---  a
+        //    |\        /|
+        //    | \s0  s1/ |
+        //    |  \    /  |
+        //  s2|   \  /   |s3
+        //    |    \/    |
+        //    |    /\    |
+        //    |   /  \   |
+        //    |  /    \  |
+        //    | /      \ |
+        //    |/        \|
+        //    K          L  ---  b
+        //
+
+        //
+        // Calculate displacements, string lengths, and spring directions
+        //
+        // Steps:
+        // 
+        // l_pos_x   -   j_pos_x   =  s0_dis_x
+        // l_pos_y   -   j_pos_y   =  s0_dis_y
+        // k_pos_x   -   m_pos_x   =  s1_dis_x
+        // k_pos_y   -   m_pos_y   =  s1_dis_y
+        // 
+        // Swap 2H with 2L in first register, then:
+        // 
+        // k_pos_x   -   j_pos_x   =  s2_dis_x
+        // k_pos_y   -   j_pos_y   =  s2_dis_y
+        // l_pos_x   -   m_pos_x   =  s3_dis_x
+        // l_pos_y   -   m_pos_y   =  s3_dis_y
+        // 
+
+        ElementIndex const pointJIndex = endpointsBuffer[s + 0].PointAIndex;
+        ElementIndex const pointKIndex = endpointsBuffer[s + 1].PointBIndex;
+        ElementIndex const pointLIndex = endpointsBuffer[s + 0].PointBIndex;
+        ElementIndex const pointMIndex = endpointsBuffer[s + 1].PointAIndex;
+        
+        assert(pointJIndex == endpointsBuffer[s + 2].PointAIndex);
+        assert(pointKIndex == endpointsBuffer[s + 2].PointBIndex);
+        assert(pointLIndex == endpointsBuffer[s + 3].PointBIndex);
+        assert(pointMIndex == endpointsBuffer[s + 3].PointAIndex);
+
+        // ?_pos_x
+        // ?_pos_y
+        // *
+        // *
+        __m128 const j_pos_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(positionBuffer + pointJIndex)));
+        __m128 const k_pos_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(positionBuffer + pointKIndex)));
+        __m128 const l_pos_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(positionBuffer + pointLIndex)));
+        __m128 const m_pos_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(positionBuffer + pointMIndex)));
+
+        __m128 const jm_pos_xy = _mm_movelh_ps(j_pos_xy, m_pos_xy); // First argument goes low
+        __m128 lk_pos_xy = _mm_movelh_ps(l_pos_xy, k_pos_xy); // First argument goes low
+        __m128 const s0s1_dis_xy = _mm_sub_ps(lk_pos_xy, jm_pos_xy);
+        lk_pos_xy = _mm_shuffle_ps(lk_pos_xy, lk_pos_xy, _MM_SHUFFLE(1, 0, 3, 2));
+        __m128 const s2s3_dis_xy = _mm_sub_ps(lk_pos_xy, jm_pos_xy);
+
+        // Shuffle:
+        //
+        // s0_dis_x     s0_dis_y
+        // s1_dis_x     s1_dis_y
+        // s2_dis_x     s2_dis_y
+        // s3_dis_x     s3_dis_y
+        __m128 const s0s1s2s3_dis_x = _mm_shuffle_ps(s0s1_dis_xy, s2s3_dis_xy, 0x88);
+        __m128 const s0s1s2s3_dis_y = _mm_shuffle_ps(s0s1_dis_xy, s2s3_dis_xy, 0xDD);
+
+        // Calculate spring lengths: sqrt( x*x + y*y )
+        //
+        // Note: the kung-fu below (reciprocal square, then reciprocal, etc.) should be faster:
+        //
+        //  Standard: sqrt 12, (div 11, and 1), (div 11, and 1) = 5instrs/36cycles
+        //  This one: rsqrt 4, and 1, (mul 4), (mul 4), rec 4, and 1 = 6instrs/18cycles
+
+        __m128 const sq_len =
+            _mm_add_ps(
+                _mm_mul_ps(s0s1s2s3_dis_x, s0s1s2s3_dis_x),
+                _mm_mul_ps(s0s1s2s3_dis_y, s0s1s2s3_dis_y));
+
+        __m128 const validMask = _mm_cmpneq_ps(sq_len, Zero); // SL==0 => 1/SL==0, to maintain "normalized == (0, 0)", as in vec2f        
+
+        __m128 const s0s1s2s3_springLength_inv =
+            _mm_and_ps(
+                _mm_rsqrt_ps(sq_len),
+                validMask);
+
+        __m128 const s0s1s2s3_springLength =
+            _mm_and_ps(
+                _mm_rcp_ps(s0s1s2s3_springLength_inv),
+                validMask);
+
+        // Calculate spring directions        
+        __m128 const s0s1s2s3_sdir_x = _mm_mul_ps(s0s1s2s3_dis_x, s0s1s2s3_springLength_inv);
+        __m128 const s0s1s2s3_sdir_y = _mm_mul_ps(s0s1s2s3_dis_y, s0s1s2s3_springLength_inv);
+
+        //////////////////////////////////////////////////////////////////////////////////////////////
+
+        //
+        // 1. Hooke's law
+        //
+
+        // Calculate springs' forces' moduli - for endpoint A:
+        //    (displacementLength[s] - restLength[s]) * stiffness[s]
+        //
+        // Strategy:
+        //
+        // ( springLength[s0] - restLength[s0] ) * stiffness[s0]
+        // ( springLength[s1] - restLength[s1] ) * stiffness[s1]
+        // ( springLength[s2] - restLength[s2] ) * stiffness[s2]
+        // ( springLength[s3] - restLength[s3] ) * stiffness[s3]
+        //
+
+        __m128 const s0s1s2s3_hooke_forceModuli =
+            _mm_mul_ps(
+                _mm_sub_ps(
+                    s0s1s2s3_springLength,
+                    _mm_load_ps(restLengthBuffer + s)),
+                _mm_load_ps(stiffnessCoefficientBuffer + s));
+
+        //
+        // 2. Damper forces
+        //
+        // Damp the velocities of each endpoint pair, as if the points were also connected by a damper
+        // along the same direction as the spring, for endpoint A:
+        //      relVelocity.dot(springDir) * dampingCoeff[s]
+        //
+        // Strategy: 
+        // 
+        // (s0_relv_x * s0_sdir_x  +  s0_relv_y * s0_sdir_y) * dampCoeff[s0]
+        // (s1_relv_x * s1_sdir_x  +  s1_relv_y * s1_sdir_y) * dampCoeff[s1]
+        // (s2_relv_x * s2_sdir_x  +  s2_relv_y * s2_sdir_y) * dampCoeff[s2]
+        // (s3_relv_x * s3_sdir_x  +  s3_relv_y * s3_sdir_y) * dampCoeff[s3]
+        //
+
+        // ?_vel_x
+        // ?_vel_y
+        // *
+        // *
+        __m128 const j_vel_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(velocityBuffer + pointJIndex)));
+        __m128 const k_vel_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(velocityBuffer + pointKIndex)));
+        __m128 const l_vel_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(velocityBuffer + pointLIndex)));
+        __m128 const m_vel_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(velocityBuffer + pointMIndex)));
+
+        __m128 const jm_vel_xy = _mm_movelh_ps(j_vel_xy, m_vel_xy); // First argument goes low
+        __m128 lk_vel_xy = _mm_movelh_ps(l_vel_xy, k_vel_xy); // First argument goes low
+        __m128 const s0s1_rvel_xy = _mm_sub_ps(lk_vel_xy, jm_vel_xy);
+        lk_vel_xy = _mm_shuffle_ps(lk_vel_xy, lk_vel_xy, _MM_SHUFFLE(1, 0, 3, 2));
+        __m128 const s2s3_rvel_xy = _mm_sub_ps(lk_vel_xy, jm_vel_xy);
+
+        __m128 s0s1s2s3_rvel_x = _mm_shuffle_ps(s0s1_rvel_xy, s2s3_rvel_xy, 0x88);
+        __m128 s0s1s2s3_rvel_y = _mm_shuffle_ps(s0s1_rvel_xy, s2s3_rvel_xy, 0xDD);
+
+        __m128 const s0s1s2s3_damping_forceModuli =
+            _mm_mul_ps(
+                _mm_add_ps( // Dot product
+                    _mm_mul_ps(s0s1s2s3_rvel_x, s0s1s2s3_sdir_x),
+                    _mm_mul_ps(s0s1s2s3_rvel_y, s0s1s2s3_sdir_y)),
+                _mm_load_ps(dampingCoefficientBuffer + s));
+
+        //
+        // 3. Apply forces: 
+        //      force A = springDir * (hookeForce + dampingForce)
+        //      force B = - forceA
+        //
+        // Strategy:
+        //
+        //  s0_tforce_a_x  =   s0_sdir_x  *  (  hookeForce[s0] + dampingForce[s0] ) 
+        //  s1_tforce_a_x  =   s1_sdir_x  *  (  hookeForce[s1] + dampingForce[s1] )
+        //  s2_tforce_a_x  =   s2_sdir_x  *  (  hookeForce[s2] + dampingForce[s2] )
+        //  s3_tforce_a_x  =   s3_sdir_x  *  (  hookeForce[s3] + dampingForce[s3] )
+        //
+        //  s0_tforce_a_y  =   s0_sdir_y  *  (  hookeForce[s0] + dampingForce[s0] ) 
+        //  s1_tforce_a_y  =   s1_sdir_y  *  (  hookeForce[s1] + dampingForce[s1] )
+        //  s2_tforce_a_y  =   s2_sdir_y  *  (  hookeForce[s2] + dampingForce[s2] )
+        //  s3_tforce_a_y  =   s3_sdir_y  *  (  hookeForce[s3] + dampingForce[s3] )
+        //
+
+        __m128 const tForceModuli = _mm_add_ps(s0s1s2s3_hooke_forceModuli, s0s1s2s3_damping_forceModuli);
+
+        __m128 const s0s1s2s3_tforceA_x =
+            _mm_mul_ps(
+                s0s1s2s3_sdir_x,
+                tForceModuli);
+
+        __m128 const s0s1s2s3_tforceA_y =
+            _mm_mul_ps(
+                s0s1s2s3_sdir_y,
+                tForceModuli);
+
+        //
+        // Unpack and add forces:
+        //      dynamicForceBuffer[pointAIndex] += total_forceA;
+        //      dynamicForceBuffer[pointBIndex] -= total_forceA;
+        //
+        // j_sforce += s0_a_tforce + s2_a_tforce
+        // m_sforce += s1_a_tforce + s3_a_tforce
+        // 
+        // l_sforce -= s0_a_tforce + s3_a_tforce
+        // k_sforce -= s1_a_tforce + s2_a_tforce
+
+
+        __m128 s0s1_tforceA_xy = _mm_unpacklo_ps(s0s1s2s3_tforceA_x, s0s1s2s3_tforceA_y); // a[0], b[0], a[1], b[1]
+        __m128 s2s3_tforceA_xy = _mm_unpackhi_ps(s0s1s2s3_tforceA_x, s0s1s2s3_tforceA_y); // a[2], b[2], a[3], b[3]
+
+        __m128 const jm_sforce_xy = _mm_add_ps(s0s1_tforceA_xy, s2s3_tforceA_xy);
+        s2s3_tforceA_xy = _mm_shuffle_ps(s2s3_tforceA_xy, s2s3_tforceA_xy, _MM_SHUFFLE(1, 0, 3, 2));
+        __m128 const lk_sforce_xy = _mm_add_ps(s0s1_tforceA_xy, s2s3_tforceA_xy);
+
+        _mm_store_ps(reinterpret_cast<float *>(&(tmpSpringForces[0])), jm_sforce_xy);
+        _mm_store_ps(reinterpret_cast<float *>(&(tmpSpringForces[2])), lk_sforce_xy);
+
+        dynamicForceBuffer[pointJIndex] += tmpSpringForces[0];
+        dynamicForceBuffer[pointMIndex] += tmpSpringForces[1];
+        dynamicForceBuffer[pointLIndex] -= tmpSpringForces[2];
+        dynamicForceBuffer[pointKIndex] -= tmpSpringForces[3];
+    }
+
+    //
+    // 2. One-by-one up to the next four-aligned spring, as we might start in the middle
+    //    of a vectorization word (e.g. at the start of a spring color)
+    //
+
+    ElementCount const endSpringIndexUnaligned = std::min(endSpringIndex, make_aligned_float_element_count(s));
+
+    for (; s < endSpringIndexUnaligned; ++s)
+    {
+        ApplySpringForces(input, s, dynamicForceBuffer);
+    }
+
+    //
+    // 3. Remaining four-by-four's
+    //
+
+    ElementCount const endSpringIndexVectorized = endSpringIndex - (endSpringIndex % 4);
+
+    for (; s < endSpringIndexVectorized; s += 4)
+    {
+        // Spring 0 displacement (s0_position.x, s0_position.y, *, *)
+        __m128 const s0pa_pos_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(positionBuffer + endpointsBuffer[s + 0].PointAIndex)));
+        __m128 const s0pb_pos_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(positionBuffer + endpointsBuffer[s + 0].PointBIndex)));
+        // s0_displacement.x, s0_displacement.y, *, *
+        __m128 const s0_displacement_xy = _mm_sub_ps(s0pb_pos_xy, s0pa_pos_xy);
+
+        // Spring 1 displacement (s1_position.x, s1_position.y, *, *)
+        __m128 const s1pa_pos_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(positionBuffer + endpointsBuffer[s + 1].PointAIndex)));
+        __m128 const s1pb_pos_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(positionBuffer + endpointsBuffer[s + 1].PointBIndex)));
+        // s1_displacement.x, s1_displacement.y
+        __m128 const s1_displacement_xy = _mm_sub_ps(s1pb_pos_xy, s1pa_pos_xy);
+
+        // s0_displacement.x, s0_displacement.y, s1_displacement.x, s1_displacement.y
+        __m128 const s0s1_displacement_xy = _mm_movelh_ps(s0_displacement_xy, s1_displacement_xy); // First argument goes low
+
+        // Spring 2 displacement (s2_position.x, s2_position.y, *, *)
+        __m128 const s2pa_pos_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(positionBuffer + endpointsBuffer[s + 2].PointAIndex)));
+        __m128 const s2pb_pos_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(positionBuffer + endpointsBuffer[s + 2].PointBIndex)));
+        // s2_displacement.x, s2_displacement.y
+        __m128 const s2_displacement_xy = _mm_sub_ps(s2pb_pos_xy, s2pa_pos_xy);
+
+        // Spring 3 displacement (s3_position.x, s3_position.y, *, *)
+        __m128 const s3pa_pos_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(positionBuffer + endpointsBuffer[s + 3].PointAIndex)));
+        __m128 const s3pb_pos_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(positionBuffer + endpointsBuffer[s + 3].PointBIndex)));
+        // s3_displacement.x, s3_displacement.y
+        __m128 const s3_displacement_xy = _mm_sub_ps(s3pb_pos_xy, s3pa_pos_xy);
+
+        // s2_displacement.x, s2_displacement.y, s3_displacement.x, s3_displacement.y
+        __m128 const s2s3_displacement_xy = _mm_movelh_ps(s2_displacement_xy, s3_displacement_xy); // First argument goes low
+
+        // Shuffle displacements:
+        // s0_displacement.x, s1_displacement.x, s2_displacement.x, s3_displacement.x
+        __m128 s0s1s2s3_displacement_x = _mm_shuffle_ps(s0s1_displacement_xy, s2s3_displacement_xy, 0x88);
+        // s0_displacement.y, s1_displacement.y, s2_displacement.y, s3_displacement.y
+        __m128 s0s1s2s3_displacement_y = _mm_shuffle_ps(s0s1_displacement_xy, s2s3_displacement_xy, 0xDD);
+
+        // Calculate spring lengths
+
+        // s0_displacement.x^2, s1_displacement.x^2, s2_displacement.x^2, s3_displacement.x^2
+        __m128 const s0s1s2s3_displacement_x2 = _mm_mul_ps(s0s1s2s3_displacement_x, s0s1s2s3_displacement_x);
+        // s0_displacement.y^2, s1_displacement.y^2, s2_displacement.y^2, s3_displacement.y^2
+        __m128 const s0s1s2s3_displacement_y2 = _mm_mul_ps(s0s1s2s3_displacement_y, s0s1s2s3_displacement_y);
+
+        // s0_displacement.x^2 + s0_displacement.y^2, s1_displacement.x^2 + s1_displacement.y^2, s2_displacement..., s3_displacement...
+        __m128 const s0s1s2s3_displacement_x2_p_y2 = _mm_add_ps(s0s1s2s3_displacement_x2, s0s1s2s3_displacement_y2);
+
+        __m128 const validMask = _mm_cmpneq_ps(s0s1s2s3_displacement_x2_p_y2, Zero);
+
+        __m128 const s0s1s2s3_springLength_inv =
+            _mm_and_ps(
+                _mm_rsqrt_ps(s0s1s2s3_displacement_x2_p_y2),
+                validMask);
+
+        __m128 const s0s1s2s3_springLength =
+            _mm_and_ps(
+                _mm_rcp_ps(s0s1s2s3_springLength_inv),
+                validMask);
+
+        // Calculate spring directions
+        __m128 const s0s1s2s3_sdir_x = _mm_mul_ps(s0s1s2s3_displacement_x, s0s1s2s3_springLength_inv);
+        __m128 const s0s1s2s3_sdir_y = _mm_mul_ps(s0s1s2s3_displacement_y, s0s1s2s3_springLength_inv);
+        
+        //////////////////////////////////////////////////////////////////////////////////////////////
+
+        //
+        // 1. Hooke's law
+        //
+
+        // Calculate springs' forces' moduli - for endpoint A:
+        //    (displacementLength[s] - restLength[s]) * stiffness[s]
+        //
+        // Strategy:
+        //
+        // ( springLength[s0] - restLength[s0] ) * stiffness[s0]
+        // ( springLength[s1] - restLength[s1] ) * stiffness[s1]
+        // ( springLength[s2] - restLength[s2] ) * stiffness[s2]
+        // ( springLength[s3] - restLength[s3] ) * stiffness[s3]
+        //
+
+        __m128 const s0s1s2s3_restLength = _mm_load_ps(restLengthBuffer + s);
+        __m128 const s0s1s2s3_stiffness = _mm_load_ps(stiffnessCoefficientBuffer + s);
+
+        __m128 const s0s1s2s3_hooke_forceModuli = _mm_mul_ps(
+            _mm_sub_ps(s0s1s2s3_springLength, s0s1s2s3_restLength),
+            s0s1s2s3_stiffness);
+
+        //
+        // 2. Damper forces
+        //
+        // Damp the velocities of each endpoint pair, as if the points were also connected by a damper
+        // along the same direction as the spring, for endpoint A:
+        //      relVelocity.dot(springDir) * dampingCoeff[s]
+        //
+        // Strategy: 
+        //
+        // ( relV[s0].x * sprDir[s0].x  +  relV[s0].y * sprDir[s0].y )  *  dampCoeff[s0]
+        // ( relV[s1].x * sprDir[s1].x  +  relV[s1].y * sprDir[s1].y )  *  dampCoeff[s1]
+        // ( relV[s2].x * sprDir[s2].x  +  relV[s2].y * sprDir[s2].y )  *  dampCoeff[s2]
+        // ( relV[s3].x * sprDir[s3].x  +  relV[s3].y * sprDir[s3].y )  *  dampCoeff[s3]
+        //
+
+        // Spring 0 rel vel (s0_vel.x, s0_vel.y, *, *)
+        __m128 const s0pa_vel_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(velocityBuffer + endpointsBuffer[s + 0].PointAIndex)));
+        __m128 const s0pb_vel_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(velocityBuffer + endpointsBuffer[s + 0].PointBIndex)));
+        // s0_relvel_x, s0_relvel_y, *, *
+        __m128 const s0_relvel_xy = _mm_sub_ps(s0pb_vel_xy, s0pa_vel_xy);
+
+        // Spring 1 rel vel (s1_vel.x, s1_vel.y, *, *)
+        __m128 const s1pa_vel_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(velocityBuffer + endpointsBuffer[s + 1].PointAIndex)));
+        __m128 const s1pb_vel_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(velocityBuffer + endpointsBuffer[s + 1].PointBIndex)));
+        // s1_relvel_x, s1_relvel_y, *, *
+        __m128 const s1_relvel_xy = _mm_sub_ps(s1pb_vel_xy, s1pa_vel_xy);
+
+        // s0_relvel.x, s0_relvel.y, s1_relvel.x, s1_relvel.y
+        __m128 const s0s1_relvel_xy = _mm_movelh_ps(s0_relvel_xy, s1_relvel_xy); // First argument goes low
+
+        // Spring 2 rel vel (s2_vel.x, s2_vel.y, *, *)
+        __m128 const s2pa_vel_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(velocityBuffer + endpointsBuffer[s + 2].PointAIndex)));
+        __m128 const s2pb_vel_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(velocityBuffer + endpointsBuffer[s + 2].PointBIndex)));
+        // s2_relvel_x, s2_relvel_y, *, *
+        __m128 const s2_relvel_xy = _mm_sub_ps(s2pb_vel_xy, s2pa_vel_xy);
+
+        // Spring 3 rel vel (s3_vel.x, s3_vel.y, *, *)
+        __m128 const s3pa_vel_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(velocityBuffer + endpointsBuffer[s + 3].PointAIndex)));
+        __m128 const s3pb_vel_xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const * restrict>(velocityBuffer + endpointsBuffer[s + 3].PointBIndex)));
+        // s3_relvel_x, s3_relvel_y, *, *
+        __m128 const s3_relvel_xy = _mm_sub_ps(s3pb_vel_xy, s3pa_vel_xy);
+
+        // s2_relvel.x, s2_relvel.y, s3_relvel.x, s3_relvel.y
+        __m128 const s2s3_relvel_xy = _mm_movelh_ps(s2_relvel_xy, s3_relvel_xy); // First argument goes low
+
+        // Shuffle rel vals:
+        // s0_relvel.x, s1_relvel.x, s2_relvel.x, s3_relvel.x
+        __m128 s0s1s2s3_relvel_x = _mm_shuffle_ps(s0s1_relvel_xy, s2s3_relvel_xy, 0x88);
+        // s0_relvel.y, s1_relvel.y, s2_relvel.y, s3_relvel.y
+        __m128 s0s1s2s3_relvel_y = _mm_shuffle_ps(s0s1_relvel_xy, s2s3_relvel_xy, 0xDD);
+
+        // Damping coeffs
+        __m128 const s0s1s2s3_dampingCoeff = _mm_load_ps(dampingCoefficientBuffer + s);
+
+        __m128 const s0s1s2s3_damping_forceModuli =
+            _mm_mul_ps(
+                _mm_add_ps( // Dot product
+                    _mm_mul_ps(s0s1s2s3_relvel_x, s0s1s2s3_sdir_x),
+                    _mm_mul_ps(s0s1s2s3_relvel_y, s0s1s2s3_sdir_y)),
+                s0s1s2s3_dampingCoeff);
+
+        //
+        // 3. Apply forces: 
+        //      force A = springDir * (hookeForce + dampingForce)
+        //      force B = - forceA
+        //
+        // Strategy:
+        //
+        //  total_forceA[s0].x  =   springDir[s0].x  *  (  hookeForce[s0] + dampingForce[s0] ) 
+        //  total_forceA[s1].x  =   springDir[s1].x  *  (  hookeForce[s1] + dampingForce[s1] )
+        //  total_forceA[s2].x  =   springDir[s2].x  *  (  hookeForce[s2] + dampingForce[s2] )
+        //  total_forceA[s3].x  =   springDir[s3].x  *  (  hookeForce[s3] + dampingForce[s3] )
+        //
+        //  total_forceA[s0].y  =   springDir[s0].y  *  (  hookeForce[s0] + dampingForce[s0] ) 
+        //  total_forceA[s1].y  =   springDir[s1].y  *  (  hookeForce[s1] + dampingForce[s1] )
+        //  total_forceA[s2].y  =   springDir[s2].y  *  (  hookeForce[s2] + dampingForce[s2] )
+        //  total_forceA[s3].y  =   springDir[s3].y  *  (  hookeForce[s3] + dampingForce[s3] )
+        //
+
+        __m128 const tForceModuli = _mm_add_ps(s0s1s2s3_hooke_forceModuli, s0s1s2s3_damping_forceModuli);
+
+        __m128 const s0s1s2s3_tforceA_x =
+            _mm_mul_ps(
+                s0s1s2s3_sdir_x,
+                tForceModuli);
+
+        __m128 const s0s1s2s3_tforceA_y =
+            _mm_mul_ps(
+                s0s1s2s3_sdir_y,
+                tForceModuli);
+
+        //
+        // Unpack and add forces:
+        //      pointSpringForceBuffer[pointAIndex] += total_forceA;
+        //      pointSpringForceBuffer[pointBIndex] -= total_forceA;
+        //
+
+        __m128 s0s1_tforceA_xy = _mm_unpacklo_ps(s0s1s2s3_tforceA_x, s0s1s2s3_tforceA_y); // a[0], b[0], a[1], b[1]
+        __m128 s2s3_tforceA_xy = _mm_unpackhi_ps(s0s1s2s3_tforceA_x, s0s1s2s3_tforceA_y); // a[2], b[2], a[3], b[3]
+
+        _mm_store_ps(reinterpret_cast<float *>(&(tmpSpringForces[0])), s0s1_tforceA_xy);
+        _mm_store_ps(reinterpret_cast<float *>(&(tmpSpringForces[2])), s2s3_tforceA_xy);
+
+        dynamicForceBuffer[endpointsBuffer[s + 0].PointAIndex] += tmpSpringForces[0];
+        dynamicForceBuffer[endpointsBuffer[s + 0].PointBIndex] -= tmpSpringForces[0];
+        dynamicForceBuffer[endpointsBuffer[s + 1].PointAIndex] += tmpSpringForces[1];
+        dynamicForceBuffer[endpointsBuffer[s + 1].PointBIndex] -= tmpSpringForces[1];
+        dynamicForceBuffer[endpointsBuffer[s + 2].PointAIndex] += tmpSpringForces[2];
+        dynamicForceBuffer[endpointsBuffer[s + 2].PointBIndex] -= tmpSpringForces[2];
+        dynamicForceBuffer[endpointsBuffer[s + 3].PointAIndex] += tmpSpringForces[3];
+        dynamicForceBuffer[endpointsBuffer[s + 3].PointBIndex] -= tmpSpringForces[3];
+    }
+
+    //
+    // 4. One-by-one
+    //
+
+    for (; s < endSpringIndex; ++s)
+    {
+        ApplySpringForces(input, s, dynamicForceBuffer);
+    }
+}
+
+void IntegrateAndResetDynamicForces_SSE(
+    DynamicForcesIntegrationInput const & input,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
+{
+    // This implementation is for 4-float SSE
+    static_assert(vectorization_float_count<int> >= 4);
+
+    float * restrict const positionBuffer = input.PositionBuffer;
+    float * restrict const velocityBuffer = input.VelocityBuffer;
+    float const * const restrict staticForceBuffer = input.StaticForceBuffer;
+    float const * const restrict integrationFactorBuffer = input.IntegrationFactorBuffer;
+
+    float * const restrict * restrict const dynamicForceBufferOfBuffers = input.DynamicForceBuffers;
+
+    __m128 const zero_4 = _mm_setzero_ps();
+    __m128 const dt_4 = _mm_load1_ps(&input.Dt);
+    __m128 const velocityFactor_4 = _mm_load1_ps(&input.VelocityFactor);
+
+    for (size_t i = startPointIndex * 2; i < endPointIndex * 2; i += 4) // Two components per vector
+    {
+        __m128 springForce_2 = zero_4;
+        for (size_t b = 0; b < input.DynamicForceBufferCount; ++b)
+        {
+            springForce_2 =
+                _mm_add_ps(
+                    springForce_2,
+                    _mm_load_ps(dynamicForceBufferOfBuffers[b] + i));
+        }
+
+        // vec2f const deltaPos =
+        //    velocityBuffer[i] * dt
+        //    + (springForceBuffer[i] + externalForceBuffer[i]) * integrationFactorBuffer[i];
+        __m128 const deltaPos_2 =
+            _mm_add_ps(
+                _mm_mul_ps(
+                    _mm_load_ps(velocityBuffer + i),
+                    dt_4),
+                _mm_mul_ps(
+                    _mm_add_ps(
+                        springForce_2,
+                        _mm_load_ps(staticForceBuffer + i)),
+                    _mm_load_ps(integrationFactorBuffer + i)));
+
+        // positionBuffer[i] += deltaPos;
+        __m128 pos_2 = _mm_load_ps(positionBuffer + i);
+        pos_2 = _mm_add_ps(pos_2, deltaPos_2);
+        _mm_store_ps(positionBuffer + i, pos_2);
+
+        // velocityBuffer[i] = deltaPos * velocityFactor;
+        __m128 const vel_2 =
+            _mm_mul_ps(
+                deltaPos_2,
+                velocityFactor_4);
+        _mm_store_ps(velocityBuffer + i, vel_2);
+
+        // Zero out spring forces now that we've integrated them
+        for (size_t b = 0; b < input.DynamicForceBufferCount; ++b)
+        {
+            _mm_store_ps(dynamicForceBufferOfBuffers[b] + i, zero_4);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////
+// AVX2
+///////////////////////////////////////////////////////////////
+
+FS_TARGET_AVX2 void ApplySpringsForces_AVX2(
+    SpringForcesInput const & input,
+    ElementIndex startSpringIndex,
+    ElementIndex endSpringIndex, // Excluded
+    vec2f * restrict dynamicForceBuffer)
+{
+    vec2f const * restrict const positionBuffer = input.PositionBuffer;
+    vec2f const * restrict const velocityBuffer = input.VelocityBuffer;
+    Springs::Endpoints const * restrict const endpointsBuffer = input.EndpointsBuffer;
+
+    alignas(32) float forceX[8];
+    alignas(32) float forceY[8];
+
+    ElementIndex s = startSpringIndex;
+
+    //
+    // 1. Perfect squares, two at a time
+    //
+
+    ElementCount const endSpringIndexPerfectSquare = std::min(endSpringIndex, input.PerfectSquareCount * 4);
+
+    assert(s >= endSpringIndexPerfectSquare || (s % 4) == 0);
+
+    for (; s + 8 <= endSpringIndexPerfectSquare; s += 8)
+    {
+        // J0 M0 | J1 M1
+        __m256 const jm_pos = _mm256_set_m128(LoadPerfectSquareJM(positionBuffer, endpointsBuffer + s + 4), LoadPerfectSquareJM(positionBuffer, endpointsBuffer + s));
+        __m256 const jm_vel = _mm256_set_m128(LoadPerfectSquareJM(velocityBuffer, endpointsBuffer + s + 4), LoadPerfectSquareJM(velocityBuffer, endpointsBuffer + s));
+
+        // L0 K0 | L1 K1
+        __m256 const lk_pos = _mm256_set_m128(LoadPerfectSquareLK(positionBuffer, endpointsBuffer + s + 4), LoadPerfectSquareLK(positionBuffer, endpointsBuffer + s));
+        __m256 const lk_vel = _mm256_set_m128(LoadPerfectSquareLK(velocityBuffer, endpointsBuffer + s + 4), LoadPerfectSquareLK(velocityBuffer, endpointsBuffer + s));
+
+        CalculateSpringForces_AVX2(
+            _mm256_sub_ps(lk_pos, jm_pos), // s0 s1 | s4 s5
+            _mm256_sub_ps(_mm256_permute_ps(lk_pos, _MM_SHUFFLE(1, 0, 3, 2)), jm_pos), // s2 s3 | s6 s7
+            _mm256_sub_ps(lk_vel, jm_vel),
+            _mm256_sub_ps(_mm256_permute_ps(lk_vel, _MM_SHUFFLE(1, 0, 3, 2)), jm_vel),
+            input,
+            s,
+            forceX,
+            forceY);
+
+        AddPerfectSquareForces(endpointsBuffer + s, forceX, forceY, dynamicForceBuffer);
+        AddPerfectSquareForces(endpointsBuffer + s + 4, forceX + 4, forceY + 4, dynamicForceBuffer);
+    }
+
+    //
+    // 2. Remaining eight-by-eight's
+    //
+
+    for (; s + 8 <= endSpringIndex; s += 8)
+    {
+        CalculateSpringForces_AVX2(
+            _mm256_set_m128(LoadSpringVectorPair(positionBuffer, endpointsBuffer + s + 4), LoadSpringVectorPair(positionBuffer, endpointsBuffer + s)),
+            _mm256_set_m128(LoadSpringVectorPair(positionBuffer, endpointsBuffer + s + 6), LoadSpringVectorPair(positionBuffer, endpointsBuffer + s + 2)),
+            _mm256_set_m128(LoadSpringVectorPair(velocityBuffer, endpointsBuffer + s + 4), LoadSpringVectorPair(velocityBuffer, endpointsBuffer + s)),
+            _mm256_set_m128(LoadSpringVectorPair(velocityBuffer, endpointsBuffer + s + 6), LoadSpringVectorPair(velocityBuffer, endpointsBuffer + s + 2)),
+            input,
+            s,
+            forceX,
+            forceY);
+
+        AddSpringForces(8, endpointsBuffer + s, forceX, forceY, dynamicForceBuffer);
+    }
+
+    //
+    // 3. One-by-one
+    //
+
+    for (; s < endSpringIndex; ++s)
+    {
+        ApplySpringForces(input, s, dynamicForceBuffer);
+    }
+}
+
+FS_TARGET_AVX2 void IntegrateAndResetDynamicForces_AVX2(
+    DynamicForcesIntegrationInput const & input,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
+{
+    assert(input.DynamicForceBufferCount >= 1);
+    assert(((endPointIndex - startPointIndex) % 4) == 0);
+
+    for (size_t i = startPointIndex * 2; i < endPointIndex * 2; i += 8) // Two components per vector
+    {
+        IntegrateAndResetEightDynamicForces_AVX2(input, i);
+    }
+}
+
+///////////////////////////////////////////////////////////////
+// AVX-512
+///////////////////////////////////////////////////////////////
+
+FS_TARGET_AVX512 void ApplySpringsForces_AVX512(
+    SpringForcesInput const & input,
+    ElementIndex startSpringIndex,
+    ElementIndex endSpringIndex, // Excluded
+    vec2f * restrict dynamicForceBuffer)
+{
+    vec2f const * restrict const positionBuffer = input.PositionBuffer;
+    vec2f const * restrict const velocityBuffer = input.VelocityBuffer;
+    Springs::Endpoints const * restrict const endpointsBuffer = input.EndpointsBuffer;
+
+    alignas(64) float forceX[16];
+    alignas(64) float forceY[16];
+
+    ElementIndex s = startSpringIndex;
+
+    //
+    // 1. Perfect squares, four at a time
+    //
+
+    ElementCount const endSpringIndexPerfectSquare = std::min(endSpringIndex, input.PerfectSquareCount * 4);
+
+    assert(s >= endSpringIndexPerfectSquare || (s % 4) == 0);
+
+    for (; s + 16 <= endSpringIndexPerfectSquare; s += 16)
+    {
+        // J0 M0 | J1 M1 | J2 M2 | J3 M3
+        __m512 const jm_pos = MakeVector_AVX512(
+            LoadPerfectSquareJM(positionBuffer, endpointsBuffer + s),
+            LoadPerfectSquareJM(positionBuffer, endpointsBuffer + s + 4),
+            LoadPerfectSquareJM(positionBuffer, endpointsBuffer + s + 8),
+            LoadPerfectSquareJM(positionBuffer, endpointsBuffer + s + 12));
+
+        __m512 const jm_vel = MakeVector_AVX512(
+            LoadPerfectSquareJM(velocityBuffer, endpointsBuffer + s),
+            LoadPerfectSquareJM(velocityBuffer, endpointsBuffer + s + 4),
+            LoadPerfectSquareJM(velocityBuffer, endpointsBuffer + s + 8),
+            LoadPerfectSquareJM(velocityBuffer, endpointsBuffer + s + 12));
+
+        // L0 K0 | L1 K1 | L2 K2 | L3 K3
+        __m512 const lk_pos = MakeVector_AVX512(
+            LoadPerfectSquareLK(positionBuffer, endpointsBuffer + s),
+            LoadPerfectSquareLK(positionBuffer, endpointsBuffer + s + 4),
+            LoadPerfectSquareLK(positionBuffer, endpointsBuffer + s + 8),
+            LoadPerfectSquareLK(positionBuffer, endpointsBuffer + s + 12));
+
+        __m512 const lk_vel = MakeVector_AVX512(
+            LoadPerfectSquareLK(velocityBuffer, endpointsBuffer + s),
+            LoadPerfectSquareLK(velocityBuffer, endpointsBuffer + s + 4),
+            LoadPerfectSquareLK(velocityBuffer, endpointsBuffer + s + 8),
+            LoadPerfectSquareLK(velocityBuffer, endpointsBuffer + s + 12));
+
+        CalculateSpringForces_AVX512(
+            _mm512_sub_ps(lk_pos, jm_pos), // s0 s1 | s4 s5 | ...
+            _mm512_sub_ps(_mm512_shuffle_ps(lk_pos, lk_pos, _MM_SHUFFLE(1, 0, 3, 2)), jm_pos), // s2 s3 | s6 s7 | ...
+            _mm512_sub_ps(lk_vel, jm_vel),
+            _mm512_sub_ps(_mm512_shuffle_ps(lk_vel, lk_vel, _MM_SHUFFLE(1, 0, 3, 2)), jm_vel),
+            input,
+            s,
+            forceX,
+            forceY);
+
+        for (size_t sq = 0; sq < 16; sq += 4)
+        {
+            AddPerfectSquareForces(endpointsBuffer + s + sq, forceX + sq, forceY + sq, dynamicForceBuffer);
+        }
+    }
+
+    //
+    // 2. Remaining sixteen-by-sixteen's
+    //
+
+    for (; s + 16 <= endSpringIndex; s += 16)
+    {
+        CalculateSpringForces_AVX512(
+            MakeVector_AVX512(
+                LoadSpringVectorPair(positionBuffer, endpointsBuffer + s),
+                LoadSpringVectorPair(positionBuffer, endpointsBuffer + s + 4),
+                LoadSpringVectorPair(positionBuffer, endpointsBuffer + s + 8),
+                LoadSpringVectorPair(positionBuffer, endpointsBuffer + s + 12)),
+            MakeVector_AVX512(
+                LoadSpringVectorPair(positionBuffer, endpointsBuffer + s + 2),
+                LoadSpringVectorPair(positionBuffer, endpointsBuffer + s + 6),
+                LoadSpringVectorPair(positionBuffer, endpointsBuffer + s + 10),
+                LoadSpringVectorPair(positionBuffer, endpointsBuffer + s + 14)),
+            MakeVector_AVX512(
+                LoadSpringVectorPair(velocityBuffer, endpointsBuffer + s),
+                LoadSpringVectorPair(velocityBuffer, endpointsBuffer + s + 4),
+                LoadSpringVectorPair(velocityBuffer, endpointsBuffer + s + 8),
+                LoadSpringVectorPair(velocityBuffer, endpointsBuffer + s + 12)),
+            MakeVector_AVX512(
+                LoadSpringVectorPair(velocityBuffer, endpointsBuffer + s + 2),
+                LoadSpringVectorPair(velocityBuffer, endpointsBuffer + s + 6),
+                LoadSpringVectorPair(velocityBuffer, endpointsBuffer + s + 10),
+                LoadSpringVectorPair(velocityBuffer, endpointsBuffer + s + 14)),
+            input,
+            s,
+            forceX,
+            forceY);
+
+        AddSpringForces(16, endpointsBuffer + s, forceX, forceY, dynamicForceBuffer);
+    }
+
+    //
+    // 3. One-by-one
+    //
+
+    for (; s < endSpringIndex; ++s)
+    {
+        ApplySpringForces(input, s, dynamicForceBuffer);
+    }
+}
+
+FS_TARGET_AVX512 void IntegrateAndResetDynamicForces_AVX512(
+    DynamicForcesIntegrationInput const & input,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
+{
+    assert(input.DynamicForceBufferCount >= 1);
+    assert(((endPointIndex - startPointIndex) % 4) == 0);
+
+    __m512 const dt_16 = _mm512_set1_ps(input.Dt);
+    __m512 const velocityFactor_16 = _mm512_set1_ps(input.VelocityFactor);
+
+    size_t i = startPointIndex * 2; // Two components per vector
+    for (; i + 16 <= endPointIndex * 2; i += 16)
+    {
+        __m512 springForce = _mm512_loadu_ps(input.DynamicForceBuffers[0] + i);
+        for (size_t b = 1; b < input.DynamicForceBufferCount; ++b)
+        {
+            springForce = _mm512_add_ps(springForce, _mm512_loadu_ps(input.DynamicForceBuffers[b] + i));
+        }
+
+        __m512 const deltaPos = _mm512_fmadd_ps(
+            _mm512_loadu_ps(input.VelocityBuffer + i),
+            dt_16,
+            _mm512_mul_ps(
+                _mm512_add_ps(springForce, _mm512_loadu_ps(input.StaticForceBuffer + i)),
+                _mm512_loadu_ps(input.IntegrationFactorBuffer + i)));
+
+        _mm512_storeu_ps(input.PositionBuffer + i, _mm512_add_ps(_mm512_loadu_ps(input.PositionBuffer + i), deltaPos));
+        _mm512_storeu_ps(input.VelocityBuffer + i, _mm512_mul_ps(deltaPos, velocityFactor_16));
+
+        // Zero out spring forces now that we've integrated them
+        for (size_t b = 0; b < input.DynamicForceBufferCount; ++b)
+        {
+            _mm512_storeu_ps(input.DynamicForceBuffers[b] + i, _mm512_setzero_ps());
+        }
+    }
+
+    // Ranges are multiples of four points, hence we might have eight floats left
+    if (i < endPointIndex * 2)
+    {
+        IntegrateAndResetEightDynamicForces_AVX2(input, i);
+    }
+}
+
+#endif
+
+}
+}
@@ -0,0 +1,107 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-16
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "Physics.h"
+
+#include <GameCore/GameTypes.h>
+#include <GameCore/SysSpecifics.h>
+#include <GameCore/Vectors.h>
+
+#include <cstddef>
+
+namespace Physics {
+
+/*
+ * The vectorized kernels of the spring relaxation algorithm, one variant per
+ * instruction set; the caller is responsible for picking the variant supported
+ * by the CPU (see GetSimdInstructionSet()).
+ *
+ * The variants do not produce identical results: spring lengths and directions are
+ * calculated with the hardware's reciprocal square root and reciprocal approximations,
+ * which have 12 bits of precision in the SSE and AVX2 variants, and 14 bits in the
+ * AVX-512 variant, while the springs that are not vectorized (at the edges of each
+ * range) use exact square roots and divisions. Spring forces may thus differ between
+ * variants - and from exact ones - by up to about 0.1% of the stiffness force of the
+ * spring at its current length.
+ */
+namespace SpringRelaxationKernels {
+
+struct SpringForcesInput
+{
+    vec2f const * PositionBuffer;
+    vec2f const * VelocityBuffer;
+    Springs::Endpoints const * EndpointsBuffer;
+    float const * RestLengthBuffer;
+    float const * StiffnessCoefficientBuffer;
+    float const * DampingCoefficientBuffer;
+    ElementCount PerfectSquareCount; // Perfect squares are the first PerfectSquareCount * 4 springs
+};
+
+struct DynamicForcesIntegrationInput
+{
+    float * PositionBuffer;
+    float * VelocityBuffer;
+    float const * StaticForceBuffer;
+    float const * IntegrationFactorBuffer;
+    float * const * DynamicForceBuffers;
+    size_t DynamicForceBufferCount;
+    float Dt;
+    float VelocityFactor;
+};
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+/*
+ * Calculates the forces of the springs in [startSpringIndex, endSpringIndex), adding them
+ * to the dynamic force buffer. When starting within the perfect squares, startSpringIndex
+ * must be at a perfect square boundary.
+ */
+
+void ApplySpringsForces_SSE(
+    SpringForcesInput const & input,
+    ElementIndex startSpringIndex,
+    ElementIndex endSpringIndex,
+    vec2f * restrict dynamicForceBuffer);
+
+void ApplySpringsForces_AVX2(
+    SpringForcesInput const & input,
+    ElementIndex startSpringIndex,
+    ElementIndex endSpringIndex,
+    vec2f * restrict dynamicForceBuffer);
+
+void ApplySpringsForces_AVX512(
+    SpringForcesInput const & input,
+    ElementIndex startSpringIndex,
+    ElementIndex endSpringIndex,
+    vec2f * restrict dynamicForceBuffer);
+
+/*
+ * Integrates the points in [startPointIndex, endPointIndex) with the sum of all the dynamic
+ * force buffers, and zeroes the latter. The number of points must be a multiple of
+ * the vectorization word size.
+ */
+
+void IntegrateAndResetDynamicForces_SSE(
+    DynamicForcesIntegrationInput const & input,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex);
+
+void IntegrateAndResetDynamicForces_AVX2(
+    DynamicForcesIntegrationInput const & input,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex);
+
+void IntegrateAndResetDynamicForces_AVX512(
+    DynamicForcesIntegrationInput const & input,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex);
+
+#endif
+
+}
+
+}
@@ -0,0 +1,424 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-17
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "SpringStrainKernels.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace Physics {
+namespace SpringStrainKernels {
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+static_assert(sizeof(Springs::Endpoints) == 2 * sizeof(ElementIndex));
+static_assert(sizeof(bool) == 1);
+
+namespace {
+
+    //
+    // Acts on the strain of a (non-deleted) spring, given its length
+    //
+    inline void ApplyStrain(
+        ElementIndex s,
+        float length,
+        float restLength,
+        Springs::StrainState & strainState,
+        Springs::StrainCalculationResults & results)
+    {
+        float const absStrain = std::abs(length - restLength);
+
+        // Check against breaking elongation
+        float const breakingElongation = strainState.BreakingElongation;
+        if (absStrain > breakingElongation)
+        {
+            // It's broken! We'll destroy it later
+            results.BrokenSprings.push_back(s);
+            return;
+        }
+
+        results.MaxSpringLength = std::max(results.MaxSpringLength, length);
+
+        if (strainState.IsStressed)
+        {
+            // Stressed spring...
+            // ...see if should un-stress it
+
+            if (absStrain < Springs::StrainState::StrainLowWatermark * breakingElongation)
+            {
+                // It's not stressed anymore
+                strainState.IsStressed = false;
+            }
+        }
+        else
+        {
+            // Not stressed spring
+            // ...see if should stress it
+
+            if (absStrain > strainState.StrainThresholdFraction * breakingElongation)
+            {
+                // It's stressed! We'll notify it later
+                strainState.IsStressed = true;
+                results.NewlyStressedSprings.push_back(s);
+            }
+        }
+    }
+
+    inline void CalculateStrain(
+        StrainCalculationInput const & input,
+        ElementIndex s,
+        Springs::StrainState * restrict strainStateBuffer,
+        Springs::StrainCalculationResults & results)
+    {
+        // Avoid breaking deleted springs
+        if (!input.IsDeletedBuffer[s])
+        {
+            float const length = (
+                input.PositionBuffer[input.EndpointsBuffer[s].PointBIndex]
+                - input.PositionBuffer[input.EndpointsBuffer[s].PointAIndex]).length();
+
+            ApplyStrain(s, length, input.RestLengthBuffer[s], strainStateBuffer[s], results);
+        }
+    }
+
+    //
+    // Visits one-by-one the springs at s whose bits are set in the mask, given their lengths
+    //
+    inline void ApplyStrainsOneByOne(
+        StrainCalculationInput const & input,
+        ElementIndex s,
+        int visitMask,
+        float const * springLengths,
+        Springs::StrainState * restrict strainStateBuffer,
+        Springs::StrainCalculationResults & results)
+    {
+        for (ElementIndex i = 0; visitMask != 0; ++i, visitMask >>= 1)
+        {
+            if (visitMask & 1)
+            {
+                ApplyStrain(s + i, springLengths[i], input.RestLengthBuffer[s + i], strainStateBuffer[s + i], results);
+            }
+        }
+    }
+
+    // Loads the differences (B - A) of two springs' endpoint positions, the first spring going low
+    inline __m128 LoadSpringVectorPair(
+        vec2f const * restrict buffer,
+        Springs::Endpoints const * endpoints)
+    {
+        __m128 const pointA = _mm_loadh_pi(
+            _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const *>(buffer + endpoints[0].PointAIndex))),
+            reinterpret_cast<__m64 const *>(buffer + endpoints[1].PointAIndex));
+
+        __m128 const pointB = _mm_loadh_pi(
+            _mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const *>(buffer + endpoints[0].PointBIndex))),
+            reinterpret_cast<__m64 const *>(buffer + endpoints[1].PointBIndex));
+
+        return _mm_sub_ps(pointB, pointA);
+    }
+
+    // Loads four bools as four 32-bit integers
+    inline __m128i LoadFourBools(bool const * buffer)
+    {
+        std::int32_t fourBools;
+        std::memcpy(&fourBools, buffer, sizeof(fourBools));
+
+        __m128i const Zero = _mm_setzero_si128();
+        return _mm_unpacklo_epi16(
+            _mm_unpacklo_epi8(_mm_cvtsi32_si128(fourBools), Zero),
+            Zero);
+    }
+}
+
+///////////////////////////////////////////////////////////////
+// SSE
+///////////////////////////////////////////////////////////////
+
+void CalculateStrains_SSE(
+    StrainCalculationInput const & input,
+    ElementIndex startSpringIndex,
+    ElementIndex endSpringIndex,
+    Springs::StrainState * restrict strainStateBuffer,
+    Springs::StrainCalculationResults & results)
+{
+    results.BrokenSprings.clear();
+    results.NewlyStressedSprings.clear();
+    results.MaxSpringLength = 0.0f;
+
+    ElementIndex s = startSpringIndex;
+
+    //
+    // 1. One-by-one up to the next four-aligned spring
+    //
+
+    ElementCount const endSpringIndexUnaligned = std::min(endSpringIndex, make_aligned_float_element_count(s));
+
+    for (; s < endSpringIndexUnaligned; ++s)
+    {
+        CalculateStrain(input, s, strainStateBuffer, results);
+    }
+
+    //
+    // 2. Four-by-four
+    //
+
+    __m128 const AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    __m128 const StrainLowWatermark = _mm_set1_ps(Springs::StrainState::StrainLowWatermark);
+
+    __m128 maxSpringLength = _mm_setzero_ps();
+
+    ElementCount const endSpringIndexVectorized = std::max(s, endSpringIndex - (endSpringIndex % 4));
+
+    for (; s < endSpringIndexVectorized; s += 4)
+    {
+        //
+        // Lengths
+        //
+
+        __m128 const s0s1_dis_xy = LoadSpringVectorPair(input.PositionBuffer, input.EndpointsBuffer + s);
+        __m128 const s2s3_dis_xy = LoadSpringVectorPair(input.PositionBuffer, input.EndpointsBuffer + s + 2);
+
+        __m128 const dis_x = _mm_shuffle_ps(s0s1_dis_xy, s2s3_dis_xy, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 const dis_y = _mm_shuffle_ps(s0s1_dis_xy, s2s3_dis_xy, _MM_SHUFFLE(3, 1, 3, 1));
+
+        __m128 const springLength = _mm_sqrt_ps(
+            _mm_add_ps(
+                _mm_mul_ps(dis_x, dis_x),
+                _mm_mul_ps(dis_y, dis_y)));
+
+        //
+        // Strains
+        //
+
+        __m128 const absStrain = _mm_and_ps(
+            _mm_sub_ps(springLength, _mm_loadu_ps(input.RestLengthBuffer + s)),
+            AbsMask);
+
+        __m128 const breakingElongation = _mm_setr_ps(
+            strainStateBuffer[s + 0].BreakingElongation,
+            strainStateBuffer[s + 1].BreakingElongation,
+            strainStateBuffer[s + 2].BreakingElongation,
+            strainStateBuffer[s + 3].BreakingElongation);
+
+        __m128 const strainThresholdFraction = _mm_setr_ps(
+            strainStateBuffer[s + 0].StrainThresholdFraction,
+            strainStateBuffer[s + 1].StrainThresholdFraction,
+            strainStateBuffer[s + 2].StrainThresholdFraction,
+            strainStateBuffer[s + 3].StrainThresholdFraction);
+
+        __m128 const isStressedMask = _mm_castsi128_ps(_mm_cmpgt_epi32(
+            _mm_setr_epi32(
+                strainStateBuffer[s + 0].IsStressed,
+                strainStateBuffer[s + 1].IsStressed,
+                strainStateBuffer[s + 2].IsStressed,
+                strainStateBuffer[s + 3].IsStressed),
+            _mm_setzero_si128()));
+
+        __m128 const isDeletedMask = _mm_castsi128_ps(_mm_cmpgt_epi32(
+            LoadFourBools(input.IsDeletedBuffer + s),
+            _mm_setzero_si128()));
+
+        //
+        // Stress: springs that break, or whose stress state changes, are visited one-by-one
+        //
+
+        __m128 const isBrokenMask = _mm_cmpgt_ps(absStrain, breakingElongation);
+
+        __m128 const isStressChangedMask = _mm_or_ps(
+            _mm_and_ps(isStressedMask, _mm_cmplt_ps(absStrain, _mm_mul_ps(StrainLowWatermark, breakingElongation))),
+            _mm_andnot_ps(isStressedMask, _mm_cmpgt_ps(absStrain, _mm_mul_ps(strainThresholdFraction, breakingElongation))));
+
+        int const visitMask = _mm_movemask_ps(
+            _mm_andnot_ps(
+                isDeletedMask,
+                _mm_or_ps(isBrokenMask, isStressChangedMask)));
+
+        maxSpringLength = _mm_max_ps(
+            _mm_andnot_ps(_mm_or_ps(isDeletedMask, isBrokenMask), springLength),
+            maxSpringLength);
+
+        if (visitMask != 0)
+        {
+            aligned_to_vword float springLengths[4];
+            _mm_store_ps(springLengths, springLength);
+
+            ApplyStrainsOneByOne(input, s, visitMask, springLengths, strainStateBuffer, results);
+        }
+    }
+
+    aligned_to_vword float maxSpringLengths[4];
+    _mm_store_ps(maxSpringLengths, maxSpringLength);
+    results.MaxSpringLength = std::max(
+        results.MaxSpringLength,
+        *std::max_element(maxSpringLengths, maxSpringLengths + 4));
+
+    //
+    // 3. Remaining one-by-one's
+    //
+
+    for (; s < endSpringIndex; ++s)
+    {
+        CalculateStrain(input, s, strainStateBuffer, results);
+    }
+}
+
+///////////////////////////////////////////////////////////////
+// AVX2
+///////////////////////////////////////////////////////////////
+
+FS_TARGET_AVX2 void CalculateStrains_AVX2(
+    StrainCalculationInput const & input,
+    ElementIndex startSpringIndex,
+    ElementIndex endSpringIndex,
+    Springs::StrainState * restrict strainStateBuffer,
+    Springs::StrainCalculationResults & results)
+{
+    results.BrokenSprings.clear();
+    results.NewlyStressedSprings.clear();
+    results.MaxSpringLength = 0.0f;
+
+    ElementIndex s = startSpringIndex;
+
+    //
+    // 1. One-by-one up to the next four-aligned spring
+    //
+
+    ElementCount const endSpringIndexUnaligned = std::min(endSpringIndex, make_aligned_float_element_count(s));
+
+    for (; s < endSpringIndexUnaligned; ++s)
+    {
+        CalculateStrain(input, s, strainStateBuffer, results);
+    }
+
+    //
+    // 2. Eight-by-eight
+    //
+
+    __m256 const AbsMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    __m256 const StrainLowWatermark = _mm256_set1_ps(Springs::StrainState::StrainLowWatermark);
+
+    // The strain state fields of eight consecutive springs, in floats
+    static_assert(sizeof(Springs::StrainState) == 3 * sizeof(float));
+    __m256i const StrainStateIndices = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+
+    __m256 maxSpringLength = _mm256_setzero_ps();
+
+    ElementCount const endSpringIndexVectorized = std::max(s, endSpringIndex - ((endSpringIndex - s) % 8));
+
+    for (; s < endSpringIndexVectorized; s += 8)
+    {
+        //
+        // Lengths
+        //
+        // Springs are in the following order in each 128-bit lane:
+        //  lo: s+0 s+1 | s+4 s+5
+        //  hi: s+2 s+3 | s+6 s+7
+        // hence de-interleaving them within lanes yields the springs in order
+        //
+
+        __m256 const dis_lo = _mm256_insertf128_ps(
+            _mm256_castps128_ps256(LoadSpringVectorPair(input.PositionBuffer, input.EndpointsBuffer + s)),
+            LoadSpringVectorPair(input.PositionBuffer, input.EndpointsBuffer + s + 4),
+            1);
+
+        __m256 const dis_hi = _mm256_insertf128_ps(
+            _mm256_castps128_ps256(LoadSpringVectorPair(input.PositionBuffer, input.EndpointsBuffer + s + 2)),
+            LoadSpringVectorPair(input.PositionBuffer, input.EndpointsBuffer + s + 6),
+            1);
+
+        __m256 const dis_x = _mm256_shuffle_ps(dis_lo, dis_hi, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 const dis_y = _mm256_shuffle_ps(dis_lo, dis_hi, _MM_SHUFFLE(3, 1, 3, 1));
+
+        __m256 const springLength = _mm256_sqrt_ps(
+            _mm256_add_ps(
+                _mm256_mul_ps(dis_x, dis_x),
+                _mm256_mul_ps(dis_y, dis_y)));
+
+        //
+        // Strains
+        //
+
+        __m256 const absStrain = _mm256_and_ps(
+            _mm256_sub_ps(springLength, _mm256_loadu_ps(input.RestLengthBuffer + s)),
+            AbsMask);
+
+        __m256 const breakingElongation = _mm256_i32gather_ps(
+            &(strainStateBuffer[s].BreakingElongation),
+            StrainStateIndices,
+            sizeof(float));
+
+        __m256 const strainThresholdFraction = _mm256_i32gather_ps(
+            &(strainStateBuffer[s].StrainThresholdFraction),
+            StrainStateIndices,
+            sizeof(float));
+
+        __m256 const isStressedMask = _mm256_castsi256_ps(_mm256_cmpgt_epi32(
+            _mm256_setr_epi32(
+                strainStateBuffer[s + 0].IsStressed,
+                strainStateBuffer[s + 1].IsStressed,
+                strainStateBuffer[s + 2].IsStressed,
+                strainStateBuffer[s + 3].IsStressed,
+                strainStateBuffer[s + 4].IsStressed,
+                strainStateBuffer[s + 5].IsStressed,
+                strainStateBuffer[s + 6].IsStressed,
+                strainStateBuffer[s + 7].IsStressed),
+            _mm256_setzero_si256()));
+
+        __m256 const isDeletedMask = _mm256_castsi256_ps(_mm256_cmpgt_epi32(
+            _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(input.IsDeletedBuffer + s))),
+            _mm256_setzero_si256()));
+
+        //
+        // Stress: springs that break, or whose stress state changes, are visited one-by-one
+        //
+
+        __m256 const isBrokenMask = _mm256_cmp_ps(absStrain, breakingElongation, _CMP_GT_OQ);
+
+        __m256 const isStressChangedMask = _mm256_blendv_ps(
+            _mm256_cmp_ps(absStrain, _mm256_mul_ps(strainThresholdFraction, breakingElongation), _CMP_GT_OQ),
+            _mm256_cmp_ps(absStrain, _mm256_mul_ps(StrainLowWatermark, breakingElongation), _CMP_LT_OQ),
+            isStressedMask);
+
+        int const visitMask = _mm256_movemask_ps(
+            _mm256_andnot_ps(
+                isDeletedMask,
+                _mm256_or_ps(isBrokenMask, isStressChangedMask)));
+
+        maxSpringLength = _mm256_max_ps(
+            _mm256_andnot_ps(_mm256_or_ps(isDeletedMask, isBrokenMask), springLength),
+            maxSpringLength);
+
+        if (visitMask != 0)
+        {
+            alignas(32) float springLengths[8];
+            _mm256_store_ps(springLengths, springLength);
+
+            ApplyStrainsOneByOne(input, s, visitMask, springLengths, strainStateBuffer, results);
+        }
+    }
+
+    alignas(32) float maxSpringLengths[8];
+    _mm256_store_ps(maxSpringLengths, maxSpringLength);
+    results.MaxSpringLength = std::max(
+        results.MaxSpringLength,
+        *std::max_element(maxSpringLengths, maxSpringLengths + 8));
+
+    //
+    // 3. Remaining one-by-one's
+    //
+
+    for (; s < endSpringIndex; ++s)
+    {
+        CalculateStrain(input, s, strainStateBuffer, results);
+    }
+}
+
+#endif
+
+}
+}
@@ -0,0 +1,62 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-17
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "Physics.h"
+
+#include <GameCore/GameTypes.h>
+#include <GameCore/SysSpecifics.h>
+#include <GameCore/Vectors.h>
+
+namespace Physics {
+
+/*
+ * The vectorized kernels of the spring strain calculation run by Springs::CalculateStrains(),
+ * one variant per instruction set; the caller is responsible for picking the variant supported
+ * by the CPU (see GetSimdInstructionSet()).
+ *
+ * Lengths, strains and the changes of stress state are calculated one vectorization word at
+ * a time, with exact square roots; only the few springs whose state changes - or which break -
+ * are then visited one-by-one, so that the results are appended in spring index order.
+ * All variants thus take the same decisions as the scalar calculation, except - because of
+ * rounding - for springs whose strain is at a threshold.
+ */
+namespace SpringStrainKernels {
+
+struct StrainCalculationInput
+{
+    vec2f const * PositionBuffer;
+    Springs::Endpoints const * EndpointsBuffer;
+    bool const * IsDeletedBuffer;
+    float const * RestLengthBuffer;
+};
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+/*
+ * Calculates the strains of the springs in [startSpringIndex, endSpringIndex), updating their
+ * stress state and storing the broken and newly-stressed springs into the results.
+ */
+
+void CalculateStrains_SSE(
+    StrainCalculationInput const & input,
+    ElementIndex startSpringIndex,
+    ElementIndex endSpringIndex,
+    Springs::StrainState * restrict strainStateBuffer,
+    Springs::StrainCalculationResults & results);
+
+void CalculateStrains_AVX2(
+    StrainCalculationInput const & input,
+    ElementIndex startSpringIndex,
+    ElementIndex endSpringIndex,
+    Springs::StrainState * restrict strainStateBuffer,
+    Springs::StrainCalculationResults & results);
+
+#endif
+
+}
+
+}
@@ -5,6 +5,10 @@
  ***************************************************************************************/
 #include "Physics.h"
 
+#include "SpringStrainKernels.h"
+
+#include <GameCore/SysSpecifics.h>
+
 #include <cmath>
 
 namespace Physics {
@@ -178,94 +182,46 @@ void Springs::UpdateForGameParameters(
     }
 }
 
-void Springs::UploadElements(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    // Either upload all springs, or just the edge springs
-    bool const doUploadAllSprings =
-        DebugShipRenderModeType::Springs == renderContext.GetDebugShipRenderMode();
-
-    // Ropes are uploaded as springs only if DebugRenderMode is springs or edge springs
-    bool const doUploadRopesAsSprings =
-        DebugShipRenderModeType::Springs == renderContext.GetDebugShipRenderMode()
-        || DebugShipRenderModeType::EdgeSprings == renderContext.GetDebugShipRenderMode();
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
 
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+// Detected once, at startup
+static SimdInstructionSet const SimdInstructionSetInUse = GetSimdInstructionSet();
 
-    for (ElementIndex i : *this)
-    {
-        // Only upload non-deleted springs that are not covered by two super-triangles, unless
-        // we are in springs render mode
-        if (!mIsDeletedBuffer[i])
-        {
-            if (IsRope(i) && !doUploadRopesAsSprings)
-            {
-                shipRenderContext.UploadElementRope(
-                    GetEndpointAIndex(i),
-                    GetEndpointBIndex(i));
-            }
-            else if (
-                mCoveringTrianglesCountBuffer[i] < 2
-                || doUploadAllSprings
-                || IsRope(i))
-            {
-                shipRenderContext.UploadElementSpring(
-                    GetEndpointAIndex(i),
-                    GetEndpointBIndex(i));
-            }
-        }
-    }
-}
-
-void Springs::UploadStressedSpringElements(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
+void Springs::CalculateStrains(
+    ElementIndex startSpringIndex,
+    ElementIndex endSpringIndex,
+    Points const & points,
+    StrainCalculationResults & results)
 {
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
+    SpringStrainKernels::StrainCalculationInput const input{
+        points.GetPositionBufferAsVec2(),
+        mEndpointsBuffer.data(),
+        mIsDeletedBuffer.data(),
+        mRestLengthBuffer.data() };
 
-    for (ElementIndex i : *this)
+    if (SimdInstructionSetInUse == SimdInstructionSet::SSE)
     {
-        if (!mIsDeletedBuffer[i])
-        {
-            if (mStrainStateBuffer[i].IsStressed)
-            {
-                shipRenderContext.UploadElementStressedSpring(
-                    GetEndpointAIndex(i),
-                    GetEndpointBIndex(i));
-            }
-        }
-    }
-}
-
-void Springs::UpdateForStrains(
-    GameParameters const & gameParameters,
-    Points & points,
-    StressRenderModeType stressRenderMode)
-{
-    if (stressRenderMode == StressRenderModeType::None)
-    {
-        InternalUpdateForStrains<false>(gameParameters, points);
+        SpringStrainKernels::CalculateStrains_SSE(input, startSpringIndex, endSpringIndex, mStrainStateBuffer.data(), results);
     }
     else
     {
-        InternalUpdateForStrains<true>(gameParameters, points);
+        SpringStrainKernels::CalculateStrains_AVX2(input, startSpringIndex, endSpringIndex, mStrainStateBuffer.data(), results);
     }
 }
 
-////////////////////////////////////////////////////////////////////
+#else
 
-template<bool DoUpdateStress>
-void Springs::InternalUpdateForStrains(
-    GameParameters const & gameParameters,
-    Points & points)
+void Springs::CalculateStrains(
+    ElementIndex startSpringIndex,
+    ElementIndex endSpringIndex,
+    Points const & points,
+    StrainCalculationResults & results)
 {
-    float constexpr StrainLowWatermark = 0.08f; // Less than this multiplier to become non-stressed
-
-    OceanSurface const & oceanSurface = mParentWorld.GetOceanSurface();
+    results.BrokenSprings.clear();
+    results.NewlyStressedSprings.clear();
+    results.MaxSpringLength = 0.0f;
 
-    // Visit all springs
-    for (ElementIndex s : *this)
+    for (ElementIndex s = startSpringIndex; s < endSpringIndex; ++s)
     {
         // Avoid breaking deleted springs
         if (!mIsDeletedBuffer[s])
@@ -273,16 +229,68 @@ void Springs::InternalUpdateForStrains(
             auto & strainState = mStrainStateBuffer[s];
 
             // Calculate strain
-            float const strain = GetLength(s, points) - mRestLengthBuffer[s];
-            float const absStrain = std::abs(strain);
+            float const length = GetLength(s, points);
+            float const absStrain = std::abs(length - mRestLengthBuffer[s]);
 
             // Check against breaking elongation
             float const breakingElongation = strainState.BreakingElongation;
             if (absStrain > breakingElongation)
             {
-                // It's broken!
+                // It's broken! We'll destroy it later
+                results.BrokenSprings.push_back(s);
+                continue;
+            }
+
+            results.MaxSpringLength = std::max(results.MaxSpringLength, length);
+
+            if (strainState.IsStressed)
+            {
+                // Stressed spring...
+                // ...see if should un-stress it
+
+                if (absStrain < StrainState::StrainLowWatermark * breakingElongation)
+                {
+                    // It's not stressed anymore
+                    strainState.IsStressed = false;
+                }
+            }
+            else
+            {
+                // Not stressed spring
+                // ...see if should stress it
+
+                if (absStrain > strainState.StrainThresholdFraction * breakingElongation)
+                {
+                    // It's stressed! We'll notify it later
+                    strainState.IsStressed = true;
+                    results.NewlyStressedSprings.push_back(s);
+                }
+            }
+        }
+    }
+}
 
-                // Destroy this spring
+#endif
+
+void Springs::ApplyStrains(
+    std::vector<StrainCalculationResults> const & strainCalculationResults,
+    GameParameters const & gameParameters,
+    Points & points,
+    StressRenderModeType stressRenderMode)
+{
+    OceanSurface const & oceanSurface = mParentWorld.GetOceanSurface();
+
+    //
+    // Break springs
+    //
+
+    for (auto const & results : strainCalculationResults)
+    {
+        for (ElementIndex const s : results.BrokenSprings)
+        {
+            // Destroying a spring might have destroyed others
+            if (!mIsDeletedBuffer[s])
+            {
                 this->Destroy(
                     s,
                     DestroyOptions::FireBreakEvent // Notify Break
@@ -290,55 +298,52 @@ void Springs::InternalUpdateForStrains(
                     gameParameters,
                     points);
             }
-            else
+        }
+    }
+
+    //
+    // Notify stress
+    //
+
+    for (auto const & results : strainCalculationResults)
+    {
+        for (ElementIndex const s : results.NewlyStressedSprings)
+        {
+            if (!mIsDeletedBuffer[s])
             {
-                if (strainState.IsStressed)
-                {
-                    // Stressed spring...
-                    // ...see if should un-stress it
-
-                    if (absStrain < StrainLowWatermark * breakingElongation)
-                    {
-                        // It's not stressed anymore
-                        strainState.IsStressed = false;
-                    }
-                }
-                else
+                mGameEventHandler->OnStress(
+                    GetBaseStructuralMaterial(s),
+                    oceanSurface.IsUnderwater(GetEndpointAPosition(s, points)), // Arbitrary
+                    1);
+            }
+        }
+    }
+
+    //
+    // Update stress
+    //
+
+    if (stressRenderMode != StressRenderModeType::None)
+    {
+        for (ElementIndex s : *this)
+        {
+            if (!mIsDeletedBuffer[s])
+            {
+                float const strain = GetLength(s, points) - mRestLengthBuffer[s];
+                float const stress = strain / mStrainStateBuffer[s].BreakingElongation; // Between -1.0 and +1.0
+
+                if (std::abs(stress) > std::abs(points.GetStress(GetEndpointAIndex(s))))
                 {
-                    // Not stressed spring
-                    // ...see if should stress it
-
-                    if (absStrain > strainState.StrainThresholdFraction * breakingElongation)
-                    {
-                        // It's stressed!
-                        strainState.IsStressed = true;
-
-                        // Notify stress
-                        mGameEventHandler->OnStress(
-                            GetBaseStructuralMaterial(s),
-                            oceanSurface.IsUnderwater(GetEndpointAPosition(s, points)), // Arbitrary
-                            1);
-                    }
+                    points.SetStress(
+                        GetEndpointAIndex(s),
+                        stress);
                 }
 
-                // Update stress
-                if constexpr (DoUpdateStress)
+                if (std::abs(stress) > std::abs(points.GetStress(GetEndpointBIndex(s))))
                 {
-                    float const stress = strain / breakingElongation; // Between -1.0 and +1.0
-                    
-                    if (std::abs(stress) > std::abs(points.GetStress(GetEndpointAIndex(s))))
-                    {
-                        points.SetStress(
-                            GetEndpointAIndex(s),
-                            stress);
-                    }
-
-                    if (std::abs(stress) > std::abs(points.GetStress(GetEndpointBIndex(s))))
-                    {
-                        points.SetStress(
-                            GetEndpointBIndex(s),
-                            stress);
-                    }
+                    points.SetStress(
+                        GetEndpointBIndex(s),
+                        stress);
                 }
             }
         }
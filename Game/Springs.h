@@ -19,6 +19,7 @@
 #include <cassert>
 #include <functional>
 #include <limits>
+#include <vector>
 
 namespace Physics
 {
@@ -100,8 +101,12 @@ private:
         {}
     };
 
+public:
+
     struct StrainState
     {
+        static float constexpr StrainLowWatermark = 0.08f; // Less than this fraction of BreakingElongation to become non-stressed
+
         float BreakingElongation; // Max length delta (compressed or stretched) after which the spring break
         float StrainThresholdFraction; // Fraction of BreakingElongation after which the spring becomes strained
         bool IsStressed; // When true, the spring is stressed - used to apply hi/lo watermark to stress state
@@ -116,16 +121,24 @@ private:
         {}
     };
 
-public:
+    // The springs found by a strain calculation, each in increasing index order
+    struct StrainCalculationResults
+    {
+        std::vector<ElementIndex> BrokenSprings;
+        std::vector<ElementIndex> NewlyStressedSprings;
+        float MaxSpringLength; // Length of the longest spring that has not broken
+    };
 
     Springs(
         ElementCount elementCount,
         ElementCount perfectSquareCount,
+        std::vector<ElementCount> && colorEnds,
         World & parentWorld,
         std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
         GameParameters const & gameParameters)
         : ElementContainer(elementCount)
         , mPerfectSquareCount(perfectSquareCount)
+        , mColorEnds(std::move(colorEnds))
         //////////////////////////////////
         // Buffers
         //////////////////////////////////
@@ -233,10 +246,25 @@ public:
     }
 
     /*
-     * Calculates the current strain - due to tension or compression - and acts depending on it,
-     * eventually breaking springs.
+     * Calculates the current strain - due to tension or compression - of the springs in the
+     * specified range, updating their stressed state and collecting the springs that have broken
+     * and the springs that have become stressed.
+     *
+     * Only modifies the springs in the range, hence it may run concurrently on disjoint ranges.
      */
-    void UpdateForStrains(
+    void CalculateStrains(
+        ElementIndex startSpringIndex,
+        ElementIndex endSpringIndex,
+        Points const & points,
+        StrainCalculationResults & results);
+
+    /*
+     * Acts on the results of CalculateStrains() - which are expected to be in increasing spring index
+     * order - breaking springs and firing stress events in spring index order; also updates
+     * the stress of points when a stress render mode is active.
+     */
+    void ApplyStrains(
+        std::vector<StrainCalculationResults> const & strainCalculationResults,
         GameParameters const & gameParameters,
         Points & points,
         StressRenderModeType stressRenderMode);
@@ -260,6 +288,15 @@ public:
         return mPerfectSquareCount;
     }
 
+    /*
+     * Returns the (exclusive) end index of each color, i.e. of each contiguous range of springs
+     * that do not share any endpoints; empty when the springs have not been colored.
+     */
+    std::vector<ElementCount> const & GetColorEnds() const
+    {
+        return mColorEnds;
+    }
+
     //
     // IsDeleted
     //
@@ -269,6 +306,11 @@ public:
         return mIsDeletedBuffer[springElementIndex];
     }
 
+    bool const * GetIsDeletedBuffer() const noexcept
+    {
+        return mIsDeletedBuffer.data();
+    }
+
     //
     // Endpoints
     //
@@ -471,11 +513,21 @@ public:
             .length();
     }
 
+    bool IsStressed(ElementIndex springElementIndex) const
+    {
+        return mStrainStateBuffer[springElementIndex].IsStressed;
+    }
+
     float GetFactoryRestLength(ElementIndex springElementIndex) const
     {
         return mFactoryRestLengthBuffer[springElementIndex];
     }
 
+    float const * GetFactoryRestLengthBuffer() const noexcept
+    {
+        return mFactoryRestLengthBuffer.data();
+    }
+
     float GetRestLength(ElementIndex springElementIndex) const noexcept
     {
         return mRestLengthBuffer[springElementIndex];
@@ -561,6 +613,11 @@ public:
         mWaterPermeabilityBuffer[springElementIndex] = value;
     }
 
+    float const * GetWaterPermeabilityBuffer() const noexcept
+    {
+        return mWaterPermeabilityBuffer.data();
+    }
+
     //
     // Heat
     //
@@ -570,6 +627,11 @@ public:
         return mMaterialThermalConductivityBuffer[springElementIndex];
     }
 
+    float const * GetMaterialThermalConductivityBuffer() const noexcept
+    {
+        return mMaterialThermalConductivityBuffer.data();
+    }
+
     //
     // Temporary buffer
     //
@@ -586,11 +648,6 @@ public:
 
 private:
 
-    template<bool DoUpdateStress>
-    inline void InternalUpdateForStrains(
-        GameParameters const & gameParameters,
-        Points & points);
-
     void UpdateCoefficientsForPartition(
         ElementIndex partition,
         ElementIndex partitionCount,
@@ -612,6 +669,8 @@ private:
 
     ElementCount const mPerfectSquareCount;
 
+    std::vector<ElementCount> const mColorEnds;
+
     //////////////////////////////////////////////////////////
     // Buffers
     //////////////////////////////////////////////////////////
@@ -79,26 +79,6 @@ void Stars::Update(
     }
 }
 
-void Stars::Upload(Render::RenderContext & renderContext) const
-{
-    if (mStarCountDirtyForRendering.has_value())
-    {
-        assert(*mStarCountDirtyForRendering <= mStars.size());
-
-        renderContext.UploadStarsStart(*mStarCountDirtyForRendering, mStars.size());
-
-        for (size_t s = 0; s < *mStarCountDirtyForRendering; ++s)
-        {
-            auto const & star = mStars[s];
-            renderContext.UploadStar(s, star.PositionNdc, star.Brightness);
-        }
-
-        renderContext.UploadStarsEnd();
-
-        mStarCountDirtyForRendering.reset();
-    }
-}
-
 //////////////////////////////////////////////////////////////////////////////
 
 void Stars::RegenerateStars(unsigned int numberOfStars)
@@ -321,27 +321,6 @@ void Storm::Update(
     mLastStormUpdateTimestamp = now;
 }
 
-void Storm::Upload(Render::RenderContext & renderContext) const
-{
-	//
-    // Upload ambient darkening
-	//
-
-    renderContext.UploadStormAmbientDarkening(mParameters.AmbientDarkening);
-
-	//
-	// Upload rain
-	//
-
-	renderContext.UploadRain(mParameters.RainDensity);
-
-	//
-	// Upload lightnings
-	//
-
-	UploadLightnings(renderContext);
-}
-
 void Storm::TriggerStorm()
 {
     if (!!mNextStormTimestamp)
@@ -592,43 +571,4 @@ void Storm::UpdateLightnings(
 	}
 }
 
-void Storm::UploadLightnings(Render::RenderContext & renderContext) const
-{
-	renderContext.UploadLightningsStart(mLightnings.size());
-
-	for (auto const & l : mLightnings)
-	{
-		switch (l.Type)
-		{
-			case LightningStateMachine::LightningType::Background:
-			{
-				assert(!!(l.NdcX));
-
-				renderContext.UploadBackgroundLightning(
-					*(l.NdcX),
-					l.Progress,
-					l.RenderProgress,
-					l.PersonalitySeed);
-
-				break;
-			}
-
-			case LightningStateMachine::LightningType::Foreground:
-			{
-				assert(!!(l.TargetWorldPosition));
-
-				renderContext.UploadForegroundLightning(
-					*(l.TargetWorldPosition),
-					l.Progress,
-					l.RenderProgress,
-					l.PersonalitySeed);
-
-				break;
-			}
-		}
-	}
-
-	renderContext.UploadLightningsEnd();
-}
-
 }
\ No newline at end of file
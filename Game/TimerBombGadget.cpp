@@ -265,120 +265,6 @@ void TimerBombGadget::OnNeighborhoodDisturbed()
     }
 }
 
-void TimerBombGadget::Upload(
-    ShipId shipId,
-    Render::RenderContext & renderContext) const
-{
-    auto & shipRenderContext = renderContext.GetShipRenderContext(shipId);
-
-    switch (mState)
-    {
-        case State::SlowFuseBurning:
-        case State::FastFuseBurning:
-        {
-            // Render bomb
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::TimerBomb, mFuseStepCounter / FuseFramesPerFuseLengthCount),
-                GetPosition(),
-                1.0,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            // Render fuse
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::TimerBombFuse, mFuseFlameFrameIndex),
-                GetPosition(),
-                1.0,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            break;
-        }
-
-        case State::DetonationLeadIn:
-        {
-            static constexpr float ShakeOffset = 0.3f;
-            vec2f shakenPosition =
-                GetPosition()
-                + (0 == (mDetonationLeadInShapeFrameCounter % 2)
-                    ? vec2f(-ShakeOffset, 0.0f)
-                    : vec2f(ShakeOffset, 0.0f));
-
-            // Render bomb
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::TimerBomb, FuseLengthStepCount),
-                shakenPosition,
-                1.0,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            break;
-        }
-
-        case State::Defusing:
-        {
-            // Render bomb
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::TimerBomb, mFuseStepCounter / FuseFramesPerFuseLengthCount),
-                GetPosition(),
-                1.0f,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            break;
-        }
-
-        case State::Defused:
-        {
-            // Render inert bomb
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                GetPlaneId(),
-                TextureFrameId(Render::GenericMipMappedTextureGroups::TimerBomb, mFuseStepCounter / FuseFramesPerFuseLengthCount),
-                GetPosition(),
-                1.0f,
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f);
-
-            break;
-        }
-
-        case State::Exploding:
-        {
-            // Calculate current progress
-            float const progress =
-                static_cast<float>(mExplosionFadeoutCounter + 1)
-                / static_cast<float>(ExplosionFadeoutStepsCount);
-
-            // Render disappearing bomb
-            shipRenderContext.UploadGenericMipMappedTextureRenderSpecification(
-                mExplosionPlaneId,
-                TextureFrameId(Render::GenericMipMappedTextureGroups::TimerBomb, mFuseStepCounter / FuseFramesPerFuseLengthCount),
-                mExplosionPosition,
-                1.0f, // Scale
-                GetRotationBaseAxis(),
-                GetRotationOffsetAxis(),
-                1.0f - progress);  // Alpha
-
-            break;
-        }
-
-        case State::Expired:
-        {
-            // No drawing
-            break;
-        }
-    }
-}
-
 void TimerBombGadget::TransitionToFastFusing(GameWallClock::time_point currentWallClockTime)
 {
     mState = State::FastFuseBurning;
@@ -63,9 +63,9 @@ public:
 
     virtual void OnNeighborhoodDisturbed() override;
 
-    virtual void Upload(
+    void Upload(
         ShipId shipId,
-        Render::RenderContext & renderContext) const override;
+        Render::RenderContext & renderContext) const;
 
 private:
 
@@ -0,0 +1,337 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-17
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "WaterFlowKernels.h"
+
+#include <GameCore/GameMath.h>
+#include <GameCore/SysSpecifics.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+
+namespace Physics {
+namespace WaterFlowKernels {
+
+float CalculateOutboundWaterFlows(
+    WaterFlowInput const & input,
+    WaterFlowOutput const & output,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
+{
+    vec2f const * restrict const positionBuffer = input.PositionBuffer;
+    float const * restrict const oldPointWaterBufferData = input.WaterBuffer;
+    vec2f const * restrict const oldPointWaterVelocityBufferData = input.WaterVelocityBuffer;
+    float * restrict const newPointWaterBufferData = output.NewWaterBuffer;
+    vec2f * restrict const newPointWaterMomentumBufferData = output.WaterMomentumBuffer;
+    float * restrict const springOutboundWaterQuantityBufferData = output.SpringOutboundWaterQuantityBuffer;
+    vec2f * restrict const springOutboundWaterMomentumBufferData = output.SpringOutboundWaterMomentumBuffer;
+
+    // Weights of outbound water flows along each spring, including impermeable ones;
+    // set to zero for springs whose resultant scalar water velocities are
+    // directed towards the point being visited
+    std::array<float, GameParameters::MaxSpringsPerPoint> springOutboundWaterFlowWeights;
+
+    // Total weight
+    float totalOutboundWaterFlowWeight;
+
+    // Resultant water velocities along each spring
+    std::array<vec2f, GameParameters::MaxSpringsPerPoint> springOutboundWaterVelocities;
+
+    // Water splashed at the points we visit
+    float waterSplashed = 0.0f;
+
+    for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
+    {
+        //
+        // 1) Calculate water momenta along *all* springs connected to this point,
+        //    including impermeable ones - as we'll eventually bounce back along those
+        //
+
+        // A higher crazyness gives more emphasys to bernoulli's velocity, as if pressures
+        // and gravity were exaggerated
+        //
+        // WV[t] = WV[t-1] + alpha * Bernoulli
+        //
+        // WaterCrazyness=0   -> alpha=1
+        // WaterCrazyness=0.5 -> alpha=0.5 + 0.5*Wh
+        // WaterCrazyness=1   -> alpha=Wh
+        float const alphaCrazyness = 1.0f + input.WaterCrazyness * (oldPointWaterBufferData[pointIndex] - 1.0f);
+
+        // Count of non-hull free and drowned neighbor points
+        float pointSplashNeighbors = 0.0f;
+        float pointSplashFreeNeighbors = 0.0f;
+
+        totalOutboundWaterFlowWeight = 0.0f;
+
+        Points::ConnectedSpring const * const connectedSprings = input.ConnectedSpringsAdjacency + input.ConnectedSpringsAdjacencyRowBegins[pointIndex];
+        size_t const connectedSpringCount = input.ConnectedSpringsAdjacencyRowEnds[pointIndex] - input.ConnectedSpringsAdjacencyRowBegins[pointIndex];
+        assert(connectedSpringCount <= GameParameters::MaxSpringsPerPoint);
+        for (size_t s = 0; s < connectedSpringCount; ++s)
+        {
+            auto const & cs = connectedSprings[s];
+
+            // Normalized spring vector, oriented point -> other endpoint
+            vec2f const springNormalizedVector = (positionBuffer[cs.OtherEndpointIndex] - positionBuffer[pointIndex]).normalise_approx();
+
+            // Component of the point's own water velocity along the spring
+            float const pointWaterVelocityAlongSpring =
+                oldPointWaterVelocityBufferData[pointIndex]
+                .dot(springNormalizedVector);
+
+            //
+            // Calulate Bernoulli's velocity gained along this spring, from this point to
+            // the other endpoint
+            //
+
+            // Pressure difference (positive implies point -> other endpoint flow)
+            float const dw = oldPointWaterBufferData[pointIndex] - oldPointWaterBufferData[cs.OtherEndpointIndex];
+
+            // Gravity potential difference (positive implies point -> other endpoint flow)
+            float const dy = positionBuffer[pointIndex].y - positionBuffer[cs.OtherEndpointIndex].y;
+
+            // Calculate gained water velocity along this spring, from point to other endpoint
+            // (Bernoulli, 1738)
+            float bernoulliVelocityAlongSpring;
+            float const dwy = dw + dy;
+            if (dwy >= 0.0f)
+            {
+                // Gained velocity goes from point to other endpoint
+                bernoulliVelocityAlongSpring = sqrtf(2.0f * GameParameters::GravityMagnitude * dwy);
+            }
+            else
+            {
+                // Gained velocity goes from other endpoint to point
+                bernoulliVelocityAlongSpring = -sqrtf(2.0f * GameParameters::GravityMagnitude * -dwy);
+            }
+
+            // Resultant scalar velocity along spring; outbound only, as
+            // if this were inbound it wouldn't result in any movement of the point's
+            // water between these two springs. Morevoer, Bernoulli's velocity injected
+            // along this spring will be picked up later also by the other endpoint,
+            // and at that time it would move water if it agrees with its velocity
+            float const springOutboundScalarWaterVelocity = std::max(
+                pointWaterVelocityAlongSpring + bernoulliVelocityAlongSpring * alphaCrazyness,
+                0.0f);
+
+            // Store weight along spring, scaling for the greater distance traveled along
+            // diagonal springs
+            springOutboundWaterFlowWeights[s] =
+                springOutboundScalarWaterVelocity
+                / input.SpringFactoryRestLengthBuffer[cs.SpringIndex];
+
+            // Resultant outbound velocity along spring
+            springOutboundWaterVelocities[s] =
+                springNormalizedVector
+                * springOutboundScalarWaterVelocity;
+
+            // Update total outbound flow weight
+            totalOutboundWaterFlowWeight += springOutboundWaterFlowWeights[s];
+
+            //
+            // Update splash neighbors counts
+            //
+
+            // How much the other endpoint's quantity of water "suppresses" splashes from
+            // adjacent kinetic energy losses:
+            //  1.0f: point has no water
+            //  0.0f: point has water
+            float const otherEndpointFreenessFactor = FastExp(-oldPointWaterBufferData[cs.OtherEndpointIndex] * 10.0f);
+
+            pointSplashFreeNeighbors +=
+                input.SpringWaterPermeabilityBuffer[cs.SpringIndex]
+                * otherEndpointFreenessFactor;
+
+            pointSplashNeighbors += input.SpringWaterPermeabilityBuffer[cs.SpringIndex];
+        }
+
+        //
+        // 2) Calculate normalization factor for water flows:
+        //    the quantity of water along a spring is proportional to the weight of the spring
+        //    (resultant velocity along that spring), and the sum of all outbound water flows must
+        //    match the water currently at the point times the water speed fraction and the adjustment
+        //
+
+        assert(totalOutboundWaterFlowWeight >= 0.0f);
+
+        float waterQuantityNormalizationFactor = 0.0f;
+        if (totalOutboundWaterFlowWeight != 0.0f)
+        {
+            waterQuantityNormalizationFactor =
+                oldPointWaterBufferData[pointIndex]
+                * input.MaterialWaterDiffusionSpeedBuffer[pointIndex] * input.WaterDiffusionSpeedAdjustment
+                / totalOutboundWaterFlowWeight;
+        }
+
+        //
+        // 3) Move water along all springs according to their flows, removing it - and
+        //    its momentum - from this point; the other endpoints will gather it in the
+        //    second pass
+        //
+
+        // Kinetic energy lost at this point
+        float pointKineticEnergyLoss = 0.0f;
+
+        // Start from the point's current water
+        newPointWaterBufferData[pointIndex] = oldPointWaterBufferData[pointIndex];
+
+        for (size_t s = 0; s < connectedSpringCount; ++s)
+        {
+            auto const & cs = connectedSprings[s];
+
+            // Our slot for this spring
+            size_t const springOutboundSlot =
+                static_cast<size_t>(cs.SpringIndex) * 2
+                + (input.SpringEndpointsBuffer[cs.SpringIndex].PointAIndex == pointIndex ? 0 : 1);
+
+            // Calculate quantity of water directed outwards
+            float const springOutboundQuantityOfWater =
+                springOutboundWaterFlowWeights[s]
+                * waterQuantityNormalizationFactor;
+
+            assert(springOutboundQuantityOfWater >= 0.0f);
+
+            if (input.SpringWaterPermeabilityBuffer[cs.SpringIndex] != 0.0f)
+            {
+                //
+                // Water - and momentum - move from point to endpoint
+                //
+
+                // Move water quantity
+                newPointWaterBufferData[pointIndex] -= springOutboundQuantityOfWater;
+                springOutboundWaterQuantityBufferData[springOutboundSlot] = springOutboundQuantityOfWater;
+
+                // Remove "old momentum" (old velocity) from point
+                newPointWaterMomentumBufferData[pointIndex] -=
+                    oldPointWaterVelocityBufferData[pointIndex]
+                    * springOutboundQuantityOfWater;
+
+                // Add "new momentum" (old velocity + velocity gained) to other endpoint
+                springOutboundWaterMomentumBufferData[springOutboundSlot] =
+                    springOutboundWaterVelocities[s]
+                    * springOutboundQuantityOfWater;
+
+
+                //
+                // Update point's kinetic energy loss:
+                // splintered water colliding with whole other endpoint
+                //
+
+                // FUTURE: get rid of this re-calculation once we pre-calculate all spring normalized vectors
+                vec2f const springNormalizedVector = (positionBuffer[cs.OtherEndpointIndex] - positionBuffer[pointIndex]).normalise_approx();
+
+                float ma = springOutboundQuantityOfWater;
+                float va = springOutboundWaterVelocities[s].length();
+                float mb = oldPointWaterBufferData[cs.OtherEndpointIndex];
+                float vb = oldPointWaterVelocityBufferData[cs.OtherEndpointIndex].dot(springNormalizedVector);
+
+                float vf = 0.0f;
+                if (ma + mb != 0.0f)
+                    vf = (ma * va + mb * vb) / (ma + mb);
+
+                float deltaKa =
+                    0.5f
+                    * ma
+                    * (va * va - vf * vf);
+
+                // Note: deltaKa might be negative, in which case deltaKb would have been
+                // more positive (perfectly inelastic -> deltaK == max); we will pickup
+                // deltaKb later
+                pointKineticEnergyLoss += std::max(deltaKa, 0.0f);
+            }
+            else
+            {
+                // Wall hit
+
+                // Note: deleted springs are removed from points' connected springs
+
+                //
+                // New momentum (old velocity + velocity gained) bounces back
+                // (and zeroes outgoing), assuming perfectly inelastic collision
+                //
+                // No changes to other endpoint
+                //
+
+                newPointWaterMomentumBufferData[pointIndex] -=
+                    springOutboundWaterVelocities[s]
+                    * springOutboundQuantityOfWater;
+
+                springOutboundWaterQuantityBufferData[springOutboundSlot] = 0.0f;
+                springOutboundWaterMomentumBufferData[springOutboundSlot] = vec2f::zero();
+
+
+                //
+                // Update point's kinetic energy loss:
+                // entire splintered water
+                //
+
+                float ma = springOutboundQuantityOfWater;
+                float va = springOutboundWaterVelocities[s].length();
+
+                float deltaKa =
+                    0.5f
+                    * ma
+                    * va * va;
+
+                assert(deltaKa >= 0.0f);
+                pointKineticEnergyLoss += deltaKa;
+            }
+        }
+
+        //
+        // 4) Update water splash
+        //
+
+        if (pointSplashNeighbors != 0.0f)
+        {
+            // Water splashed is proportional to kinetic energy loss that took
+            // place near free points (i.e. not drowned by water)
+            waterSplashed +=
+                pointKineticEnergyLoss
+                * pointSplashFreeNeighbors
+                / pointSplashNeighbors;
+        }
+    }
+
+    return waterSplashed;
+}
+
+void GatherInboundWaterFlows(
+    WaterFlowInput const & input,
+    WaterFlowOutput const & output,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
+{
+    float * restrict const newPointWaterBufferData = output.NewWaterBuffer;
+    vec2f * restrict const newPointWaterMomentumBufferData = output.WaterMomentumBuffer;
+    float const * restrict const springOutboundWaterQuantityBufferData = output.SpringOutboundWaterQuantityBuffer;
+    vec2f const * restrict const springOutboundWaterMomentumBufferData = output.SpringOutboundWaterMomentumBuffer;
+
+    for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
+    {
+        float inboundQuantityOfWater = 0.0f;
+        vec2f inboundWaterMomentum = vec2f::zero();
+
+        for (ElementIndex c = input.ConnectedSpringsAdjacencyRowBegins[pointIndex]; c < input.ConnectedSpringsAdjacencyRowEnds[pointIndex]; ++c)
+        {
+            auto const & cs = input.ConnectedSpringsAdjacency[c];
+
+            // The other endpoint's slot for this spring
+            size_t const springInboundSlot =
+                static_cast<size_t>(cs.SpringIndex) * 2
+                + (input.SpringEndpointsBuffer[cs.SpringIndex].PointAIndex == pointIndex ? 1 : 0);
+
+            inboundQuantityOfWater += springOutboundWaterQuantityBufferData[springInboundSlot];
+            inboundWaterMomentum += springOutboundWaterMomentumBufferData[springInboundSlot];
+        }
+
+        newPointWaterBufferData[pointIndex] += inboundQuantityOfWater;
+        newPointWaterMomentumBufferData[pointIndex] += inboundWaterMomentum;
+    }
+}
+
+}
+}
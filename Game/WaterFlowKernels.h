@@ -0,0 +1,74 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-17
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "Physics.h"
+
+#include <GameCore/GameTypes.h>
+#include <GameCore/Vectors.h>
+
+namespace Physics {
+
+/*
+ * The two passes of the water flow algorithm run by Ship::UpdateWaterVelocities(), on plain
+ * buffers. Each pass only writes the state of the points it visits, hence both may be run
+ * concurrently on disjoint ranges of points - as long as all ranges have gone through the
+ * first pass before any goes through the second one.
+ *
+ * The passes move the same quantities of water and momentum as visiting each point and
+ * scattering its outbound flows directly into the other endpoints, except for the order
+ * in which the flows are summed at each point.
+ */
+namespace WaterFlowKernels {
+
+struct WaterFlowInput
+{
+    vec2f const * PositionBuffer;
+    float const * WaterBuffer;
+    vec2f const * WaterVelocityBuffer;
+    float const * MaterialWaterDiffusionSpeedBuffer;
+    Points::ConnectedSpring const * ConnectedSpringsAdjacency; // The springs of point p are [RowBegins[p], RowEnds[p])
+    ElementIndex const * ConnectedSpringsAdjacencyRowBegins;
+    ElementIndex const * ConnectedSpringsAdjacencyRowEnds;
+    Springs::Endpoints const * SpringEndpointsBuffer;
+    float const * SpringFactoryRestLengthBuffer;
+    float const * SpringWaterPermeabilityBuffer;
+    float WaterCrazyness;
+    float WaterDiffusionSpeedAdjustment;
+};
+
+struct WaterFlowOutput
+{
+    float * NewWaterBuffer;
+    vec2f * WaterMomentumBuffer; // Expected to contain the points' current water momenta
+    float * SpringOutboundWaterQuantityBuffer; // Two slots per spring: spring index * 2, + 1 for endpoint B
+    vec2f * SpringOutboundWaterMomentumBuffer; // Same slots as above
+};
+
+/*
+ * First pass: calculates the outbound flows of the points in [startPointIndex, endPointIndex)
+ * along their springs, removing them from the points and storing them in the points' slots
+ * of their springs. Returns the water splashed at the visited points.
+ */
+float CalculateOutboundWaterFlows(
+    WaterFlowInput const & input,
+    WaterFlowOutput const & output,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex);
+
+/*
+ * Second pass: adds to the points in [startPointIndex, endPointIndex) the inbound flows
+ * stored by their springs' other endpoints.
+ */
+void GatherInboundWaterFlows(
+    WaterFlowInput const & input,
+    WaterFlowOutput const & output,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex);
+
+}
+
+}
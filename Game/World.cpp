@@ -5,13 +5,27 @@
  ***************************************************************************************/
 #include "Physics.h"
 
+#include <GameCore/GameException.h>
 #include <GameCore/GameRandomEngine.h>
+#include <GameCore/GameWallClock.h>
 
 #include <algorithm>
 #include <cassert>
 
 namespace Physics {
 
+namespace {
+
+    void CheckDeterministicRunClock(GameParameters const & gameParameters)
+    {
+        // A deterministic run needs a clock that only moves with the simulation
+        if (gameParameters.DoRunDeterministically && !GameWallClock::GetInstance().IsSimulated())
+        {
+            throw GameException("A deterministic simulation requires the game wall clock to be simulated");
+        }
+    }
+}
+
 World::World(
     OceanFloorTerrain && oceanFloorTerrain,
     bool areCloudShadowsEnabled,
@@ -34,13 +48,20 @@ World::World(
     , mFishes(fishSpeciesDatabase, mGameEventHandler)
     //
     , mAllAABBs()
+    , mShipAABBSets()
+    , mShipInteractionsMutex()
 {
+    // World pieces take the time at creation, hence the clock must have been switched by now
+    CheckDeterministicRunClock(gameParameters);
+
     // Initialize world pieces that need to be initialized now
     mStars.Update(mCurrentSimulationTime, gameParameters);
     mStorm.Update(mCurrentSimulationTime, gameParameters);
     mWind.Update(mStorm.GetParameters(), gameParameters);
     mClouds.Update(mCurrentSimulationTime, mWind.GetBaseAndStormSpeedMagnitude(), mStorm.GetParameters(), gameParameters);
+    mOceanSurface.BeginUpdate();
     mOceanSurface.Update(mCurrentSimulationTime, mWind, gameParameters);
+    mOceanSurface.EndUpdate();
     mOceanFloor.Update(gameParameters);
 }
 
@@ -102,6 +123,17 @@ size_t World::GetShipCount() const
     return mAllShips.size();
 }
 
+std::uint64_t World::CalculateStateHash() const
+{
+    std::uint64_t hash = 0;
+    for (auto const & ship : mAllShips)
+    {
+        hash = (hash * 1099511628211ull) ^ ship->CalculateStateHash();
+    }
+
+    return hash;
+}
+
 size_t World::GetShipPointCount(ShipId shipId) const
 {
     assert(shipId >= 0 && shipId < mAllShips.size());
@@ -750,13 +782,35 @@ void World::AdjustOceanSurfaceTo(
         worldRadius);
 }
 
+void World::SetOceanFloorTerrain(OceanFloorTerrain const & oceanFloorTerrain)
+{
+    mOceanFloor.SetTerrain(oceanFloorTerrain);
+
+    // Ships resting on the ocean floor need to notice it has changed
+    for (auto & ship : mAllShips)
+    {
+        ship->WakeUp();
+    }
+}
+
 std::optional<bool> World::AdjustOceanFloorTo(
     float x1,
     float targetY1,
     float x2,
     float targetY2)
 {
-    return mOceanFloor.AdjustTo(x1, targetY1, x2, targetY2);
+    auto const result = mOceanFloor.AdjustTo(x1, targetY1, x2, targetY2);
+
+    if (result.has_value() && *result)
+    {
+        // Ships resting on the ocean floor need to notice it has changed
+        for (auto & ship : mAllShips)
+        {
+            ship->WakeUp();
+        }
+    }
+
+    return result;
 }
 
 bool World::ScrubThrough(
@@ -998,9 +1052,20 @@ void World::Update(
     ThreadManager & threadManager,
     PerfStats & perfStats)
 {
+    // The parameters may have been changed since the world was created
+    CheckDeterministicRunClock(gameParameters);
+
     // Update current time
     mCurrentSimulationTime += GameParameters::SimulationStepTimeDuration<float>;
 
+    // A simulated wall clock only moves with the simulation
+    if (GameWallClock::GetInstance().IsSimulated())
+    {
+        GameWallClock::GetInstance().Advance(
+            std::chrono::duration_cast<GameWallClock::duration>(
+                std::chrono::duration<float>(GameParameters::SimulationStepTimeDuration<float>)));
+    }
+
     // Prepare all AABBs
     mAllAABBs.Clear();
 
@@ -1016,77 +1081,152 @@ void World::Update(
 
     mClouds.Update(mCurrentSimulationTime, mWind.GetBaseAndStormSpeedMagnitude(), mStorm.GetParameters(), gameParameters);
 
-    mOceanSurface.Update(mCurrentSimulationTime, mWind, gameParameters);
+    //
+    // The ocean surface only depends on displacements from the previous step,
+    // hence we may update it concurrently with ships - which then see the
+    // surface from the previous step
+    //
 
-    mOceanFloor.Update(gameParameters);
+    mOceanSurface.BeginUpdate();
 
-    for (auto & ship : mAllShips)
+    auto const updateOceanSurface = [&]()
     {
-        ship->Update(
-            mCurrentSimulationTime,
-            mStorm.GetParameters(),
-            gameParameters,
-            stressRenderMode,
-            mAllAABBs,
-            threadManager,
-            perfStats);
+        auto const startTime = std::chrono::steady_clock::now();
+
+        mOceanSurface.Update(mCurrentSimulationTime, mWind, gameParameters);
+
+        perfStats.TotalOceanSurfaceUpdateDuration.Update(std::chrono::steady_clock::now() - startTime);
+    };
+
+    bool const doUpdateOceanSurfaceConcurrently =
+        gameParameters.DoUpdateOceanSurfaceConcurrently
+        && !gameParameters.DoRunDeterministically
+        && threadManager.GetSimulationParallelism() > 1;
+
+    if (!doUpdateOceanSurfaceConcurrently)
+    {
+        updateOceanSurface();
+
+        mOceanSurface.EndUpdate();
     }
 
+    mOceanFloor.Update(gameParameters);
+
     {
         auto const startTime = std::chrono::steady_clock::now();
 
-        mFishes.Update(mCurrentSimulationTime, mOceanSurface, mOceanFloor, gameParameters, visibleWorld, mAllAABBs);
+        bool const doUpdateShipsConcurrently =
+            gameParameters.DoUpdateShipsConcurrently
+            && !gameParameters.DoRunDeterministically
+            && mAllShips.size() > 1
+            && threadManager.GetSimulationParallelism() > 1;
 
-        perfStats.TotalFishUpdateDuration.Update(std::chrono::steady_clock::now() - startTime);
-    }
-}
+        if (doUpdateShipsConcurrently || doUpdateOceanSurfaceConcurrently)
+        {
+            //
+            // Run concurrent jobs: either one job for each ship, or one job for all ships,
+            // and - if requested - one job for the ocean surface. Ship jobs get a share of
+            // the simulation threads for their own parallel tasks, while the ocean surface
+            // job is light and only needs its own thread.
+            //
 
-void World::RenderUpload(
-    GameParameters const & gameParameters,
-    Render::RenderContext & renderContext,
-    PerfStats & /*perfStats*/)
-{
-    mStars.Upload(renderContext);
+            size_t const shipJobCount = doUpdateShipsConcurrently ? mAllShips.size() : 1;
+            size_t const oceanSurfaceJobCount = doUpdateOceanSurfaceConcurrently ? 1 : 0;
 
-    mWind.Upload(renderContext);
+            auto & jobThreadPools = threadManager.GetSimulationJobThreadPools(
+                shipJobCount + oceanSurfaceJobCount,
+                oceanSurfaceJobCount);
 
-    mStorm.Upload(renderContext);
+            mShipAABBSets.resize(mAllShips.size());
 
-    mClouds.Upload(renderContext);
+            std::vector<ThreadPool::Task> jobTasks;
+            jobTasks.reserve(shipJobCount + oceanSurfaceJobCount);
 
-    mOceanFloor.Upload(gameParameters, renderContext);
+            for (size_t s = 0; s < mAllShips.size(); ++s)
+            {
+                mShipAABBSets[s].Clear();
+            }
 
-    mOceanSurface.Upload(renderContext);
+            auto const updateShip = [&](size_t s, ThreadPool & shipThreadPool)
+            {
+                mAllShips[s]->Update(
+                    mCurrentSimulationTime,
+                    mStorm.GetParameters(),
+                    gameParameters,
+                    stressRenderMode,
+                    mShipAABBSets[s],
+                    shipThreadPool,
+                    perfStats);
+            };
+
+            if (doUpdateShipsConcurrently)
+            {
+                for (size_t s = 0; s < mAllShips.size(); ++s)
+                {
+                    jobTasks.emplace_back(
+                        [&, s]()
+                        {
+                            updateShip(s, *jobThreadPools[s]);
+                        });
+                }
+            }
+            else
+            {
+                jobTasks.emplace_back(
+                    [&]()
+                    {
+                        for (size_t s = 0; s < mAllShips.size(); ++s)
+                        {
+                            updateShip(s, *jobThreadPools[0]);
+                        }
+                    });
+            }
 
-    mFishes.Upload(renderContext);
+            if (doUpdateOceanSurfaceConcurrently)
+            {
+                jobTasks.emplace_back(updateOceanSurface);
+            }
 
-    // Ships
-    {
-        renderContext.UploadShipsStart();
+            threadManager.GetSimulationThreadPool().Run(jobTasks);
+
+            if (doUpdateOceanSurfaceConcurrently)
+            {
+                mOceanSurface.EndUpdate();
+            }
 
-        for (auto const & ship : mAllShips)
+            // Merge AABBs, in ship order
+            for (auto const & shipAABBSet : mShipAABBSets)
+            {
+                for (auto const & aabb : shipAABBSet.GetItems())
+                {
+                    mAllAABBs.Add(aabb);
+                }
+            }
+        }
+        else
         {
-            ship->RenderUpload(renderContext);
+            for (auto & ship : mAllShips)
+            {
+                ship->Update(
+                    mCurrentSimulationTime,
+                    mStorm.GetParameters(),
+                    gameParameters,
+                    stressRenderMode,
+                    mAllAABBs,
+                    threadManager.GetSimulationThreadPool(),
+                    perfStats);
+            }
         }
 
-        renderContext.UploadShipsEnd();
+        perfStats.TotalShipsUpdateDuration.Update(std::chrono::steady_clock::now() - startTime);
     }
 
-    // AABBs
-    if (renderContext.GetShowAABBs())
     {
-        renderContext.UploadAABBsStart(mAllAABBs.GetCount());
-
-        auto constexpr color = rgbaColor(18, 8, 255, 255).toVec4f();
+        auto const startTime = std::chrono::steady_clock::now();
 
-        for (auto const & aabb : mAllAABBs.GetItems())
-        {
-            renderContext.UploadAABB(
-                aabb,
-                color);
-        }
+        mFishes.Update(mCurrentSimulationTime, mOceanSurface, mOceanFloor, gameParameters, visibleWorld, mAllAABBs);
 
-        renderContext.UploadAABBsEnd();
+        perfStats.TotalFishUpdateDuration.Update(std::chrono::steady_clock::now() - startTime);
     }
 }
 
@@ -27,6 +27,7 @@
 #include <chrono>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <vector>
@@ -65,6 +66,12 @@ public:
 
     size_t GetShipCount() const;
 
+    /*
+     * Calculates a hash of the state of the simulation of all ships, for telling
+     * whether two deterministic runs have produced the same results.
+     */
+    std::uint64_t CalculateStateHash() const;
+
     size_t GetShipPointCount(ShipId shipId) const;
 
     Geometry::AABBSet GetAllAABBs() const
@@ -82,6 +89,8 @@ public:
         float fishScareRadius,
         std::chrono::milliseconds delay)
     {
+        std::scoped_lock const lock(mShipInteractionsMutex);
+
         mFishes.DisturbAt(
             position,
             fishScareRadius,
@@ -90,6 +99,8 @@ public:
 
     inline void DisturbOcean(std::chrono::milliseconds delay)
     {
+        std::scoped_lock const lock(mShipInteractionsMutex);
+
         mFishes.TriggerWidespreadPanic(delay);
     }
 
@@ -104,6 +115,8 @@ public:
         float x,
         float yOffset)
     {
+        std::scoped_lock const lock(mShipInteractionsMutex);
+
         mOceanSurface.DisplaceAt(x, yOffset);
     }
 
@@ -112,10 +125,7 @@ public:
         return mOceanFloor;
     }
 
-    inline void SetOceanFloorTerrain(OceanFloorTerrain const & oceanFloorTerrain)
-    {
-        mOceanFloor.SetTerrain(oceanFloorTerrain);
-    }
+    void SetOceanFloorTerrain(OceanFloorTerrain const & oceanFloorTerrain);
 
     inline OceanFloorTerrain const & GetOceanFloorTerrain() const
     {
@@ -394,6 +404,18 @@ private:
     // The set of all AABB's in the world, updated at each
     // simulation cycle and at each ship addition
     Geometry::AABBSet mAllAABBs;
+
+    //
+    // Concurrent ship updates
+    //
+
+    // The AABB's of each ship, populated independently by each ship
+    // and merged into mAllAABBs at the end of the ships' update
+    std::vector<Geometry::AABBSet> mShipAABBSets;
+
+    // Serializes the world modifications that ships may request
+    // while being updated concurrently
+    std::mutex mShipInteractionsMutex;
 };
 
 }
@@ -0,0 +1,551 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-17
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "Physics.h"
+
+#include "RenderContext.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace Physics {
+
+///////////////////////////////////////////////////////////////////////////////////
+// World
+///////////////////////////////////////////////////////////////////////////////////
+
+void World::RenderUpload(
+    GameParameters const & gameParameters,
+    Render::RenderContext & renderContext,
+    PerfStats & /*perfStats*/)
+{
+    mStars.Upload(renderContext);
+
+    mWind.Upload(renderContext);
+
+    mStorm.Upload(renderContext);
+
+    mClouds.Upload(renderContext);
+
+    mOceanFloor.Upload(gameParameters, renderContext);
+
+    mOceanSurface.Upload(renderContext);
+
+    mFishes.Upload(renderContext);
+
+    // Ships
+    {
+        renderContext.UploadShipsStart();
+
+        for (auto const & ship : mAllShips)
+        {
+            ship->RenderUpload(renderContext);
+        }
+
+        renderContext.UploadShipsEnd();
+    }
+
+    // AABBs
+    if (renderContext.GetShowAABBs())
+    {
+        renderContext.UploadAABBsStart(mAllAABBs.GetCount());
+
+        auto constexpr color = rgbaColor(18, 8, 255, 255).toVec4f();
+
+        for (auto const & aabb : mAllAABBs.GetItems())
+        {
+            renderContext.UploadAABB(
+                aabb,
+                color);
+        }
+
+        renderContext.UploadAABBsEnd();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// OceanSurface
+///////////////////////////////////////////////////////////////////////////////////
+
+// The number of slices we want to render the water surface as;
+// this is our graphical resolution
+template<typename T>
+T constexpr OceanSurfaceRenderSlices = 768;
+
+void OceanSurface::Upload(Render::RenderContext & renderContext) const
+{
+    switch (renderContext.GetOceanRenderDetail())
+    {
+        case OceanRenderDetailType::Basic:
+        {
+            InternalUpload<OceanRenderDetailType::Basic>(renderContext);
+
+            break;
+        }
+
+        case OceanRenderDetailType::Detailed:
+        {
+            InternalUpload<OceanRenderDetailType::Detailed>(renderContext);
+
+            break;
+        }
+    }
+}
+
+template<OceanRenderDetailType DetailType>
+void OceanSurface::InternalUpload(Render::RenderContext & renderContext) const
+{
+    static_assert(DetailType == OceanRenderDetailType::Basic || DetailType == OceanRenderDetailType::Detailed);
+
+    register_int constexpr DetailXOffsetSamples = 2; // # of (whole) samples that the detailed planes are offset by
+
+    float constexpr MidPlaneDamp = 0.8f;
+    float constexpr BackPlaneDamp = 0.45f;
+
+    //
+    // We want to upload at most OceanSurfaceRenderSlices slices
+    //
+
+    // Find index of leftmost sample, and its corresponding world X
+    auto const leftmostSampleIndex = FastTruncateToArchInt((renderContext.GetVisibleWorld().TopLeft.x + GameParameters::HalfMaxWorldWidth) / Dx);
+    float sampleIndexWorldX = -GameParameters::HalfMaxWorldWidth + (Dx * leftmostSampleIndex);
+
+    // Calculate number of samples required to cover screen from leftmost sample
+    // up to the visible world right (included)
+    float const coverageWorldWidth = renderContext.GetVisibleWorld().BottomRight.x - sampleIndexWorldX;
+    auto const numberOfSamplesToRender = static_cast<size_t>(ceil(coverageWorldWidth / Dx));
+
+    if (numberOfSamplesToRender >= OceanSurfaceRenderSlices<size_t>)
+    {
+        //
+        // Zoom out from afar: each slice encompasses more than 1 sample;
+        // we upload then OceanSurfaceRenderSlices slices, interpolating Y at each slice boundary
+        //
+
+        // Start uploading
+        if constexpr (DetailType == OceanRenderDetailType::Basic)
+            renderContext.UploadOceanBasicStart(OceanSurfaceRenderSlices<int>);
+        else
+            renderContext.UploadOceanDetailedStart(OceanSurfaceRenderSlices<int>);
+
+        // Calculate dx between each pair of slices we want to upload
+        float const sliceDx = coverageWorldWidth / OceanSurfaceRenderSlices<float>;
+
+        if constexpr (DetailType == OceanRenderDetailType::Basic)
+        {
+            for (size_t s = 0;
+                s <= OceanSurfaceRenderSlices<size_t>;
+                ++s, sampleIndexWorldX = std::min(sampleIndexWorldX + sliceDx, GameParameters::HalfMaxWorldWidth))
+            {
+                renderContext.UploadOceanBasic(
+                    sampleIndexWorldX,
+                    GetHeightAt(sampleIndexWorldX));
+            }
+        }
+        else
+        {
+            auto const getSampleAtX = [this](float sampleIndexWorldX)
+            {
+                //
+                // Split sample index X into index in sample array and fractional part
+                // between that sample and the next
+                //
+
+                assert(sampleIndexWorldX >= -GameParameters::HalfMaxWorldWidth
+                    && sampleIndexWorldX <= GameParameters::HalfMaxWorldWidth + 1.0f); // Allow for compounding inaccuracies
+
+                // Fractional index in the sample array
+                float const sampleIndexF = (sampleIndexWorldX + GameParameters::HalfMaxWorldWidth) / Dx;
+
+                // Integral part
+                auto const sampleIndexI = FastTruncateToArchInt(sampleIndexF);
+
+                // Fractional part within sample index and the next sample index
+                float const sampleIndexDx = sampleIndexF - sampleIndexI;
+
+                assert(sampleIndexI >= 0 && sampleIndexI <= static_cast<decltype(sampleIndexI)>(SamplesCount)); // Allow for compounding inaccuracies
+                assert(sampleIndexDx >= 0.0f && sampleIndexDx < 1.0f);
+
+                //
+                // Interpolate sample at sampleIndexX
+                //
+
+                float const sample =
+                    mSamples[sampleIndexI].SampleValue
+                    + mSamples[sampleIndexI].SampleValuePlusOneMinusSampleValue * sampleIndexDx;
+
+                return std::make_tuple(sample, sampleIndexI, sampleIndexDx);
+            };
+
+            // First step:
+            //  - previous, current = s[0]
+            auto [currentSample, currentSampleIndexI, currentSampleIndexDx] = getSampleAtX(sampleIndexWorldX);
+            float previousDerivative = 0.0f; // [0] - [-1]
+            float nextSample = 0.0f;
+
+            for (size_t s = 0; s < OceanSurfaceRenderSlices<size_t>; ++s)
+            {
+                //
+                // Interpolate back- and mid- samples at sampleIndeX minus offsets,
+                // re-using the fractional part that we've already calculated for sampleIndexX
+                //
+
+                auto const indexBack = std::max(currentSampleIndexI - DetailXOffsetSamples * 2, register_int(0));
+                float const sampleBack =
+                    mSamples[indexBack].SampleValue
+                    + mSamples[indexBack].SampleValuePlusOneMinusSampleValue * currentSampleIndexDx;
+
+                auto const indexMid = std::max(currentSampleIndexI - DetailXOffsetSamples, register_int(0));
+                float const sampleMid =
+                    mSamples[indexMid].SampleValue
+                    + mSamples[indexMid].SampleValuePlusOneMinusSampleValue * currentSampleIndexDx;
+
+                // Get next sample
+                float const nextSampleIndexWorldX = sampleIndexWorldX + sliceDx;
+                std::tie(nextSample, currentSampleIndexI, currentSampleIndexDx) = getSampleAtX(nextSampleIndexWorldX);
+
+                // Calculate second derivative
+                float const nextDerivative = nextSample - currentSample;
+                float const d2YFront = nextDerivative - previousDerivative;
+
+                // Upload
+                renderContext.UploadOceanDetailed(
+                    sampleIndexWorldX,
+                    sampleBack * BackPlaneDamp,
+                    sampleMid * MidPlaneDamp,
+                    currentSample,
+                    d2YFront);
+
+                // Advance
+                currentSample = nextSample;
+                previousDerivative = nextDerivative;
+                sampleIndexWorldX = nextSampleIndexWorldX;
+            }
+
+            // We do one extra iteration as the number of slices is the number of quads, and the last vertical
+            // quad side must be at the end of the width
+
+            auto const indexBack = std::max(currentSampleIndexI - DetailXOffsetSamples * 2, register_int(0));
+            float const sampleBack =
+                mSamples[indexBack].SampleValue
+                + mSamples[indexBack].SampleValuePlusOneMinusSampleValue * currentSampleIndexDx;
+
+            auto const indexMid = std::max(currentSampleIndexI - DetailXOffsetSamples, register_int(0));
+            float const sampleMid =
+                mSamples[indexMid].SampleValue
+                + mSamples[indexMid].SampleValuePlusOneMinusSampleValue * currentSampleIndexDx;
+
+            renderContext.UploadOceanDetailed(
+                sampleIndexWorldX,
+                sampleBack * BackPlaneDamp,
+                sampleMid * MidPlaneDamp,
+                currentSample,
+                -previousDerivative); // 0.0 - previousDerivative
+        }
+    }
+    else
+    {
+        //
+        // Zoom in: each sample encompasses multiple slices; we upload then just the
+        // required number of samples - using straight, whole samples - which is less
+        // than the max number of slices we're prepared to upload, and we let OpenGL
+        // interpolate on our behalf
+        //
+
+        if constexpr (DetailType == OceanRenderDetailType::Basic)
+            renderContext.UploadOceanBasicStart(numberOfSamplesToRender);
+        else
+            renderContext.UploadOceanDetailedStart(numberOfSamplesToRender);
+
+        // We do one extra iteration as the number of slices is the number of quads, and the last vertical
+        // quad side must be at the end of the width
+        for (size_t s = 0; s <= numberOfSamplesToRender; ++s, sampleIndexWorldX += Dx)
+        {
+            if constexpr (DetailType == OceanRenderDetailType::Basic)
+            {
+                renderContext.UploadOceanBasic(
+                    sampleIndexWorldX,
+                    mSamples[leftmostSampleIndex + static_cast<register_int>(s)].SampleValue);
+            }
+            else
+            {
+                renderContext.UploadOceanDetailed(
+                    sampleIndexWorldX,
+                    mSamples[std::max(leftmostSampleIndex + static_cast<register_int>(s) - DetailXOffsetSamples * 2, register_int(0))].SampleValue * BackPlaneDamp,
+                    mSamples[std::max(leftmostSampleIndex + static_cast<register_int>(s) - DetailXOffsetSamples, register_int(0))].SampleValue * MidPlaneDamp,
+                    mSamples[leftmostSampleIndex + static_cast<register_int>(s)].SampleValue,
+                    0.0f); // No need to worry with second derivative in zoom-in case
+            }
+        }
+    }
+
+    if constexpr (DetailType == OceanRenderDetailType::Basic)
+        renderContext.UploadOceanBasicEnd();
+    else
+        renderContext.UploadOceanDetailedEnd();
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// OceanFloor
+///////////////////////////////////////////////////////////////////////////////////
+
+// The number of slices we want to render the ocean floor as;
+// this is the graphical resolution
+template<typename T>
+T constexpr OceanFloorRenderSlices = 500;
+
+void OceanFloor::Upload(
+    GameParameters const & /*gameParameters*/,
+    Render::RenderContext & renderContext) const
+{
+    //
+    // We want to upload at most OceanFloorRenderSlices slices
+    //
+
+    // Find index of leftmost sample, and its corresponding world X
+    auto const sampleIndex = FastTruncateToArchInt((renderContext.GetVisibleWorld().TopLeft.x + GameParameters::HalfMaxWorldWidth) / Dx);
+    float sampleIndexX = -GameParameters::HalfMaxWorldWidth + (Dx * sampleIndex);
+
+    // Calculate number of samples required to cover screen from leftmost sample
+    // up to the visible world right (included)
+    float const coverageWidth = renderContext.GetVisibleWorld().BottomRight.x - sampleIndexX;
+    size_t const numberOfSamplesToRender = static_cast<size_t>(ceil(coverageWidth / Dx));
+
+    if (numberOfSamplesToRender >= OceanFloorRenderSlices<size_t>)
+    {
+        //
+        // Have to take more than 1 sample per slice
+        //
+
+        renderContext.UploadLandStart(OceanFloorRenderSlices<size_t>);
+
+        // Calculate dx between each pair of slices with want to upload
+        float const sliceDx = coverageWidth / OceanFloorRenderSlices<float>;
+
+        // We do one extra iteration as the number of slices is the number of quads, and the last vertical
+        // quad side must be at the end of the width
+        for (size_t s = 0;
+            s <= OceanFloorRenderSlices<size_t>;
+            ++s, sampleIndexX = std::min(sampleIndexX + sliceDx, GameParameters::HalfMaxWorldWidth))
+        {
+            renderContext.UploadLand(
+                sampleIndexX,
+                GetHeightAt(sampleIndexX));
+        }
+    }
+    else
+    {
+        //
+        // We just upload the required number of samples, which is less than
+        // the max number of slices we're prepared to upload, and we let OpenGL
+        // interpolate on our behalf
+        //
+
+        renderContext.UploadLandStart(numberOfSamplesToRender);
+
+        // We do one extra iteration as the number of slices is the number of quads, and the last vertical
+        // quad side must be at the end of the width
+        for (size_t s = 0; s <= numberOfSamplesToRender; ++s, sampleIndexX += Dx)
+        {
+            renderContext.UploadLand(
+                sampleIndexX,
+                mSamples[s + sampleIndex].SampleValue);
+        }
+    }
+
+    renderContext.UploadLandEnd();
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// Clouds
+///////////////////////////////////////////////////////////////////////////////////
+
+void Clouds::Upload(Render::RenderContext & renderContext) const
+{
+    //
+    // Upload clouds
+    //
+
+    renderContext.UploadCloudsStart(mClouds.size() + mStormClouds.size());
+
+    for (auto const & cloud : mClouds)
+    {
+        renderContext.UploadCloud(
+            cloud->Id,
+            cloud->X,
+            cloud->Y,
+            cloud->Z,
+            cloud->Scale,
+            cloud->Darkening,
+            cloud->GrowthProgress);
+    }
+
+    for (auto const & cloud : mStormClouds)
+    {
+        renderContext.UploadCloud(
+            cloud->Id,
+            cloud->X,
+            cloud->Y,
+            cloud->Z,
+            cloud->Scale,
+            cloud->Darkening,
+            cloud->GrowthProgress);
+    }
+
+    renderContext.UploadCloudsEnd();
+
+    //
+    // Upload shadows
+    //
+
+    if (mAreShadowsEnabled)
+    {
+        renderContext.UploadCloudShadows(
+            mShadowBuffer.data(),
+            mShadowBuffer.GetSize());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// Stars
+///////////////////////////////////////////////////////////////////////////////////
+
+void Stars::Upload(Render::RenderContext & renderContext) const
+{
+    if (mStarCountDirtyForRendering.has_value())
+    {
+        assert(*mStarCountDirtyForRendering <= mStars.size());
+
+        renderContext.UploadStarsStart(*mStarCountDirtyForRendering, mStars.size());
+
+        for (size_t s = 0; s < *mStarCountDirtyForRendering; ++s)
+        {
+            auto const & star = mStars[s];
+            renderContext.UploadStar(s, star.PositionNdc, star.Brightness);
+        }
+
+        renderContext.UploadStarsEnd();
+
+        mStarCountDirtyForRendering.reset();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// Storm
+///////////////////////////////////////////////////////////////////////////////////
+
+void Storm::Upload(Render::RenderContext & renderContext) const
+{
+	//
+    // Upload ambient darkening
+	//
+
+    renderContext.UploadStormAmbientDarkening(mParameters.AmbientDarkening);
+
+	//
+	// Upload rain
+	//
+
+	renderContext.UploadRain(mParameters.RainDensity);
+
+	//
+	// Upload lightnings
+	//
+
+	UploadLightnings(renderContext);
+}
+
+void Storm::UploadLightnings(Render::RenderContext & renderContext) const
+{
+	renderContext.UploadLightningsStart(mLightnings.size());
+
+	for (auto const & l : mLightnings)
+	{
+		switch (l.Type)
+		{
+			case LightningStateMachine::LightningType::Background:
+			{
+				assert(!!(l.NdcX));
+
+				renderContext.UploadBackgroundLightning(
+					*(l.NdcX),
+					l.Progress,
+					l.RenderProgress,
+					l.PersonalitySeed);
+
+				break;
+			}
+
+			case LightningStateMachine::LightningType::Foreground:
+			{
+				assert(!!(l.TargetWorldPosition));
+
+				renderContext.UploadForegroundLightning(
+					*(l.TargetWorldPosition),
+					l.Progress,
+					l.RenderProgress,
+					l.PersonalitySeed);
+
+				break;
+			}
+		}
+	}
+
+	renderContext.UploadLightningsEnd();
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// Wind
+///////////////////////////////////////////////////////////////////////////////////
+
+void Wind::Upload(Render::RenderContext & renderContext) const
+{
+    renderContext.UploadWind(mCurrentWindSpeed);
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+// Fishes
+///////////////////////////////////////////////////////////////////////////////////
+
+void Fishes::Upload(Render::RenderContext & renderContext) const
+{
+    renderContext.UploadFishesStart(mFishes.size());
+
+    for (size_t f = 0; f < mFishes.size(); ++f)
+    {
+        Fish const & fish = mFishes[f];
+
+        float angleCw = mFishRenderVectors[f].angleCw();
+        float horizontalScale = mFishRenderVectors[f].length();
+
+        if (angleCw < -Pi<float> / 2.0f)
+        {
+            angleCw = Pi<float> +angleCw;
+            horizontalScale *= -1.0f;
+        }
+        else if (angleCw > Pi<float> / 2.0f)
+        {
+            angleCw = -Pi<float> +angleCw;
+            horizontalScale *= -1.0f;
+        }
+
+        auto const & species = mFishShoals[fish.ShoalId].Species;
+
+        renderContext.UploadFish(
+            fish.RenderTextureFrameId,
+            mFishPositions[f],
+            species.WorldSize * mCurrentFishSizeMultiplier,
+            angleCw,
+            horizontalScale,
+            species.TailX,
+            species.TailSwingWidth,
+            std::sin(mFishTailProgressPhases[f]));
+    }
+
+    renderContext.UploadFishesEnd();
+}
+
+}
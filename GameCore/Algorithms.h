@@ -10,8 +10,10 @@
 
 #include <algorithm>
 #include <array>
+#include <cassert>
 #include <cmath>
 #include <iterator>
+#include <vector>
 
 namespace Algorithms {
 
@@ -515,6 +517,327 @@ inline void DiffuseLight(
 #endif
 }
 
+/*
+ * Lamps binned into the square tiles of a grid covering the AABB of a set of points.
+ *
+ * Each tile gets the list of the lamps that may light any of its points, i.e. of the lamps
+ * that are on, whose spread reaches the tile, and whose plane ID is not lower than the
+ * lowest plane ID of the tile's points. Lists are padded to the vectorization float count
+ * with lamps that produce no light, so that the vectorized kernels may run over them.
+ */
+template<typename TVector>
+struct DiffuseLightTiles
+{
+    // Tiles are made large enough to have (about) at most this number of tiles per side
+    static int constexpr MaxTilesPerSide = 64;
+
+    TVector Origin;
+    float InverseTileSize;
+    int Width;
+    int Height;
+
+    // Start of each tile's lamps in the lamp buffers, plus one sentinel at the end
+    std::vector<ElementIndex> TileLampStarts;
+
+    // Lamp data, by tile
+    unique_aligned_buffer<TVector> LampPositions;
+    unique_aligned_buffer<PlaneId> LampPlaneIds;
+    unique_aligned_buffer<float> LampDistanceCoeffs;
+    unique_aligned_buffer<float> LampSpreadMaxDistances;
+    size_t LampCapacity;
+
+    // Scratch
+    std::vector<PlaneId> TileMinPointPlaneIds;
+    std::vector<ElementIndex> TileNextLamps;
+
+    DiffuseLightTiles()
+        : Origin()
+        , InverseTileSize(1.0f)
+        , Width(0)
+        , Height(0)
+        , TileLampStarts()
+        , LampPositions()
+        , LampPlaneIds()
+        , LampDistanceCoeffs()
+        , LampSpreadMaxDistances()
+        , LampCapacity(0)
+        , TileMinPointPlaneIds()
+        , TileNextLamps()
+    {}
+
+    inline int GetTileIndex(TVector const & position) const noexcept
+    {
+        int const x = std::min(static_cast<int>((position.x - Origin.x) * InverseTileSize), Width - 1);
+        int const y = std::min(static_cast<int>((position.y - Origin.y) * InverseTileSize), Height - 1);
+
+        assert(x >= 0 && y >= 0);
+
+        return y * Width + x;
+    }
+
+    void EnsureLampCapacity(size_t lampCount)
+    {
+        if (lampCount > LampCapacity)
+        {
+            LampCapacity = make_aligned_float_element_count(lampCount * 2);
+
+            LampPositions = make_unique_buffer_aligned_to_vectorization_word<TVector>(LampCapacity);
+            LampPlaneIds = make_unique_buffer_aligned_to_vectorization_word<PlaneId>(LampCapacity);
+            LampDistanceCoeffs = make_unique_buffer_aligned_to_vectorization_word<float>(LampCapacity);
+            LampSpreadMaxDistances = make_unique_buffer_aligned_to_vectorization_word<float>(LampCapacity);
+        }
+    }
+};
+
+/*
+ * Bins the lamps into tiles covering the given points; the tiles may then be
+ * used for DiffuseLight_Tiled with the same points.
+ */
+template<typename TVector>
+inline void PrepareDiffuseLightTiles(
+    ElementIndex const pointCount,
+    TVector const * restrict pointPositions,
+    PlaneId const * restrict pointPlaneIds,
+    TVector const * restrict lampPositions,
+    PlaneId const * restrict lampPlaneIds,
+    float const * restrict lampDistanceCoeffs,
+    float const * restrict lampSpreadMaxDistances,
+    ElementIndex const lampCount,
+    DiffuseLightTiles<TVector> & tiles)
+{
+    assert(pointCount > 0);
+
+    //
+    // 1. Calculate points' AABB, and tile size from the spread of the lamps that are on
+    //
+
+    TVector minPosition = pointPositions[0];
+    TVector maxPosition = pointPositions[0];
+    for (ElementIndex p = 1; p < pointCount; ++p)
+    {
+        minPosition.x = std::min(minPosition.x, pointPositions[p].x);
+        minPosition.y = std::min(minPosition.y, pointPositions[p].y);
+        maxPosition.x = std::max(maxPosition.x, pointPositions[p].x);
+        maxPosition.y = std::max(maxPosition.y, pointPositions[p].y);
+    }
+
+    float totalSpread = 0.0f;
+    ElementCount activeLampCount = 0;
+    for (ElementIndex l = 0; l < lampCount; ++l)
+    {
+        if (lampDistanceCoeffs[l] > 0.0f && lampSpreadMaxDistances[l] > 0.0f)
+        {
+            totalSpread += lampSpreadMaxDistances[l];
+            ++activeLampCount;
+        }
+    }
+
+    // The average spread, so that each lamp covers a handful of tiles
+    float const extent = std::max(maxPosition.x - minPosition.x, maxPosition.y - minPosition.y);
+    float const tileSize = std::max(
+        std::max(
+            activeLampCount > 0 ? totalSpread / static_cast<float>(activeLampCount) : extent,
+            extent / static_cast<float>(DiffuseLightTiles<TVector>::MaxTilesPerSide)),
+        1.0f);
+
+    tiles.Origin = minPosition;
+    tiles.InverseTileSize = 1.0f / tileSize;
+    tiles.Width = static_cast<int>((maxPosition.x - minPosition.x) * tiles.InverseTileSize) + 1;
+    tiles.Height = static_cast<int>((maxPosition.y - minPosition.y) * tiles.InverseTileSize) + 1;
+
+    size_t const tileCount = static_cast<size_t>(tiles.Width) * static_cast<size_t>(tiles.Height);
+
+    //
+    // 2. Calculate lowest plane ID of each tile
+    //
+
+    tiles.TileMinPointPlaneIds.assign(tileCount, NonePlaneId);
+    for (ElementIndex p = 0; p < pointCount; ++p)
+    {
+        auto & tileMinPlaneId = tiles.TileMinPointPlaneIds[tiles.GetTileIndex(pointPositions[p])];
+        tileMinPlaneId = std::min(tileMinPlaneId, pointPlaneIds[p]);
+    }
+
+    //
+    // 3. Bin lamps - first counting them, and then storing them
+    //
+
+    auto const visitLampTiles = [&](auto && tileVisitor)
+    {
+        for (ElementIndex l = 0; l < lampCount; ++l)
+        {
+            if (lampDistanceCoeffs[l] <= 0.0f || lampSpreadMaxDistances[l] <= 0.0f)
+            {
+                // Lamp is off
+                continue;
+            }
+
+            float const spread = lampSpreadMaxDistances[l];
+            int const minX = std::max(static_cast<int>(std::floor((lampPositions[l].x - spread - tiles.Origin.x) * tiles.InverseTileSize)), 0);
+            int const maxX = std::min(static_cast<int>(std::floor((lampPositions[l].x + spread - tiles.Origin.x) * tiles.InverseTileSize)), tiles.Width - 1);
+            int const minY = std::max(static_cast<int>(std::floor((lampPositions[l].y - spread - tiles.Origin.y) * tiles.InverseTileSize)), 0);
+            int const maxY = std::min(static_cast<int>(std::floor((lampPositions[l].y + spread - tiles.Origin.y) * tiles.InverseTileSize)), tiles.Height - 1);
+
+            for (int y = minY; y <= maxY; ++y)
+            {
+                for (int x = minX; x <= maxX; ++x)
+                {
+                    int const t = y * tiles.Width + x;
+                    if (tiles.TileMinPointPlaneIds[t] <= lampPlaneIds[l]) // Also excludes empty tiles
+                    {
+                        tileVisitor(t, l);
+                    }
+                }
+            }
+        }
+    };
+
+    tiles.TileLampStarts.assign(tileCount + 1, 0);
+    visitLampTiles(
+        [&tiles](int t, ElementIndex)
+        {
+            ++tiles.TileLampStarts[t + 1];
+        });
+
+    // Counts -> starts, padding each tile's lamps
+    for (size_t t = 0; t < tileCount; ++t)
+    {
+        tiles.TileLampStarts[t + 1] = tiles.TileLampStarts[t] + make_aligned_float_element_count(tiles.TileLampStarts[t + 1]);
+    }
+
+    tiles.EnsureLampCapacity(tiles.TileLampStarts[tileCount]);
+
+    // Initialize all lamps as padding lamps, producing no light
+    std::fill_n(tiles.LampPositions.get(), tiles.TileLampStarts[tileCount], TVector());
+    std::fill_n(tiles.LampPlaneIds.get(), tiles.TileLampStarts[tileCount], PlaneId(0));
+    std::fill_n(tiles.LampDistanceCoeffs.get(), tiles.TileLampStarts[tileCount], 0.0f);
+    std::fill_n(tiles.LampSpreadMaxDistances.get(), tiles.TileLampStarts[tileCount], 0.0f);
+
+    auto & tileNextLamps = tiles.TileNextLamps;
+    tileNextLamps.assign(tiles.TileLampStarts.cbegin(), tiles.TileLampStarts.cbegin() + tileCount);
+
+    visitLampTiles(
+        [&](int t, ElementIndex l)
+        {
+            ElementIndex const tl = tileNextLamps[t]++;
+            tiles.LampPositions[tl] = lampPositions[l];
+            tiles.LampPlaneIds[tl] = lampPlaneIds[l];
+            tiles.LampDistanceCoeffs[tl] = lampDistanceCoeffs[l];
+            tiles.LampSpreadMaxDistances[tl] = lampSpreadMaxDistances[l];
+        });
+}
+
+/*
+ * Same as DiffuseLight, but each batch of points is only lit by the lamps of the tiles
+ * the points belong to.
+ */
+template<typename TVector>
+inline void DiffuseLight_Tiled(
+    ElementIndex const pointStart,
+    ElementIndex const pointEnd,
+    TVector const * restrict pointPositions,
+    PlaneId const * restrict pointPlaneIds,
+    DiffuseLightTiles<TVector> const & tiles,
+    float * restrict outLightBuffer) noexcept
+{
+    assert(is_aligned_to_float_element_count(pointStart));
+    assert(is_aligned_to_float_element_count(pointEnd));
+
+    // Runs DiffuseLight with the lamps of the tile, on points relative to the pointers
+    auto const diffuseTileLight = [&tiles](
+        int t,
+        ElementIndex runStart,
+        ElementIndex runEnd,
+        TVector const * runPointPositions,
+        PlaneId const * runPointPlaneIds,
+        float * runOutLightBuffer)
+    {
+        ElementIndex const tileLampStart = tiles.TileLampStarts[t];
+        ElementCount const tileLampCount = tiles.TileLampStarts[t + 1] - tileLampStart;
+        if (tileLampCount == 0)
+        {
+            std::fill(runOutLightBuffer + runStart, runOutLightBuffer + runEnd, 0.0f);
+        }
+        else
+        {
+            DiffuseLight(
+                runStart,
+                runEnd,
+                runPointPositions,
+                runPointPlaneIds,
+                tiles.LampPositions.get() + tileLampStart,
+                tiles.LampPlaneIds.get() + tileLampStart,
+                tiles.LampDistanceCoeffs.get() + tileLampStart,
+                tiles.LampSpreadMaxDistances.get() + tileLampStart,
+                tileLampCount,
+                runOutLightBuffer);
+        }
+    };
+
+    //
+    // Visit points in batches of 4, coalescing consecutive batches that lie in the same tile
+    //
+
+    ElementIndex runStart = pointStart;
+    int runTile = -1;
+
+    for (ElementIndex p = pointStart; p < pointEnd; p += 4)
+    {
+        std::array<int, 4> batchTiles;
+        for (ElementIndex p2 = 0; p2 < 4; ++p2)
+        {
+            batchTiles[p2] = tiles.GetTileIndex(pointPositions[p + p2]);
+        }
+
+        if (batchTiles[0] == batchTiles[1] && batchTiles[0] == batchTiles[2] && batchTiles[0] == batchTiles[3])
+        {
+            if (batchTiles[0] != runTile)
+            {
+                // Flush current run and start new one
+                if (runTile >= 0)
+                {
+                    diffuseTileLight(runTile, runStart, p, pointPositions, pointPlaneIds, outLightBuffer);
+                }
+
+                runStart = p;
+                runTile = batchTiles[0];
+            }
+
+            continue;
+        }
+
+        // Batch straddles tiles; flush current run
+        if (runTile >= 0)
+        {
+            diffuseTileLight(runTile, runStart, p, pointPositions, pointPlaneIds, outLightBuffer);
+            runTile = -1;
+        }
+
+        // Each point gets the max light from the lamps of each of the batch's tiles;
+        // since a point's own tile has all the lamps that may reach it, this is the
+        // same as lighting it with all lamps
+        diffuseTileLight(batchTiles[0], p, p + 4, pointPositions, pointPlaneIds, outLightBuffer);
+        for (ElementIndex p2 = 1; p2 < 4; ++p2)
+        {
+            if (std::find(batchTiles.cbegin(), batchTiles.cbegin() + p2, batchTiles[p2]) == batchTiles.cbegin() + p2)
+            {
+                aligned_to_vword float tmpLight[4];
+                diffuseTileLight(batchTiles[p2], 0, 4, pointPositions + p, pointPlaneIds + p, tmpLight);
+
+                for (ElementIndex p3 = 0; p3 < 4; ++p3)
+                {
+                    outLightBuffer[p + p3] = std::max(outLightBuffer[p + p3], tmpLight[p3]);
+                }
+            }
+        }
+    }
+
+    if (runTile >= 0)
+    {
+        diffuseTileLight(runTile, runStart, pointEnd, pointPositions, pointPlaneIds, outLightBuffer);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // BufferSmoothing
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -618,4 +941,298 @@ inline void SmoothBufferAndAdd(
 #endif
 }
 
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// Shallow water
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * The two passes of a step of a shallow water equations solver on a staggered grid,
+ * where height H[i] has velocity V[i] at its left and velocity V[i+1] at its right.
+ *
+ * Heights:
+ *      H[i] *= 1 + heightFactor * (V[i] - V[i+1])
+ *
+ * Velocities, from the heights updated by the first pass:
+ *      NewV[i] = previousVWeight1 * V[i] + previousVWeight2 * (V[i-1] + V[i+1]) - velocityFactor * (H[i] - H[i-1])
+ *
+ * Buffers need not be aligned, and the velocity pass reads one element before and one after
+ * the range.
+ */
+
+inline void UpdateShallowWaterHeights_Naive(
+    float * restrict heightField,
+    float const * restrict velocityField,
+    size_t count,
+    float heightFactor) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        heightField[i] *= 1.0f + heightFactor * (velocityField[i] - velocityField[i + 1]);
+    }
+}
+
+inline void UpdateShallowWaterVelocities_Naive(
+    float const * restrict heightField,
+    float const * restrict velocityField,
+    float * restrict newVelocityField,
+    size_t count,
+    float previousVWeight1,
+    float previousVWeight2,
+    float velocityFactor) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        float const previousV =
+            previousVWeight1 * velocityField[i]
+            + previousVWeight2 * (velocityField[i - 1] + velocityField[i + 1]);
+
+        newVelocityField[i] = previousV - velocityFactor * (heightField[i] - heightField[i - 1]);
+    }
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+inline void UpdateShallowWaterHeights_SSEVectorized(
+    float * restrict heightField,
+    float const * restrict velocityField,
+    size_t count,
+    float heightFactor) noexcept
+{
+    // This code is vectorized for SSE = 4 floats
+    static_assert(vectorization_float_count<size_t> >= 4);
+
+    __m128 const one = _mm_set_ps1(1.0f);
+    __m128 const heightFactor_4 = _mm_set_ps1(heightFactor);
+
+    size_t const vectorizedCount = count - (count % 4);
+
+    for (size_t i = 0; i < vectorizedCount; i += 4)
+    {
+        __m128 const velocityDelta = _mm_sub_ps(
+            _mm_loadu_ps(velocityField + i),
+            _mm_loadu_ps(velocityField + i + 1));
+
+        _mm_storeu_ps(
+            heightField + i,
+            _mm_mul_ps(
+                _mm_loadu_ps(heightField + i),
+                _mm_add_ps(
+                    one,
+                    _mm_mul_ps(heightFactor_4, velocityDelta))));
+    }
+
+    UpdateShallowWaterHeights_Naive(
+        heightField + vectorizedCount,
+        velocityField + vectorizedCount,
+        count - vectorizedCount,
+        heightFactor);
+}
+
+inline void UpdateShallowWaterVelocities_SSEVectorized(
+    float const * restrict heightField,
+    float const * restrict velocityField,
+    float * restrict newVelocityField,
+    size_t count,
+    float previousVWeight1,
+    float previousVWeight2,
+    float velocityFactor) noexcept
+{
+    // This code is vectorized for SSE = 4 floats
+    static_assert(vectorization_float_count<size_t> >= 4);
+
+    __m128 const previousVWeight1_4 = _mm_set_ps1(previousVWeight1);
+    __m128 const previousVWeight2_4 = _mm_set_ps1(previousVWeight2);
+    __m128 const velocityFactor_4 = _mm_set_ps1(velocityFactor);
+
+    size_t const vectorizedCount = count - (count % 4);
+
+    for (size_t i = 0; i < vectorizedCount; i += 4)
+    {
+        __m128 const previousV = _mm_add_ps(
+            _mm_mul_ps(previousVWeight1_4, _mm_loadu_ps(velocityField + i)),
+            _mm_mul_ps(
+                previousVWeight2_4,
+                _mm_add_ps(
+                    _mm_loadu_ps(velocityField + i - 1),
+                    _mm_loadu_ps(velocityField + i + 1))));
+
+        __m128 const heightDelta = _mm_sub_ps(
+            _mm_loadu_ps(heightField + i),
+            _mm_loadu_ps(heightField + i - 1));
+
+        _mm_storeu_ps(
+            newVelocityField + i,
+            _mm_sub_ps(
+                previousV,
+                _mm_mul_ps(velocityFactor_4, heightDelta)));
+    }
+
+    UpdateShallowWaterVelocities_Naive(
+        heightField + vectorizedCount,
+        velocityField + vectorizedCount,
+        newVelocityField + vectorizedCount,
+        count - vectorizedCount,
+        previousVWeight1,
+        previousVWeight2,
+        velocityFactor);
+}
+#endif
+
+inline void UpdateShallowWaterHeights(
+    float * restrict heightField,
+    float const * restrict velocityField,
+    size_t count,
+    float heightFactor) noexcept
+{
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    UpdateShallowWaterHeights_SSEVectorized(heightField, velocityField, count, heightFactor);
+#else
+    UpdateShallowWaterHeights_Naive(heightField, velocityField, count, heightFactor);
+#endif
+}
+
+inline void UpdateShallowWaterVelocities(
+    float const * restrict heightField,
+    float const * restrict velocityField,
+    float * restrict newVelocityField,
+    size_t count,
+    float previousVWeight1,
+    float previousVWeight2,
+    float velocityFactor) noexcept
+{
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    UpdateShallowWaterVelocities_SSEVectorized(heightField, velocityField, newVelocityField, count, previousVWeight1, previousVWeight2, velocityFactor);
+#else
+    UpdateShallowWaterVelocities_Naive(heightField, velocityField, newVelocityField, count, previousVWeight1, previousVWeight2, velocityFactor);
+#endif
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// Height field sampling
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Samples a height field at the x coordinate of each position, writing either the height
+ * (DoCalculateDepths == false) or the height minus the position's y (DoCalculateDepths == true).
+ *
+ * The height field consists of (value, next value - value) pairs, spaced dx apart starting at -originOffset:
+ *      F = (x + originOffset) / dx
+ *      Height = Samples[trunc(F)].Value + Samples[trunc(F)].Delta * (F - trunc(F))
+ *
+ * Positions are assumed to be within the height field; the results match those of the equivalent
+ * scalar calculation within floating-point rounding, as with fast math the compiler may re-associate
+ * and contract the operations differently in each variant.
+ */
+
+template<bool DoCalculateDepths, typename TVector>
+inline void SampleHeightField_Naive(
+    TVector const * restrict positions,
+    size_t count,
+    float const * restrict samples,
+    float originOffset,
+    float dx,
+    float * restrict outValues) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        float const sampleIndexF = (positions[i].x + originOffset) / dx;
+        register_int const sampleIndexI = static_cast<register_int>(sampleIndexF);
+        float const sampleIndexDx = sampleIndexF - sampleIndexI;
+
+        float const height =
+            samples[sampleIndexI * 2]
+            + samples[sampleIndexI * 2 + 1] * sampleIndexDx;
+
+        if constexpr (DoCalculateDepths)
+            outValues[i] = height - positions[i].y;
+        else
+            outValues[i] = height;
+    }
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+template<bool DoCalculateDepths, typename TVector>
+inline void SampleHeightField_SSEVectorized(
+    TVector const * restrict positions,
+    size_t count,
+    float const * restrict samples,
+    float originOffset,
+    float dx,
+    float * restrict outValues) noexcept
+{
+    // This code is vectorized for SSE = 4 floats
+    static_assert(vectorization_float_count<size_t> >= 4);
+    static_assert(sizeof(TVector) == 2 * sizeof(float));
+
+    __m128 const originOffset_4 = _mm_set_ps1(originOffset);
+    __m128 const dx_4 = _mm_set_ps1(dx);
+
+    size_t const vectorizedCount = count - (count % 4);
+
+    for (size_t i = 0; i < vectorizedCount; i += 4)
+    {
+        // Deinterleave positions
+        __m128 const p01 = _mm_loadu_ps(reinterpret_cast<float const *>(positions + i)); // x0, y0, x1, y1
+        __m128 const p23 = _mm_loadu_ps(reinterpret_cast<float const *>(positions + i + 2)); // x2, y2, x3, y3
+        __m128 const x = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(2, 0, 2, 0));
+
+        __m128 const sampleIndexF = _mm_div_ps(_mm_add_ps(x, originOffset_4), dx_4);
+        __m128i const sampleIndexI = _mm_cvttps_epi32(sampleIndexF);
+        __m128 const sampleIndexDx = _mm_sub_ps(sampleIndexF, _mm_cvtepi32_ps(sampleIndexI));
+
+        // Gather (value, delta) pairs
+        alignas(16) int32_t sampleIndices[4];
+        _mm_store_si128(reinterpret_cast<__m128i *>(sampleIndices), sampleIndexI);
+
+        __m128 s01 = _mm_setzero_ps();
+        s01 = _mm_loadl_pi(s01, reinterpret_cast<__m64 const *>(samples + sampleIndices[0] * 2));
+        s01 = _mm_loadh_pi(s01, reinterpret_cast<__m64 const *>(samples + sampleIndices[1] * 2)); // v0, d0, v1, d1
+        __m128 s23 = _mm_setzero_ps();
+        s23 = _mm_loadl_pi(s23, reinterpret_cast<__m64 const *>(samples + sampleIndices[2] * 2));
+        s23 = _mm_loadh_pi(s23, reinterpret_cast<__m64 const *>(samples + sampleIndices[3] * 2)); // v2, d2, v3, d3
+
+        __m128 const height = _mm_add_ps(
+            _mm_shuffle_ps(s01, s23, _MM_SHUFFLE(2, 0, 2, 0)),
+            _mm_mul_ps(
+                _mm_shuffle_ps(s01, s23, _MM_SHUFFLE(3, 1, 3, 1)),
+                sampleIndexDx));
+
+        if constexpr (DoCalculateDepths)
+        {
+            __m128 const y = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(3, 1, 3, 1));
+            _mm_storeu_ps(outValues + i, _mm_sub_ps(height, y));
+        }
+        else
+        {
+            _mm_storeu_ps(outValues + i, height);
+        }
+    }
+
+    SampleHeightField_Naive<DoCalculateDepths>(
+        positions + vectorizedCount,
+        count - vectorizedCount,
+        samples,
+        originOffset,
+        dx,
+        outValues + vectorizedCount);
+}
+#endif
+
+template<bool DoCalculateDepths, typename TVector>
+inline void SampleHeightField(
+    TVector const * restrict positions,
+    size_t count,
+    float const * restrict samples,
+    float originOffset,
+    float dx,
+    float * restrict outValues) noexcept
+{
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+    SampleHeightField_SSEVectorized<DoCalculateDepths>(positions, count, samples, originOffset, dx, outValues);
+#else
+    SampleHeightField_Naive<DoCalculateDepths>(positions, count, samples, originOffset, dx, outValues);
+#endif
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,210 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-16
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameTypes.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+/*
+ * This class hands out slots from a fixed range of element indices, tagging each
+ * allocated slot with one of KindCount kinds.
+ *
+ * - Free slots are kept in a stack, so that allocation and release are O(1);
+ * - Allocated slots are kept in a list ordered by allocation time, so that - when
+ *   there are no free slots left - the oldest slot may be reused in O(1);
+ * - Allocated slots are also kept in one dense span per kind, so that the slots of
+ *   one kind may be visited without visiting all the others.
+ *
+ * Releasing a slot moves the last slot of its kind into its position in the span;
+ * visits that release slots should then proceed backwards.
+ */
+template<size_t KindCount>
+class FreeListAllocator final
+{
+public:
+
+    FreeListAllocator(
+        ElementIndex firstSlot,
+        ElementCount slotCount)
+        : mFirstSlot(firstSlot)
+        , mSlots(slotCount)
+        , mFreeSlots()
+        , mOldestSlot(NoneElementIndex)
+        , mNewestSlot(NoneElementIndex)
+        , mKindSlots()
+    {
+        // Hand out lower slots first
+        mFreeSlots.reserve(slotCount);
+        for (ElementIndex s = firstSlot + slotCount; s > firstSlot; --s)
+        {
+            mFreeSlots.push_back(s - 1);
+        }
+    }
+
+    FreeListAllocator(FreeListAllocator && other) = default;
+    FreeListAllocator & operator=(FreeListAllocator && other) = default;
+
+    /*
+     * Allocates a slot for the specified kind; when there are no free slots, either
+     * reuses the oldest allocated slot (doReuseOldest) or returns NoneElementIndex.
+     */
+    inline ElementIndex Allocate(
+        size_t kind,
+        bool doReuseOldest) noexcept
+    {
+        assert(kind < KindCount);
+
+        ElementIndex slot;
+        if (!mFreeSlots.empty())
+        {
+            slot = mFreeSlots.back();
+            mFreeSlots.pop_back();
+        }
+        else if (doReuseOldest && mOldestSlot != NoneElementIndex)
+        {
+            slot = mOldestSlot;
+            Unlink(slot);
+        }
+        else
+        {
+            return NoneElementIndex;
+        }
+
+        Link(slot, kind);
+
+        return slot;
+    }
+
+    /*
+     * Returns an allocated slot to the free slots.
+     */
+    inline void Release(ElementIndex slot) noexcept
+    {
+        assert(IsAllocated(slot));
+
+        Unlink(slot);
+
+        mFreeSlots.push_back(slot);
+    }
+
+    inline bool IsAllocated(ElementIndex slot) const noexcept
+    {
+        assert(slot >= mFirstSlot && slot - mFirstSlot < mSlots.size());
+
+        return mSlots[slot - mFirstSlot].Kind != NoneKind;
+    }
+
+    /*
+     * The slots currently allocated for the specified kind, in no particular order.
+     */
+    inline std::vector<ElementIndex> const & GetSlots(size_t kind) const noexcept
+    {
+        assert(kind < KindCount);
+
+        return mKindSlots[kind];
+    }
+
+    inline ElementIndex GetOldestSlot() const noexcept
+    {
+        return mOldestSlot;
+    }
+
+    inline size_t GetFreeSlotCount() const noexcept
+    {
+        return mFreeSlots.size();
+    }
+
+private:
+
+    static size_t constexpr NoneKind = KindCount;
+
+    struct Slot
+    {
+        // Links in the age list
+        ElementIndex Older;
+        ElementIndex Newer;
+
+        // The kind of this slot, and its position in that kind's span;
+        // NoneKind when free
+        size_t Kind;
+        size_t KindSlotPosition;
+
+        Slot()
+            : Older(NoneElementIndex)
+            , Newer(NoneElementIndex)
+            , Kind(NoneKind)
+            , KindSlotPosition(0)
+        {}
+    };
+
+    inline void Link(
+        ElementIndex slot,
+        size_t kind) noexcept
+    {
+        Slot & s = mSlots[slot - mFirstSlot];
+
+        // Age list: becomes newest
+        s.Older = mNewestSlot;
+        s.Newer = NoneElementIndex;
+        if (mNewestSlot != NoneElementIndex)
+            mSlots[mNewestSlot - mFirstSlot].Newer = slot;
+        else
+            mOldestSlot = slot;
+        mNewestSlot = slot;
+
+        // Kind span: appended
+        s.Kind = kind;
+        s.KindSlotPosition = mKindSlots[kind].size();
+        mKindSlots[kind].push_back(slot);
+    }
+
+    inline void Unlink(ElementIndex slot) noexcept
+    {
+        Slot & s = mSlots[slot - mFirstSlot];
+
+        assert(s.Kind != NoneKind);
+
+        // Age list
+        if (s.Older != NoneElementIndex)
+            mSlots[s.Older - mFirstSlot].Newer = s.Newer;
+        else
+            mOldestSlot = s.Newer;
+
+        if (s.Newer != NoneElementIndex)
+            mSlots[s.Newer - mFirstSlot].Older = s.Older;
+        else
+            mNewestSlot = s.Older;
+
+        // Kind span: last one takes our place
+        auto & kindSlots = mKindSlots[s.Kind];
+        ElementIndex const lastSlot = kindSlots.back();
+        kindSlots[s.KindSlotPosition] = lastSlot;
+        mSlots[lastSlot - mFirstSlot].KindSlotPosition = s.KindSlotPosition;
+        kindSlots.pop_back();
+
+        s.Kind = NoneKind;
+    }
+
+private:
+
+    ElementIndex mFirstSlot;
+
+    std::vector<Slot> mSlots;
+
+    // Stack of free slots
+    std::vector<ElementIndex> mFreeSlots;
+
+    // Ends of the age list
+    ElementIndex mOldestSlot;
+    ElementIndex mNewestSlot;
+
+    // Dense spans of allocated slots, one per kind
+    std::array<std::vector<ElementIndex>, KindCount> mKindSlots;
+};
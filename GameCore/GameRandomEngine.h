@@ -6,27 +6,89 @@
 #pragma once
 
 #include "GameMath.h"
+#include "SysSpecifics.h"
 #include "Vectors.h"
+#include "Xoshiro128PlusPlus.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <random>
 
 /*
  * The random engine for the entire game.
  *
- * Not so random - always uses the same seed. On purpose! We want two instances
+ * Not so random - always uses the same seeds. On purpose! We want two instances
  * of the game to be identical to each other.
  *
- * Singleton.
+ * There is one canonical instance, with a fixed seed, meant to be used by the main
+ * thread. Jobs that run on other threads - e.g. ships being updated in parallel,
+ * or thread pool tasks - use instead their own streams: each stream is created from
+ * an ordinal that identifies its job, and is bound to the thread running the job
+ * by means of a StreamScope; while bound, GetInstance() returns the stream rather
+ * than the canonical instance.
  */
 class GameRandomEngine
 {
 public:
 
+    /*
+     * Binds a stream to the current thread for the lifetime of the scope, restoring
+     * the previously-bound stream (if any) at the end of it.
+     */
+    class StreamScope final
+    {
+    public:
+
+        explicit StreamScope(GameRandomEngine & stream)
+            : mPreviousStream(GetBoundStream())
+        {
+            GetBoundStream() = &stream;
+        }
+
+        ~StreamScope()
+        {
+            GetBoundStream() = mPreviousStream;
+        }
+
+        StreamScope(StreamScope const &) = delete;
+        StreamScope & operator=(StreamScope const &) = delete;
+
+    private:
+
+        GameRandomEngine * const mPreviousStream;
+    };
+
     static GameRandomEngine & GetInstance()
     {
-        static GameRandomEngine * instance = new GameRandomEngine();
+        GameRandomEngine * const boundStream = GetBoundStream();
+        if (boundStream != nullptr)
+        {
+            return *boundStream;
+        }
+
+        static GameRandomEngine * canonicalInstance = new GameRandomEngine(MakeSeed(0, 0));
+
+        return *canonicalInstance;
+    }
+
+    /*
+     * Creates a new, independent engine; two streams with the same ordinal
+     * generate the same sequence.
+     */
+    static GameRandomEngine CreateStream(std::uint32_t streamOrdinal)
+    {
+        return GameRandomEngine(MakeSeed(1, streamOrdinal));
+    }
 
-        return *instance;
+    /*
+     * A fingerprint of the state of the engine, for detecting whether any values
+     * have been drawn.
+     */
+    std::uint64_t GetStateFingerprint() const
+    {
+        return mRandomEngine.GetStateFingerprint();
     }
 
     /*
@@ -93,9 +155,12 @@ public:
         return dis(mRandomEngine);
     }
 
+    /*
+     * Returns a value in [0.0, 1.0).
+     */
     inline float GenerateNormalizedUniformReal()
     {
-        return mRandomUniformDistribution(mRandomEngine);
+        return ToNormalizedUniformReal(mRandomEngine());
     }
 
     inline float GenerateUniformReal(
@@ -156,17 +221,185 @@ public:
         return mean + mNormalDistribution(mRandomEngine) * stdev;
     }
 
+    //
+    // Batch generation
+    //
+    // The uniform ones generate the same values as invoking their single-value
+    // counterparts count times would; the normal ones generate their values
+    // in pairs, and thus do not.
+    //
+
+    void GenerateNormalizedUniformReals(
+        float * restrict outValues,
+        size_t count)
+    {
+        GenerateUniformReals(outValues, count, 0.0f, 1.0f);
+    }
+
+    void GenerateUniformReals(
+        float * restrict outValues,
+        size_t count,
+        float minValue,
+        float maxValue)
+    {
+        float const range = maxValue - minValue;
+
+        alignas(16) std::uint32_t bits[BatchChunkSize];
+        for (size_t start = 0; start < count; start += BatchChunkSize)
+        {
+            size_t const chunkSize = std::min(count - start, BatchChunkSize);
+
+            mRandomEngine.Generate(bits, chunkSize);
+
+            size_t i = 0;
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+            // Same operations as ToNormalizedUniformReal(), four values at a time
+            __m128 const minValue_4 = _mm_set1_ps(minValue);
+            __m128 const range_4 = _mm_set1_ps(range);
+            __m128 const normalizationFactor_4 = _mm_set1_ps(1.0f / 16777216.0f);
+
+            for (; i + 4 <= chunkSize; i += 4)
+            {
+                __m128i const bits_4 = _mm_load_si128(reinterpret_cast<__m128i const *>(bits + i));
+                __m128 const normalized_4 = _mm_mul_ps(
+                    _mm_cvtepi32_ps(_mm_srli_epi32(bits_4, 8)),
+                    normalizationFactor_4);
+
+                _mm_storeu_ps(
+                    outValues + start + i,
+                    _mm_add_ps(minValue_4, _mm_mul_ps(normalized_4, range_4)));
+            }
+
+#endif
+
+            for (; i < chunkSize; ++i)
+            {
+                outValues[start + i] = minValue + ToNormalizedUniformReal(bits[i]) * range;
+            }
+        }
+    }
+
+    /*
+     * Generates random numbers distributed according to a Gaussian with mean zero
+     * and stdev 1, via the Box-Muller transform.
+     */
+    void GenerateStandardNormalReals(
+        float * restrict outValues,
+        size_t count)
+    {
+        std::uint32_t bits[BatchChunkSize];
+        for (size_t start = 0; start < count; start += BatchChunkSize)
+        {
+            size_t const chunkSize = std::min(count - start, BatchChunkSize);
+            size_t const pairCount = (chunkSize + 1) / 2;
+
+            mRandomEngine.Generate(bits, pairCount * 2);
+
+            for (size_t p = 0; p < pairCount; ++p)
+            {
+                // (0.0, 1.0], so to stay away from log(0)
+                float const u1 = 1.0f - ToNormalizedUniformReal(bits[p * 2]);
+                float const u2 = ToNormalizedUniformReal(bits[p * 2 + 1]);
+
+                float const magnitude = std::sqrt(-2.0f * std::log(u1));
+                float const angle = 2.0f * Pi<float> * u2;
+
+                outValues[start + p * 2] = magnitude * std::cos(angle);
+                if (p * 2 + 1 < chunkSize)
+                {
+                    outValues[start + p * 2 + 1] = magnitude * std::sin(angle);
+                }
+            }
+        }
+    }
+
+    void GenerateUniformRadialVectors(
+        vec2f * restrict outValues,
+        size_t count,
+        float minMagnitude,
+        float maxMagnitude)
+    {
+        std::uint32_t bits[BatchChunkSize];
+        for (size_t start = 0; start < count; start += BatchChunkSize / 2)
+        {
+            size_t const chunkSize = std::min(count - start, BatchChunkSize / 2);
+
+            mRandomEngine.Generate(bits, chunkSize * 2);
+
+            for (size_t i = 0; i < chunkSize; ++i)
+            {
+                float const magnitude = minMagnitude + ToNormalizedUniformReal(bits[i * 2]) * (maxMagnitude - minMagnitude);
+                float const angle = ToNormalizedUniformReal(bits[i * 2 + 1]) * (2.0f * Pi<float>);
+
+                outValues[start + i] = vec2f::fromPolar(magnitude, angle);
+            }
+        }
+    }
+
+    /*
+     * Generates points uniformly distributed over the area of the circle with the
+     * specified radius, centered at the origin.
+     */
+    void GenerateUniformPointsInCircle(
+        vec2f * restrict outValues,
+        size_t count,
+        float radius)
+    {
+        std::uint32_t bits[BatchChunkSize];
+        for (size_t start = 0; start < count; start += BatchChunkSize / 2)
+        {
+            size_t const chunkSize = std::min(count - start, BatchChunkSize / 2);
+
+            mRandomEngine.Generate(bits, chunkSize * 2);
+
+            for (size_t i = 0; i < chunkSize; ++i)
+            {
+                // Density grows linearly with the radius
+                float const magnitude = radius * std::sqrt(ToNormalizedUniformReal(bits[i * 2]));
+                float const angle = ToNormalizedUniformReal(bits[i * 2 + 1]) * (2.0f * Pi<float>);
+
+                outValues[start + i] = vec2f::fromPolar(magnitude, angle);
+            }
+        }
+    }
+
 private:
 
-    GameRandomEngine()
+    explicit GameRandomEngine(std::uint64_t seed)
+        : mRandomEngine(seed)
+        , mNormalDistribution(0.0f, 1.0f)
+    {
+    }
+
+    static std::uint64_t MakeSeed(
+        std::uint32_t domain,
+        std::uint32_t ordinal)
+    {
+        // The canonical instance and streams live in different domains;
+        // SplitMix64 seeding makes neighboring seeds unrelated
+        return (static_cast<std::uint64_t>(domain) << 63)
+            | (static_cast<std::uint64_t>(ordinal) << 32)
+            | static_cast<std::uint64_t>(19730528u);
+    }
+
+    static GameRandomEngine *& GetBoundStream()
+    {
+        thread_local GameRandomEngine * boundStream = nullptr;
+
+        return boundStream;
+    }
+
+    static inline float ToNormalizedUniformReal(std::uint32_t bits)
     {
-        std::seed_seq seed_seq({ 1, 242, 19730528 });
-        mRandomEngine = std::ranlux48_base(seed_seq);
-        mRandomUniformDistribution = std::uniform_real_distribution<float>(0.0f, 1.0f);
-        mNormalDistribution = std::normal_distribution<float>(0.0f, 1.0f);
+        // The top 24 bits, i.e. the float mantissa's worth, scaled to [0.0, 1.0)
+        return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
     }
 
-    std::ranlux48_base mRandomEngine;
-    std::uniform_real_distribution<float> mRandomUniformDistribution;
+    // The number of values we generate at a time in batch generation
+    static size_t constexpr BatchChunkSize = 256;
+
+    Xoshiro128PlusPlus mRandomEngine;
     std::normal_distribution<float> mNormalDistribution;
 };
@@ -5,6 +5,7 @@
 ***************************************************************************************/
 #pragma once
 
+#include <cassert>
 #include <chrono>
 #include <optional>
 
@@ -13,6 +14,10 @@
  *
  * Note: it's not really a wall clock - its values do not measure time.
  *
+ * The clock may also be made a simulated one, in which case it only moves
+ * when it's advanced explicitly - e.g. by one simulation step at a time, for
+ * runs that need to be reproducible.
+ *
  * Singleton.
  */
 class GameWallClock
@@ -40,13 +45,22 @@ public:
      */
     inline float_time ContinuousNowAsFloat() const
     {
+        if (!!mSimulatedNow)
+        {
+            return AsFloat(*mSimulatedNow);
+        }
+
         return std::chrono::duration_cast<std::chrono::duration<float>>(std::chrono::steady_clock::now() - mClockStartTime)
             .count();
     }
 
     inline time_point Now() const
     {
-        if (!!mLastResumeTime)
+        if (!!mSimulatedNow)
+        {
+            return *mSimulatedNow;
+        }
+        else if (!!mLastResumeTime)
         {
             // We're running
             return mLastPauseTime + (std::chrono::steady_clock::now() - *mLastResumeTime);
@@ -157,12 +171,34 @@ public:
         }
     }
 
+    bool IsSimulated() const
+    {
+        return !!mSimulatedNow;
+    }
+
+    /*
+     * Turns the clock into a simulated one, restarting it from its start time;
+     * from now on, time only moves via Advance().
+     */
+    void SetSimulated()
+    {
+        mSimulatedNow = mClockStartTime;
+    }
+
+    void Advance(duration interval)
+    {
+        assert(!!mSimulatedNow);
+
+        *mSimulatedNow += interval;
+    }
+
 private:
 
     GameWallClock()
         : mClockStartTime(std::chrono::steady_clock::now())
         , mLastPauseTime(std::chrono::steady_clock::now())
         , mLastResumeTime(mLastPauseTime)
+        , mSimulatedNow()
     {
 
     }
@@ -170,4 +206,5 @@ private:
     time_point const mClockStartTime;
     time_point mLastPauseTime;
     std::optional<time_point> mLastResumeTime;
+    std::optional<time_point> mSimulatedNow;
 };
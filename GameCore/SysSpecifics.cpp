@@ -5,6 +5,14 @@
 ***************************************************************************************/
 #include "SysSpecifics.h"
 
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
 #if FS_IS_ARCHITECTURE_ARM_32()
 #pragma message ("ARCHITECTURE:FS_ARCHITECTURE_ARM_32")
 #elif FS_IS_ARCHITECTURE_ARM_64()
@@ -25,4 +33,95 @@
 #pragma message ("OS:FS_OS_WINDOWS")
 #else
 #pragma message ("OS:<UNKNOWN>")
-#endif
\ No newline at end of file
+#endif
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+namespace {
+
+    void Cpuid(
+        unsigned int leaf,
+        unsigned int subleaf,
+        unsigned int registers[4])
+    {
+#ifdef _MSC_VER
+        int r[4];
+        __cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+        for (int i = 0; i < 4; ++i)
+        {
+            registers[i] = static_cast<unsigned int>(r[i]);
+        }
+#else
+        __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+    }
+
+    std::uint64_t Xgetbv()
+    {
+#ifdef _MSC_VER
+        return _xgetbv(0);
+#else
+        std::uint32_t eax, edx;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (static_cast<std::uint64_t>(edx) << 32) | eax;
+#endif
+    }
+
+    SimdInstructionSet DetectSimdInstructionSet()
+    {
+        unsigned int registers[4]; // eax, ebx, ecx, edx
+
+        Cpuid(0, 0, registers);
+        unsigned int const maxLeaf = registers[0];
+        if (maxLeaf < 7)
+        {
+            return SimdInstructionSet::SSE;
+        }
+
+        Cpuid(1, 0, registers);
+        bool const hasFma = (registers[2] & (1u << 12)) != 0;
+        bool const hasOsXsave = (registers[2] & (1u << 27)) != 0;
+        bool const hasAvx = (registers[2] & (1u << 28)) != 0;
+        if (!hasFma || !hasOsXsave || !hasAvx)
+        {
+            return SimdInstructionSet::SSE;
+        }
+
+        // Check that the OS saves the YMM (and ZMM) registers
+        std::uint64_t const xcr0 = Xgetbv();
+        bool const isYmmEnabled = (xcr0 & 0x06) == 0x06;
+        bool const isZmmEnabled = (xcr0 & 0xe6) == 0xe6;
+
+        Cpuid(7, 0, registers);
+        bool const hasAvx2 = (registers[1] & (1u << 5)) != 0;
+        bool const hasAvx512F = (registers[1] & (1u << 16)) != 0;
+
+        if (hasAvx2 && hasAvx512F && isZmmEnabled)
+        {
+            return SimdInstructionSet::AVX512;
+        }
+        else if (hasAvx2 && isYmmEnabled)
+        {
+            return SimdInstructionSet::AVX2;
+        }
+        else
+        {
+            return SimdInstructionSet::SSE;
+        }
+    }
+}
+
+SimdInstructionSet GetSimdInstructionSet()
+{
+    static SimdInstructionSet const instructionSet = DetectSimdInstructionSet();
+    return instructionSet;
+}
+
+#else
+
+SimdInstructionSet GetSimdInstructionSet()
+{
+    return SimdInstructionSet::SSE;
+}
+
+#endif
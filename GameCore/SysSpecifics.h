@@ -144,7 +144,36 @@ inline constexpr T ceil_square_power_of_two(T value)
 // MAC
 #include <pmmintrin.h>
 */
-#include <pmmintrin.h>
+#include <immintrin.h>
+#endif
+
+/*
+ * The x86 vector instruction sets we have specific code paths for, in order of width.
+ *
+ * Code paths for instruction sets beyond the baseline (SSE) are compiled into
+ * functions decorated with the respective FS_TARGET_* attribute, and are only
+ * to be invoked after checking GetSimdInstructionSet().
+ */
+enum class SimdInstructionSet
+{
+    SSE = 0,
+    AVX2,
+    AVX512
+};
+
+/*
+ * Returns the widest instruction set supported by both the CPU and the OS; detected via CPUID at the first invocation.
+ * On non-x86 architectures, returns SSE, i.e. "baseline".
+ */
+SimdInstructionSet GetSimdInstructionSet();
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FS_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define FS_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#else
+// MSVC allows intrinsics of any instruction set without flags
+#define FS_TARGET_AVX2
+#define FS_TARGET_AVX512
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,217 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-16
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "TaskGraph.h"
+
+#include "GameException.h"
+
+#include <optional>
+
+std::uint64_t TaskGraph::Fingerprint(
+    void const * data,
+    size_t size)
+{
+    // FNV-1a
+    std::uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= static_cast<std::uint64_t>(static_cast<std::uint8_t const *>(data)[i]);
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+TaskGraph::TaskGraph()
+    : mTasks()
+    , mResources()
+    , mIsVerificationEnabled(false)
+    , mIsSequential(false)
+    , mLastRunStatistics()
+    , mBatchTasks()
+{
+}
+
+void TaskGraph::AddTask(
+    char const * name,
+    ResourceSet reads,
+    ResourceSet writes,
+    Task task,
+    bool usesThreadPool)
+{
+    assert(mTasks.size() < MaxTasks);
+
+    // Find earlier tasks we conflict with
+    std::uint64_t predecessors = 0;
+    for (size_t t = 0; t < mTasks.size(); ++t)
+    {
+        if ((mTasks[t].Writes & (reads | writes)) != 0
+            || (mTasks[t].Reads & writes) != 0)
+        {
+            predecessors |= std::uint64_t(1) << t;
+        }
+    }
+
+    mTasks.push_back(
+        TaskInfo{
+            name,
+            reads,
+            writes,
+            std::move(task),
+            usesThreadPool,
+            predecessors,
+            GameChronometer::duration::zero() });
+}
+
+void TaskGraph::RunAndClear(ThreadPool & threadPool)
+{
+    auto const startTime = GameChronometer::now();
+
+    try
+    {
+        if (mIsVerificationEnabled)
+        {
+            RunVerifying();
+        }
+        else if (mIsSequential)
+        {
+            RunSequentially();
+        }
+        else
+        {
+            RunConcurrently(threadPool);
+        }
+    }
+    catch (...)
+    {
+        mTasks.clear();
+        throw;
+    }
+
+    mLastRunStatistics.ElapsedDuration = GameChronometer::now() - startTime;
+    mLastRunStatistics.TasksDuration = GameChronometer::duration::zero();
+    for (auto const & task : mTasks)
+    {
+        mLastRunStatistics.TasksDuration += task.Duration;
+    }
+
+    mTasks.clear();
+}
+
+void TaskGraph::RunConcurrently(ThreadPool & threadPool)
+{
+    std::uint64_t const allTasks = (mTasks.size() == MaxTasks)
+        ? ~std::uint64_t(0)
+        : (std::uint64_t(1) << mTasks.size()) - 1;
+
+    std::uint64_t completedTasks = 0;
+
+    while (completedTasks != allTasks)
+    {
+        //
+        // Collect all ready tasks that don't need the thread pool, and the first
+        // ready task that does; since they're ready, none of them depends on any
+        // of the others
+        //
+
+        mBatchTasks.clear();
+        std::uint64_t batchTasks = 0;
+        std::optional<size_t> readyThreadPoolTask;
+
+        for (size_t t = 0; t < mTasks.size(); ++t)
+        {
+            std::uint64_t const taskBit = std::uint64_t(1) << t;
+
+            if ((completedTasks & taskBit) == 0
+                && (mTasks[t].Predecessors & ~completedTasks) == 0)
+            {
+                if (!mTasks[t].UsesThreadPool)
+                {
+                    mBatchTasks.emplace_back(
+                        [this, t]()
+                        {
+                            RunTask(t);
+                        });
+
+                    batchTasks |= taskBit;
+                }
+                else if (!readyThreadPoolTask.has_value())
+                {
+                    readyThreadPoolTask = t;
+                }
+            }
+        }
+
+        if (!mBatchTasks.empty())
+        {
+            threadPool.Run(mBatchTasks);
+        }
+
+        if (readyThreadPoolTask.has_value())
+        {
+            RunTask(*readyThreadPoolTask);
+        }
+
+        completedTasks |= batchTasks;
+
+        if (readyThreadPoolTask.has_value())
+        {
+            completedTasks |= std::uint64_t(1) << *readyThreadPoolTask;
+        }
+    }
+
+    mBatchTasks.clear();
+}
+
+void TaskGraph::RunVerifying()
+{
+    std::array<std::uint64_t, MaxResources> fingerprintsBefore;
+
+    // The insertion order is a valid topological order
+    for (size_t t = 0; t < mTasks.size(); ++t)
+    {
+        auto const & task = mTasks[t];
+
+        for (size_t r = 0; r < MaxResources; ++r)
+        {
+            if (mResources[r].Fingerprint)
+            {
+                fingerprintsBefore[r] = mResources[r].Fingerprint();
+            }
+        }
+
+        RunTask(t);
+
+        for (size_t r = 0; r < MaxResources; ++r)
+        {
+            if (mResources[r].Fingerprint
+                && (task.Writes & (ResourceSet(1) << r)) == 0
+                && mResources[r].Fingerprint() != fingerprintsBefore[r])
+            {
+                throw GameException(
+                    "Task \"" + std::string(task.Name) + "\" has modified resource \"" + mResources[r].Name
+                    + "\", which it has not declared as written");
+            }
+        }
+    }
+}
+
+void TaskGraph::RunSequentially()
+{
+    // The insertion order is a valid topological order
+    for (size_t t = 0; t < mTasks.size(); ++t)
+    {
+        RunTask(t);
+    }
+}
+
+void TaskGraph::RunTask(size_t t)
+{
+    auto const startTime = GameChronometer::now();
+
+    mTasks[t].Function();
+
+    mTasks[t].Duration = GameChronometer::now() - startTime;
+}
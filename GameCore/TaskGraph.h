@@ -0,0 +1,185 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-16
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameChronometer.h"
+#include "ThreadPool.h"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/*
+ * This class runs a set of tasks that declare which resources (e.g. buffers)
+ * they read and write.
+ *
+ * Tasks are added in the order in which they would run sequentially; a task
+ * depends on all the earlier tasks it conflicts with (read-after-write, write-after-read,
+ * write-after-write), hence running the graph has the same outcome as running the tasks
+ * in sequence, provided that the declarations are correct.
+ *
+ * At each step, all the tasks whose dependencies are satisfied and that don't use the
+ * thread pool are run concurrently, as one batch of the thread pool; then, one of the ready
+ * tasks that use the pool runs on the calling thread, spreading its work over the pool. As
+ * the pool doesn't support nested batches, tasks that use the pool run one at a time, and
+ * do not overlap other tasks. No threads other than the pool's are used, hence a graph never
+ * runs more threads than the pool's parallelism.
+ * Tasks may thus run on any of the calling thread and the pool's threads; whatever they call
+ * must be thread-safe.
+ *
+ * When verification is enabled, tasks are run one at a time, and the fingerprints of the
+ * registered resources are compared before and after each task to detect writes to resources
+ * that have not been declared as written. Reads are not verified: a task reading a resource
+ * it hasn't declared goes undetected, and it might race with the task writing it.
+ *
+ * When sequential, tasks are run one at a time on the calling thread, in insertion order;
+ * tasks that use the thread pool still do so.
+ */
+class TaskGraph final
+{
+public:
+
+    using ResourceSet = std::uint64_t;
+
+    using Task = std::function<void()>;
+
+    using FingerprintFunction = std::function<std::uint64_t()>;
+
+    static size_t constexpr MaxResources = 64;
+
+    static size_t constexpr MaxTasks = 64;
+
+    template<typename... TResource>
+    static constexpr ResourceSet Resources(TResource... resources)
+    {
+        return ((ResourceSet(1) << static_cast<size_t>(resources)) | ... | ResourceSet(0));
+    }
+
+    static std::uint64_t Fingerprint(
+        void const * data,
+        size_t size);
+
+public:
+
+    TaskGraph();
+
+    /*
+     * Registers a resource for verification; unregistered resources are not verified.
+     */
+    template<typename TResource>
+    void RegisterResource(
+        TResource resource,
+        std::string name,
+        FingerprintFunction fingerprintFunction)
+    {
+        assert(static_cast<size_t>(resource) < MaxResources);
+
+        mResources[static_cast<size_t>(resource)] = ResourceInfo{ std::move(name), std::move(fingerprintFunction) };
+    }
+
+    bool IsVerificationEnabled() const
+    {
+        return mIsVerificationEnabled;
+    }
+
+    void SetVerificationEnabled(bool value)
+    {
+        mIsVerificationEnabled = value;
+    }
+
+    bool IsSequential() const
+    {
+        return mIsSequential;
+    }
+
+    void SetSequential(bool value)
+    {
+        mIsSequential = value;
+    }
+
+    /*
+     * Removes all tasks, keeping registered resources.
+     */
+    void Clear()
+    {
+        mTasks.clear();
+    }
+
+    void AddTask(
+        char const * name,
+        ResourceSet reads,
+        ResourceSet writes,
+        Task task,
+        bool usesThreadPool = false);
+
+    /*
+     * Runs all tasks and clears the graph.
+     */
+    void RunAndClear(ThreadPool & threadPool);
+
+    struct RunStatistics
+    {
+        GameChronometer::duration ElapsedDuration; // Wall-clock duration of the whole run
+        GameChronometer::duration TasksDuration; // Sum of the durations of all tasks; above the elapsed duration when tasks overlap
+
+        RunStatistics()
+            : ElapsedDuration(GameChronometer::duration::zero())
+            , TasksDuration(GameChronometer::duration::zero())
+        {}
+    };
+
+    RunStatistics const & GetLastRunStatistics() const
+    {
+        return mLastRunStatistics;
+    }
+
+private:
+
+    void RunConcurrently(ThreadPool & threadPool);
+
+    void RunVerifying();
+
+    void RunSequentially();
+
+    void RunTask(size_t t);
+
+private:
+
+    struct TaskInfo
+    {
+        char const * Name;
+        ResourceSet Reads;
+        ResourceSet Writes;
+        Task Function;
+        bool UsesThreadPool;
+
+        std::uint64_t Predecessors; // Bitmask of task indices
+
+        GameChronometer::duration Duration; // Set when run
+    };
+
+    struct ResourceInfo
+    {
+        std::string Name;
+        FingerprintFunction Fingerprint;
+    };
+
+    std::vector<TaskInfo> mTasks;
+
+    std::array<ResourceInfo, MaxResources> mResources;
+
+    bool mIsVerificationEnabled;
+
+    bool mIsSequential;
+
+    RunStatistics mLastRunStatistics;
+
+    // Scratch
+    std::vector<ThreadPool::Task> mBatchTasks;
+};
@@ -61,6 +61,9 @@ void ThreadManager::SetSimulationParallelism(size_t parallelism)
     // (Re-)create thread pool
     //
 
+    mSimulationJobThreadPools.clear();
+    mSimulationJobThreadPoolsSingleThreadedJobCount = 0;
+
     mSimulationThreadPool.reset();
 
     mSimulationThreadPool = std::make_unique<ThreadPool>(parallelism, *this);
@@ -71,6 +74,46 @@ ThreadPool & ThreadManager::GetSimulationThreadPool()
     return *mSimulationThreadPool;
 }
 
+std::vector<std::unique_ptr<ThreadPool>> & ThreadManager::GetSimulationJobThreadPools(
+    size_t jobCount,
+    size_t singleThreadedJobCount)
+{
+    assert(singleThreadedJobCount <= jobCount);
+
+    if (mSimulationJobThreadPools.size() != jobCount
+        || mSimulationJobThreadPoolsSingleThreadedJobCount != singleThreadedJobCount)
+    {
+        //
+        // (Re-)create job thread pools
+        //
+        // Each job runs on one thread of the simulation thread pool; when there are
+        // less jobs than threads, the remaining threads are distributed among the
+        // jobs that are not single-threaded
+        //
+
+        mSimulationJobThreadPools.clear();
+
+        size_t const multiThreadedJobCount = jobCount - singleThreadedJobCount;
+        size_t const multiThreadedJobsParallelism = GetSimulationParallelism() - std::min(singleThreadedJobCount, GetSimulationParallelism());
+
+        for (size_t j = 0; j < jobCount; ++j)
+        {
+            size_t jobParallelism = 1;
+            if (j < multiThreadedJobCount && multiThreadedJobCount < multiThreadedJobsParallelism)
+            {
+                jobParallelism = multiThreadedJobsParallelism / multiThreadedJobCount
+                    + ((j < multiThreadedJobsParallelism % multiThreadedJobCount) ? 1 : 0);
+            }
+
+            mSimulationJobThreadPools.emplace_back(std::make_unique<ThreadPool>(jobParallelism, *this));
+        }
+
+        mSimulationJobThreadPoolsSingleThreadedJobCount = singleThreadedJobCount;
+    }
+
+    return mSimulationJobThreadPools;
+}
+
 void ThreadManager::InitializeThisThread()
 {
 #if FS_IS_OS_WINDOWS()
@@ -7,6 +7,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 class ThreadPool;
 
@@ -40,11 +41,30 @@ public:
 
     ThreadPool & GetSimulationThreadPool();
 
+    /*
+     * Returns one thread pool for each of the specified number of independent
+     * simulation jobs that are about to be run concurrently as tasks of the
+     * simulation thread pool.
+     *
+     * The job pools partition the simulation parallelism among themselves,
+     * accounting for the simulation thread pool's threads running the jobs,
+     * so that no more threads than the simulation parallelism run at any time.
+     *
+     * The last singleThreadedJobCount jobs are light jobs that get no share of
+     * the parallelism, i.e. their pools run tasks on the job's own thread only.
+     */
+    std::vector<std::unique_ptr<ThreadPool>> & GetSimulationJobThreadPools(
+        size_t jobCount,
+        size_t singleThreadedJobCount = 0);
+
 private:
 
     size_t mMaxSimulationParallelism; // Calculated via init args and hardware concurrency; never changes
 
     std::unique_ptr<ThreadPool> mSimulationThreadPool;
+
+    std::vector<std::unique_ptr<ThreadPool>> mSimulationJobThreadPools; // Re-created whenever job counts or parallelism change
+    size_t mSimulationJobThreadPoolsSingleThreadedJobCount;
 };
 
 #include "ThreadPool.h"
\ No newline at end of file
@@ -10,27 +10,66 @@
 
 #include <algorithm>
 
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+#include <immintrin.h>
+#endif
+
+namespace /* anonymous */ {
+
+    // The number of spin iterations before a waiting thread parks;
+    // long enough to bridge the gap between back-to-back batches
+    size_t constexpr SpinIterationsBeforeParking = 2048;
+
+    inline void SpinWait(size_t iteration)
+    {
+        if ((iteration % 64) == 63)
+        {
+            // Give other threads a chance, e.g. when cores are oversubscribed
+            std::this_thread::yield();
+        }
+        else
+        {
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+            _mm_pause();
+#else
+            std::this_thread::yield();
+#endif
+        }
+    }
+}
+
 ThreadPool::ThreadPool(
     size_t parallelism,
     ThreadManager & threadManager)
-    : mLock()
-    , mThreads()
+    : mThreads()
+    , mDeques()
+    , mBatchRunner(nullptr)
+    , mBatchContext(nullptr)
+    , mItemsToComplete(0)
+    , mBatchEpoch(0)
+    , mLock()
     , mWorkerThreadSignal()
     , mMainThreadSignal()
-    , mRemainingTasks()
-    , mTasksToComplete(0)
+    , mParkedWorkerThreadCount(0)
+    , mIsMainThreadParked(false)
     , mIsStop(false)
 {
     LogMessage("ThreadPool: creating thread pool with parallelism=", parallelism);
 
     assert(parallelism > 0);
 
+    // One deque per thread (main thread is one of them)
+    for (size_t i = 0; i < parallelism; ++i)
+    {
+        mDeques.emplace_back(std::make_unique<WorkStealingDeque<size_t>>());
+    }
+
     // Start N-1 threads (main thread is one of them)
     for (size_t i = 0; i < parallelism - 1; ++i)
     {
-        mThreads.emplace_back([this, &threadManager]()
+        mThreads.emplace_back([this, dequeIndex = i + 1, &threadManager]()
             {
-                ThreadLoop(threadManager);
+                ThreadLoop(dequeIndex, threadManager);
             });
     }
 }
@@ -41,7 +80,7 @@ ThreadPool::~ThreadPool()
     {
         std::unique_lock const lock{ mLock };
 
-        mIsStop = true;
+        mIsStop.store(true);
     }
 
     // Signal threads
@@ -56,70 +95,120 @@ ThreadPool::~ThreadPool()
 
 void ThreadPool::Run(std::vector<Task> const & tasks)
 {
-    assert(mRemainingTasks.empty());
-    assert(0 == mTasksToComplete);
+    RunBatch(
+        tasks.size(),
+        [](void const * batchContext, size_t item)
+        {
+            (*static_cast<std::vector<Task> const *>(batchContext))[item]();
+        },
+        &tasks);
+}
+
+void ThreadPool::RunBatch(
+    size_t itemCount,
+    BatchItemRunner runner,
+    void const * batchContext)
+{
+    assert(0 == mItemsToComplete.load());
+
+    mBatchRunner = runner;
+    mBatchContext = batchContext;
 
     // Shortcut to avoid paying synchronization penalties
     // in trivial cases
-    if (mThreads.empty() || tasks.size() == 1)
+    if (mThreads.empty() || itemCount <= 1)
     {
-        for (Task const & task : tasks)
+        for (size_t i = 0; i < itemCount; ++i)
         {
-            RunTask(task);
+            RunItem(i);
         }
 
         return;
     }
 
-    // Queue all the task (pointers) except the first one,
-    // which we're gonna run immediately now to guarantee
-    // that the first task always runs on the main thread
+    //
+    // Queue all the items except the first one, which we're gonna run
+    // immediately now to guarantee that the first item always runs on the
+    // main thread.
+    //
+    // Each deque gets a contiguous range of items, so that in the absence
+    // of stealing each thread works on adjacent data.
+    //
+
+    size_t const queuedItemCount = itemCount - 1;
+
+    mItemsToComplete.store(queuedItemCount, std::memory_order_relaxed);
+
+    size_t const dequeCount = mDeques.size();
+    for (size_t d = 0; d < dequeCount; ++d)
     {
-        std::unique_lock const lock{ mLock };
+        size_t const startItem = 1 + (queuedItemCount * d) / dequeCount;
+        size_t const endItem = 1 + (queuedItemCount * (d + 1)) / dequeCount;
 
-        for (size_t t = 1; t < tasks.size(); ++t)
+        // Worker threads steal from the top, hence get their items in order;
+        // the main thread takes from the bottom, hence we push its items in reverse
+        if (d == 0)
+        {
+            for (size_t i = endItem; i > startItem; --i)
+            {
+                mDeques[d]->Push(i - 1);
+            }
+        }
+        else
         {
-            mRemainingTasks.push_back(&(tasks[t]));
+            for (size_t i = startItem; i < endItem; ++i)
+            {
+                mDeques[d]->Push(i);
+            }
         }
-
-        mTasksToComplete = mRemainingTasks.size();
     }
 
     // Signal threads
-    mWorkerThreadSignal.notify_all();
-
-    // Run the first task on the main thread
-    if (!tasks.empty())
+    mBatchEpoch.fetch_add(1, std::memory_order_seq_cst);
+    if (mParkedWorkerThreadCount.load(std::memory_order_seq_cst) > 0)
     {
-        RunTask(tasks.front());
+        {
+            // Make sure that threads about to park see the new epoch
+            std::unique_lock const lock{ mLock };
+        }
+
+        mWorkerThreadSignal.notify_all();
     }
 
-    // Run the remaining tasks on own thread, if needed
-    RunRemainingTasksLoop();
+    // Run the first item on the main thread
+    RunItem(0);
 
-    // Only returns when there are no more tasks
-    assert(mRemainingTasks.empty());
+    // Help with the remaining items
+    while (RunAvailableItems(0));
 
-    // Wait until all tasks are completed
+    // Wait until all items are completed
+    for (size_t iteration = 0; mItemsToComplete.load(std::memory_order_acquire) != 0; ++iteration)
     {
-        std::unique_lock lock{ mLock };
-
-        if (0 != mTasksToComplete)
+        if (iteration < SpinIterationsBeforeParking)
         {
-            // Wait for signal
+            SpinWait(iteration);
+        }
+        else
+        {
+            std::unique_lock lock{ mLock };
+
+            mIsMainThreadParked.store(true, std::memory_order_seq_cst);
+
             mMainThreadSignal.wait(
                 lock,
                 [this]()
                 {
-                    return 0 == mTasksToComplete;
+                    return 0 == mItemsToComplete.load(std::memory_order_seq_cst);
                 });
 
-            assert(0 == mTasksToComplete);
+            mIsMainThreadParked.store(false, std::memory_order_relaxed);
         }
     }
 }
 
-void ThreadPool::ThreadLoop(ThreadManager & threadManager)
+void ThreadPool::ThreadLoop(
+    size_t dequeIndex,
+    ThreadManager & threadManager)
 {
     //
     // Initialize thread
@@ -131,102 +220,110 @@ void ThreadPool::ThreadLoop(ThreadManager & threadManager)
     // Run thread loop until thread pool is destroyed
     //
 
+    std::uint64_t lastBatchEpoch = 0;
+
     while (true)
     {
-        {
-            std::unique_lock lock{ mLock };
+        //
+        // Wait for a new batch (or for being stopped): spin first, then park
+        //
 
-            if (mIsStop)
+        std::uint64_t batchEpoch;
+        for (size_t iteration = 0; ; ++iteration)
+        {
+            if (mIsStop.load(std::memory_order_relaxed))
             {
                 // We're done!
-                break;
+                LogMessage("Thread exiting");
+                return;
             }
 
-            // Wait for signal that tasks have been queued (or that we've been stopped)
-            mWorkerThreadSignal.wait(
-                lock,
-                [this]()
-                {
-                    return mIsStop || !mRemainingTasks.empty();
-                });
-
-            if (mIsStop)
+            batchEpoch = mBatchEpoch.load(std::memory_order_acquire);
+            if (batchEpoch != lastBatchEpoch)
             {
-                // We're done!
                 break;
             }
+
+            if (iteration < SpinIterationsBeforeParking)
+            {
+                SpinWait(iteration);
+            }
+            else
+            {
+                std::unique_lock lock{ mLock };
+
+                mParkedWorkerThreadCount.fetch_add(1, std::memory_order_seq_cst);
+
+                mWorkerThreadSignal.wait(
+                    lock,
+                    [this, lastBatchEpoch]()
+                    {
+                        return mIsStop.load() || mBatchEpoch.load(std::memory_order_seq_cst) != lastBatchEpoch;
+                    });
+
+                mParkedWorkerThreadCount.fetch_sub(1, std::memory_order_relaxed);
+
+                iteration = 0;
+            }
         }
 
-        // Tasks have been queued...
+        lastBatchEpoch = batchEpoch;
 
-        // ...run the remaining tasks
-        RunRemainingTasksLoop();
-    }
+        // Items have been queued...
 
-    LogMessage("Thread exiting");
+        // ...run them, until there are no more
+        while (RunAvailableItems(dequeIndex));
+    }
 }
 
-void ThreadPool::RunRemainingTasksLoop()
+bool ThreadPool::RunAvailableItems(size_t dequeIndex)
 {
     //
-    // Run tasks until queue is empty
+    // Runs items from our own deque first, then steals from the
+    // others; returns false when all deques appear to be empty
     //
 
-    while (true)
-    {
-        //
-        // De-queue a task
-        //
+    size_t const dequeCount = mDeques.size();
 
-        Task const * task = nullptr;
-        {
-            std::unique_lock const lock{ mLock };
+    size_t item;
+    bool hasRunAny = false;
 
-            if (!mRemainingTasks.empty())
-            {
-                task = mRemainingTasks.front();
-                mRemainingTasks.pop_front();
-            }
-        }
+    for (size_t d = 0; d < dequeCount; ++d)
+    {
+        size_t const victimDequeIndex = (dequeIndex + d) % dequeCount;
+        auto & deque = *mDeques[victimDequeIndex];
 
-        if (task == nullptr)
+        while (victimDequeIndex == 0 && dequeIndex == 0
+            ? deque.Take(item) // We own it
+            : deque.Steal(item))
         {
-            // No more tasks
-            return;
+            RunItem(item);
+            CompleteItem();
+            hasRunAny = true;
         }
+    }
 
-        //
-        // Run the task
-        //
-
-        RunTask(*task);
-
-        //
-        // Signal task completion
-        //
+    if (hasRunAny)
+    {
+        // Try again, there might be something we've missed
+        return true;
+    }
 
+    // We've failed stealing, though some steals might have just lost a race
+    return std::any_of(
+        mDeques.cbegin(),
+        mDeques.cend(),
+        [](auto const & deque)
         {
-            std::unique_lock const lock{ mLock };
-
-            assert(mTasksToComplete > 0);
-
-            --mTasksToComplete;
-            if (0 == mTasksToComplete)
-            {
-                // All tasks completed...
-
-                // ...signal main thread
-                mMainThreadSignal.notify_one();
-            }
-        }
-    }
+            return !deque->IsEmpty();
+        });
 }
 
-void ThreadPool::RunTask(Task const & task)
+void ThreadPool::RunItem(size_t item)
 {
     try
     {
-        task();
+        mBatchRunner(mBatchContext, item);
     }
     catch (std::exception const & e)
     {
@@ -236,4 +333,20 @@ void ThreadPool::RunTask(Task const & task)
 
         // Keep going...
     }
-}
\ No newline at end of file
+}
+
+void ThreadPool::CompleteItem()
+{
+    if (mItemsToComplete.fetch_sub(1, std::memory_order_seq_cst) == 1
+        && mIsMainThreadParked.load(std::memory_order_seq_cst))
+    {
+        // All items completed and the main thread is parked...
+
+        // ...signal main thread
+        {
+            std::unique_lock const lock{ mLock };
+        }
+
+        mMainThreadSignal.notify_one();
+    }
+}
@@ -6,18 +6,28 @@
 #pragma once
 
 #include "ThreadManager.h"
+#include "WorkStealingDeque.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
-#include <deque>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 /*
  * This class implements a thread pool that executes batches of tasks.
  *
+ * The items of a batch are distributed among per-thread work-stealing deques;
+ * each thread works off its own deque first and then steals from the others.
+ *
+ * Between batches, worker threads spin for a short while before parking, so that
+ * back-to-back batches do not pay for a wake-up.
  */
 class ThreadPool final
 {
@@ -52,35 +62,111 @@ public:
         tasks.clear();
     }
 
+    /*
+     * Invokes function(chunkBegin, chunkEnd) over consecutive chunks of [begin, end),
+     * each chunk being at least grain elements long (except possibly the last one).
+     *
+     * The first chunk is guaranteed to run on the main thread.
+     */
+    template<typename TFunction>
+    void ParallelFor(
+        size_t begin,
+        size_t end,
+        size_t grain,
+        TFunction && function)
+    {
+        if (end <= begin)
+        {
+            return;
+        }
+
+        size_t const chunkSize = CalculateChunkSize(end - begin, grain);
+
+        struct Context
+        {
+            size_t Begin;
+            size_t End;
+            size_t ChunkSize;
+            std::remove_reference_t<TFunction> * Function;
+        };
+
+        Context const context{ begin, end, chunkSize, &function };
+
+        RunBatch(
+            (end - begin + chunkSize - 1) / chunkSize,
+            [](void const * batchContext, size_t item)
+            {
+                Context const & ctx = *static_cast<Context const *>(batchContext);
+
+                size_t const chunkBegin = ctx.Begin + item * ctx.ChunkSize;
+                size_t const chunkEnd = std::min(chunkBegin + ctx.ChunkSize, ctx.End);
+
+                (*ctx.Function)(chunkBegin, chunkEnd);
+            },
+            &context);
+    }
+
 private:
 
-    void ThreadLoop(ThreadManager & threadManager);
+    // Runs one item of the current batch
+    using BatchItemRunner = void(*)(void const * batchContext, size_t item);
 
-    void RunRemainingTasksLoop();
+    size_t CalculateChunkSize(
+        size_t count,
+        size_t grain) const
+    {
+        // Aim at a few chunks per thread, so that stealing may even out imbalances
+        size_t const chunkCount = GetParallelism() * ChunksPerThread;
+
+        return std::max(
+            std::max(grain, size_t(1)),
+            (count + chunkCount - 1) / chunkCount);
+    }
 
-    void RunTask(Task const & task);
+    void RunBatch(
+        size_t itemCount,
+        BatchItemRunner runner,
+        void const * batchContext);
+
+    void ThreadLoop(
+        size_t dequeIndex,
+        ThreadManager & threadManager);
+
+    // Returns false when there's nothing left to run
+    bool RunAvailableItems(size_t dequeIndex);
+
+    void RunItem(size_t item);
+
+    void CompleteItem();
 
 private:
 
-    // Our thread lock
-    std::mutex mLock;
+    static size_t constexpr ChunksPerThread = 4;
 
     // Our threads
     std::vector<std::thread> mThreads;
 
-    // The condition variable to wake up threads
-    std::condition_variable mWorkerThreadSignal;
+    // One deque per thread, including the main thread (index 0);
+    // only the main thread pushes into them
+    std::vector<std::unique_ptr<WorkStealingDeque<size_t>>> mDeques;
 
-    // The condition variable to wake up the main thread
-    std::condition_variable mMainThreadSignal;
+    // The current batch; only changed by the main thread when no items are outstanding
+    BatchItemRunner mBatchRunner;
+    void const * mBatchContext;
+
+    // The number of queued items awaiting for completion
+    std::atomic<size_t> mItemsToComplete;
 
-    // The tasks currently awaiting to be picked up;
-    // expected to be empty at each Run invocation
-    std::deque<Task const *> mRemainingTasks;
+    // Incremented at each batch; worker threads wait for it to change
+    std::atomic<std::uint64_t> mBatchEpoch;
 
-    // The number of tasks awaiting for completion
-    size_t mTasksToComplete;
+    // Parking
+    std::mutex mLock;
+    std::condition_variable mWorkerThreadSignal;
+    std::condition_variable mMainThreadSignal;
+    std::atomic<size_t> mParkedWorkerThreadCount;
+    std::atomic<bool> mIsMainThreadParked;
 
     // Set to true when have to stop
-    bool mIsStop;
+    std::atomic<bool> mIsStop;
 };
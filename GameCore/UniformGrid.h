@@ -0,0 +1,284 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-16
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "AABB.h"
+#include "GameGeometry.h"
+#include "GameTypes.h"
+#include "Vectors.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+/*
+ * A uniform grid indexing a set of positions, for spatial queries.
+ *
+ * The grid spans the bounding box of the positions at the moment it is built,
+ * and it is a snapshot: it needs to be re-built whenever positions change.
+ * Elements are stored sorted by cell (counting sort), hence within each cell
+ * they are in increasing index order.
+ *
+ * Queries visit a superset of the elements satisfying the query - i.e. all
+ * the elements of all the cells touched by the query - and callers are expected
+ * to apply their own exact test to each visited element.
+ */
+class UniformGrid final
+{
+public:
+
+    // Cells are enlarged when needed so that there are no more than these many cells per element
+    static size_t constexpr MaxCellsPerElement = 4;
+
+public:
+
+    explicit UniformGrid(float cellSize)
+        : mNominalCellSize(cellSize)
+        , mCellSize(cellSize)
+        , mOrigin(vec2f::zero())
+        , mWidth(0)
+        , mHeight(0)
+        , mCellStarts(1, 0)
+        , mElements()
+        , mElementCells()
+    {
+        assert(cellSize > 0.0f);
+    }
+
+    ElementCount GetElementCount() const
+    {
+        return static_cast<ElementCount>(mElements.size());
+    }
+
+    // The actual cell size, which might be larger than the nominal one
+    float GetCellSize() const
+    {
+        return mCellSize;
+    }
+
+    size_t GetCellCount() const
+    {
+        return mWidth * mHeight;
+    }
+
+    void Build(
+        vec2f const * positions,
+        ElementCount elementCount)
+    {
+        mElements.resize(elementCount);
+        mElementCells.resize(elementCount);
+
+        if (elementCount == 0)
+        {
+            mWidth = 0;
+            mHeight = 0;
+            mCellStarts.assign(1, 0);
+            return;
+        }
+
+        //
+        // Calculate extent and cell size
+        //
+
+        Geometry::AABB extent;
+        for (ElementIndex e = 0; e < elementCount; ++e)
+        {
+            extent.ExtendTo(positions[e]);
+        }
+
+        mOrigin = extent.BottomLeft;
+
+        size_t const maxCells = static_cast<size_t>(elementCount) * MaxCellsPerElement;
+
+        mCellSize = mNominalCellSize;
+        while (true)
+        {
+            mWidth = static_cast<size_t>(extent.GetWidth() / mCellSize) + 1;
+            mHeight = static_cast<size_t>(extent.GetHeight() / mCellSize) + 1;
+
+            if (mWidth * mHeight <= maxCells)
+            {
+                break;
+            }
+
+            // Too sparse, enlarge cells
+            mCellSize *= std::max(
+                std::sqrt(static_cast<float>(mWidth * mHeight) / static_cast<float>(maxCells)),
+                1.1f);
+        }
+
+        //
+        // Counting sort of elements by cell
+        //
+
+        mCellStarts.assign(mWidth * mHeight + 1, 0);
+
+        for (ElementIndex e = 0; e < elementCount; ++e)
+        {
+            size_t const cellIndex = CalculateCellIndex(positions[e]);
+            mElementCells[e] = static_cast<ElementIndex>(cellIndex);
+            ++mCellStarts[cellIndex + 1];
+        }
+
+        for (size_t c = 1; c < mCellStarts.size(); ++c)
+        {
+            mCellStarts[c] += mCellStarts[c - 1];
+        }
+
+        assert(mCellStarts.back() == elementCount);
+
+        // Use the cell starts as insertion cursors, restoring them afterwards
+        for (ElementIndex e = 0; e < elementCount; ++e)
+        {
+            mElements[mCellStarts[mElementCells[e]]++] = e;
+        }
+
+        for (size_t c = mCellStarts.size() - 1; c > 0; --c)
+        {
+            mCellStarts[c] = mCellStarts[c - 1];
+        }
+
+        mCellStarts[0] = 0;
+    }
+
+    /*
+     * Visits the elements that might be within the specified radius of the center.
+     */
+    template<typename TVisitor>
+    void VisitInRadius(
+        vec2f const & center,
+        float radius,
+        TVisitor && visitor) const
+    {
+        float const slackRadius = radius + mCellSize * CellSlack;
+
+        VisitCells(
+            Geometry::AABB(
+                center.x - radius,
+                center.x + radius,
+                center.y + radius,
+                center.y - radius),
+            [&center, slackRadius](vec2f const & cellBottomLeft, vec2f const & cellTopRight)
+            {
+                // Distance between center and cell
+                float const dx = std::max(std::max(cellBottomLeft.x - center.x, center.x - cellTopRight.x), 0.0f);
+                float const dy = std::max(std::max(cellBottomLeft.y - center.y, center.y - cellTopRight.y), 0.0f);
+                return dx * dx + dy * dy <= slackRadius * slackRadius;
+            },
+            std::forward<TVisitor>(visitor));
+    }
+
+    /*
+     * Visits the elements that might be within the specified distance of the segment.
+     */
+    template<typename TVisitor>
+    void VisitNearSegment(
+        vec2f const & startPos,
+        vec2f const & endPos,
+        float radius,
+        TVisitor && visitor) const
+    {
+        // Distance from the cell center within which the cell might be within the radius
+        float const cellRadius = radius + mCellSize * (0.7072f + CellSlack);
+
+        VisitCells(
+            Geometry::AABB(
+                std::min(startPos.x, endPos.x) - radius,
+                std::max(startPos.x, endPos.x) + radius,
+                std::max(startPos.y, endPos.y) + radius,
+                std::min(startPos.y, endPos.y) - radius),
+            [&startPos, &endPos, cellRadius](vec2f const & cellBottomLeft, vec2f const & cellTopRight)
+            {
+                return Segment::DistanceToPoint(startPos, endPos, (cellBottomLeft + cellTopRight) / 2.0f) <= cellRadius;
+            },
+            std::forward<TVisitor>(visitor));
+    }
+
+private:
+
+    // Fraction of cell size by which cell tests are relaxed, to account for rounding
+    static float constexpr CellSlack = 0.001f;
+
+    size_t CalculateCellIndex(vec2f const & position) const
+    {
+        size_t const x = std::min(static_cast<size_t>(std::max((position.x - mOrigin.x) / mCellSize, 0.0f)), mWidth - 1);
+        size_t const y = std::min(static_cast<size_t>(std::max((position.y - mOrigin.y) / mCellSize, 0.0f)), mHeight - 1);
+        return y * mWidth + x;
+    }
+
+    template<typename TCellFilter, typename TVisitor>
+    void VisitCells(
+        Geometry::AABB const & aabb,
+        TCellFilter && cellFilter,
+        TVisitor && visitor) const
+    {
+        if (mWidth == 0)
+        {
+            return;
+        }
+
+        float const left = (aabb.BottomLeft.x - mOrigin.x) / mCellSize;
+        float const right = (aabb.TopRight.x - mOrigin.x) / mCellSize;
+        float const bottom = (aabb.BottomLeft.y - mOrigin.y) / mCellSize;
+        float const top = (aabb.TopRight.y - mOrigin.y) / mCellSize;
+
+        if (right < 0.0f || left >= static_cast<float>(mWidth)
+            || top < 0.0f || bottom >= static_cast<float>(mHeight))
+        {
+            // Entirely outside
+            return;
+        }
+
+        size_t const xStart = static_cast<size_t>(std::max(left, 0.0f));
+        size_t const xEnd = std::min(static_cast<size_t>(right), mWidth - 1) + 1;
+        size_t const yStart = static_cast<size_t>(std::max(bottom, 0.0f));
+        size_t const yEnd = std::min(static_cast<size_t>(top), mHeight - 1) + 1;
+
+        for (size_t y = yStart; y < yEnd; ++y)
+        {
+            for (size_t x = xStart; x < xEnd; ++x)
+            {
+                size_t const cellIndex = y * mWidth + x;
+                if (mCellStarts[cellIndex] == mCellStarts[cellIndex + 1])
+                {
+                    // Empty cell
+                    continue;
+                }
+
+                vec2f const cellBottomLeft = mOrigin + vec2f(static_cast<float>(x), static_cast<float>(y)) * mCellSize;
+                if (!cellFilter(cellBottomLeft, cellBottomLeft + vec2f(mCellSize, mCellSize)))
+                {
+                    continue;
+                }
+
+                for (ElementIndex i = mCellStarts[cellIndex]; i < mCellStarts[cellIndex + 1]; ++i)
+                {
+                    visitor(mElements[i]);
+                }
+            }
+        }
+    }
+
+private:
+
+    float const mNominalCellSize;
+
+    float mCellSize;
+    vec2f mOrigin;
+    size_t mWidth;
+    size_t mHeight;
+
+    // Start of each cell in mElements; one more than the cells, to delimit the last one
+    std::vector<ElementIndex> mCellStarts;
+
+    // Elements sorted by cell
+    std::vector<ElementIndex> mElements;
+
+    // Scratch: cell of each element
+    std::vector<ElementIndex> mElementCells;
+};
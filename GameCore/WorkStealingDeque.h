@@ -0,0 +1,203 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2026-10-16
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/*
+ * This class implements a lock-free, single-owner, multiple-thieves deque
+ * (Chase & Lev, "Dynamic Circular Work-Stealing Deque", with the memory
+ * orderings of Le et al., "Correct and Efficient Work-Stealing for Weak
+ * Memory Models").
+ *
+ * The owner thread pushes and takes at the bottom, while any other thread may
+ * steal from the top.
+ *
+ * Buffers that are outgrown are only released at destruction, as thieves might
+ * still be reading from them.
+ */
+template<typename TElement>
+class WorkStealingDeque final
+{
+    static_assert(std::is_trivially_copyable_v<TElement>);
+
+public:
+
+    explicit WorkStealingDeque(size_t initialCapacity = 64)
+        : mTop(0)
+        , mBottom(0)
+        , mBuffer(nullptr)
+        , mAllBuffers()
+    {
+        size_t capacity = 1;
+        while (capacity < initialCapacity)
+            capacity <<= 1;
+
+        mBuffer.store(MakeBuffer(capacity), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(WorkStealingDeque const &) = delete;
+    WorkStealingDeque & operator=(WorkStealingDeque const &) = delete;
+
+    /*
+     * Owner only.
+     */
+    void Push(TElement element)
+    {
+        std::int64_t const b = mBottom.load(std::memory_order_relaxed);
+        std::int64_t const t = mTop.load(std::memory_order_acquire);
+        Buffer * buffer = mBuffer.load(std::memory_order_relaxed);
+
+        if (b - t > static_cast<std::int64_t>(buffer->Capacity) - 1)
+        {
+            buffer = Grow(buffer, t, b);
+        }
+
+        buffer->Put(b, element);
+
+        std::atomic_thread_fence(std::memory_order_release);
+        mBottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    /*
+     * Owner only. Returns false if the deque is empty.
+     */
+    bool Take(TElement & element)
+    {
+        std::int64_t const b = mBottom.load(std::memory_order_relaxed) - 1;
+        Buffer * const buffer = mBuffer.load(std::memory_order_relaxed);
+        mBottom.store(b, std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::int64_t t = mTop.load(std::memory_order_relaxed);
+
+        if (t > b)
+        {
+            // Empty
+            mBottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        element = buffer->Get(b);
+
+        if (t == b)
+        {
+            // Last element, race against thieves
+            bool const hasWon = mTop.compare_exchange_strong(
+                t,
+                t + 1,
+                std::memory_order_seq_cst,
+                std::memory_order_relaxed);
+
+            mBottom.store(b + 1, std::memory_order_relaxed);
+
+            return hasWon;
+        }
+
+        return true;
+    }
+
+    /*
+     * Any thread. Returns false if the deque is empty or if the
+     * element has been taken by someone else in the meantime.
+     */
+    bool Steal(TElement & element)
+    {
+        std::int64_t t = mTop.load(std::memory_order_acquire);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::int64_t const b = mBottom.load(std::memory_order_acquire);
+
+        if (t >= b)
+        {
+            // Empty
+            return false;
+        }
+
+        Buffer const * const buffer = mBuffer.load(std::memory_order_acquire);
+        element = buffer->Get(t);
+
+        return mTop.compare_exchange_strong(
+            t,
+            t + 1,
+            std::memory_order_seq_cst,
+            std::memory_order_relaxed);
+    }
+
+    /*
+     * Any thread; only a hint when invoked by thieves.
+     */
+    bool IsEmpty() const
+    {
+        std::int64_t const b = mBottom.load(std::memory_order_relaxed);
+        std::int64_t const t = mTop.load(std::memory_order_relaxed);
+        return t >= b;
+    }
+
+private:
+
+    struct Buffer
+    {
+        size_t const Capacity; // Power of two
+        std::unique_ptr<std::atomic<TElement>[]> Elements;
+
+        explicit Buffer(size_t capacity)
+            : Capacity(capacity)
+            , Elements(new std::atomic<TElement>[capacity])
+        {
+            assert((capacity & (capacity - 1)) == 0);
+        }
+
+        inline TElement Get(std::int64_t index) const
+        {
+            return Elements[static_cast<size_t>(index) & (Capacity - 1)].load(std::memory_order_relaxed);
+        }
+
+        inline void Put(std::int64_t index, TElement element)
+        {
+            Elements[static_cast<size_t>(index) & (Capacity - 1)].store(element, std::memory_order_relaxed);
+        }
+    };
+
+    Buffer * MakeBuffer(size_t capacity)
+    {
+        mAllBuffers.emplace_back(std::make_unique<Buffer>(capacity));
+        return mAllBuffers.back().get();
+    }
+
+    Buffer * Grow(
+        Buffer const * oldBuffer,
+        std::int64_t top,
+        std::int64_t bottom)
+    {
+        Buffer * const newBuffer = MakeBuffer(oldBuffer->Capacity * 2);
+        for (std::int64_t i = top; i < bottom; ++i)
+        {
+            newBuffer->Put(i, oldBuffer->Get(i));
+        }
+
+        mBuffer.store(newBuffer, std::memory_order_release);
+
+        return newBuffer;
+    }
+
+private:
+
+    // Separate cache lines, as top is hammered by thieves
+    alignas(64) std::atomic<std::int64_t> mTop;
+    alignas(64) std::atomic<std::int64_t> mBottom;
+    alignas(64) std::atomic<Buffer *> mBuffer;
+
+    // Owner only
+    std::vector<std::unique_ptr<Buffer>> mAllBuffers;
+};
@@ -0,0 +1,235 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2026-10-16
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "SysSpecifics.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/*
+ * A xoshiro128++ pseudo-random number generator (Blackman & Vigna), satisfying
+ * the UniformRandomBitGenerator requirements so that it may be used with the
+ * standard distributions.
+ *
+ * The generator runs LaneCount independent xoshiro128++ states side by side, with
+ * the state of all lanes stored lane-contiguous; on x86 all lanes are advanced with
+ * SSE2, four at a time, elsewhere with a straight loop over plain arrays.
+ * Values are consumed in lane order - the same sequence regardless of whether they
+ * are drawn one at a time or in batches.
+ *
+ * All lanes are seeded from a single 64-bit seed, via SplitMix64 as recommended
+ * by the authors.
+ */
+class Xoshiro128PlusPlus final
+{
+public:
+
+    // Two vectorization words of 32-bit lanes
+    static size_t constexpr LaneCount = 8;
+
+    using result_type = std::uint32_t;
+
+    static constexpr result_type min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+public:
+
+    explicit Xoshiro128PlusPlus(std::uint64_t seed)
+        : mS0()
+        , mS1()
+        , mS2()
+        , mS3()
+        , mBlock()
+        , mBlockIndex(LaneCount) // Block is empty
+    {
+        std::uint64_t splitMixState = seed;
+
+        for (size_t l = 0; l < LaneCount; ++l)
+        {
+            std::uint64_t const r0 = SplitMix64(splitMixState);
+            std::uint64_t const r1 = SplitMix64(splitMixState);
+
+            mS0[l] = static_cast<std::uint32_t>(r0);
+            mS1[l] = static_cast<std::uint32_t>(r0 >> 32);
+            mS2[l] = static_cast<std::uint32_t>(r1);
+            mS3[l] = static_cast<std::uint32_t>(r1 >> 32);
+
+            // The all-zero state is the only one xoshiro can't get out of
+            assert(mS0[l] != 0 || mS1[l] != 0 || mS2[l] != 0 || mS3[l] != 0);
+        }
+    }
+
+    inline result_type operator()()
+    {
+        if (mBlockIndex == LaneCount)
+        {
+            GenerateBlock(mBlock);
+            mBlockIndex = 0;
+        }
+
+        return mBlock[mBlockIndex++];
+    }
+
+    /*
+     * Fills the specified buffer with the next count values; equivalent to invoking
+     * operator() count times.
+     */
+    void Generate(
+        result_type * restrict outValues,
+        size_t count)
+    {
+        // Drain what's left of the current block
+        while (mBlockIndex < LaneCount && count > 0)
+        {
+            *(outValues++) = mBlock[mBlockIndex++];
+            --count;
+        }
+
+        // Generate whole blocks straight into the output
+        for (; count >= LaneCount; count -= LaneCount, outValues += LaneCount)
+        {
+            GenerateBlock(outValues);
+        }
+
+        // Leave the remainder of the last block for later
+        for (; count > 0; --count)
+        {
+            *(outValues++) = operator()();
+        }
+    }
+
+    /*
+     * A fingerprint of the state of the generator; changes whenever a value is drawn.
+     */
+    std::uint64_t GetStateFingerprint() const
+    {
+        // FNV-1a over the state words and the position within the block
+        std::uint64_t hash = 14695981039346656037ull;
+        auto const mix = [&hash](std::uint64_t value)
+        {
+            hash ^= value;
+            hash *= 1099511628211ull;
+        };
+
+        for (size_t l = 0; l < LaneCount; ++l)
+        {
+            mix(mS0[l]);
+            mix(mS1[l]);
+            mix(mS2[l]);
+            mix(mS3[l]);
+        }
+
+        mix(mBlockIndex);
+
+        return hash;
+    }
+
+private:
+
+    static inline std::uint64_t SplitMix64(std::uint64_t & state)
+    {
+        std::uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    static inline std::uint32_t RotL(
+        std::uint32_t x,
+        int k)
+    {
+        return (x << k) | (x >> (32 - k));
+    }
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+    static inline __m128i RotL_4(
+        __m128i x,
+        int k)
+    {
+        return _mm_or_si128(_mm_slli_epi32(x, k), _mm_srli_epi32(x, 32 - k));
+    }
+
+#endif
+
+    inline void GenerateBlock(result_type * restrict outValues)
+    {
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+        static_assert(LaneCount % 4 == 0);
+
+        for (size_t l = 0; l < LaneCount; l += 4)
+        {
+            __m128i s0 = _mm_load_si128(reinterpret_cast<__m128i const *>(mS0 + l));
+            __m128i s1 = _mm_load_si128(reinterpret_cast<__m128i const *>(mS1 + l));
+            __m128i s2 = _mm_load_si128(reinterpret_cast<__m128i const *>(mS2 + l));
+            __m128i s3 = _mm_load_si128(reinterpret_cast<__m128i const *>(mS3 + l));
+
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i *>(outValues + l),
+                _mm_add_epi32(RotL_4(_mm_add_epi32(s0, s3), 7), s0));
+
+            __m128i const t = _mm_slli_epi32(s1, 9);
+
+            s2 = _mm_xor_si128(s2, s0);
+            s3 = _mm_xor_si128(s3, s1);
+            s1 = _mm_xor_si128(s1, s2);
+            s0 = _mm_xor_si128(s0, s3);
+
+            s2 = _mm_xor_si128(s2, t);
+
+            s3 = RotL_4(s3, 11);
+
+            _mm_store_si128(reinterpret_cast<__m128i *>(mS0 + l), s0);
+            _mm_store_si128(reinterpret_cast<__m128i *>(mS1 + l), s1);
+            _mm_store_si128(reinterpret_cast<__m128i *>(mS2 + l), s2);
+            _mm_store_si128(reinterpret_cast<__m128i *>(mS3 + l), s3);
+        }
+
+#else
+
+        for (size_t l = 0; l < LaneCount; ++l)
+        {
+            outValues[l] = RotL(mS0[l] + mS3[l], 7) + mS0[l];
+
+            std::uint32_t const t = mS1[l] << 9;
+
+            mS2[l] ^= mS0[l];
+            mS3[l] ^= mS1[l];
+            mS1[l] ^= mS2[l];
+            mS0[l] ^= mS3[l];
+
+            mS2[l] ^= t;
+
+            mS3[l] = RotL(mS3[l], 11);
+        }
+
+#endif
+    }
+
+private:
+
+    // The state of all lanes
+    alignas(16) std::uint32_t mS0[LaneCount];
+    alignas(16) std::uint32_t mS1[LaneCount];
+    alignas(16) std::uint32_t mS2[LaneCount];
+    alignas(16) std::uint32_t mS3[LaneCount];
+
+    // The last block of values generated for operator(), and the index
+    // of the next value to hand out from it
+    result_type mBlock[LaneCount];
+    size_t mBlockIndex;
+};
@@ -0,0 +1,84 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-17
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#include "CacheCounters.h"
+
+#include <GameCore/SysSpecifics.h>
+
+#if FS_IS_OS_LINUX()
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+namespace {
+
+#if FS_IS_OS_LINUX()
+
+int OpenReadMissesCounter(std::uint64_t cacheId)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config =
+        cacheId
+        | (static_cast<std::uint64_t>(PERF_COUNT_HW_CACHE_OP_READ) << 8)
+        | (static_cast<std::uint64_t>(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+    attr.inherit = 1; // Count the threads started after this one, too
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+std::optional<std::uint64_t> ReadCounter(int fd)
+{
+    std::uint64_t value;
+    if (fd < 0 || read(fd, &value, sizeof(value)) != sizeof(value))
+    {
+        return std::nullopt;
+    }
+
+    return value;
+}
+
+#endif
+
+}
+
+CacheCounters::CacheCounters()
+    : mL1DReadMissesFd(-1)
+    , mLLCReadMissesFd(-1)
+{
+#if FS_IS_OS_LINUX()
+    mL1DReadMissesFd = OpenReadMissesCounter(PERF_COUNT_HW_CACHE_L1D);
+    mLLCReadMissesFd = OpenReadMissesCounter(PERF_COUNT_HW_CACHE_LL);
+#endif
+}
+
+CacheCounters::~CacheCounters()
+{
+#if FS_IS_OS_LINUX()
+    if (mL1DReadMissesFd >= 0)
+        close(mL1DReadMissesFd);
+    if (mLLCReadMissesFd >= 0)
+        close(mLLCReadMissesFd);
+#endif
+}
+
+CacheCounters::Values CacheCounters::Read() const
+{
+    Values values;
+
+#if FS_IS_OS_LINUX()
+    values.L1DReadMisses = ReadCounter(mL1DReadMissesFd);
+    values.LLCReadMisses = ReadCounter(mLLCReadMissesFd);
+#endif
+
+    return values;
+}
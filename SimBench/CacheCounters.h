@@ -0,0 +1,41 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-17
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+/*
+ * Hardware counters of the data cache read misses of this process' threads - this
+ * thread and the threads it starts afterwards.
+ *
+ * Counters are only available on Linux, and only where the kernel exposes them (e.g.
+ * not in most virtual machines); elsewhere, their values are empty.
+ */
+class CacheCounters
+{
+public:
+
+    struct Values
+    {
+        std::optional<std::uint64_t> L1DReadMisses;
+        std::optional<std::uint64_t> LLCReadMisses;
+    };
+
+    CacheCounters();
+
+    ~CacheCounters();
+
+    CacheCounters(CacheCounters const &) = delete;
+    CacheCounters & operator=(CacheCounters const &) = delete;
+
+    Values Read() const;
+
+private:
+
+    int mL1DReadMissesFd;
+    int mLLCReadMissesFd;
+};
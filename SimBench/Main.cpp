@@ -0,0 +1,487 @@
+/***************************************************************************************
+ * Original Author:		Gabriele Giuseppini
+ * Created:				2026-10-16
+ * Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+ ***************************************************************************************/
+
+#include "CacheCounters.h"
+
+#include <Game/FishSpeciesDatabase.h>
+#include <Game/GameEventDispatcher.h>
+#include <Game/GameParameters.h>
+#include <Game/MaterialDatabase.h>
+#include <Game/OceanFloorTerrain.h>
+#include <Game/PerfStats.h>
+#include <Game/Physics.h>
+#include <Game/ResourceLocator.h>
+#include <Game/ShipDeSerializer.h>
+#include <Game/ShipFactory.h>
+#include <Game/ShipStrengthRandomizer.h>
+#include <Game/ShipTexturizer.h>
+#include <Game/ViewModel.h>
+
+#include <GameCore/GameChronometer.h>
+#include <GameCore/GameWallClock.h>
+#include <GameCore/ThreadManager.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define SEPARATOR "------------------------------------------------------"
+
+struct SimBenchOptions
+{
+    std::vector<std::filesystem::path> ShipFilePaths;
+    size_t StepCount;
+    size_t WarmupStepCount;
+    std::optional<size_t> Parallelism;
+    std::optional<std::filesystem::path> ResourceRootPath;
+    bool DoUpdateShipsConcurrently;
+    bool DoUpdateOceanSurfaceConcurrently;
+    bool DoColorSprings;
+    bool DoRunDeterministically;
+    std::optional<std::filesystem::path> WriteHashesFilePath;
+    std::optional<std::filesystem::path> CheckHashesFilePath;
+
+    SimBenchOptions()
+        : ShipFilePaths()
+        , StepCount(1000)
+        , WarmupStepCount(100)
+        , Parallelism()
+        , ResourceRootPath()
+        , DoUpdateShipsConcurrently(true)
+        , DoUpdateOceanSurfaceConcurrently(false)
+        , DoColorSprings(false)
+        , DoRunDeterministically(false)
+        , WriteHashesFilePath()
+        , CheckHashesFilePath()
+    {}
+};
+
+SimBenchOptions ParseOptions(int argc, char ** argv);
+int DoRun(SimBenchOptions const & options, std::string const & argv0);
+void PrintPerfStats(PerfStats const & perfStats, size_t stepCount, GameChronometer::duration totalWallDuration, CacheCounters::Values const & startCacheCounters, CacheCounters::Values const & endCacheCounters);
+void PrintUsage();
+
+int main(int argc, char ** argv)
+{
+    if (argc == 1)
+    {
+        PrintUsage();
+        return 0;
+    }
+
+    try
+    {
+        SimBenchOptions const options = ParseOptions(argc, argv);
+
+        return DoRun(options, argv[0]);
+    }
+    catch (std::exception & ex)
+    {
+        std::cout << "ERROR: " << ex.what() << std::endl;
+        return -1;
+    }
+}
+
+SimBenchOptions ParseOptions(int argc, char ** argv)
+{
+    SimBenchOptions options;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string option(argv[i]);
+        if (option == "-n" || option == "--steps"
+            || option == "-w" || option == "--warmup"
+            || option == "-p" || option == "--parallelism"
+            || option == "-r" || option == "--resources"
+            || option == "--write-hashes"
+            || option == "--check-hashes")
+        {
+            ++i;
+            if (i == argc)
+            {
+                throw std::runtime_error(option + " option specified without a value");
+            }
+
+            std::string const value(argv[i]);
+
+            if (option == "-n" || option == "--steps")
+            {
+                options.StepCount = static_cast<size_t>(std::stoul(value));
+            }
+            else if (option == "-w" || option == "--warmup")
+            {
+                options.WarmupStepCount = static_cast<size_t>(std::stoul(value));
+            }
+            else if (option == "-p" || option == "--parallelism")
+            {
+                options.Parallelism = static_cast<size_t>(std::stoul(value));
+                if (*options.Parallelism == 0)
+                {
+                    throw std::runtime_error("Parallelism must be at least 1");
+                }
+            }
+            else if (option == "--write-hashes")
+            {
+                options.WriteHashesFilePath = std::filesystem::path(value);
+            }
+            else if (option == "--check-hashes")
+            {
+                options.CheckHashesFilePath = std::filesystem::path(value);
+            }
+            else
+            {
+                options.ResourceRootPath = std::filesystem::path(value);
+            }
+        }
+        else if (option == "-s" || option == "--serial-ships")
+        {
+            options.DoUpdateShipsConcurrently = false;
+        }
+        else if (option == "-c" || option == "--color-springs")
+        {
+            options.DoColorSprings = true;
+        }
+        else if (option == "-o" || option == "--concurrent-ocean")
+        {
+            options.DoUpdateOceanSurfaceConcurrently = true;
+        }
+        else if (option == "-d" || option == "--deterministic")
+        {
+            options.DoRunDeterministically = true;
+        }
+        else if (!option.empty() && option[0] == '-')
+        {
+            throw std::runtime_error("Unrecognized option '" + option + "'");
+        }
+        else
+        {
+            options.ShipFilePaths.emplace_back(option);
+        }
+    }
+
+    if (options.ShipFilePaths.empty())
+    {
+        throw std::runtime_error("No ship file specified");
+    }
+
+    return options;
+}
+
+int DoRun(
+    SimBenchOptions const & options,
+    std::string const & argv0)
+{
+    ThreadManager::InitializeThisThread();
+
+    ResourceLocator const resourceLocator = options.ResourceRootPath.has_value()
+        ? ResourceLocator(*options.ResourceRootPath)
+        : ResourceLocator(argv0);
+
+    //
+    // Load databases
+    //
+
+    FishSpeciesDatabase const fishSpeciesDatabase = FishSpeciesDatabase::Load(resourceLocator);
+    MaterialDatabase const materialDatabase = MaterialDatabase::Load(resourceLocator);
+
+    ShipTexturizer const shipTexturizer(materialDatabase, resourceLocator);
+    ShipStrengthRandomizer const shipStrengthRandomizer;
+
+    //
+    // Load expected hashes
+    //
+
+    std::vector<std::uint64_t> expectedHashes;
+    if (options.CheckHashesFilePath.has_value())
+    {
+        std::ifstream hashesFile(*options.CheckHashesFilePath);
+        if (!hashesFile)
+        {
+            throw std::runtime_error("Cannot open hashes file '" + options.CheckHashesFilePath->string() + "'");
+        }
+
+        std::string line;
+        while (std::getline(hashesFile, line))
+        {
+            if (!line.empty())
+            {
+                expectedHashes.push_back(static_cast<std::uint64_t>(std::stoull(line, nullptr, 16)));
+            }
+        }
+    }
+
+    //
+    // Create world
+    //
+
+    // A deterministic run needs a clock that only moves with the simulation; this has
+    // to happen before the world is created, as parts of it take the time at creation
+    if (options.DoRunDeterministically)
+    {
+        GameWallClock::GetInstance().SetSimulated();
+    }
+
+    auto gameEventDispatcher = std::make_shared<GameEventDispatcher>();
+
+    GameParameters gameParameters;
+    gameParameters.DoUpdateShipsConcurrently = options.DoUpdateShipsConcurrently;
+    gameParameters.DoUpdateOceanSurfaceConcurrently = options.DoUpdateOceanSurfaceConcurrently;
+    gameParameters.DoColorSpringsForParallelism = options.DoColorSprings;
+    gameParameters.DoRunDeterministically = options.DoRunDeterministically;
+
+    // The view only affects world elements that depend on what's visible (e.g. fishes);
+    // we use the same view that the game starts with
+    Render::ViewModel const viewModel(1.0f, vec2f::zero(), DisplayLogicalSize(1920, 1080), 1);
+
+    auto world = std::make_unique<Physics::World>(
+        OceanFloorTerrain::LoadFromImage(resourceLocator.GetDefaultOceanFloorTerrainFilePath()),
+        false, // areCloudShadowsEnabled
+        fishSpeciesDatabase,
+        gameEventDispatcher,
+        gameParameters,
+        viewModel.GetVisibleWorld());
+
+    //
+    // Load ships
+    //
+
+    for (auto const & shipFilePath : options.ShipFilePaths)
+    {
+        auto shipDefinition = ShipDeSerializer::LoadShip(shipFilePath, materialDatabase);
+
+        auto [ship, textureImage] = ShipFactory::Create(
+            world->GetNextShipId(),
+            *world,
+            std::move(shipDefinition),
+            ShipLoadOptions(),
+            materialDatabase,
+            shipTexturizer,
+            shipStrengthRandomizer,
+            gameEventDispatcher,
+            gameParameters);
+
+        std::cout << "  Loaded " << shipFilePath << ": " << ship->GetPointCount() << " points" << std::endl;
+
+        world->AddShip(std::move(ship));
+    }
+
+    //
+    // Create threads
+    //
+
+    // The counters only count the threads started after them
+    CacheCounters const cacheCounters;
+
+    ThreadManager threadManager(
+        false, // No rendering
+        options.Parallelism.value_or(ThreadManager::GetNumberOfProcessors()));
+
+    if (options.Parallelism.has_value() && threadManager.GetSimulationParallelism() != *options.Parallelism)
+    {
+        std::cout << "  WARNING: parallelism capped at " << threadManager.GetSimulationParallelism() << std::endl;
+    }
+
+    std::cout << SEPARATOR << std::endl;
+    std::cout << "Running sim-bench:" << std::endl;
+    std::cout << "  ships       : " << world->GetShipCount() << std::endl;
+    std::cout << "  warmup steps: " << options.WarmupStepCount << std::endl;
+    std::cout << "  steps       : " << options.StepCount << std::endl;
+    std::cout << "  parallelism : " << threadManager.GetSimulationParallelism() << std::endl;
+    std::cout << "  ship updates: " << (gameParameters.DoUpdateShipsConcurrently && !gameParameters.DoRunDeterministically ? "concurrent" : "serial") << std::endl;
+    std::cout << "  ocean update: " << (gameParameters.DoUpdateOceanSurfaceConcurrently && !gameParameters.DoRunDeterministically ? "concurrent with ships" : "serial") << std::endl;
+    std::cout << "  springs     : " << (gameParameters.DoColorSpringsForParallelism ? "colored" : "uncolored") << std::endl;
+    std::cout << "  determinism : " << (gameParameters.DoRunDeterministically ? "on" : "off") << std::endl;
+
+    //
+    // Run
+    //
+
+    PerfStats perfStats;
+
+    bool const doHash = options.WriteHashesFilePath.has_value() || options.CheckHashesFilePath.has_value();
+    std::vector<std::uint64_t> hashes;
+    GameChronometer::duration hashingDuration = GameChronometer::duration::zero();
+
+    auto const runSteps = [&](size_t stepCount)
+    {
+        for (size_t s = 0; s < stepCount; ++s)
+        {
+            auto const startTime = GameChronometer::now();
+
+            world->Update(
+                gameParameters,
+                viewModel.GetVisibleWorld(),
+                StressRenderModeType::None,
+                threadManager,
+                perfStats);
+
+            gameEventDispatcher->Flush();
+
+            perfStats.TotalNetUpdateDuration.Update(GameChronometer::now() - startTime);
+            perfStats.TotalUpdateDuration.Update(GameChronometer::now() - startTime);
+
+            if (doHash)
+            {
+                auto const hashStartTime = GameChronometer::now();
+
+                hashes.push_back(world->CalculateStateHash());
+
+                hashingDuration += GameChronometer::now() - hashStartTime;
+            }
+        }
+    };
+
+    runSteps(options.WarmupStepCount);
+
+    PerfStats const warmupPerfStats = perfStats;
+
+    auto const startCacheCounters = cacheCounters.Read();
+    auto const startTime = GameChronometer::now();
+    hashingDuration = GameChronometer::duration::zero();
+
+    runSteps(options.StepCount);
+
+    // Hashing is not part of the simulation
+    auto const totalWallDuration = GameChronometer::now() - startTime - hashingDuration;
+    auto const endCacheCounters = cacheCounters.Read();
+
+    PrintPerfStats(perfStats - warmupPerfStats, options.StepCount, totalWallDuration, startCacheCounters, endCacheCounters);
+
+    //
+    // Hashes
+    //
+
+    if (options.WriteHashesFilePath.has_value())
+    {
+        std::ofstream hashesFile(*options.WriteHashesFilePath);
+        if (!hashesFile)
+        {
+            throw std::runtime_error("Cannot create hashes file '" + options.WriteHashesFilePath->string() + "'");
+        }
+
+        hashesFile << std::hex << std::setfill('0');
+        for (auto const hash : hashes)
+        {
+            hashesFile << std::setw(16) << hash << std::endl;
+        }
+
+        std::cout << "  Written " << hashes.size() << " step hashes to " << *options.WriteHashesFilePath << std::endl;
+    }
+
+    if (options.CheckHashesFilePath.has_value())
+    {
+        std::cout << SEPARATOR << std::endl;
+
+        for (size_t s = 0; s < hashes.size() && s < expectedHashes.size(); ++s)
+        {
+            if (hashes[s] != expectedHashes[s])
+            {
+                std::cout << "Hash check FAILED: first divergence at step " << s << std::endl;
+                return 1;
+            }
+        }
+
+        if (hashes.size() != expectedHashes.size())
+        {
+            std::cout << "Hash check FAILED: " << hashes.size() << " steps run, " << expectedHashes.size() << " steps expected" << std::endl;
+            return 1;
+        }
+
+        std::cout << "Hash check passed: " << hashes.size() << " steps" << std::endl;
+    }
+
+    return 0;
+}
+
+void PrintPerfStats(
+    PerfStats const & perfStats,
+    size_t stepCount,
+    GameChronometer::duration totalWallDuration,
+    CacheCounters::Values const & startCacheCounters,
+    CacheCounters::Values const & endCacheCounters)
+{
+    float const totalWallSeconds = std::chrono::duration_cast<std::chrono::duration<float>>(totalWallDuration).count();
+
+    std::cout << SEPARATOR << std::endl;
+    std::cout << "Results (per step averages):" << std::endl;
+
+    std::cout << std::fixed << std::setprecision(3);
+
+    std::cout << "  Update            : " << perfStats.TotalUpdateDuration.ToRatio<std::chrono::microseconds>() << " us" << std::endl;
+    std::cout << "    Ocean surface   : " << perfStats.TotalOceanSurfaceUpdateDuration.ToRatio<std::chrono::microseconds>() << " us" << std::endl;
+    std::cout << "    Ships           : " << perfStats.TotalShipsUpdateDuration.ToRatio<std::chrono::microseconds>() << " us" << std::endl;
+    std::cout << "      Springs       : " << perfStats.TotalShipsSpringsUpdateDuration.ToRatio<std::chrono::microseconds>() << " us (per ship)" << std::endl;
+
+    float const taskGraphDuration = perfStats.TotalShipsUpdateTaskGraphDuration.ToRatio<std::chrono::microseconds>();
+    float const taskGraphTasksDuration = perfStats.TotalShipsUpdateTaskGraphTasksDuration.ToRatio<std::chrono::microseconds>();
+    std::cout << "      Task graph    : " << taskGraphDuration << " us (per ship), tasks " << taskGraphTasksDuration << " us";
+    if (taskGraphDuration > 0.0f)
+    {
+        // Above 1 when tasks overlap
+        std::cout << ", overlap " << taskGraphTasksDuration / taskGraphDuration << "x";
+    }
+
+    std::cout << std::endl;
+    std::cout << "    Fishes          : " << perfStats.TotalFishUpdateDuration.ToRatio<std::chrono::microseconds>() << " us" << std::endl;
+
+    std::cout << "  Light diffusion   : " << perfStats.LightDiffusionHits.GetCount() << " hits, "
+        << perfStats.LightDiffusionPartialHits.GetCount() << " partial hits, "
+        << perfStats.LightDiffusionMisses.GetCount() << " misses" << std::endl;
+
+    auto const printCacheMisses = [stepCount](std::optional<std::uint64_t> const & start, std::optional<std::uint64_t> const & end)
+    {
+        if (start.has_value() && end.has_value() && stepCount > 0)
+        {
+            // Includes hashing, if any
+            std::cout << static_cast<float>(*end - *start) / static_cast<float>(stepCount) << " read misses" << std::endl;
+        }
+        else
+        {
+            std::cout << "unavailable" << std::endl;
+        }
+    };
+
+    std::cout << "  L1D cache         : ";
+    printCacheMisses(startCacheCounters.L1DReadMisses, endCacheCounters.L1DReadMisses);
+    std::cout << "  Last-level cache  : ";
+    printCacheMisses(startCacheCounters.LLCReadMisses, endCacheCounters.LLCReadMisses);
+
+    std::cout << "  Total wall time   : " << totalWallSeconds << " s" << std::endl;
+    if (totalWallSeconds > 0.0f)
+    {
+        std::cout << "  Throughput        : " << static_cast<float>(stepCount) / totalWallSeconds << " steps/s" << std::endl;
+    }
+}
+
+void PrintUsage()
+{
+    std::cout << std::endl;
+    std::cout << "Usage:" << std::endl;
+    std::cout << " SimBench <ship_file> [<ship_file> ...] [-n, --steps <count>] [-w, --warmup <count>]" << std::endl;
+    std::cout << "          [-p, --parallelism <threads>] [-r, --resources <root_dir>] [-s, --serial-ships]" << std::endl;
+    std::cout << "          [-c, --color-springs] [-o, --concurrent-ocean] [-d, --deterministic]" << std::endl;
+    std::cout << "          [--write-hashes <file>] [--check-hashes <file>]" << std::endl;
+    std::cout << std::endl;
+    std::cout << " <root_dir> is the directory containing the 'Data' folder; it defaults to the directory" << std::endl;
+    std::cout << " of this executable." << std::endl;
+    std::cout << " Multiple ships are updated concurrently, unless -s is specified." << std::endl;
+    std::cout << " With -c, springs are colored at load time so that spring forces need no per-thread buffers." << std::endl;
+    std::cout << " With -o, the ocean surface is updated concurrently with ships." << std::endl;
+    std::cout << " With -d, the simulation produces the same results regardless of parallelism, at the" << std::endl;
+    std::cout << " cost of some concurrency; -s and -o are then ignored." << std::endl;
+    std::cout << " --write-hashes writes a hash of the simulation state after each step (warmup included)," << std::endl;
+    std::cout << " and --check-hashes compares against a file written earlier, reporting the first step" << std::endl;
+    std::cout << " at which the two runs diverge." << std::endl;
+    std::cout << " Cache misses are reported where the system exposes hardware counters (Linux only)." << std::endl;
+}
@@ -5,8 +5,10 @@
 
 #include <GameCore/GameTypes.h>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <random>
 
 #include "gtest/gtest.h"
 
@@ -349,6 +351,94 @@ TEST(AlgorithmsTests, DiffuseLight_SSEVectorized_8Lamps)
 }
 #endif
 
+void RunDiffuseLightTiledTest(bool doShufflePoints)
+{
+    std::mt19937 randomEngine(42);
+    std::uniform_real_distribution<float> unitDistribution(0.0f, 1.0f);
+
+    // Points on a 64x32 grid, with random plane IDs
+    ElementCount constexpr PointCount = 64 * 32;
+    auto pointPositions = make_unique_buffer_aligned_to_vectorization_word<vec2f>(PointCount);
+    auto pointPlaneIds = make_unique_buffer_aligned_to_vectorization_word<PlaneId>(PointCount);
+    for (ElementIndex p = 0; p < PointCount; ++p)
+    {
+        pointPositions[p] = vec2f(static_cast<float>(p % 64), static_cast<float>(p / 64));
+        pointPlaneIds[p] = static_cast<PlaneId>(unitDistribution(randomEngine) * 10.0f);
+    }
+
+    if (doShufflePoints)
+    {
+        std::shuffle(pointPositions.get(), pointPositions.get() + PointCount, randomEngine);
+    }
+
+    // Lamps around the grid, some of them off
+    ElementCount constexpr LampCount = 100;
+    auto lampPositions = make_unique_buffer_aligned_to_vectorization_word<vec2f>(LampCount);
+    auto lampPlaneIds = make_unique_buffer_aligned_to_vectorization_word<PlaneId>(LampCount);
+    auto lampDistanceCoeffs = make_unique_buffer_aligned_to_vectorization_word<float>(LampCount);
+    auto lampSpreadMaxDistances = make_unique_buffer_aligned_to_vectorization_word<float>(LampCount);
+    for (ElementIndex l = 0; l < LampCount; ++l)
+    {
+        lampPositions[l] = vec2f(unitDistribution(randomEngine) * 80.0f - 8.0f, unitDistribution(randomEngine) * 48.0f - 8.0f);
+        lampPlaneIds[l] = static_cast<PlaneId>(unitDistribution(randomEngine) * 10.0f);
+        lampSpreadMaxDistances[l] = 1.0f + unitDistribution(randomEngine) * 10.0f;
+        lampDistanceCoeffs[l] = (l % 5 == 0) ? 0.0f : 0.05f + unitDistribution(randomEngine) * 0.2f;
+    }
+
+    auto expectedLightBuffer = make_unique_buffer_aligned_to_vectorization_word<float>(PointCount);
+    Algorithms::DiffuseLight_Naive(
+        pointPositions.get(),
+        pointPlaneIds.get(),
+        PointCount,
+        lampPositions.get(),
+        lampPlaneIds.get(),
+        lampDistanceCoeffs.get(),
+        lampSpreadMaxDistances.get(),
+        LampCount,
+        expectedLightBuffer.get());
+
+    Algorithms::DiffuseLightTiles<vec2f> tiles;
+    Algorithms::PrepareDiffuseLightTiles(
+        PointCount,
+        pointPositions.get(),
+        pointPlaneIds.get(),
+        lampPositions.get(),
+        lampPlaneIds.get(),
+        lampDistanceCoeffs.get(),
+        lampSpreadMaxDistances.get(),
+        LampCount,
+        tiles);
+
+    EXPECT_GT(tiles.Width * tiles.Height, 1);
+
+    // Tiles have fewer lamps than the whole ship
+    for (int t = 0; t < tiles.Width * tiles.Height; ++t)
+    {
+        EXPECT_LT(tiles.TileLampStarts[t + 1] - tiles.TileLampStarts[t], LampCount);
+    }
+
+    auto outLightBuffer = make_unique_buffer_aligned_to_vectorization_word<float>(PointCount);
+
+    // Two halves, as if run by two threads
+    Algorithms::DiffuseLight_Tiled(0, PointCount / 2, pointPositions.get(), pointPlaneIds.get(), tiles, outLightBuffer.get());
+    Algorithms::DiffuseLight_Tiled(PointCount / 2, PointCount, pointPositions.get(), pointPlaneIds.get(), tiles, outLightBuffer.get());
+
+    for (ElementIndex p = 0; p < PointCount; ++p)
+    {
+        EXPECT_NEAR(expectedLightBuffer[p], outLightBuffer[p], 0.0001f);
+    }
+}
+
+TEST(AlgorithmsTests, DiffuseLight_Tiled_MatchesNaive)
+{
+    RunDiffuseLightTiledTest(false);
+}
+
+TEST(AlgorithmsTests, DiffuseLight_Tiled_MatchesNaive_ScatteredPoints)
+{
+    RunDiffuseLightTiledTest(true);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // BufferSmoothing
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -410,4 +500,214 @@ TEST(AlgorithmsTests, SmoothBufferAndAdd_12_5_SSEVectorized)
 {
     RunSmoothBufferAndAddTest_12_5(Algorithms::SmoothBufferAndAdd_SSEVectorized<12, 5>);
 }
-#endif
\ No newline at end of file
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// Shallow water
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+    // Odd, to exercise the non-vectorized remainder
+    size_t constexpr ShallowWaterTestCount = 23;
+
+    struct ShallowWaterTestFields
+    {
+        std::vector<float> Heights; // ShallowWaterTestCount + one before
+        std::vector<float> Velocities; // ShallowWaterTestCount + one before + one after
+
+        ShallowWaterTestFields()
+        {
+            std::mt19937 randomEngine(42);
+            std::uniform_real_distribution<float> heightDistribution(45.0f, 55.0f);
+            std::uniform_real_distribution<float> velocityDistribution(-2.0f, 2.0f);
+
+            for (size_t i = 0; i < ShallowWaterTestCount + 1; ++i)
+            {
+                Heights.push_back(heightDistribution(randomEngine));
+            }
+
+            for (size_t i = 0; i < ShallowWaterTestCount + 2; ++i)
+            {
+                Velocities.push_back(velocityDistribution(randomEngine));
+            }
+        }
+    };
+}
+
+template<typename Algorithm>
+void RunUpdateShallowWaterHeightsTest(Algorithm algorithm)
+{
+    ShallowWaterTestFields fields;
+
+    std::vector<float> heights = fields.Heights;
+
+    algorithm(
+        heights.data() + 1,
+        fields.Velocities.data() + 1,
+        ShallowWaterTestCount,
+        0.25f);
+
+    EXPECT_EQ(fields.Heights[0], heights[0]);
+
+    for (size_t i = 1; i < ShallowWaterTestCount + 1; ++i)
+    {
+        EXPECT_FLOAT_EQ(
+            fields.Heights[i] * (1.0f + 0.25f * (fields.Velocities[i] - fields.Velocities[i + 1])),
+            heights[i]);
+    }
+}
+
+TEST(AlgorithmsTests, UpdateShallowWaterHeights_Naive)
+{
+    RunUpdateShallowWaterHeightsTest(Algorithms::UpdateShallowWaterHeights_Naive);
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+TEST(AlgorithmsTests, UpdateShallowWaterHeights_SSEVectorized)
+{
+    RunUpdateShallowWaterHeightsTest(Algorithms::UpdateShallowWaterHeights_SSEVectorized);
+}
+#endif
+
+template<typename Algorithm>
+void RunUpdateShallowWaterVelocitiesTest(Algorithm algorithm)
+{
+    ShallowWaterTestFields fields;
+
+    std::vector<float> newVelocities(ShallowWaterTestCount + 2, 1000.0f);
+
+    algorithm(
+        fields.Heights.data() + 1,
+        fields.Velocities.data() + 1,
+        newVelocities.data() + 1,
+        ShallowWaterTestCount,
+        0.8f,
+        0.1f,
+        3.0f);
+
+    EXPECT_EQ(1000.0f, newVelocities[0]);
+
+    for (size_t i = 1; i < ShallowWaterTestCount + 1; ++i)
+    {
+        EXPECT_FLOAT_EQ(
+            0.8f * fields.Velocities[i] + 0.1f * (fields.Velocities[i - 1] + fields.Velocities[i + 1])
+            - 3.0f * (fields.Heights[i] - fields.Heights[i - 1]),
+            newVelocities[i]);
+    }
+
+    EXPECT_EQ(1000.0f, newVelocities[ShallowWaterTestCount + 1]);
+}
+
+TEST(AlgorithmsTests, UpdateShallowWaterVelocities_Naive)
+{
+    RunUpdateShallowWaterVelocitiesTest(Algorithms::UpdateShallowWaterVelocities_Naive);
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+TEST(AlgorithmsTests, UpdateShallowWaterVelocities_SSEVectorized)
+{
+    RunUpdateShallowWaterVelocitiesTest(Algorithms::UpdateShallowWaterVelocities_SSEVectorized);
+}
+#endif
+
+namespace {
+
+    size_t constexpr HeightFieldTestSampleCount = 64;
+    float constexpr HeightFieldTestOriginOffset = 100.0f;
+    float constexpr HeightFieldTestDx = 200.0f / static_cast<float>(HeightFieldTestSampleCount - 1);
+
+    struct HeightFieldTestData
+    {
+        std::vector<float> Samples; // (value, next value - value) pairs
+        std::vector<vec2f> Positions;
+
+        HeightFieldTestData()
+        {
+            std::mt19937 randomEngine(42);
+            std::uniform_real_distribution<float> heightDistribution(-5.0f, 5.0f);
+            std::uniform_real_distribution<float> xDistribution(-HeightFieldTestOriginOffset, HeightFieldTestOriginOffset - 0.01f);
+            std::uniform_real_distribution<float> yDistribution(-10.0f, 10.0f);
+
+            std::vector<float> values;
+            for (size_t i = 0; i < HeightFieldTestSampleCount + 1; ++i)
+            {
+                values.push_back(heightDistribution(randomEngine));
+            }
+
+            for (size_t i = 0; i < HeightFieldTestSampleCount; ++i)
+            {
+                Samples.push_back(values[i]);
+                Samples.push_back(values[i + 1] - values[i]);
+            }
+
+            // Exercise the boundaries
+            Positions.emplace_back(-HeightFieldTestOriginOffset, 0.0f);
+            Positions.emplace_back(0.0f, 0.0f);
+
+            for (size_t i = 0; i < 21; ++i)
+            {
+                Positions.emplace_back(xDistribution(randomEngine), yDistribution(randomEngine));
+            }
+        }
+
+        float CalculateHeight(vec2f const & position) const
+        {
+            float const sampleIndexF = (position.x + HeightFieldTestOriginOffset) / HeightFieldTestDx;
+            size_t const sampleIndexI = static_cast<size_t>(sampleIndexF);
+            return Samples[sampleIndexI * 2] + Samples[sampleIndexI * 2 + 1] * (sampleIndexF - static_cast<float>(sampleIndexI));
+        }
+    };
+}
+
+template<typename Algorithm>
+void RunSampleHeightFieldTest(
+    Algorithm algorithm,
+    bool doCalculateDepths)
+{
+    HeightFieldTestData data;
+
+    std::vector<float> values(data.Positions.size(), 0.0f);
+
+    algorithm(
+        data.Positions.data(),
+        data.Positions.size(),
+        data.Samples.data(),
+        HeightFieldTestOriginOffset,
+        HeightFieldTestDx,
+        values.data());
+
+    // Not exact, as with fast math the compiler is free to re-associate and contract operations
+    float constexpr Tolerance = 0.0001f;
+
+    for (size_t i = 0; i < data.Positions.size(); ++i)
+    {
+        float const expectedHeight = data.CalculateHeight(data.Positions[i]);
+        if (doCalculateDepths)
+            EXPECT_NEAR(expectedHeight - data.Positions[i].y, values[i], Tolerance);
+        else
+            EXPECT_NEAR(expectedHeight, values[i], Tolerance);
+    }
+}
+
+TEST(AlgorithmsTests, SampleHeightField_Heights_Naive)
+{
+    RunSampleHeightFieldTest(Algorithms::SampleHeightField_Naive<false, vec2f>, false);
+}
+
+TEST(AlgorithmsTests, SampleHeightField_Depths_Naive)
+{
+    RunSampleHeightFieldTest(Algorithms::SampleHeightField_Naive<true, vec2f>, true);
+}
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+TEST(AlgorithmsTests, SampleHeightField_Heights_SSEVectorized)
+{
+    RunSampleHeightFieldTest(Algorithms::SampleHeightField_SSEVectorized<false, vec2f>, false);
+}
+
+TEST(AlgorithmsTests, SampleHeightField_Depths_SSEVectorized)
+{
+    RunSampleHeightFieldTest(Algorithms::SampleHeightField_SSEVectorized<true, vec2f>, true);
+}
+#endif
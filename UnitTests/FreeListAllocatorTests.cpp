@@ -0,0 +1,116 @@
+#include <GameCore/FreeListAllocator.h>
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+
+TEST(FreeListAllocatorTests, Allocate_HandsOutLowerSlotsFirst)
+{
+    FreeListAllocator<2> allocator(10, 3);
+
+    EXPECT_EQ(10u, allocator.Allocate(0, false));
+    EXPECT_EQ(11u, allocator.Allocate(1, false));
+    EXPECT_EQ(12u, allocator.Allocate(0, false));
+
+    EXPECT_EQ(0u, allocator.GetFreeSlotCount());
+}
+
+TEST(FreeListAllocatorTests, Allocate_ReturnsNoneWhenFull)
+{
+    FreeListAllocator<1> allocator(10, 2);
+
+    allocator.Allocate(0, false);
+    allocator.Allocate(0, false);
+
+    EXPECT_EQ(NoneElementIndex, allocator.Allocate(0, false));
+}
+
+TEST(FreeListAllocatorTests, Allocate_ReusesOldestWhenFull)
+{
+    FreeListAllocator<2> allocator(10, 3);
+
+    allocator.Allocate(0, false); // 10
+    allocator.Allocate(0, false); // 11
+    allocator.Allocate(1, false); // 12
+
+    // 10 is the oldest
+    EXPECT_EQ(10u, allocator.Allocate(1, true));
+    EXPECT_EQ(11u, allocator.GetOldestSlot());
+
+    ASSERT_EQ(1u, allocator.GetSlots(0).size());
+    EXPECT_EQ(11u, allocator.GetSlots(0)[0]);
+    ASSERT_EQ(2u, allocator.GetSlots(1).size());
+
+    // 11 is now the oldest
+    EXPECT_EQ(11u, allocator.Allocate(1, true));
+    EXPECT_EQ(12u, allocator.GetOldestSlot());
+    EXPECT_EQ(0u, allocator.GetSlots(0).size());
+}
+
+TEST(FreeListAllocatorTests, Release_MakesSlotAvailable)
+{
+    FreeListAllocator<1> allocator(10, 3);
+
+    allocator.Allocate(0, false); // 10
+    allocator.Allocate(0, false); // 11
+    allocator.Allocate(0, false); // 12
+
+    allocator.Release(11);
+
+    EXPECT_FALSE(allocator.IsAllocated(11));
+    EXPECT_EQ(1u, allocator.GetFreeSlotCount());
+    EXPECT_EQ(11u, allocator.Allocate(0, false));
+    EXPECT_TRUE(allocator.IsAllocated(11));
+}
+
+TEST(FreeListAllocatorTests, Release_UpdatesAgeOrder)
+{
+    FreeListAllocator<1> allocator(0, 3);
+
+    allocator.Allocate(0, false); // 0
+    allocator.Allocate(0, false); // 1
+    allocator.Allocate(0, false); // 2
+
+    allocator.Release(0);
+    EXPECT_EQ(1u, allocator.GetOldestSlot());
+
+    // Takes free slot, becomes newest
+    EXPECT_EQ(0u, allocator.Allocate(0, true));
+    EXPECT_EQ(1u, allocator.GetOldestSlot());
+
+    // Middle release
+    allocator.Release(2);
+    EXPECT_EQ(2u, allocator.Allocate(0, true));
+
+    // Order is now 1, 0, 2
+    EXPECT_EQ(1u, allocator.Allocate(0, true));
+    EXPECT_EQ(0u, allocator.Allocate(0, true));
+    EXPECT_EQ(2u, allocator.Allocate(0, true));
+}
+
+TEST(FreeListAllocatorTests, Release_KeepsKindSpansDense)
+{
+    FreeListAllocator<2> allocator(0, 6);
+
+    for (int i = 0; i < 6; ++i)
+    {
+        allocator.Allocate(i % 2, false);
+    }
+
+    // Release while visiting backwards, as the update loops do
+    auto const & kind0Slots = allocator.GetSlots(0);
+    for (size_t i = kind0Slots.size(); i-- > 0; )
+    {
+        if (kind0Slots[i] != 2)
+        {
+            allocator.Release(kind0Slots[i]);
+        }
+    }
+
+    ASSERT_EQ(1u, allocator.GetSlots(0).size());
+    EXPECT_EQ(2u, allocator.GetSlots(0)[0]);
+
+    auto kind1Slots = allocator.GetSlots(1);
+    std::sort(kind1Slots.begin(), kind1Slots.end());
+    EXPECT_EQ(std::vector<ElementIndex>({ 1, 3, 5 }), kind1Slots);
+}
@@ -1,9 +1,16 @@
 #include <Game/GameEventDispatcher.h>
 
+#include <GameCore/TaskGraph.h>
+#include <GameCore/ThreadManager.h>
+#include <GameCore/ThreadPool.h>
+
 #include "Utils.h"
 
 #include "gmock/gmock.h"
 
+#include <thread>
+#include <vector>
+
 class _MockGameEventHandler
     : public IStructuralGameEventHandler
     , public ILifecycleGameEventHandler
@@ -133,4 +140,101 @@ TEST(GameEventDispatcherTests, ClearsStateAtUpdate)
     dispatcher.Flush();
 
     Mock::VerifyAndClear(&handler);
-}
\ No newline at end of file
+}
+TEST(GameEventDispatcherTests, DefersEventsFiredOnOtherThreads_UntilFlush)
+{
+    MockHandler handler;
+
+    GameEventDispatcher dispatcher;
+    dispatcher.RegisterLifecycleEventHandler(&handler);
+
+    EXPECT_CALL(handler, OnSinkingBegin(_)).Times(0);
+
+    std::thread t(
+        [&dispatcher]()
+        {
+            dispatcher.OnSinkingBegin(7);
+            dispatcher.OnSinkingBegin(3);
+        });
+
+    t.join();
+
+    Mock::VerifyAndClear(&handler);
+
+    auto const ownerThreadId = std::this_thread::get_id();
+
+    {
+        InSequence s;
+
+        EXPECT_CALL(handler, OnSinkingBegin(7))
+            .WillOnce([ownerThreadId](ShipId) { EXPECT_EQ(ownerThreadId, std::this_thread::get_id()); });
+        EXPECT_CALL(handler, OnSinkingBegin(3))
+            .WillOnce([ownerThreadId](ShipId) { EXPECT_EQ(ownerThreadId, std::this_thread::get_id()); });
+    }
+
+    dispatcher.Flush();
+
+    Mock::VerifyAndClear(&handler);
+
+    EXPECT_CALL(handler, OnSinkingBegin(_)).Times(0);
+
+    dispatcher.Flush();
+
+    Mock::VerifyAndClear(&handler);
+}
+
+TEST(GameEventDispatcherTests, PublishesEventsFiredByTaskGraphTasks_OnOwnerThread)
+{
+    MockHandler handler;
+
+    GameEventDispatcher dispatcher;
+    dispatcher.RegisterLifecycleEventHandler(&handler);
+
+    auto const ownerThreadId = std::this_thread::get_id();
+
+    std::vector<ShipId> publishedShipIds;
+    EXPECT_CALL(handler, OnSinkingBegin(_))
+        .WillRepeatedly(
+            [&](ShipId shipId)
+            {
+                EXPECT_EQ(ownerThreadId, std::this_thread::get_id());
+                publishedShipIds.push_back(shipId);
+            });
+
+    // Tasks that fire events may run on pool threads
+    ThreadManager threadManager(false, 16);
+    ThreadPool threadPool(4, threadManager);
+    TaskGraph graph;
+
+    graph.AddTask(
+        "UsesThreadPool",
+        0,
+        TaskGraph::Resources(0),
+        [&]()
+        {
+            threadPool.ParallelFor(0, 100, 1, [](size_t, size_t) {});
+            dispatcher.OnSinkingBegin(0);
+        },
+        true);
+
+    for (ShipId i = 1; i <= 4; ++i)
+    {
+        graph.AddTask(
+            "FiresEvent",
+            0,
+            TaskGraph::Resources(i),
+            [&dispatcher, i]()
+            {
+                dispatcher.OnSinkingBegin(i);
+            });
+    }
+
+    graph.RunAndClear(threadPool);
+
+    dispatcher.Flush();
+
+    Mock::VerifyAndClear(&handler);
+
+    std::sort(publishedShipIds.begin(), publishedShipIds.end());
+    EXPECT_EQ(std::vector<ShipId>({ 0, 1, 2, 3, 4 }), publishedShipIds);
+}
@@ -0,0 +1,139 @@
+#include <GameCore/GameRandomEngine.h>
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+TEST(GameRandomEngineTests, CreateStream_SameOrdinal_SameSequence)
+{
+    auto stream1 = GameRandomEngine::CreateStream(3);
+    auto stream2 = GameRandomEngine::CreateStream(3);
+    auto stream3 = GameRandomEngine::CreateStream(4);
+
+    int differentCount = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        float const value1 = stream1.GenerateNormalizedUniformReal();
+        EXPECT_EQ(value1, stream2.GenerateNormalizedUniformReal());
+
+        if (value1 != stream3.GenerateNormalizedUniformReal())
+            ++differentCount;
+    }
+
+    EXPECT_GT(differentCount, 98);
+}
+
+TEST(GameRandomEngineTests, GenerateUniformReals_MatchesSingleValues)
+{
+    auto singleStream = GameRandomEngine::CreateStream(0);
+    auto batchStream = GameRandomEngine::CreateStream(0);
+
+    std::vector<float> batchValues(1000);
+    batchStream.GenerateUniformReals(batchValues.data(), batchValues.size(), -2.0f, 5.0f);
+
+    for (float const batchValue : batchValues)
+    {
+        EXPECT_EQ(singleStream.GenerateUniformReal(-2.0f, 5.0f), batchValue);
+        EXPECT_GE(batchValue, -2.0f);
+        EXPECT_LT(batchValue, 5.0f);
+    }
+}
+
+TEST(GameRandomEngineTests, GenerateUniformRadialVectors_MatchesSingleValues)
+{
+    auto singleStream = GameRandomEngine::CreateStream(0);
+    auto batchStream = GameRandomEngine::CreateStream(0);
+
+    std::vector<vec2f> batchValues(300);
+    batchStream.GenerateUniformRadialVectors(batchValues.data(), batchValues.size(), 1.0f, 2.0f);
+
+    for (vec2f const & batchValue : batchValues)
+    {
+        EXPECT_EQ(singleStream.GenerateUniformRadialVector(1.0f, 2.0f), batchValue);
+    }
+}
+
+TEST(GameRandomEngineTests, GenerateStandardNormalReals_Distribution)
+{
+    auto stream = GameRandomEngine::CreateStream(0);
+
+    std::vector<float> values(10001); // Odd, to exercise the unpaired value
+    stream.GenerateStandardNormalReals(values.data(), values.size());
+
+    float sum = 0.0f;
+    float sumOfSquares = 0.0f;
+    for (float const value : values)
+    {
+        sum += value;
+        sumOfSquares += value * value;
+    }
+
+    float const mean = sum / static_cast<float>(values.size());
+    float const variance = sumOfSquares / static_cast<float>(values.size()) - mean * mean;
+
+    EXPECT_NEAR(0.0f, mean, 0.05f);
+    EXPECT_NEAR(1.0f, variance, 0.05f);
+}
+
+TEST(GameRandomEngineTests, GenerateUniformPointsInCircle_WithinRadius)
+{
+    auto stream = GameRandomEngine::CreateStream(0);
+
+    std::vector<vec2f> values(1000);
+    stream.GenerateUniformPointsInCircle(values.data(), values.size(), 3.0f);
+
+    size_t innerCount = 0;
+    for (vec2f const & value : values)
+    {
+        EXPECT_LE(value.length(), 3.0f + 0.0001f);
+
+        // Half of the area is within radius / sqrt(2)
+        if (value.length() < 3.0f / std::sqrt(2.0f))
+            ++innerCount;
+    }
+
+    EXPECT_NEAR(500.0f, static_cast<float>(innerCount), 60.0f);
+}
+
+TEST(GameRandomEngineTests, StreamScope_BindsStreamToThread)
+{
+    auto stream = GameRandomEngine::CreateStream(7);
+    auto referenceStream = GameRandomEngine::CreateStream(7);
+
+    GameRandomEngine * const canonicalInstance = &GameRandomEngine::GetInstance();
+
+    {
+        GameRandomEngine::StreamScope const scope(stream);
+
+        EXPECT_EQ(&stream, &GameRandomEngine::GetInstance());
+
+        for (int i = 0; i < 10; ++i)
+        {
+            EXPECT_EQ(referenceStream.GenerateNormalizedUniformReal(), GameRandomEngine::GetInstance().GenerateNormalizedUniformReal());
+        }
+
+        {
+            auto innerStream = GameRandomEngine::CreateStream(8);
+            GameRandomEngine::StreamScope const innerScope(innerStream);
+
+            EXPECT_EQ(&innerStream, &GameRandomEngine::GetInstance());
+        }
+
+        EXPECT_EQ(&stream, &GameRandomEngine::GetInstance());
+    }
+
+    EXPECT_EQ(canonicalInstance, &GameRandomEngine::GetInstance());
+}
+
+TEST(GameRandomEngineTests, GetStateFingerprint_ChangesWithDraws)
+{
+    auto stream = GameRandomEngine::CreateStream(0);
+
+    auto const fingerprint1 = stream.GetStateFingerprint();
+    EXPECT_EQ(fingerprint1, stream.GetStateFingerprint());
+
+    stream.GenerateNormalizedUniformReal();
+
+    EXPECT_NE(fingerprint1, stream.GetStateFingerprint());
+}
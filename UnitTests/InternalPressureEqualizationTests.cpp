@@ -0,0 +1,199 @@
+#include <Game/InternalPressureEqualization.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Physics;
+
+namespace {
+
+    class TestGraph
+    {
+    public:
+
+        TestGraph(
+            std::vector<float> && internalPressures,
+            std::vector<bool> const & isHull,
+            std::vector<std::pair<ElementIndex, ElementIndex>> && springs)
+            : InternalPressures(std::move(internalPressures))
+            , IsHull(new bool[isHull.size()])
+            , Springs(std::move(springs))
+            , mRows(InternalPressures.size())
+        {
+            std::copy(isHull.cbegin(), isHull.cend(), IsHull.get());
+
+            for (ElementIndex s = 0; s < Springs.size(); ++s)
+            {
+                mRows[Springs[s].first].emplace_back(s, Springs[s].second);
+                mRows[Springs[s].second].emplace_back(s, Springs[s].first);
+            }
+        }
+
+        void Equalize()
+        {
+            ElementCount const pointCount = static_cast<ElementCount>(InternalPressures.size());
+
+            std::vector<float> nonHullNeighborCounts(pointCount);
+            for (ElementIndex p = 0; p < pointCount; ++p)
+            {
+                nonHullNeighborCounts[p] = InternalPressureEqualization::CalculateNonHullNeighborCount(
+                    GetRow(p),
+                    IsHull.get());
+            }
+
+            std::vector<float> springFluxes(Springs.size());
+            for (ElementIndex s = 0; s < Springs.size(); ++s)
+            {
+                springFluxes[s] = InternalPressureEqualization::CalculateSpringFlux(
+                    Springs[s].first,
+                    Springs[s].second,
+                    InternalPressures.data(),
+                    IsHull.get(),
+                    nonHullNeighborCounts.data());
+            }
+
+            std::vector<float> newInternalPressures(pointCount);
+            for (ElementIndex p = 0; p < pointCount; ++p)
+            {
+                newInternalPressures[p] = InternalPressureEqualization::GatherInternalPressure(
+                    p,
+                    GetRow(p),
+                    InternalPressures.data(),
+                    IsHull.get(),
+                    springFluxes.data());
+            }
+
+            InternalPressures = std::move(newInternalPressures);
+        }
+
+        float GetNonHullTotal() const
+        {
+            float total = 0.0f;
+            for (size_t p = 0; p < InternalPressures.size(); ++p)
+            {
+                if (!IsHull[p])
+                    total += InternalPressures[p];
+            }
+
+            return total;
+        }
+
+        std::vector<float> InternalPressures;
+        std::unique_ptr<bool[]> IsHull;
+        std::vector<std::pair<ElementIndex, ElementIndex>> Springs;
+
+    private:
+
+        Points::ConnectedSpringsRow GetRow(ElementIndex p) const
+        {
+            return Points::ConnectedSpringsRow(
+                mRows[p].data(),
+                mRows[p].data() + mRows[p].size());
+        }
+
+        std::vector<std::vector<Points::ConnectedSpring>> mRows;
+    };
+}
+
+TEST(InternalPressureEqualizationTests, DistributesSurplusToLowerNeighbors)
+{
+    // A=10, with two lower neighbors each connected only to A
+    TestGraph graph(
+        { 10.0f, 0.0f, 0.0f },
+        { false, false, false },
+        { {0, 1}, {0, 2} });
+
+    graph.Equalize();
+
+    EXPECT_NEAR(graph.InternalPressures[0], 10.0f / 3.0f, 0.0001f);
+    EXPECT_NEAR(graph.InternalPressures[1], 10.0f / 3.0f, 0.0001f);
+    EXPECT_NEAR(graph.InternalPressures[2], 10.0f / 3.0f, 0.0001f);
+    EXPECT_NEAR(graph.GetNonHullTotal(), 10.0f, 0.0001f);
+}
+
+TEST(InternalPressureEqualizationTests, HullPointsTakeAverageOfNonHullNeighbors)
+{
+    TestGraph graph(
+        { 4.0f, 2.0f, 100.0f },
+        { false, false, true },
+        { {0, 2}, {1, 2} });
+
+    graph.Equalize();
+
+    EXPECT_FLOAT_EQ(graph.InternalPressures[0], 4.0f);
+    EXPECT_FLOAT_EQ(graph.InternalPressures[1], 2.0f);
+    EXPECT_FLOAT_EQ(graph.InternalPressures[2], 3.0f);
+}
+
+TEST(InternalPressureEqualizationTests, ConservesNonHullTotal)
+{
+    //
+    // Grid of points with diagonals, some of which are hull points
+    //
+
+    int constexpr Width = 12;
+    int constexpr Height = 9;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> pressureDist(0.0f, 100.0f);
+    std::bernoulli_distribution isHullDist(0.2);
+
+    std::vector<float> internalPressures;
+    std::vector<bool> isHull;
+    for (int p = 0; p < Width * Height; ++p)
+    {
+        internalPressures.push_back(pressureDist(rng));
+        isHull.push_back(isHullDist(rng));
+    }
+
+    std::vector<std::pair<ElementIndex, ElementIndex>> springs;
+    for (int y = 0; y < Height; ++y)
+    {
+        for (int x = 0; x < Width; ++x)
+        {
+            ElementIndex const p = static_cast<ElementIndex>(y * Width + x);
+            if (x + 1 < Width)
+                springs.emplace_back(p, p + 1);
+            if (y + 1 < Height)
+                springs.emplace_back(p + Width, p); // Endpoint A higher than B
+            if (x + 1 < Width && y + 1 < Height)
+                springs.emplace_back(p, p + Width + 1);
+        }
+    }
+
+    TestGraph graph(std::move(internalPressures), isHull, std::move(springs));
+
+    float const initialTotal = graph.GetNonHullTotal();
+    float minNonHull = std::numeric_limits<float>::max();
+    float maxNonHull = std::numeric_limits<float>::lowest();
+    for (size_t p = 0; p < graph.InternalPressures.size(); ++p)
+    {
+        if (!isHull[p])
+        {
+            minNonHull = std::min(minNonHull, graph.InternalPressures[p]);
+            maxNonHull = std::max(maxNonHull, graph.InternalPressures[p]);
+        }
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        graph.Equalize();
+
+        EXPECT_NEAR(graph.GetNonHullTotal(), initialTotal, initialTotal * 0.0001f);
+
+        // No overshoot
+        for (size_t p = 0; p < graph.InternalPressures.size(); ++p)
+        {
+            if (!isHull[p])
+            {
+                EXPECT_GE(graph.InternalPressures[p], minNonHull - 0.001f);
+                EXPECT_LE(graph.InternalPressures[p], maxNonHull + 0.001f);
+            }
+        }
+    }
+}
@@ -0,0 +1,340 @@
+#include <Game/LightDiffusionKernels.h>
+
+#include <GameCore/Algorithms.h>
+#include <GameCore/SysSpecifics.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Physics;
+
+namespace {
+
+    //
+    // A grid of points on a few planes, some of which carry lamps, whose light is diffused
+    // incrementally - as Ship::DiffuseLight() does - and from scratch
+    //
+    class TestLitPoints
+    {
+    public:
+
+        static ElementCount constexpr GridWidth = 16;
+        static ElementCount constexpr GridHeight = 12;
+        static ElementCount constexpr PointCount = GridWidth * GridHeight; // Multiple of the vectorization word
+
+        explicit TestLitPoints(bool isTiled)
+            : mIsTiled(isTiled)
+            , mTiles()
+            , mLastPointPositions(PointCount)
+            , mLampHistory()
+            , mDirtyBatches(PointCount / vectorization_float_count<ElementCount>)
+            , mLight(PointCount)
+        {
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<float> jitterDist(-0.2f, 0.2f);
+            std::uniform_int_distribution<PlaneId> planeIdDist(1, 3);
+
+            for (ElementIndex p = 0; p < PointCount; ++p)
+            {
+                PointPositions.emplace_back(
+                    static_cast<float>(p % GridWidth) + jitterDist(rng),
+                    static_cast<float>(p / GridWidth) + jitterDist(rng));
+
+                PointPlaneIds.push_back(planeIdDist(rng));
+            }
+
+            for (ElementIndex const lampPointIndex : { 17, 40, 95, 130, 171 })
+            {
+                LampPointIndices.push_back(lampPointIndex);
+                LampDistanceCoeffs.push_back(0.25f);
+                LampSpreadMaxDistances.push_back(4.0f);
+            }
+
+            // Start from a full diffusion
+            Step(true);
+        }
+
+        /*
+         * Diffuses the light from scratch on all points, into a separate buffer.
+         */
+        std::vector<float> DiffuseFromScratch() const
+        {
+            PrepareLamps();
+
+            std::vector<float> light(PointCount);
+
+            Algorithms::DiffuseLight(
+                0,
+                PointCount,
+                PointPositions.data(),
+                PointPlaneIds.data(),
+                mLampPositions.data(),
+                mLampPlaneIds.data(),
+                mLampDistanceCoeffs.data(),
+                mLampSpreadMaxDistances.data(),
+                static_cast<ElementCount>(mLampPositions.size()),
+                light.data());
+
+            return light;
+        }
+
+        /*
+         * Diffuses light incrementally - unless the structure has changed, as the ship does -
+         * on two ranges of points; returns the number of dirty batches.
+         */
+        ElementCount Step(bool hasStructureChanged)
+        {
+            PrepareLamps();
+
+            auto const input = MakeInput();
+
+            ElementIndex const rangeStarts[] = { 0, PointCount / 2, PointCount };
+
+            if (hasStructureChanged || mLampHistory.Positions.size() != LampPointIndices.size())
+            {
+                mLampHistory.RememberAll(input);
+                std::fill(mDirtyBatches.begin(), mDirtyBatches.end(), static_cast<char>(true));
+
+                for (size_t r = 0; r < 2; ++r)
+                {
+                    LightDiffusionKernels::DiffuseLightOnPoints(input, rangeStarts[r], rangeStarts[r + 1], mLastPointPositions.data(), mLight.data());
+                }
+
+                return static_cast<ElementCount>(mDirtyBatches.size());
+            }
+
+            std::vector<LightDiffusionKernels::DirtyRegion> dirtyRegions;
+            LightDiffusionKernels::DetectLampChanges(input, mLampHistory, dirtyRegions);
+
+            ElementCount dirtyBatchCount = 0;
+            for (size_t r = 0; r < 2; ++r)
+            {
+                dirtyBatchCount += LightDiffusionKernels::DetectDirtyPointBatches(
+                    input,
+                    mLastPointPositions.data(),
+                    dirtyRegions,
+                    rangeStarts[r],
+                    rangeStarts[r + 1],
+                    reinterpret_cast<bool *>(mDirtyBatches.data()));
+            }
+
+            for (size_t r = 0; r < 2; ++r)
+            {
+                LightDiffusionKernels::DiffuseLightOnDirtyPoints(
+                    input,
+                    reinterpret_cast<bool const *>(mDirtyBatches.data()),
+                    rangeStarts[r],
+                    rangeStarts[r + 1],
+                    mLastPointPositions.data(),
+                    mLight.data());
+            }
+
+            return dirtyBatchCount;
+        }
+
+        std::vector<float> const & GetLight() const
+        {
+            return mLight;
+        }
+
+        std::vector<vec2f> PointPositions;
+        std::vector<PlaneId> PointPlaneIds;
+        std::vector<ElementIndex> LampPointIndices;
+        std::vector<float> LampDistanceCoeffs;
+        std::vector<float> LampSpreadMaxDistances;
+
+    private:
+
+        // Gathers the lamps' state from their points, padded with lamps that produce no light
+        void PrepareLamps() const
+        {
+            size_t const bufferLampCount = make_aligned_float_element_count(LampPointIndices.size());
+
+            mLampPositions.assign(bufferLampCount, vec2f::zero());
+            mLampPlaneIds.assign(bufferLampCount, 0);
+            mLampDistanceCoeffs.assign(bufferLampCount, 0.0f);
+            mLampSpreadMaxDistances.assign(bufferLampCount, 0.0f);
+
+            for (size_t l = 0; l < LampPointIndices.size(); ++l)
+            {
+                mLampPositions[l] = PointPositions[LampPointIndices[l]];
+                mLampPlaneIds[l] = PointPlaneIds[LampPointIndices[l]];
+                mLampDistanceCoeffs[l] = LampDistanceCoeffs[l];
+                mLampSpreadMaxDistances[l] = LampSpreadMaxDistances[l];
+            }
+        }
+
+        LightDiffusionKernels::LightDiffusionInput MakeInput()
+        {
+            if (mIsTiled)
+            {
+                Algorithms::PrepareDiffuseLightTiles(
+                    PointCount,
+                    PointPositions.data(),
+                    PointPlaneIds.data(),
+                    mLampPositions.data(),
+                    mLampPlaneIds.data(),
+                    mLampDistanceCoeffs.data(),
+                    mLampSpreadMaxDistances.data(),
+                    static_cast<ElementCount>(mLampPositions.size()),
+                    mTiles);
+            }
+
+            return LightDiffusionKernels::LightDiffusionInput{
+                PointPositions.data(),
+                PointPlaneIds.data(),
+                mLampPositions.data(),
+                mLampPlaneIds.data(),
+                mLampDistanceCoeffs.data(),
+                mLampSpreadMaxDistances.data(),
+                static_cast<ElementCount>(LampPointIndices.size()),
+                static_cast<ElementCount>(mLampPositions.size()),
+                mIsTiled ? &mTiles : nullptr };
+        }
+
+        bool const mIsTiled;
+        Algorithms::DiffuseLightTiles<vec2f> mTiles;
+
+        std::vector<vec2f> mutable mLampPositions;
+        std::vector<PlaneId> mutable mLampPlaneIds;
+        std::vector<float> mutable mLampDistanceCoeffs;
+        std::vector<float> mutable mLampSpreadMaxDistances;
+
+        std::vector<vec2f> mLastPointPositions;
+        LightDiffusionKernels::LampHistory mLampHistory;
+        std::vector<char> mDirtyBatches; // Not vector<bool>, as we need the bools' storage
+        std::vector<float> mLight;
+    };
+
+    static_assert(sizeof(char) == sizeof(bool));
+
+    void ExpectMatchesFromScratch(TestLitPoints const & testPoints, float tolerance = 1e-6f)
+    {
+        auto const expectedLight = testPoints.DiffuseFromScratch();
+
+        for (ElementIndex p = 0; p < TestLitPoints::PointCount; ++p)
+        {
+            EXPECT_NEAR(expectedLight[p], testPoints.GetLight()[p], tolerance) << "point " << p;
+        }
+    }
+}
+
+class LightDiffusionKernelsTests : public testing::TestWithParam<bool>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    LightDiffusionKernelsTests,
+    LightDiffusionKernelsTests,
+    ::testing::Values(
+        false, // All lamps
+        true // Lamps binned into tiles
+    ));
+
+TEST_P(LightDiffusionKernelsTests, NoChanges_DiffusesNothing)
+{
+    TestLitPoints testPoints(GetParam());
+
+    EXPECT_EQ(0, testPoints.Step(false));
+
+    ExpectMatchesFromScratch(testPoints);
+}
+
+TEST_P(LightDiffusionKernelsTests, MovingLamp_MatchesFromScratch)
+{
+    TestLitPoints testPoints(GetParam());
+
+    // Move the lamp's point, as lamps follow their points
+    testPoints.PointPositions[testPoints.LampPointIndices[1]] += vec2f(2.5f, -1.5f);
+
+    ElementCount const dirtyBatchCount = testPoints.Step(false);
+    EXPECT_GT(dirtyBatchCount, 0);
+    EXPECT_LT(dirtyBatchCount, TestLitPoints::PointCount / vectorization_float_count<ElementCount>);
+
+    ExpectMatchesFromScratch(testPoints);
+}
+
+TEST_P(LightDiffusionKernelsTests, MovingPoints_MatchesFromScratch)
+{
+    TestLitPoints testPoints(GetParam());
+
+    for (ElementIndex const p : { 3, 50, 51, 120 })
+    {
+        testPoints.PointPositions[p] += vec2f(0.5f, 0.75f);
+    }
+
+    ElementCount const dirtyBatchCount = testPoints.Step(false);
+    EXPECT_GT(dirtyBatchCount, 0);
+    EXPECT_LE(dirtyBatchCount, 3); // 50 and 51 are in the same batch
+
+    ExpectMatchesFromScratch(testPoints);
+}
+
+TEST_P(LightDiffusionKernelsTests, MovingPointsBelowThreshold_StaysWithinThreshold)
+{
+    TestLitPoints testPoints(GetParam());
+
+    for (ElementIndex p = 0; p < TestLitPoints::PointCount; p += 7)
+    {
+        testPoints.PointPositions[p] += vec2f(LightDiffusionKernels::MaxPositionChange / 2.0f, 0.0f);
+    }
+
+    EXPECT_EQ(0, testPoints.Step(false));
+
+    // Light changes by at most the distance coefficient for each unit of distance
+    ExpectMatchesFromScratch(testPoints, 0.25f * LightDiffusionKernels::MaxPositionChange);
+}
+
+TEST_P(LightDiffusionKernelsTests, TogglingLamps_MatchesFromScratch)
+{
+    TestLitPoints testPoints(GetParam());
+
+    // Off
+    testPoints.LampDistanceCoeffs[2] = 0.0f;
+    EXPECT_GT(testPoints.Step(false), 0);
+    ExpectMatchesFromScratch(testPoints);
+
+    // Dimmed
+    testPoints.LampDistanceCoeffs[2] = 0.1f;
+    EXPECT_GT(testPoints.Step(false), 0);
+    ExpectMatchesFromScratch(testPoints);
+
+    // Back on, and another one off at the same time
+    testPoints.LampDistanceCoeffs[2] = 0.25f;
+    testPoints.LampDistanceCoeffs[4] = 0.0f;
+    EXPECT_GT(testPoints.Step(false), 0);
+    ExpectMatchesFromScratch(testPoints);
+}
+
+TEST_P(LightDiffusionKernelsTests, RemovingPoints_MatchesFromScratch)
+{
+    TestLitPoints testPoints(GetParam());
+
+    // Remove the point of a lamp, and detach a few points onto a plane of their own; as
+    // for the ship, structural changes make for a full diffusion
+    testPoints.LampPointIndices.erase(testPoints.LampPointIndices.begin() + 3);
+    testPoints.LampDistanceCoeffs.erase(testPoints.LampDistanceCoeffs.begin() + 3);
+    testPoints.LampSpreadMaxDistances.erase(testPoints.LampSpreadMaxDistances.begin() + 3);
+
+    for (ElementIndex const p : { 128, 129, 130, 131, 144, 145 })
+    {
+        testPoints.PointPlaneIds[p] = 4;
+    }
+
+    testPoints.Step(true);
+    ExpectMatchesFromScratch(testPoints);
+
+    // Further changes are incremental again
+    testPoints.PointPositions[testPoints.LampPointIndices[0]] += vec2f(-1.0f, 1.0f);
+    testPoints.PointPositions[100] += vec2f(0.0f, 0.5f);
+
+    ElementCount const dirtyBatchCount = testPoints.Step(false);
+    EXPECT_GT(dirtyBatchCount, 0);
+    EXPECT_LT(dirtyBatchCount, TestLitPoints::PointCount / vectorization_float_count<ElementCount>);
+
+    ExpectMatchesFromScratch(testPoints);
+}
@@ -0,0 +1,352 @@
+#include <Game/SpringRelaxationKernels.h>
+
+#include <GameCore/Buffer.h>
+#include <GameCore/SysSpecifics.h>
+
+#include <cmath>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+using namespace Physics;
+
+namespace {
+
+    //
+    // A set of springs with perfect squares first, followed by springs between
+    // random pairs of points
+    //
+    class TestSprings
+    {
+    public:
+
+        static ElementCount constexpr GridWidth = 8;
+        static ElementCount constexpr GridHeight = 8;
+        static ElementCount constexpr PointCount = GridWidth * GridHeight;
+
+        static ElementCount constexpr PerfectSquareCount = 13;
+        static ElementCount constexpr OtherSpringCount = 39; // Not a multiple of any vectorization word
+
+        TestSprings()
+            : PositionBuffer(PointCount)
+            , VelocityBuffer(PointCount)
+            , Endpoints()
+            , RestLengths()
+            , StiffnessCoefficients()
+            , DampingCoefficients()
+        {
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<float> jitterDist(-0.2f, 0.2f);
+            std::uniform_real_distribution<float> velocityDist(-5.0f, 5.0f);
+            std::uniform_real_distribution<float> restLengthFactorDist(0.8f, 1.2f);
+            std::uniform_real_distribution<float> stiffnessDist(500.0f, 1000.0f);
+            std::uniform_real_distribution<float> dampingDist(0.0f, 10.0f);
+            std::uniform_int_distribution<ElementIndex> pointDist(0, PointCount - 1);
+
+            for (ElementIndex p = 0; p < PointCount; ++p)
+            {
+                PositionBuffer[p] = vec2f(
+                    static_cast<float>(p % GridWidth) + jitterDist(rng),
+                    static_cast<float>(p / GridWidth) + jitterDist(rng));
+
+                VelocityBuffer[p] = vec2f(velocityDist(rng), velocityDist(rng));
+            }
+
+            // Perfect squares: J->L, M->K, J->K, M->L
+            for (ElementIndex sq = 0; sq < PerfectSquareCount; ++sq)
+            {
+                ElementIndex const x = (sq * 2) % (GridWidth - 1);
+                ElementIndex const y = (sq * 2) / (GridWidth - 1);
+
+                ElementIndex const j = y * GridWidth + x;
+                ElementIndex const m = j + 1;
+                ElementIndex const k = j + GridWidth;
+                ElementIndex const l = k + 1;
+
+                Endpoints.emplace_back(j, l);
+                Endpoints.emplace_back(m, k);
+                Endpoints.emplace_back(j, k);
+                Endpoints.emplace_back(m, l);
+            }
+
+            for (ElementIndex s = 0; s < OtherSpringCount; ++s)
+            {
+                ElementIndex const a = pointDist(rng);
+                ElementIndex b = pointDist(rng);
+                if (b == a)
+                    b = (a + 1) % PointCount;
+
+                Endpoints.emplace_back(a, b);
+            }
+
+            for (auto const & endpoints : Endpoints)
+            {
+                RestLengths.push_back((PositionBuffer[endpoints.PointBIndex] - PositionBuffer[endpoints.PointAIndex]).length() * restLengthFactorDist(rng));
+                StiffnessCoefficients.push_back(stiffnessDist(rng));
+                DampingCoefficients.push_back(dampingDist(rng));
+            }
+        }
+
+        ElementCount GetSpringCount() const
+        {
+            return static_cast<ElementCount>(Endpoints.size());
+        }
+
+        SpringRelaxationKernels::SpringForcesInput MakeInput() const
+        {
+            return SpringRelaxationKernels::SpringForcesInput{
+                PositionBuffer.data(),
+                VelocityBuffer.data(),
+                Endpoints.data(),
+                RestLengths.data(),
+                StiffnessCoefficients.data(),
+                DampingCoefficients.data(),
+                PerfectSquareCount };
+        }
+
+        //
+        // Calculates the forces in double precision, together with - for each point - the
+        // error we tolerate; the reciprocal (square root) approximations used by the kernels
+        // have a relative error of at most 1.5 * 2^-12
+        //
+        void CalculateReferenceForces(
+            std::vector<double> & forceX,
+            std::vector<double> & forceY,
+            std::vector<double> & tolerance) const
+        {
+            forceX.assign(PointCount, 0.0);
+            forceY.assign(PointCount, 0.0);
+            tolerance.assign(PointCount, 1e-3);
+
+            for (size_t s = 0; s < Endpoints.size(); ++s)
+            {
+                auto const a = Endpoints[s].PointAIndex;
+                auto const b = Endpoints[s].PointBIndex;
+
+                double const disX = static_cast<double>(PositionBuffer[b].x) - static_cast<double>(PositionBuffer[a].x);
+                double const disY = static_cast<double>(PositionBuffer[b].y) - static_cast<double>(PositionBuffer[a].y);
+                double const length = std::sqrt(disX * disX + disY * disY);
+                double const dirX = disX / length;
+                double const dirY = disY / length;
+
+                double const fSpring = (length - RestLengths[s]) * StiffnessCoefficients[s];
+
+                double const relVelX = static_cast<double>(VelocityBuffer[b].x) - static_cast<double>(VelocityBuffer[a].x);
+                double const relVelY = static_cast<double>(VelocityBuffer[b].y) - static_cast<double>(VelocityBuffer[a].y);
+                double const fDamp = (relVelX * dirX + relVelY * dirY) * DampingCoefficients[s];
+
+                forceX[a] += dirX * (fSpring + fDamp);
+                forceY[a] += dirY * (fSpring + fDamp);
+                forceX[b] -= dirX * (fSpring + fDamp);
+                forceY[b] -= dirY * (fSpring + fDamp);
+
+                // Length is off by up to two approximations, direction by up to one
+                double constexpr MaxRelativeError = 4.0 * 1.5 / 4096.0;
+                double const springTolerance = MaxRelativeError * (
+                    length * StiffnessCoefficients[s]
+                    + std::abs(fSpring)
+                    + 2.0 * std::sqrt(relVelX * relVelX + relVelY * relVelY) * DampingCoefficients[s]);
+
+                tolerance[a] += springTolerance;
+                tolerance[b] += springTolerance;
+            }
+        }
+
+        Buffer<vec2f> PositionBuffer;
+        Buffer<vec2f> VelocityBuffer;
+        std::vector<Springs::Endpoints> Endpoints;
+        std::vector<float> RestLengths;
+        std::vector<float> StiffnessCoefficients;
+        std::vector<float> DampingCoefficients;
+    };
+
+    using ApplySpringsForcesFunction = std::function<void(
+        SpringRelaxationKernels::SpringForcesInput const &,
+        ElementIndex,
+        ElementIndex,
+        vec2f *)>;
+
+    struct SpringsForcesVariant
+    {
+        std::string Name;
+        ApplySpringsForcesFunction Function;
+    };
+
+    std::vector<SpringsForcesVariant> GetSupportedSpringsForcesVariants()
+    {
+        std::vector<SpringsForcesVariant> variants;
+
+        variants.push_back({ "SSE", SpringRelaxationKernels::ApplySpringsForces_SSE });
+
+        if (GetSimdInstructionSet() >= SimdInstructionSet::AVX2)
+            variants.push_back({ "AVX2", SpringRelaxationKernels::ApplySpringsForces_AVX2 });
+
+        if (GetSimdInstructionSet() >= SimdInstructionSet::AVX512)
+            variants.push_back({ "AVX512", SpringRelaxationKernels::ApplySpringsForces_AVX512 });
+
+        return variants;
+    }
+}
+
+TEST(SpringRelaxationKernelsTests, ApplySpringsForces_MatchesReferenceWithinApproximationError)
+{
+    TestSprings const springs;
+
+    std::vector<double> referenceForceX;
+    std::vector<double> referenceForceY;
+    std::vector<double> tolerance;
+    springs.CalculateReferenceForces(referenceForceX, referenceForceY, tolerance);
+
+    for (auto const & variant : GetSupportedSpringsForcesVariants())
+    {
+        Buffer<vec2f> dynamicForceBuffer(TestSprings::PointCount, vec2f::zero());
+
+        variant.Function(
+            springs.MakeInput(),
+            0,
+            springs.GetSpringCount(),
+            dynamicForceBuffer.data());
+
+        for (ElementIndex p = 0; p < TestSprings::PointCount; ++p)
+        {
+            EXPECT_NEAR(dynamicForceBuffer[p].x, referenceForceX[p], tolerance[p]) << variant.Name << " point " << p;
+            EXPECT_NEAR(dynamicForceBuffer[p].y, referenceForceY[p], tolerance[p]) << variant.Name << " point " << p;
+        }
+    }
+}
+
+TEST(SpringRelaxationKernelsTests, ApplySpringsForces_VariantsAgreeWithinApproximationError)
+{
+    TestSprings const springs;
+
+    std::vector<double> referenceForceX;
+    std::vector<double> referenceForceY;
+    std::vector<double> tolerance;
+    springs.CalculateReferenceForces(referenceForceX, referenceForceY, tolerance);
+
+    auto const variants = GetSupportedSpringsForcesVariants();
+
+    // Run each variant over sub-ranges, as the caller does with spring colors
+    ElementIndex const splitSpringIndex = TestSprings::PerfectSquareCount * 4 + 5;
+
+    std::vector<Buffer<vec2f>> dynamicForceBuffers;
+    for (auto const & variant : variants)
+    {
+        dynamicForceBuffers.emplace_back(TestSprings::PointCount, vec2f::zero());
+
+        variant.Function(springs.MakeInput(), 0, splitSpringIndex, dynamicForceBuffers.back().data());
+        variant.Function(springs.MakeInput(), splitSpringIndex, springs.GetSpringCount(), dynamicForceBuffers.back().data());
+    }
+
+    for (size_t v = 1; v < variants.size(); ++v)
+    {
+        for (ElementIndex p = 0; p < TestSprings::PointCount; ++p)
+        {
+            // Each variant is within tolerance of the reference
+            EXPECT_NEAR(dynamicForceBuffers[v][p].x, dynamicForceBuffers[0][p].x, 2.0 * tolerance[p]) << variants[v].Name << " point " << p;
+            EXPECT_NEAR(dynamicForceBuffers[v][p].y, dynamicForceBuffers[0][p].y, 2.0 * tolerance[p]) << variants[v].Name << " point " << p;
+        }
+    }
+}
+
+TEST(SpringRelaxationKernelsTests, IntegrateAndResetDynamicForces_VariantsAgree)
+{
+    using IntegrateFunction = std::function<void(SpringRelaxationKernels::DynamicForcesIntegrationInput const &, ElementIndex, ElementIndex)>;
+
+    std::vector<std::pair<std::string, IntegrateFunction>> variants;
+    variants.emplace_back("SSE", SpringRelaxationKernels::IntegrateAndResetDynamicForces_SSE);
+    if (GetSimdInstructionSet() >= SimdInstructionSet::AVX2)
+        variants.emplace_back("AVX2", SpringRelaxationKernels::IntegrateAndResetDynamicForces_AVX2);
+    if (GetSimdInstructionSet() >= SimdInstructionSet::AVX512)
+        variants.emplace_back("AVX512", SpringRelaxationKernels::IntegrateAndResetDynamicForces_AVX512);
+
+    ElementCount constexpr PointCount = 64;
+    size_t constexpr DynamicForceBufferCount = 3;
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+
+    std::vector<float> initialPositions(PointCount * 2);
+    std::vector<float> initialVelocities(PointCount * 2);
+    std::vector<float> staticForces(PointCount * 2);
+    std::vector<float> integrationFactors(PointCount * 2);
+    std::vector<std::vector<float>> initialDynamicForces(DynamicForceBufferCount, std::vector<float>(PointCount * 2));
+    for (size_t i = 0; i < PointCount * 2; ++i)
+    {
+        initialPositions[i] = dist(rng);
+        initialVelocities[i] = dist(rng);
+        staticForces[i] = dist(rng);
+        integrationFactors[i] = std::abs(dist(rng)) * 0.001f;
+        for (auto & dynamicForces : initialDynamicForces)
+            dynamicForces[i] = dist(rng);
+    }
+
+    std::vector<std::vector<float>> resultPositions;
+    std::vector<std::vector<float>> resultVelocities;
+
+    for (auto const & variant : variants)
+    {
+        Buffer<float> positionBuffer(PointCount * 2);
+        Buffer<float> velocityBuffer(PointCount * 2);
+        Buffer<float> staticForceBuffer(PointCount * 2);
+        Buffer<float> integrationFactorBuffer(PointCount * 2);
+        std::vector<Buffer<float>> dynamicForceBuffers;
+        std::vector<float *> dynamicForceBufferPointers;
+        for (size_t i = 0; i < PointCount * 2; ++i)
+        {
+            positionBuffer[i] = initialPositions[i];
+            velocityBuffer[i] = initialVelocities[i];
+            staticForceBuffer[i] = staticForces[i];
+            integrationFactorBuffer[i] = integrationFactors[i];
+        }
+
+        for (auto const & dynamicForces : initialDynamicForces)
+        {
+            dynamicForceBuffers.emplace_back(PointCount * 2);
+            for (size_t i = 0; i < PointCount * 2; ++i)
+                dynamicForceBuffers.back()[i] = dynamicForces[i];
+        }
+
+        for (auto & dynamicForceBuffer : dynamicForceBuffers)
+            dynamicForceBufferPointers.push_back(dynamicForceBuffer.data());
+
+        variant.second(
+            SpringRelaxationKernels::DynamicForcesIntegrationInput{
+                positionBuffer.data(),
+                velocityBuffer.data(),
+                staticForceBuffer.data(),
+                integrationFactorBuffer.data(),
+                dynamicForceBufferPointers.data(),
+                DynamicForceBufferCount,
+                0.02f,
+                0.99f },
+            0,
+            PointCount);
+
+        resultPositions.emplace_back(positionBuffer.data(), positionBuffer.data() + PointCount * 2);
+        resultVelocities.emplace_back(velocityBuffer.data(), velocityBuffer.data() + PointCount * 2);
+
+        for (auto const & dynamicForceBuffer : dynamicForceBuffers)
+        {
+            for (size_t i = 0; i < PointCount * 2; ++i)
+                EXPECT_EQ(0.0f, dynamicForceBuffer[i]) << variant.first;
+        }
+    }
+
+    // No approximations here, only rounding (e.g. of fused multiply-adds)
+    for (size_t v = 1; v < variants.size(); ++v)
+    {
+        for (size_t i = 0; i < PointCount * 2; ++i)
+        {
+            EXPECT_NEAR(resultPositions[v][i], resultPositions[0][i], 1e-5f * (1.0f + std::abs(resultPositions[0][i]))) << variants[v].first;
+            EXPECT_NEAR(resultVelocities[v][i], resultVelocities[0][i], 1e-5f * (1.0f + std::abs(resultVelocities[0][i]))) << variants[v].first;
+        }
+    }
+}
+
+#endif
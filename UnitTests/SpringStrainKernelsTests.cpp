@@ -0,0 +1,254 @@
+#include <Game/SpringStrainKernels.h>
+
+#include <GameCore/Buffer.h>
+#include <GameCore/SysSpecifics.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#if FS_IS_ARCHITECTURE_X86_32() || FS_IS_ARCHITECTURE_X86_64()
+
+using namespace Physics;
+
+namespace {
+
+    //
+    // A set of springs between random pairs of points, each one strained by a fraction
+    // of its breaking elongation that falls clearly within one of the bands of the
+    // stress hysteresis
+    //
+    class TestSprings
+    {
+    public:
+
+        static ElementCount constexpr PointCount = 64;
+        static ElementCount constexpr SpringCount = 61; // Not a multiple of any vectorization word
+
+        static float constexpr StrainThresholdFraction = 0.5f;
+
+        enum class StrainBand
+        {
+            Relaxed, // Below the low watermark
+            Moderate, // Between the low watermark and the threshold
+            High, // Above the threshold
+            Broken
+        };
+
+        TestSprings()
+            : PositionBuffer(PointCount)
+            , Endpoints()
+            , IsDeleted()
+            , RestLengths()
+            , StrainStates()
+            , Bands()
+        {
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<float> positionDist(-10.0f, 10.0f);
+            std::uniform_real_distribution<float> breakingElongationDist(0.1f, 0.5f);
+            std::uniform_int_distribution<ElementIndex> pointDist(0, PointCount - 1);
+            std::uniform_int_distribution<int> bandDist(0, 3);
+            std::bernoulli_distribution isStressedDist(0.5);
+            std::bernoulli_distribution isDeletedDist(0.1);
+            std::bernoulli_distribution isCompressedDist(0.5);
+
+            for (ElementIndex p = 0; p < PointCount; ++p)
+            {
+                PositionBuffer[p] = vec2f(positionDist(rng), positionDist(rng));
+            }
+
+            for (ElementIndex s = 0; s < SpringCount; ++s)
+            {
+                ElementIndex const a = pointDist(rng);
+                ElementIndex b = pointDist(rng);
+                if (b == a)
+                    b = (a + 1) % PointCount;
+
+                Endpoints.emplace_back(a, b);
+                IsDeleted.push_back(isDeletedDist(rng));
+
+                float const breakingElongation = breakingElongationDist(rng);
+                StrainStates.emplace_back(breakingElongation, StrainThresholdFraction, isStressedDist(rng));
+
+                Bands.push_back(static_cast<StrainBand>(bandDist(rng)));
+                float strainFraction;
+                switch (Bands.back())
+                {
+                    case StrainBand::Relaxed: strainFraction = 0.02f; break;
+                    case StrainBand::Moderate: strainFraction = 0.3f; break;
+                    case StrainBand::High: strainFraction = 0.7f; break;
+                    default: strainFraction = 1.5f; break;
+                }
+
+                float const strain = strainFraction * breakingElongation * (isCompressedDist(rng) ? -1.0f : 1.0f);
+                RestLengths.push_back(GetLength(s) - strain);
+            }
+        }
+
+        float GetLength(ElementIndex s) const
+        {
+            return (PositionBuffer[Endpoints[s].PointBIndex] - PositionBuffer[Endpoints[s].PointAIndex]).length();
+        }
+
+        SpringStrainKernels::StrainCalculationInput MakeInput() const
+        {
+            return SpringStrainKernels::StrainCalculationInput{
+                PositionBuffer.data(),
+                Endpoints.data(),
+                reinterpret_cast<bool const *>(IsDeleted.data()),
+                RestLengths.data() };
+        }
+
+        Buffer<vec2f> PositionBuffer;
+        std::vector<Springs::Endpoints> Endpoints;
+        std::vector<char> IsDeleted; // Not vector<bool>, as we need the bools' storage
+        std::vector<float> RestLengths;
+        std::vector<Springs::StrainState> StrainStates;
+        std::vector<StrainBand> Bands;
+    };
+
+    static_assert(sizeof(char) == sizeof(bool));
+
+    using CalculateStrainsFunction = std::function<void(
+        SpringStrainKernels::StrainCalculationInput const &,
+        ElementIndex,
+        ElementIndex,
+        Springs::StrainState *,
+        Springs::StrainCalculationResults &)>;
+
+    struct CalculateStrainsVariant
+    {
+        std::string Name;
+        CalculateStrainsFunction Function;
+    };
+
+    std::vector<CalculateStrainsVariant> GetSupportedCalculateStrainsVariants()
+    {
+        std::vector<CalculateStrainsVariant> variants;
+
+        variants.push_back({ "SSE", SpringStrainKernels::CalculateStrains_SSE });
+
+        if (GetSimdInstructionSet() >= SimdInstructionSet::AVX2)
+            variants.push_back({ "AVX2", SpringStrainKernels::CalculateStrains_AVX2 });
+
+        return variants;
+    }
+}
+
+TEST(SpringStrainKernelsTests, CalculateStrains_MatchesStressHysteresis)
+{
+    TestSprings const springs;
+
+    for (auto const & variant : GetSupportedCalculateStrainsVariants())
+    {
+        std::vector<Springs::StrainState> strainStates = springs.StrainStates;
+        Springs::StrainCalculationResults results;
+
+        variant.Function(
+            springs.MakeInput(),
+            0,
+            TestSprings::SpringCount,
+            strainStates.data(),
+            results);
+
+        std::vector<ElementIndex> expectedBrokenSprings;
+        std::vector<ElementIndex> expectedNewlyStressedSprings;
+        float expectedMaxSpringLength = 0.0f;
+
+        for (ElementIndex s = 0; s < TestSprings::SpringCount; ++s)
+        {
+            bool const wasStressed = springs.StrainStates[s].IsStressed;
+            bool expectedIsStressed = wasStressed;
+
+            if (!springs.IsDeleted[s])
+            {
+                switch (springs.Bands[s])
+                {
+                    case TestSprings::StrainBand::Relaxed:
+                    {
+                        expectedIsStressed = false;
+                        break;
+                    }
+
+                    case TestSprings::StrainBand::Moderate:
+                    {
+                        break;
+                    }
+
+                    case TestSprings::StrainBand::High:
+                    {
+                        expectedIsStressed = true;
+                        if (!wasStressed)
+                            expectedNewlyStressedSprings.push_back(s);
+                        break;
+                    }
+
+                    case TestSprings::StrainBand::Broken:
+                    {
+                        expectedBrokenSprings.push_back(s);
+                        break;
+                    }
+                }
+
+                if (springs.Bands[s] != TestSprings::StrainBand::Broken)
+                    expectedMaxSpringLength = std::max(expectedMaxSpringLength, springs.GetLength(s));
+            }
+
+            EXPECT_EQ(expectedIsStressed, strainStates[s].IsStressed) << variant.Name << " spring " << s;
+        }
+
+        EXPECT_EQ(expectedBrokenSprings, results.BrokenSprings) << variant.Name;
+        EXPECT_EQ(expectedNewlyStressedSprings, results.NewlyStressedSprings) << variant.Name;
+
+        // Lengths are exact, but for the rounding of fused multiply-adds
+        EXPECT_NEAR(expectedMaxSpringLength, results.MaxSpringLength, 1e-6f * expectedMaxSpringLength) << variant.Name;
+    }
+}
+
+TEST(SpringStrainKernelsTests, CalculateStrains_RangesConcatenateToWhole)
+{
+    TestSprings const springs;
+
+    for (auto const & variant : GetSupportedCalculateStrainsVariants())
+    {
+        std::vector<Springs::StrainState> wholeStrainStates = springs.StrainStates;
+        Springs::StrainCalculationResults wholeResults;
+
+        variant.Function(springs.MakeInput(), 0, TestSprings::SpringCount, wholeStrainStates.data(), wholeResults);
+
+        // Run over sub-ranges that start in the middle of vectorization words, as the caller does
+        std::vector<ElementIndex> const rangeStarts{ 0, 3, 5, 6, 23, 40, TestSprings::SpringCount };
+
+        std::vector<Springs::StrainState> rangeStrainStates = springs.StrainStates;
+        std::vector<ElementIndex> rangeBrokenSprings;
+        std::vector<ElementIndex> rangeNewlyStressedSprings;
+        float rangeMaxSpringLength = 0.0f;
+
+        for (size_t r = 0; r < rangeStarts.size() - 1; ++r)
+        {
+            Springs::StrainCalculationResults rangeResults;
+
+            variant.Function(springs.MakeInput(), rangeStarts[r], rangeStarts[r + 1], rangeStrainStates.data(), rangeResults);
+
+            rangeBrokenSprings.insert(rangeBrokenSprings.end(), rangeResults.BrokenSprings.cbegin(), rangeResults.BrokenSprings.cend());
+            rangeNewlyStressedSprings.insert(rangeNewlyStressedSprings.end(), rangeResults.NewlyStressedSprings.cbegin(), rangeResults.NewlyStressedSprings.cend());
+            rangeMaxSpringLength = std::max(rangeMaxSpringLength, rangeResults.MaxSpringLength);
+        }
+
+        for (ElementIndex s = 0; s < TestSprings::SpringCount; ++s)
+        {
+            EXPECT_EQ(wholeStrainStates[s].IsStressed, rangeStrainStates[s].IsStressed) << variant.Name << " spring " << s;
+        }
+
+        EXPECT_EQ(wholeResults.BrokenSprings, rangeBrokenSprings) << variant.Name;
+        EXPECT_EQ(wholeResults.NewlyStressedSprings, rangeNewlyStressedSprings) << variant.Name;
+        EXPECT_NEAR(wholeResults.MaxSpringLength, rangeMaxSpringLength, 1e-6f * wholeResults.MaxSpringLength) << variant.Name;
+    }
+}
+
+#endif
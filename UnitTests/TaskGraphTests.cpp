@@ -0,0 +1,254 @@
+#include <GameCore/TaskGraph.h>
+
+#include <GameCore/GameException.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+    enum class TestResource : size_t
+    {
+        A = 0,
+        B,
+        C
+    };
+
+    // Returns the position of the task in the recorded order
+    size_t PositionOf(std::vector<int> const & order, int task)
+    {
+        return static_cast<size_t>(std::distance(order.cbegin(), std::find(order.cbegin(), order.cend(), task)));
+    }
+}
+
+class TaskGraphTests : public testing::TestWithParam<size_t>
+{
+public:
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+protected:
+
+    ThreadManager mThreadManager{ false, 16 };
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    TaskGraphTests,
+    TaskGraphTests,
+    ::testing::Values(
+        1,
+        2,
+        4
+    ));
+
+TEST_P(TaskGraphTests, RunsAllTasks_RespectingDependencies)
+{
+    ThreadPool threadPool(GetParam(), mThreadManager);
+    TaskGraph graph;
+
+    std::mutex orderMutex;
+    std::vector<int> order;
+    auto const makeTask = [&](int id)
+    {
+        return [&, id]()
+        {
+            std::scoped_lock const lock(orderMutex);
+            order.push_back(id);
+        };
+    };
+
+    // 0: writes A
+    // 1: reads A (RAW on 0)
+    // 2: writes B (independent)
+    // 3: writes A (WAR on 1, WAW on 0)
+    // 4: reads B, C (RAW on 2)
+    graph.AddTask("0", 0, TaskGraph::Resources(TestResource::A), makeTask(0));
+    graph.AddTask("1", TaskGraph::Resources(TestResource::A), 0, makeTask(1));
+    graph.AddTask("2", 0, TaskGraph::Resources(TestResource::B), makeTask(2));
+    graph.AddTask("3", 0, TaskGraph::Resources(TestResource::A), makeTask(3));
+    graph.AddTask("4", TaskGraph::Resources(TestResource::B, TestResource::C), 0, makeTask(4));
+
+    graph.RunAndClear(threadPool);
+
+    ASSERT_EQ(5u, order.size());
+    EXPECT_LT(PositionOf(order, 0), PositionOf(order, 1));
+    EXPECT_LT(PositionOf(order, 1), PositionOf(order, 3));
+    EXPECT_LT(PositionOf(order, 2), PositionOf(order, 4));
+
+    // Graph is cleared
+    order.clear();
+    graph.RunAndClear(threadPool);
+    EXPECT_TRUE(order.empty());
+}
+
+TEST_P(TaskGraphTests, ThreadPoolTasks_MayUseThreadPool)
+{
+    ThreadPool threadPool(GetParam(), mThreadManager);
+    TaskGraph graph;
+
+    std::atomic<int> counter(0);
+
+    graph.AddTask(
+        "Independent",
+        0,
+        TaskGraph::Resources(TestResource::A),
+        [&counter]()
+        {
+            ++counter;
+        });
+
+    graph.AddTask(
+        "Parallel",
+        0,
+        TaskGraph::Resources(TestResource::B),
+        [&threadPool, &counter]()
+        {
+            threadPool.ParallelFor(
+                0,
+                100,
+                1,
+                [&counter](size_t begin, size_t end)
+                {
+                    counter += static_cast<int>(end - begin);
+                });
+        },
+        true);
+
+    graph.RunAndClear(threadPool);
+
+    EXPECT_EQ(101, counter.load());
+}
+
+TEST_P(TaskGraphTests, ReadyTasks_RunOnThreadPoolThreadsOnly)
+{
+    ThreadPool threadPool(GetParam(), mThreadManager);
+    TaskGraph graph;
+
+    std::mutex threadIdsMutex;
+    std::set<std::thread::id> threadIds;
+
+    auto const recordThreadId = [&]()
+    {
+        std::lock_guard<std::mutex> const lock(threadIdsMutex);
+        threadIds.insert(std::this_thread::get_id());
+    };
+
+    std::atomic<int> runningTaskCount(0);
+    std::atomic<bool> hasParallelOverlappedOtherTasks(false);
+
+    graph.AddTask(
+        "Parallel",
+        0,
+        TaskGraph::Resources(TestResource::B),
+        [&]()
+        {
+            hasParallelOverlappedOtherTasks = hasParallelOverlappedOtherTasks || (runningTaskCount.load() != 0);
+
+            threadPool.ParallelFor(
+                0,
+                100,
+                1,
+                [&](size_t, size_t)
+                {
+                    recordThreadId();
+                });
+
+            hasParallelOverlappedOtherTasks = hasParallelOverlappedOtherTasks || (runningTaskCount.load() != 0);
+        },
+        true);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        graph.AddTask(
+            "Independent",
+            0,
+            0,
+            [&]()
+            {
+                ++runningTaskCount;
+
+                recordThreadId();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+                --runningTaskCount;
+            });
+    }
+
+    graph.RunAndClear(threadPool);
+
+    // No threads other than the pool's, and no nested batches
+    EXPECT_LE(threadIds.size(), GetParam());
+    EXPECT_EQ(1u, threadIds.count(std::this_thread::get_id()));
+    EXPECT_FALSE(hasParallelOverlappedOtherTasks.load());
+
+    EXPECT_GT(graph.GetLastRunStatistics().ElapsedDuration.count(), 0);
+    EXPECT_GT(graph.GetLastRunStatistics().TasksDuration.count(), 0);
+}
+
+TEST(TaskGraphTests, Verification_AcceptsDeclaredWrites)
+{
+    ThreadManager threadManager(false, 16);
+    ThreadPool threadPool(2, threadManager);
+
+    std::vector<float> a(16, 0.0f);
+    std::vector<float> b(16, 0.0f);
+
+    TaskGraph graph;
+    graph.RegisterResource(TestResource::A, "A", [&a]() { return TaskGraph::Fingerprint(a.data(), a.size() * sizeof(float)); });
+    graph.RegisterResource(TestResource::B, "B", [&b]() { return TaskGraph::Fingerprint(b.data(), b.size() * sizeof(float)); });
+    graph.SetVerificationEnabled(true);
+
+    graph.AddTask("WritesA", TaskGraph::Resources(TestResource::B), TaskGraph::Resources(TestResource::A), [&]() { a[3] = b[3] + 1.0f; });
+    graph.AddTask("WritesB", 0, TaskGraph::Resources(TestResource::B), [&]() { b[5] = 2.0f; });
+
+    EXPECT_NO_THROW(graph.RunAndClear(threadPool));
+
+    EXPECT_EQ(1.0f, a[3]);
+    EXPECT_EQ(2.0f, b[5]);
+}
+
+TEST(TaskGraphTests, Verification_DetectsUndeclaredWrites)
+{
+    ThreadManager threadManager(false, 16);
+    ThreadPool threadPool(2, threadManager);
+
+    std::vector<float> a(16, 0.0f);
+    std::vector<float> b(16, 0.0f);
+
+    TaskGraph graph;
+    graph.RegisterResource(TestResource::A, "A", [&a]() { return TaskGraph::Fingerprint(a.data(), a.size() * sizeof(float)); });
+    graph.RegisterResource(TestResource::B, "B", [&b]() { return TaskGraph::Fingerprint(b.data(), b.size() * sizeof(float)); });
+    graph.SetVerificationEnabled(true);
+
+    // Declares reading B, but writes it
+    graph.AddTask("WritesA", TaskGraph::Resources(TestResource::B), TaskGraph::Resources(TestResource::A), [&]() { a[3] = 1.0f; b[3] = 1.0f; });
+
+    EXPECT_THROW(graph.RunAndClear(threadPool), GameException);
+}
+
+TEST(TaskGraphTests, Sequential_RunsTasksInInsertionOrder)
+{
+    ThreadManager threadManager(false, 16);
+    ThreadPool threadPool(4, threadManager);
+
+    std::vector<int> order;
+
+    TaskGraph graph;
+    graph.SetSequential(true);
+
+    // All independent of each other
+    graph.AddTask("0", 0, TaskGraph::Resources(TestResource::A), [&]() { order.push_back(0); });
+    graph.AddTask("1", 0, TaskGraph::Resources(TestResource::B), [&]() { order.push_back(1); });
+    graph.AddTask("2", 0, TaskGraph::Resources(TestResource::C), [&]() { order.push_back(2); });
+
+    graph.RunAndClear(threadPool);
+
+    EXPECT_EQ(std::vector<int>({ 0, 1, 2 }), order);
+}
@@ -1,7 +1,11 @@
 #include <GameCore/ThreadPool.h>
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
+#include <limits>
+#include <thread>
+#include <tuple>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -98,4 +102,190 @@ TEST_P(ThreadPoolTests_FourRuns, Four_Runs)
     t.Run(tasks);
 
     ASSERT_TRUE(std::all_of(results.cbegin(), results.cend(), [](bool b) { return b; }));
-}
\ No newline at end of file
+}
+
+TEST(ThreadPoolTests, SimulationJobThreadPools_ShareParallelism)
+{
+    ThreadManager threadManager(false, 16);
+    size_t const parallelism = threadManager.GetSimulationParallelism();
+
+    for (size_t jobCount : { size_t(1), size_t(2), size_t(3), parallelism, parallelism + 3 })
+    {
+        auto const & jobThreadPools = threadManager.GetSimulationJobThreadPools(jobCount);
+        ASSERT_EQ(jobThreadPools.size(), jobCount);
+
+        size_t totalParallelism = 0;
+        for (auto const & jobThreadPool : jobThreadPools)
+        {
+            EXPECT_GE(jobThreadPool->GetParallelism(), 1u);
+            totalParallelism += jobThreadPool->GetParallelism();
+        }
+
+        EXPECT_EQ(totalParallelism, std::max(parallelism, jobCount));
+    }
+}
+
+TEST(ThreadPoolTests, SimulationJobThreadPools_SingleThreadedJobs)
+{
+    ThreadManager threadManager(false, 16);
+    size_t const parallelism = threadManager.GetSimulationParallelism();
+
+    for (size_t jobCount : { size_t(1), size_t(2), size_t(3), parallelism + 3 })
+    {
+        auto const & jobThreadPools = threadManager.GetSimulationJobThreadPools(jobCount + 1, 1);
+        ASSERT_EQ(jobThreadPools.size(), jobCount + 1);
+
+        // The single-threaded job is the last one
+        EXPECT_EQ(jobThreadPools.back()->GetParallelism(), 1u);
+
+        size_t totalParallelism = 0;
+        for (auto const & jobThreadPool : jobThreadPools)
+        {
+            EXPECT_GE(jobThreadPool->GetParallelism(), 1u);
+            totalParallelism += jobThreadPool->GetParallelism();
+        }
+
+        EXPECT_EQ(totalParallelism, std::max(parallelism, jobCount + 1));
+    }
+}
+
+TEST(ThreadPoolTests, Run_FirstTaskRunsOnMainThread)
+{
+    ThreadManager threadManager(false, 16);
+    ThreadPool t(4, threadManager);
+
+    std::thread::id firstTaskThreadId;
+
+    std::vector<ThreadPool::Task> tasks;
+    tasks.emplace_back([&firstTaskThreadId]() { firstTaskThreadId = std::this_thread::get_id(); });
+    for (size_t i = 1; i < 8; ++i)
+    {
+        tasks.emplace_back([]() {});
+    }
+
+    t.Run(tasks);
+
+    EXPECT_EQ(std::this_thread::get_id(), firstTaskThreadId);
+}
+
+TEST(ThreadPoolTests, Run_BackToBackBatches)
+{
+    ThreadManager threadManager(false, 16);
+    ThreadPool t(4, threadManager);
+
+    std::atomic<size_t> counter(0);
+
+    std::vector<ThreadPool::Task> tasks;
+    for (size_t i = 0; i < 6; ++i)
+    {
+        tasks.emplace_back([&counter]() { ++counter; });
+    }
+
+    for (size_t b = 0; b < 2000; ++b)
+    {
+        t.Run(tasks);
+
+        ASSERT_EQ((b + 1) * tasks.size(), counter.load());
+    }
+}
+
+class ThreadPoolTests_ParallelFor : public testing::TestWithParam<std::tuple<size_t, size_t, size_t>>
+{
+public:
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+protected:
+
+    ThreadManager mThreadManager{ false, 16 };
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    ThreadPoolTests_ParallelFor,
+    ThreadPoolTests_ParallelFor,
+    ::testing::Values(
+        // Parallelism, count, grain
+        std::make_tuple(1, 0, 1),
+        std::make_tuple(1, 100, 7),
+        std::make_tuple(4, 0, 1),
+        std::make_tuple(4, 1, 1),
+        std::make_tuple(4, 3, 0),
+        std::make_tuple(4, 100, 1),
+        std::make_tuple(4, 100, 7),
+        std::make_tuple(4, 100, 1000),
+        std::make_tuple(4, 10007, 16),
+        std::make_tuple(3, 10007, 1)
+    ));
+
+TEST_P(ThreadPoolTests_ParallelFor, CoversRangeExactlyOnce)
+{
+    size_t const parallelism = std::get<0>(GetParam());
+    size_t const count = std::get<1>(GetParam());
+    size_t const grain = std::get<2>(GetParam());
+
+    size_t constexpr Begin = 5;
+
+    std::vector<std::atomic<int>> hits(Begin + count);
+    std::atomic<size_t> smallestChunk(std::numeric_limits<size_t>::max());
+    std::atomic<size_t> chunkCount(0);
+
+    ThreadPool t(parallelism, mThreadManager);
+    t.ParallelFor(
+        Begin,
+        Begin + count,
+        grain,
+        [&](size_t chunkBegin, size_t chunkEnd)
+        {
+            ASSERT_LT(chunkBegin, chunkEnd);
+
+            for (size_t i = chunkBegin; i < chunkEnd; ++i)
+            {
+                ++hits[i];
+            }
+
+            if (chunkEnd != Begin + count)
+            {
+                size_t current = smallestChunk.load();
+                while (chunkEnd - chunkBegin < current && !smallestChunk.compare_exchange_weak(current, chunkEnd - chunkBegin));
+            }
+
+            ++chunkCount;
+        });
+
+    for (size_t i = 0; i < Begin; ++i)
+    {
+        EXPECT_EQ(0, hits[i].load());
+    }
+
+    for (size_t i = Begin; i < Begin + count; ++i)
+    {
+        EXPECT_EQ(1, hits[i].load());
+    }
+
+    if (chunkCount.load() > 1)
+    {
+        EXPECT_GE(smallestChunk.load(), std::max(grain, size_t(1)));
+    }
+}
+
+TEST(ThreadPoolTests, ParallelFor_FirstChunkRunsOnMainThread)
+{
+    ThreadManager threadManager(false, 16);
+    ThreadPool t(4, threadManager);
+
+    std::thread::id firstChunkThreadId;
+
+    t.ParallelFor(
+        0,
+        1000,
+        10,
+        [&firstChunkThreadId](size_t chunkBegin, size_t /*chunkEnd*/)
+        {
+            if (chunkBegin == 0)
+            {
+                firstChunkThreadId = std::this_thread::get_id();
+            }
+        });
+
+    EXPECT_EQ(std::this_thread::get_id(), firstChunkThreadId);
+}
@@ -0,0 +1,191 @@
+#include <GameCore/UniformGrid.h>
+
+#include <GameCore/GameGeometry.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+    std::vector<vec2f> MakeRandomPositions(
+        size_t count,
+        float extent,
+        unsigned int seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(-extent, extent);
+
+        std::vector<vec2f> positions;
+        for (size_t i = 0; i < count; ++i)
+        {
+            positions.emplace_back(dist(rng), dist(rng));
+        }
+
+        return positions;
+    }
+
+    std::vector<ElementIndex> CollectInRadius(
+        UniformGrid const & grid,
+        std::vector<vec2f> const & positions,
+        vec2f const & center,
+        float radius)
+    {
+        std::vector<ElementIndex> result;
+        grid.VisitInRadius(
+            center,
+            radius,
+            [&](ElementIndex e)
+            {
+                if ((positions[e] - center).length() <= radius)
+                {
+                    result.push_back(e);
+                }
+            });
+
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+}
+
+TEST(UniformGridTests, Empty)
+{
+    UniformGrid grid(1.0f);
+    grid.Build(nullptr, 0);
+
+    EXPECT_EQ(0u, grid.GetElementCount());
+
+    size_t visitCount = 0;
+    grid.VisitInRadius(vec2f::zero(), 10.0f, [&](ElementIndex) { ++visitCount; });
+    grid.VisitNearSegment(vec2f::zero(), vec2f(5.0f, 5.0f), 10.0f, [&](ElementIndex) { ++visitCount; });
+    EXPECT_EQ(0u, visitCount);
+}
+
+TEST(UniformGridTests, VisitsEachElementOnce)
+{
+    auto const positions = MakeRandomPositions(1000, 50.0f, 1);
+
+    UniformGrid grid(1.0f);
+    grid.Build(positions.data(), static_cast<ElementCount>(positions.size()));
+
+    std::vector<size_t> visitCounts(positions.size(), 0);
+    grid.VisitInRadius(
+        vec2f::zero(),
+        1000.0f,
+        [&](ElementIndex e)
+        {
+            ++visitCounts[e];
+        });
+
+    for (size_t e = 0; e < positions.size(); ++e)
+    {
+        EXPECT_EQ(1u, visitCounts[e]);
+    }
+}
+
+TEST(UniformGridTests, VisitInRadius_MatchesLinearScan)
+{
+    auto const positions = MakeRandomPositions(2000, 30.0f, 2);
+
+    UniformGrid grid(1.5f);
+    grid.Build(positions.data(), static_cast<ElementCount>(positions.size()));
+
+    auto const centers = MakeRandomPositions(50, 40.0f, 3);
+    for (vec2f const & center : centers)
+    {
+        for (float const radius : { 0.5f, 3.0f, 12.0f })
+        {
+            std::vector<ElementIndex> expected;
+            for (ElementIndex e = 0; e < positions.size(); ++e)
+            {
+                if ((positions[e] - center).length() <= radius)
+                {
+                    expected.push_back(e);
+                }
+            }
+
+            EXPECT_EQ(expected, CollectInRadius(grid, positions, center, radius));
+        }
+    }
+}
+
+TEST(UniformGridTests, VisitNearSegment_MatchesLinearScan)
+{
+    auto const positions = MakeRandomPositions(2000, 30.0f, 4);
+
+    UniformGrid grid(1.0f);
+    grid.Build(positions.data(), static_cast<ElementCount>(positions.size()));
+
+    auto const endpoints = MakeRandomPositions(60, 40.0f, 5);
+    for (size_t i = 0; i + 1 < endpoints.size(); i += 2)
+    {
+        float constexpr Radius = 0.75f;
+
+        std::vector<ElementIndex> expected;
+        for (ElementIndex e = 0; e < positions.size(); ++e)
+        {
+            if (Segment::DistanceToPoint(endpoints[i], endpoints[i + 1], positions[e]) < Radius)
+            {
+                expected.push_back(e);
+            }
+        }
+
+        std::vector<ElementIndex> actual;
+        grid.VisitNearSegment(
+            endpoints[i],
+            endpoints[i + 1],
+            Radius,
+            [&](ElementIndex e)
+            {
+                if (Segment::DistanceToPoint(endpoints[i], endpoints[i + 1], positions[e]) < Radius)
+                {
+                    actual.push_back(e);
+                }
+            });
+
+        std::sort(actual.begin(), actual.end());
+
+        EXPECT_EQ(expected, actual);
+    }
+}
+
+TEST(UniformGridTests, SparsePositions_EnlargeCells)
+{
+    // Two clusters very far apart
+    std::vector<vec2f> positions{
+        vec2f(0.0f, 0.0f),
+        vec2f(0.5f, 0.5f),
+        vec2f(100000.0f, 100000.0f),
+        vec2f(100000.5f, 100000.5f) };
+
+    UniformGrid grid(1.0f);
+    grid.Build(positions.data(), static_cast<ElementCount>(positions.size()));
+
+    EXPECT_LE(grid.GetCellCount(), positions.size() * UniformGrid::MaxCellsPerElement);
+    EXPECT_GT(grid.GetCellSize(), 1.0f);
+
+    EXPECT_EQ(std::vector<ElementIndex>({ 0, 1 }), CollectInRadius(grid, positions, vec2f(0.25f, 0.25f), 1.0f));
+    EXPECT_EQ(std::vector<ElementIndex>({ 2, 3 }), CollectInRadius(grid, positions, vec2f(100000.0f, 100000.0f), 1.0f));
+}
+
+TEST(UniformGridTests, Rebuild_ReflectsNewPositions)
+{
+    std::vector<vec2f> positions{
+        vec2f(0.0f, 0.0f),
+        vec2f(10.0f, 10.0f) };
+
+    UniformGrid grid(1.0f);
+    grid.Build(positions.data(), static_cast<ElementCount>(positions.size()));
+
+    EXPECT_EQ(std::vector<ElementIndex>({ 0 }), CollectInRadius(grid, positions, vec2f::zero(), 1.0f));
+
+    positions[0] = vec2f(10.0f, 10.5f);
+    positions[1] = vec2f(-5.0f, 0.0f);
+    positions.emplace_back(0.2f, 0.2f);
+    grid.Build(positions.data(), static_cast<ElementCount>(positions.size()));
+
+    EXPECT_EQ(std::vector<ElementIndex>({ 2 }), CollectInRadius(grid, positions, vec2f::zero(), 1.0f));
+    EXPECT_EQ(std::vector<ElementIndex>({ 0 }), CollectInRadius(grid, positions, vec2f(10.0f, 10.0f), 1.0f));
+}
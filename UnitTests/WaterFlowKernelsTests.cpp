@@ -0,0 +1,370 @@
+#include <Game/WaterFlowKernels.h>
+
+#include <GameCore/GameMath.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Physics;
+
+namespace {
+
+    //
+    // A grid of points connected by horizontal, vertical, and diagonal springs, some of
+    // which are impermeable, with random water and water velocities
+    //
+    class TestWaterPoints
+    {
+    public:
+
+        static ElementCount constexpr GridWidth = 7;
+        static ElementCount constexpr GridHeight = 6;
+        static ElementCount constexpr PointCount = GridWidth * GridHeight;
+
+        TestWaterPoints()
+        {
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<float> jitterDist(-0.1f, 0.1f);
+            std::uniform_real_distribution<float> waterDist(0.0f, 1.5f);
+            std::uniform_real_distribution<float> waterVelocityDist(-3.0f, 3.0f);
+            std::uniform_real_distribution<float> diffusionSpeedDist(0.5f, 1.0f);
+
+            for (ElementIndex p = 0; p < PointCount; ++p)
+            {
+                PositionBuffer.emplace_back(
+                    static_cast<float>(p % GridWidth) + jitterDist(rng),
+                    static_cast<float>(p / GridWidth) + jitterDist(rng));
+
+                // Leave some points dry
+                WaterBuffer.push_back((p % 5) == 0 ? 0.0f : waterDist(rng));
+                WaterVelocityBuffer.emplace_back(waterVelocityDist(rng), waterVelocityDist(rng));
+                MaterialWaterDiffusionSpeedBuffer.push_back(diffusionSpeedDist(rng));
+            }
+
+            for (ElementIndex y = 0; y < GridHeight; ++y)
+            {
+                for (ElementIndex x = 0; x < GridWidth; ++x)
+                {
+                    ElementIndex const p = y * GridWidth + x;
+
+                    if (x + 1 < GridWidth)
+                        AddSpring(p, p + 1);
+
+                    if (y + 1 < GridHeight)
+                    {
+                        AddSpring(p, p + GridWidth);
+
+                        if (x + 1 < GridWidth)
+                            AddSpring(p, p + GridWidth + 1);
+
+                        if (x > 0)
+                            AddSpring(p, p + GridWidth - 1);
+                    }
+                }
+            }
+
+            // Make every fifth spring impermeable, as if it had a hull endpoint
+            for (size_t s = 0; s < SpringEndpoints.size(); ++s)
+            {
+                SpringWaterPermeabilityBuffer.push_back((s % 5) == 0 ? 0.0f : 1.0f);
+            }
+
+            // Lay out adjacency rows
+            std::vector<std::vector<Points::ConnectedSpring>> connectedSprings(PointCount);
+            for (ElementIndex s = 0; s < static_cast<ElementIndex>(SpringEndpoints.size()); ++s)
+            {
+                connectedSprings[SpringEndpoints[s].PointAIndex].emplace_back(s, SpringEndpoints[s].PointBIndex);
+                connectedSprings[SpringEndpoints[s].PointBIndex].emplace_back(s, SpringEndpoints[s].PointAIndex);
+            }
+
+            for (auto const & row : connectedSprings)
+            {
+                ConnectedSpringsAdjacencyRowBegins.push_back(static_cast<ElementIndex>(ConnectedSpringsAdjacency.size()));
+                ConnectedSpringsAdjacency.insert(ConnectedSpringsAdjacency.end(), row.cbegin(), row.cend());
+                ConnectedSpringsAdjacencyRowEnds.push_back(static_cast<ElementIndex>(ConnectedSpringsAdjacency.size()));
+            }
+        }
+
+        WaterFlowKernels::WaterFlowInput MakeInput() const
+        {
+            return WaterFlowKernels::WaterFlowInput{
+                PositionBuffer.data(),
+                WaterBuffer.data(),
+                WaterVelocityBuffer.data(),
+                MaterialWaterDiffusionSpeedBuffer.data(),
+                ConnectedSpringsAdjacency.data(),
+                ConnectedSpringsAdjacencyRowBegins.data(),
+                ConnectedSpringsAdjacencyRowEnds.data(),
+                SpringEndpoints.data(),
+                SpringFactoryRestLengthBuffer.data(),
+                SpringWaterPermeabilityBuffer.data(),
+                WaterCrazyness,
+                WaterDiffusionSpeedAdjustment };
+        }
+
+        std::vector<vec2f> MakeWaterMomenta() const
+        {
+            std::vector<vec2f> waterMomenta;
+            for (ElementIndex p = 0; p < PointCount; ++p)
+            {
+                waterMomenta.push_back(WaterVelocityBuffer[p] * WaterBuffer[p]);
+            }
+
+            return waterMomenta;
+        }
+
+        //
+        // Runs the algorithm as it used to be, visiting each point and scattering its outbound
+        // flows directly into the other endpoints; returns the water splashed
+        //
+        float RunReferenceScatter(
+            std::vector<float> & newWater,
+            std::vector<vec2f> & newWaterMomenta) const
+        {
+            newWater = WaterBuffer;
+            newWaterMomenta = MakeWaterMomenta();
+
+            std::vector<float> pointFreenessFactors;
+            for (ElementIndex p = 0; p < PointCount; ++p)
+            {
+                pointFreenessFactors.push_back(FastExp(-WaterBuffer[p] * 10.0f));
+            }
+
+            float waterSplashed = 0.0f;
+
+            for (ElementIndex pointIndex = 0; pointIndex < PointCount; ++pointIndex)
+            {
+                std::array<float, GameParameters::MaxSpringsPerPoint> springOutboundWaterFlowWeights;
+                std::array<vec2f, GameParameters::MaxSpringsPerPoint> springOutboundWaterVelocities;
+                float totalOutboundWaterFlowWeight = 0.0f;
+
+                float const alphaCrazyness = 1.0f + WaterCrazyness * (WaterBuffer[pointIndex] - 1.0f);
+
+                float pointSplashNeighbors = 0.0f;
+                float pointSplashFreeNeighbors = 0.0f;
+
+                ElementIndex const rowBegin = ConnectedSpringsAdjacencyRowBegins[pointIndex];
+                size_t const connectedSpringCount = ConnectedSpringsAdjacencyRowEnds[pointIndex] - rowBegin;
+                for (size_t s = 0; s < connectedSpringCount; ++s)
+                {
+                    auto const & cs = ConnectedSpringsAdjacency[rowBegin + s];
+
+                    vec2f const springNormalizedVector = (PositionBuffer[cs.OtherEndpointIndex] - PositionBuffer[pointIndex]).normalise_approx();
+
+                    float const pointWaterVelocityAlongSpring = WaterVelocityBuffer[pointIndex].dot(springNormalizedVector);
+
+                    float const dw = WaterBuffer[pointIndex] - WaterBuffer[cs.OtherEndpointIndex];
+                    float const dy = PositionBuffer[pointIndex].y - PositionBuffer[cs.OtherEndpointIndex].y;
+                    float const dwy = dw + dy;
+                    float const bernoulliVelocityAlongSpring = (dwy >= 0.0f)
+                        ? sqrtf(2.0f * GameParameters::GravityMagnitude * dwy)
+                        : -sqrtf(2.0f * GameParameters::GravityMagnitude * -dwy);
+
+                    float const springOutboundScalarWaterVelocity = std::max(
+                        pointWaterVelocityAlongSpring + bernoulliVelocityAlongSpring * alphaCrazyness,
+                        0.0f);
+
+                    springOutboundWaterFlowWeights[s] = springOutboundScalarWaterVelocity / SpringFactoryRestLengthBuffer[cs.SpringIndex];
+                    springOutboundWaterVelocities[s] = springNormalizedVector * springOutboundScalarWaterVelocity;
+                    totalOutboundWaterFlowWeight += springOutboundWaterFlowWeights[s];
+
+                    pointSplashFreeNeighbors += SpringWaterPermeabilityBuffer[cs.SpringIndex] * pointFreenessFactors[cs.OtherEndpointIndex];
+                    pointSplashNeighbors += SpringWaterPermeabilityBuffer[cs.SpringIndex];
+                }
+
+                float waterQuantityNormalizationFactor = 0.0f;
+                if (totalOutboundWaterFlowWeight != 0.0f)
+                {
+                    waterQuantityNormalizationFactor =
+                        WaterBuffer[pointIndex]
+                        * MaterialWaterDiffusionSpeedBuffer[pointIndex] * WaterDiffusionSpeedAdjustment
+                        / totalOutboundWaterFlowWeight;
+                }
+
+                float pointKineticEnergyLoss = 0.0f;
+
+                for (size_t s = 0; s < connectedSpringCount; ++s)
+                {
+                    auto const & cs = ConnectedSpringsAdjacency[rowBegin + s];
+
+                    float const springOutboundQuantityOfWater = springOutboundWaterFlowWeights[s] * waterQuantityNormalizationFactor;
+
+                    if (SpringWaterPermeabilityBuffer[cs.SpringIndex] != 0.0f)
+                    {
+                        newWater[pointIndex] -= springOutboundQuantityOfWater;
+                        newWater[cs.OtherEndpointIndex] += springOutboundQuantityOfWater;
+
+                        newWaterMomenta[pointIndex] -= WaterVelocityBuffer[pointIndex] * springOutboundQuantityOfWater;
+                        newWaterMomenta[cs.OtherEndpointIndex] += springOutboundWaterVelocities[s] * springOutboundQuantityOfWater;
+
+                        vec2f const springNormalizedVector = (PositionBuffer[cs.OtherEndpointIndex] - PositionBuffer[pointIndex]).normalise_approx();
+
+                        float const ma = springOutboundQuantityOfWater;
+                        float const va = springOutboundWaterVelocities[s].length();
+                        float const mb = WaterBuffer[cs.OtherEndpointIndex];
+                        float const vb = WaterVelocityBuffer[cs.OtherEndpointIndex].dot(springNormalizedVector);
+
+                        float vf = 0.0f;
+                        if (ma + mb != 0.0f)
+                            vf = (ma * va + mb * vb) / (ma + mb);
+
+                        pointKineticEnergyLoss += std::max(0.5f * ma * (va * va - vf * vf), 0.0f);
+                    }
+                    else
+                    {
+                        newWaterMomenta[pointIndex] -= springOutboundWaterVelocities[s] * springOutboundQuantityOfWater;
+
+                        float const ma = springOutboundQuantityOfWater;
+                        float const va = springOutboundWaterVelocities[s].length();
+
+                        pointKineticEnergyLoss += 0.5f * ma * va * va;
+                    }
+                }
+
+                if (pointSplashNeighbors != 0.0f)
+                {
+                    waterSplashed += pointKineticEnergyLoss * pointSplashFreeNeighbors / pointSplashNeighbors;
+                }
+            }
+
+            return waterSplashed;
+        }
+
+        std::vector<vec2f> PositionBuffer;
+        std::vector<float> WaterBuffer;
+        std::vector<vec2f> WaterVelocityBuffer;
+        std::vector<float> MaterialWaterDiffusionSpeedBuffer;
+        std::vector<Points::ConnectedSpring> ConnectedSpringsAdjacency;
+        std::vector<ElementIndex> ConnectedSpringsAdjacencyRowBegins;
+        std::vector<ElementIndex> ConnectedSpringsAdjacencyRowEnds;
+        std::vector<Springs::Endpoints> SpringEndpoints;
+        std::vector<float> SpringFactoryRestLengthBuffer;
+        std::vector<float> SpringWaterPermeabilityBuffer;
+
+        float const WaterCrazyness = 0.8125f;
+        float const WaterDiffusionSpeedAdjustment = 1.0f;
+
+    private:
+
+        void AddSpring(
+            ElementIndex pointAIndex,
+            ElementIndex pointBIndex)
+        {
+            SpringEndpoints.emplace_back(pointAIndex, pointBIndex);
+            SpringFactoryRestLengthBuffer.push_back((PositionBuffer[pointBIndex] - PositionBuffer[pointAIndex]).length());
+        }
+    };
+}
+
+class WaterFlowKernelsTests : public testing::TestWithParam<size_t>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    WaterFlowKernelsTests,
+    WaterFlowKernelsTests,
+    ::testing::Values(
+        1, // One range
+        3, // Ranges not at row boundaries
+        TestWaterPoints::PointCount // One point per range
+    ));
+
+TEST_P(WaterFlowKernelsTests, MatchesScatter)
+{
+    TestWaterPoints const testPoints;
+
+    //
+    // Reference
+    //
+
+    std::vector<float> expectedWater;
+    std::vector<vec2f> expectedWaterMomenta;
+    float const expectedWaterSplashed = testPoints.RunReferenceScatter(expectedWater, expectedWaterMomenta);
+
+    //
+    // Kernels, first pass on all ranges, then second pass on all ranges
+    //
+
+    std::vector<float> actualWater(TestWaterPoints::PointCount);
+    std::vector<vec2f> actualWaterMomenta = testPoints.MakeWaterMomenta();
+    std::vector<float> springOutboundWaterQuantities(testPoints.SpringEndpoints.size() * 2);
+    std::vector<vec2f> springOutboundWaterMomenta(testPoints.SpringEndpoints.size() * 2);
+
+    auto const input = testPoints.MakeInput();
+    WaterFlowKernels::WaterFlowOutput const output{
+        actualWater.data(),
+        actualWaterMomenta.data(),
+        springOutboundWaterQuantities.data(),
+        springOutboundWaterMomenta.data() };
+
+    size_t const rangeCount = GetParam();
+    auto const rangeStart = [rangeCount](size_t r)
+    {
+        return static_cast<ElementIndex>(r * TestWaterPoints::PointCount / rangeCount);
+    };
+
+    float actualWaterSplashed = 0.0f;
+    for (size_t r = 0; r < rangeCount; ++r)
+    {
+        actualWaterSplashed += WaterFlowKernels::CalculateOutboundWaterFlows(input, output, rangeStart(r), rangeStart(r + 1));
+    }
+
+    for (size_t r = 0; r < rangeCount; ++r)
+    {
+        WaterFlowKernels::GatherInboundWaterFlows(input, output, rangeStart(r), rangeStart(r + 1));
+    }
+
+    //
+    // Verify
+    //
+    // Quantities are the same, only summed in a different order; we tolerate a few ulps
+    // of the magnitudes involved
+    //
+
+    float constexpr Tolerance = 0.0001f;
+
+    float expectedTotalWater = 0.0f;
+    float actualTotalWater = 0.0f;
+    vec2f expectedTotalWaterMomentum = vec2f::zero();
+    vec2f actualTotalWaterMomentum = vec2f::zero();
+
+    for (ElementIndex p = 0; p < TestWaterPoints::PointCount; ++p)
+    {
+        EXPECT_NEAR(expectedWater[p], actualWater[p], Tolerance) << "point " << p;
+        EXPECT_NEAR(expectedWaterMomenta[p].x, actualWaterMomenta[p].x, Tolerance) << "point " << p;
+        EXPECT_NEAR(expectedWaterMomenta[p].y, actualWaterMomenta[p].y, Tolerance) << "point " << p;
+
+        expectedTotalWater += expectedWater[p];
+        actualTotalWater += actualWater[p];
+        expectedTotalWaterMomentum += expectedWaterMomenta[p];
+        actualTotalWaterMomentum += actualWaterMomenta[p];
+    }
+
+    EXPECT_NEAR(expectedTotalWater, actualTotalWater, Tolerance);
+    EXPECT_NEAR(expectedTotalWaterMomentum.x, actualTotalWaterMomentum.x, Tolerance * TestWaterPoints::PointCount);
+    EXPECT_NEAR(expectedTotalWaterMomentum.y, actualTotalWaterMomentum.y, Tolerance * TestWaterPoints::PointCount);
+    EXPECT_NEAR(expectedWaterSplashed, actualWaterSplashed, Tolerance * std::max(expectedWaterSplashed, 1.0f));
+
+    // Water only moves between points
+    float initialTotalWater = 0.0f;
+    for (float const w : testPoints.WaterBuffer)
+    {
+        initialTotalWater += w;
+    }
+
+    EXPECT_NEAR(initialTotalWater, actualTotalWater, Tolerance * TestWaterPoints::PointCount);
+
+    // Something has actually moved
+    float totalWaterMoved = 0.0f;
+    for (ElementIndex p = 0; p < TestWaterPoints::PointCount; ++p)
+    {
+        totalWaterMoved += std::abs(actualWater[p] - testPoints.WaterBuffer[p]);
+    }
+
+    EXPECT_GT(totalWaterMoved, 1.0f);
+}
@@ -0,0 +1,135 @@
+#include <GameCore/WorkStealingDeque.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+TEST(WorkStealingDequeTests, EmptyAtConstruction)
+{
+    WorkStealingDeque<size_t> deque;
+
+    size_t element;
+    EXPECT_TRUE(deque.IsEmpty());
+    EXPECT_FALSE(deque.Take(element));
+    EXPECT_FALSE(deque.Steal(element));
+}
+
+TEST(WorkStealingDequeTests, Take_IsLifo)
+{
+    WorkStealingDeque<size_t> deque;
+
+    deque.Push(1);
+    deque.Push(2);
+    deque.Push(3);
+
+    size_t element;
+    ASSERT_TRUE(deque.Take(element));
+    EXPECT_EQ(3u, element);
+    ASSERT_TRUE(deque.Take(element));
+    EXPECT_EQ(2u, element);
+    ASSERT_TRUE(deque.Take(element));
+    EXPECT_EQ(1u, element);
+    EXPECT_FALSE(deque.Take(element));
+    EXPECT_TRUE(deque.IsEmpty());
+}
+
+TEST(WorkStealingDequeTests, Steal_IsFifo)
+{
+    WorkStealingDeque<size_t> deque;
+
+    deque.Push(1);
+    deque.Push(2);
+    deque.Push(3);
+
+    size_t element;
+    ASSERT_TRUE(deque.Steal(element));
+    EXPECT_EQ(1u, element);
+    ASSERT_TRUE(deque.Steal(element));
+    EXPECT_EQ(2u, element);
+    ASSERT_TRUE(deque.Take(element));
+    EXPECT_EQ(3u, element);
+    EXPECT_FALSE(deque.Steal(element));
+}
+
+TEST(WorkStealingDequeTests, GrowsBeyondInitialCapacity)
+{
+    WorkStealingDeque<size_t> deque(4);
+
+    for (size_t i = 0; i < 100; ++i)
+    {
+        deque.Push(i);
+    }
+
+    size_t element;
+    for (size_t i = 0; i < 50; ++i)
+    {
+        ASSERT_TRUE(deque.Steal(element));
+        EXPECT_EQ(i, element);
+    }
+
+    for (size_t i = 100; i > 50; --i)
+    {
+        ASSERT_TRUE(deque.Take(element));
+        EXPECT_EQ(i - 1, element);
+    }
+
+    EXPECT_TRUE(deque.IsEmpty());
+}
+
+TEST(WorkStealingDequeTests, ConcurrentThieves_GetEachElementOnce)
+{
+    size_t constexpr ElementCount = 100000;
+    size_t constexpr ThiefCount = 3;
+
+    WorkStealingDeque<size_t> deque(16);
+
+    std::vector<std::atomic<int>> hits(ElementCount);
+    std::atomic<bool> isPushingDone(false);
+
+    std::vector<std::thread> thieves;
+    for (size_t t = 0; t < ThiefCount; ++t)
+    {
+        thieves.emplace_back(
+            [&]()
+            {
+                size_t element;
+                while (true)
+                {
+                    bool const wasPushingDone = isPushingDone.load();
+
+                    if (deque.Steal(element))
+                    {
+                        ++hits[element];
+                    }
+                    else if (wasPushingDone && deque.IsEmpty())
+                    {
+                        break;
+                    }
+                }
+            });
+    }
+
+    // Owner: interleave pushes and takes
+    for (size_t i = 0; i < ElementCount; ++i)
+    {
+        deque.Push(i);
+
+        size_t element;
+        if ((i % 3) == 0 && deque.Take(element))
+        {
+            ++hits[element];
+        }
+    }
+
+    isPushingDone.store(true);
+
+    for (auto & t : thieves)
+    {
+        t.join();
+    }
+
+    EXPECT_TRUE(std::all_of(hits.cbegin(), hits.cend(), [](auto const & h) { return h.load() == 1; }));
+}
@@ -0,0 +1,68 @@
+#include <GameCore/Xoshiro128PlusPlus.h>
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+
+TEST(Xoshiro128PlusPlusTests, SameSeed_SameSequence)
+{
+    Xoshiro128PlusPlus engine1(42);
+    Xoshiro128PlusPlus engine2(42);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(engine1(), engine2());
+    }
+}
+
+TEST(Xoshiro128PlusPlusTests, DifferentSeed_DifferentSequence)
+{
+    Xoshiro128PlusPlus engine1(42);
+    Xoshiro128PlusPlus engine2(43);
+
+    int equalCount = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        if (engine1() == engine2())
+            ++equalCount;
+    }
+
+    EXPECT_LT(equalCount, 2);
+}
+
+TEST(Xoshiro128PlusPlusTests, Generate_MatchesSingleValues)
+{
+    Xoshiro128PlusPlus singleEngine(7);
+    Xoshiro128PlusPlus batchEngine(7);
+
+    std::vector<std::uint32_t> singleValues;
+    for (int i = 0; i < 100; ++i)
+    {
+        singleValues.push_back(singleEngine());
+    }
+
+    // Mix single draws and batches of sizes that straddle blocks
+    std::vector<std::uint32_t> batchValues(100);
+    batchValues[0] = batchEngine();
+    batchEngine.Generate(batchValues.data() + 1, 3);
+    batchEngine.Generate(batchValues.data() + 4, Xoshiro128PlusPlus::LaneCount * 3 + 5);
+    size_t const generatedCount = 4 + Xoshiro128PlusPlus::LaneCount * 3 + 5;
+    batchValues[generatedCount] = batchEngine();
+    batchEngine.Generate(batchValues.data() + generatedCount + 1, 100 - generatedCount - 1);
+
+    EXPECT_EQ(singleValues, batchValues);
+}
+
+TEST(Xoshiro128PlusPlusTests, UsableWithStandardDistributions)
+{
+    Xoshiro128PlusPlus engine(1);
+    std::uniform_int_distribution<int> dis(3, 5);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        int const value = dis(engine);
+        EXPECT_GE(value, 3);
+        EXPECT_LE(value, 5);
+    }
+}